@@ -6,6 +6,7 @@
    read the COPYING file packaged in the distribution */
 
 #include "ap_abstract0.h"
+#include "ap_trace.h"
 
 /* ********************************************************************** */
 /* 0. Utility and checking functions */
@@ -95,8 +96,8 @@ The %luth abstract value of the array is of type %s and not of the type %s expec
 bool ap_abstract0_check_abstract2(ap_funid_t funid, ap_manager_t* man,
 				  ap_abstract0_t* a1, ap_abstract0_t* a2)
 {
-  ap_dimension_t dim1 = _ap_abstract0_dimension(a1);
-  ap_dimension_t dim2 = _ap_abstract0_dimension(a2);
+  ap_dimension_t dim1 = _ap_abstract0_dimension(man,a1);
+  ap_dimension_t dim2 = _ap_abstract0_dimension(man,a2);
   if ( (dim1.intdim != dim2.intdim) || (dim1.realdim != dim2.realdim) ){
     char str[160];
 
@@ -135,9 +136,9 @@ bool ap_abstract0_check_abstract_array(ap_funid_t funid, ap_manager_t* man,
     res = false;
   }
   else {
-    dim0 = _ap_abstract0_dimension(tab[0]);
+    dim0 = _ap_abstract0_dimension(man,tab[0]);
     for (i=1; i<size; i++){
-      dim = _ap_abstract0_dimension(tab[i]);
+      dim = _ap_abstract0_dimension(man,tab[i]);
       if ( (dim.intdim != dim0.intdim) || (dim.realdim != dim0.realdim) ){
 	res = false;
 	break;
@@ -552,12 +553,26 @@ bool ap_abstract0_check_dimperm(ap_funid_t funid, ap_manager_t* man,
 
 ap_abstract0_t* ap_abstract0_copy(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_COPY);
+    ap_abstract0_t* res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_copy(man,a);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_COPY)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_copy(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_COPY,man,a)){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_COPY];
     return ap_abstract0_cons(man,ptr(man,a->value));
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     return ap_abstract0_top(man,
 			    dimension.intdim,
 			    dimension.realdim);
@@ -566,6 +581,17 @@ ap_abstract0_t* ap_abstract0_copy(ap_manager_t* man, ap_abstract0_t* a)
 
 void ap_abstract0_free(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (man->trace && ap_trace_has_value(man->trace,a)){
+    if (ap_trace_on(man)){
+      ap_trace_t* t = ap_trace_begin(man,AP_FUNID_FREE);
+      ap_trace_put_value(t,a);
+      ap_trace_end(t,a,NULL);
+    }
+    else {
+      /* freed by a recorded call: the address may be reused */
+      ap_trace_forget(man->trace,a);
+    }
+  }
   if (a->man==NULL){
     fprintf(stderr,"ap_abstract0_c: ap_abstract0_free: the abstract value has probably already been deallocated !\n");
     abort();
@@ -585,6 +611,20 @@ void ap_abstract0_free(ap_manager_t* man, ap_abstract0_t* a)
 }
 size_t ap_abstract0_size(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_ASIZE);
+    size_t res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_size(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_ASIZE)){
+    size_t res;
+    res = ap_abstract0_size(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_ASIZE,man,a)){
     size_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_ASIZE];
     return ptr(man,a->value);
@@ -599,6 +639,18 @@ size_t ap_abstract0_size(ap_manager_t* man, ap_abstract0_t* a)
 /* ============================================================ */
 void ap_abstract0_minimize(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_MINIMIZE);
+    ap_trace_put_value(t,a);
+    ap_abstract0_minimize(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_MINIMIZE)){
+    ap_abstract0_minimize(man,a);
+    ap_manager_timer_exit(man);
+    return;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_MINIMIZE,man,a)){
     void (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MINIMIZE];
     ptr(man,a->value);
@@ -606,6 +658,18 @@ void ap_abstract0_minimize(ap_manager_t* man, ap_abstract0_t* a)
 }
 void ap_abstract0_canonicalize(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_CANONICALIZE);
+    ap_trace_put_value(t,a);
+    ap_abstract0_canonicalize(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_CANONICALIZE)){
+    ap_abstract0_canonicalize(man,a);
+    ap_manager_timer_exit(man);
+    return;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_CANONICALIZE,man,a)){
     void (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_CANONICALIZE];
     ptr(man,a->value);
@@ -613,6 +677,20 @@ void ap_abstract0_canonicalize(ap_manager_t* man, ap_abstract0_t* a)
 }
 int ap_abstract0_hash(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_HASH);
+    int res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_hash(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_HASH)){
+    int res;
+    res = ap_abstract0_hash(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_CANONICALIZE,man,a)){
     int (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_HASH];
     return ptr(man,a->value);
@@ -622,6 +700,19 @@ int ap_abstract0_hash(ap_manager_t* man, ap_abstract0_t* a)
 }
 void ap_abstract0_approximate(ap_manager_t* man, ap_abstract0_t* a, int n)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_APPROXIMATE);
+    ap_trace_put_value(t,a);
+    ap_trace_put_int(t,n);
+    ap_abstract0_approximate(man,a,n);
+    ap_trace_end(t,NULL,NULL);
+    return;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_APPROXIMATE)){
+    ap_abstract0_approximate(man,a,n);
+    ap_manager_timer_exit(man);
+    return;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_APPROXIMATE,man,a)){
     void (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_APPROXIMATE];
     ptr(man,a->value,n);
@@ -685,7 +776,8 @@ ap_membuf_t ap_abstract0_serialize_raw(ap_manager_t* man, ap_abstract0_t* a)
 ap_abstract0_t* ap_abstract0_deserialize_raw(ap_manager_t* man, void* p, size_t* size)
 {
   void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_DESERIALIZE_RAW];
-  return ap_abstract0_cons(man,ptr(man,p,size));
+  void* value = ptr(man,p,size);
+  return value ? ap_abstract0_cons(man,value) : NULL;
 }
 
 /* ********************************************************************** */
@@ -696,16 +788,62 @@ ap_abstract0_t* ap_abstract0_deserialize_raw(ap_manager_t* man, void* p, size_t*
 /* ============================================================ */
 ap_abstract0_t* ap_abstract0_bottom(ap_manager_t* man, size_t intdim, size_t realdim)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_BOTTOM);
+    ap_abstract0_t* res;
+    ap_trace_put_size(t,intdim);
+    ap_trace_put_size(t,realdim);
+    res = ap_abstract0_bottom(man,intdim,realdim);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_BOTTOM)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_bottom(man,intdim,realdim);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_BOTTOM];
   return ap_abstract0_cons(man,ptr(man,intdim,realdim));
 }
 ap_abstract0_t* ap_abstract0_top(ap_manager_t* man, size_t intdim, size_t realdim){
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_TOP);
+    ap_abstract0_t* res;
+    ap_trace_put_size(t,intdim);
+    ap_trace_put_size(t,realdim);
+    res = ap_abstract0_top(man,intdim,realdim);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_TOP)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_top(man,intdim,realdim);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_TOP];
   return ap_abstract0_cons(man,ptr(man,intdim,realdim));
 }
 ap_abstract0_t* ap_abstract0_of_box(ap_manager_t* man,
 				    size_t intdim, size_t realdim,
 				    ap_interval_t** tinterval){
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_OF_BOX);
+    ap_abstract0_t* res;
+    ap_trace_put_size(t,intdim);
+    ap_trace_put_size(t,realdim);
+    ap_trace_put_interval_array(t,tinterval,intdim+realdim);
+    res = ap_abstract0_of_box(man,intdim,realdim,tinterval);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_OF_BOX)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_of_box(man,intdim,realdim,tinterval);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_OF_BOX];
   return ap_abstract0_cons(man,ptr(man,intdim,realdim,tinterval));
 }
@@ -716,8 +854,7 @@ ap_abstract0_t* ap_abstract0_of_box(ap_manager_t* man,
 ap_dimension_t ap_abstract0_dimension(ap_manager_t* man, ap_abstract0_t* a)
 {
   ap_abstract0_checkman1(AP_FUNID_DIMENSION,man,a);
-  ap_dimension_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_DIMENSION];
-  return ptr(a->man,a->value);
+  return _ap_abstract0_dimension(man,a);
 }
 
 /* ============================================================ */
@@ -725,6 +862,20 @@ ap_dimension_t ap_abstract0_dimension(ap_manager_t* man, ap_abstract0_t* a)
 /* ============================================================ */
 bool ap_abstract0_is_bottom(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_IS_BOTTOM);
+    bool res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_is_bottom(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_IS_BOTTOM)){
+    bool res;
+    res = ap_abstract0_is_bottom(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_IS_BOTTOM,man,a)){
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_IS_BOTTOM];
     return ptr(man,a->value);
@@ -736,6 +887,20 @@ bool ap_abstract0_is_bottom(ap_manager_t* man, ap_abstract0_t* a)
 }
 bool ap_abstract0_is_top(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_IS_TOP);
+    bool res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_is_top(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_IS_TOP)){
+    bool res;
+    res = ap_abstract0_is_top(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_IS_TOP,man,a)){
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_IS_TOP];
     return ptr(man,a->value);
@@ -747,6 +912,21 @@ bool ap_abstract0_is_top(ap_manager_t* man, ap_abstract0_t* a)
 }
 bool ap_abstract0_is_leq(ap_manager_t* man, ap_abstract0_t* a1, ap_abstract0_t* a2)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_IS_LEQ);
+    bool res;
+    ap_trace_put_value(t,a1);
+    ap_trace_put_value(t,a2);
+    res = ap_abstract0_is_leq(man,a1,a2);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_IS_LEQ)){
+    bool res;
+    res = ap_abstract0_is_leq(man,a1,a2);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (a1==a2){
     return true;
   }
@@ -763,6 +943,21 @@ bool ap_abstract0_is_leq(ap_manager_t* man, ap_abstract0_t* a1, ap_abstract0_t*
 }
 bool ap_abstract0_is_eq(ap_manager_t* man, ap_abstract0_t* a1, ap_abstract0_t* a2)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_IS_EQ);
+    bool res;
+    ap_trace_put_value(t,a1);
+    ap_trace_put_value(t,a2);
+    res = ap_abstract0_is_eq(man,a1,a2);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_IS_EQ)){
+    bool res;
+    res = ap_abstract0_is_eq(man,a1,a2);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (a1==a2){
     return true;
   }
@@ -779,8 +974,23 @@ bool ap_abstract0_is_eq(ap_manager_t* man, ap_abstract0_t* a1, ap_abstract0_t* a
 }
 bool ap_abstract0_sat_lincons(ap_manager_t* man, ap_abstract0_t* a, ap_lincons0_t* lincons)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_SAT_LINCONS);
+    bool res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_lincons0(t,lincons);
+    res = ap_abstract0_sat_lincons(man,a,lincons);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_SAT_LINCONS)){
+    bool res;
+    res = ap_abstract0_sat_lincons(man,a,lincons);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_SAT_LINCONS,man,a) &&
-      ap_abstract0_check_linexpr(AP_FUNID_SAT_LINCONS,man,_ap_abstract0_dimension(a),lincons->linexpr0) ){
+      ap_abstract0_check_linexpr(AP_FUNID_SAT_LINCONS,man,_ap_abstract0_dimension(man,a),lincons->linexpr0) ){
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_LINCONS];
     return ptr(man,a->value,lincons);
   }
@@ -791,8 +1001,23 @@ bool ap_abstract0_sat_lincons(ap_manager_t* man, ap_abstract0_t* a, ap_lincons0_
 }
 bool ap_abstract0_sat_tcons(ap_manager_t* man, ap_abstract0_t* a, ap_tcons0_t* tcons)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_SAT_TCONS);
+    bool res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_tcons0(t,tcons);
+    res = ap_abstract0_sat_tcons(man,a,tcons);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_SAT_TCONS)){
+    bool res;
+    res = ap_abstract0_sat_tcons(man,a,tcons);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_SAT_TCONS,man,a) &&
-      ap_abstract0_check_texpr(AP_FUNID_SAT_TCONS,man,_ap_abstract0_dimension(a),tcons->texpr0) ){
+      ap_abstract0_check_texpr(AP_FUNID_SAT_TCONS,man,_ap_abstract0_dimension(man,a),tcons->texpr0) ){
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_TCONS];
     return ptr(man,a->value,tcons);
   }
@@ -804,8 +1029,24 @@ bool ap_abstract0_sat_tcons(ap_manager_t* man, ap_abstract0_t* a, ap_tcons0_t* t
 bool ap_abstract0_sat_interval(ap_manager_t* man, ap_abstract0_t* a,
 			       ap_dim_t dim, ap_interval_t* interval)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_SAT_INTERVAL);
+    bool res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_size(t,dim);
+    ap_trace_put_interval(t,interval);
+    res = ap_abstract0_sat_interval(man,a,dim,interval);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_SAT_INTERVAL)){
+    bool res;
+    res = ap_abstract0_sat_interval(man,a,dim,interval);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_SAT_INTERVAL,man,a) &&
-      ap_abstract0_check_dim(AP_FUNID_SAT_INTERVAL,man,_ap_abstract0_dimension(a),dim)){
+      ap_abstract0_check_dim(AP_FUNID_SAT_INTERVAL,man,_ap_abstract0_dimension(man,a),dim)){
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_INTERVAL];
     return ptr(man,a->value,dim,interval);
   }
@@ -817,8 +1058,23 @@ bool ap_abstract0_sat_interval(ap_manager_t* man, ap_abstract0_t* a,
 bool ap_abstract0_is_dimension_unconstrained(ap_manager_t* man, ap_abstract0_t* a,
 					     ap_dim_t dim)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_IS_DIMENSION_UNCONSTRAINED);
+    bool res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_size(t,dim);
+    res = ap_abstract0_is_dimension_unconstrained(man,a,dim);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_IS_DIMENSION_UNCONSTRAINED)){
+    bool res;
+    res = ap_abstract0_is_dimension_unconstrained(man,a,dim);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_IS_DIMENSION_UNCONSTRAINED,man,a) &&
-      ap_abstract0_check_dim(AP_FUNID_IS_DIMENSION_UNCONSTRAINED,man,_ap_abstract0_dimension(a),dim)){
+      ap_abstract0_check_dim(AP_FUNID_IS_DIMENSION_UNCONSTRAINED,man,_ap_abstract0_dimension(man,a),dim)){
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_IS_DIMENSION_UNCONSTRAINED];
     return ptr(man,a->value,dim);
   }
@@ -834,8 +1090,23 @@ bool ap_abstract0_is_dimension_unconstrained(ap_manager_t* man, ap_abstract0_t*
 ap_interval_t* ap_abstract0_bound_linexpr(ap_manager_t* man,
 					  ap_abstract0_t* a, ap_linexpr0_t* expr)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_BOUND_LINEXPR);
+    ap_interval_t* res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_linexpr0(t,expr);
+    res = ap_abstract0_bound_linexpr(man,a,expr);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_BOUND_LINEXPR)){
+    ap_interval_t* res;
+    res = ap_abstract0_bound_linexpr(man,a,expr);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_BOUND_LINEXPR,man,a) &&
-      ap_abstract0_check_linexpr(AP_FUNID_BOUND_LINEXPR,man,_ap_abstract0_dimension(a),expr)){
+      ap_abstract0_check_linexpr(AP_FUNID_BOUND_LINEXPR,man,_ap_abstract0_dimension(man,a),expr)){
     ap_interval_t* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_BOUND_LINEXPR];
     return ptr(man,a->value,expr);
   }
@@ -849,8 +1120,23 @@ ap_interval_t* ap_abstract0_bound_linexpr(ap_manager_t* man,
 ap_interval_t* ap_abstract0_bound_texpr(ap_manager_t* man,
 					ap_abstract0_t* a, ap_texpr0_t* expr)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_BOUND_TEXPR);
+    ap_interval_t* res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_texpr0(t,expr);
+    res = ap_abstract0_bound_texpr(man,a,expr);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_BOUND_TEXPR)){
+    ap_interval_t* res;
+    res = ap_abstract0_bound_texpr(man,a,expr);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_BOUND_TEXPR,man,a) &&
-      ap_abstract0_check_texpr(AP_FUNID_BOUND_TEXPR,man,_ap_abstract0_dimension(a),expr)){
+      ap_abstract0_check_texpr(AP_FUNID_BOUND_TEXPR,man,_ap_abstract0_dimension(man,a),expr)){
     ap_interval_t* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_BOUND_TEXPR];
     return ptr(man,a->value,expr);
   }
@@ -864,8 +1150,23 @@ ap_interval_t* ap_abstract0_bound_texpr(ap_manager_t* man,
 ap_interval_t* ap_abstract0_bound_dimension(ap_manager_t* man,
 					    ap_abstract0_t* a, ap_dim_t dim)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_BOUND_DIMENSION);
+    ap_interval_t* res;
+    ap_trace_put_value(t,a);
+    ap_trace_put_size(t,dim);
+    res = ap_abstract0_bound_dimension(man,a,dim);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_BOUND_DIMENSION)){
+    ap_interval_t* res;
+    res = ap_abstract0_bound_dimension(man,a,dim);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_BOUND_DIMENSION,man,a) &&
-      ap_abstract0_check_dim(AP_FUNID_BOUND_DIMENSION,man,_ap_abstract0_dimension(a),dim)){
+      ap_abstract0_check_dim(AP_FUNID_BOUND_DIMENSION,man,_ap_abstract0_dimension(man,a),dim)){
     ap_interval_t* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_BOUND_DIMENSION];
     return ptr(man,a->value,dim);
   }
@@ -878,6 +1179,20 @@ ap_interval_t* ap_abstract0_bound_dimension(ap_manager_t* man,
 }
 ap_lincons0_array_t ap_abstract0_to_lincons_array(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_TO_LINCONS_ARRAY);
+    ap_lincons0_array_t res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_to_lincons_array(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_TO_LINCONS_ARRAY)){
+    ap_lincons0_array_t res;
+    res = ap_abstract0_to_lincons_array(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_TO_LINCONS_ARRAY,man,a)){
     ap_lincons0_array_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_TO_LINCONS_ARRAY];
     return ptr(man,a->value);
@@ -889,6 +1204,20 @@ ap_lincons0_array_t ap_abstract0_to_lincons_array(ap_manager_t* man, ap_abstract
 }
 ap_tcons0_array_t ap_abstract0_to_tcons_array(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_TO_TCONS_ARRAY);
+    ap_tcons0_array_t res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_to_tcons_array(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_TO_TCONS_ARRAY)){
+    ap_tcons0_array_t res;
+    res = ap_abstract0_to_tcons_array(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_TO_TCONS_ARRAY,man,a)){
     ap_tcons0_array_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_TO_TCONS_ARRAY];
     return ptr(man,a->value);
@@ -900,13 +1229,27 @@ ap_tcons0_array_t ap_abstract0_to_tcons_array(ap_manager_t* man, ap_abstract0_t*
 }
 ap_interval_t** ap_abstract0_to_box(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_TO_BOX);
+    ap_interval_t** res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_to_box(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_TO_BOX)){
+    ap_interval_t** res;
+    res = ap_abstract0_to_box(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_TO_BOX,man,a)){
     ap_interval_t** (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_TO_BOX];
     return ptr(man,a->value);
   }
   else {
     size_t i;
-    ap_dimension_t d = _ap_abstract0_dimension(a);
+    ap_dimension_t d = _ap_abstract0_dimension(man,a);
     ap_interval_t** titv = ap_interval_array_alloc(d.intdim+d.realdim);
     for (i=0; i<d.intdim+d.realdim; i++){
       ap_interval_reinit(titv[i],man->option.scalar_discr);
@@ -917,6 +1260,20 @@ ap_interval_t** ap_abstract0_to_box(ap_manager_t* man, ap_abstract0_t* a)
 }
 ap_generator0_array_t ap_abstract0_to_generator_array(ap_manager_t* man, ap_abstract0_t* a)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_TO_GENERATOR_ARRAY);
+    ap_generator0_array_t res;
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_to_generator_array(man,a);
+    ap_trace_end(t,NULL,NULL);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_TO_GENERATOR_ARRAY)){
+    ap_generator0_array_t res;
+    res = ap_abstract0_to_generator_array(man,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman1(AP_FUNID_TO_GENERATOR_ARRAY,man,a)){
     ap_generator0_array_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_TO_GENERATOR_ARRAY];
     return ptr(man,a->value);
@@ -937,6 +1294,22 @@ ap_generator0_array_t ap_abstract0_to_generator_array(ap_manager_t* man, ap_abst
 ap_abstract0_t* ap_abstract0_meetjoin(ap_funid_t funid,
 				      ap_manager_t* man, bool destructive, ap_abstract0_t* a1, ap_abstract0_t* a2)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,funid);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a1);
+    ap_trace_put_value(t,a2);
+    res = ap_abstract0_meetjoin(funid,man,destructive,a1,a2);
+    ap_trace_end(t,destructive ? a1 : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,funid)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_meetjoin(funid,man,destructive,a1,a2);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman2(funid,man,a1,a2) &&
       ap_abstract0_check_abstract2(funid,man,a1,a2)){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[funid];
@@ -944,7 +1317,7 @@ ap_abstract0_t* ap_abstract0_meetjoin(ap_funid_t funid,
     return ap_abstract0_cons2(man,destructive,a1,value);
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a1);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a1);
     if (destructive) _ap_abstract0_free(a1);
     return ap_abstract0_top(man,
 			    dimension.intdim,
@@ -960,6 +1333,20 @@ ap_abstract0_t* ap_abstract0_join(ap_manager_t* man, bool destructive, ap_abstra
 
 ap_abstract0_t* ap_abstract0_meetjoin_array(ap_funid_t funid, ap_manager_t* man, ap_abstract0_t** tab, size_t size)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,funid);
+    ap_abstract0_t* res;
+    ap_trace_put_value_array(t,tab,size);
+    res = ap_abstract0_meetjoin_array(funid,man,tab,size);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,funid)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_meetjoin_array(funid,man,tab,size);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman_array(funid,man,tab,size) &&
       ap_abstract0_check_abstract_array(funid,man,tab,size)){
     size_t i;
@@ -974,7 +1361,7 @@ ap_abstract0_t* ap_abstract0_meetjoin_array(ap_funid_t funid, ap_manager_t* man,
   else {
     ap_dimension_t dimension = { 0, 0};
     if (size>0){
-      dimension = _ap_abstract0_dimension(tab[0]);
+      dimension = _ap_abstract0_dimension(man,tab[0]);
     }
     return ap_abstract0_top(man,
 			    dimension.intdim,
@@ -992,7 +1379,23 @@ ap_abstract0_t* ap_abstract0_meet_lincons_array(ap_manager_t* man,
 						ap_abstract0_t* a,
 						ap_lincons0_array_t* array)
 {
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_MEET_LINCONS_ARRAY);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_lincons0_array(t,array);
+    res = ap_abstract0_meet_lincons_array(man,destructive,a,array);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_MEET_LINCONS_ARRAY)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_meet_lincons_array(man,destructive,a,array);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
   if (ap_abstract0_checkman1(AP_FUNID_MEET_LINCONS_ARRAY,man,a) &&
       ap_abstract0_check_lincons_array(AP_FUNID_MEET_LINCONS_ARRAY,man,dimension,array) ){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MEET_LINCONS_ARRAY];
@@ -1011,7 +1414,23 @@ ap_abstract0_t* ap_abstract0_meet_tcons_array(ap_manager_t* man,
 					      ap_abstract0_t* a,
 					      ap_tcons0_array_t* array)
 {
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_MEET_TCONS_ARRAY);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_tcons0_array(t,array);
+    res = ap_abstract0_meet_tcons_array(man,destructive,a,array);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_MEET_TCONS_ARRAY)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_meet_tcons_array(man,destructive,a,array);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
   if (ap_abstract0_checkman1(AP_FUNID_MEET_TCONS_ARRAY,man,a) &&
       ap_abstract0_check_tcons_array(AP_FUNID_MEET_TCONS_ARRAY,man,dimension,array) ){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MEET_TCONS_ARRAY];
@@ -1030,7 +1449,23 @@ ap_abstract0_t* ap_abstract0_add_ray_array(ap_manager_t* man,
 					   ap_abstract0_t* a,
 					   ap_generator0_array_t* array)
 {
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_ADD_RAY_ARRAY);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_generator0_array(t,array);
+    res = ap_abstract0_add_ray_array(man,destructive,a,array);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_ADD_RAY_ARRAY)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_add_ray_array(man,destructive,a,array);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
   if (ap_abstract0_checkman1(AP_FUNID_ADD_RAY_ARRAY,man,a) &&
       ap_abstract0_check_generator_array(AP_FUNID_ADD_RAY_ARRAY,man,dimension,array)){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_ADD_RAY_ARRAY];
@@ -1058,6 +1493,25 @@ ap_abstract0_t* ap_abstract0_asssub_linexpr_array(ap_funid_t funid,
 						  size_t size,
 						  ap_abstract0_t* dest)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,funid);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dim_array(t,tdim,size);
+    ap_trace_put_linexpr0_array(t,texpr,size);
+    ap_trace_put_bool(t,dest!=NULL);
+    if (dest) ap_trace_put_value(t,dest);
+    res = ap_abstract0_asssub_linexpr_array(funid,man,destructive,a,tdim,texpr,size,dest);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,funid)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_asssub_linexpr_array(funid,man,destructive,a,tdim,texpr,size,dest);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (size==0){
     if (dest){
       return ap_abstract0_meet(man,destructive,a,dest);
@@ -1070,7 +1524,7 @@ ap_abstract0_t* ap_abstract0_asssub_linexpr_array(ap_funid_t funid,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     if (ap_abstract0_checkman1(funid,man,a) &&
 	(dest!=NULL ? (ap_abstract0_checkman1(funid,man,dest) && ap_abstract0_check_abstract2(funid,man,a,dest)) : true) &&
 	ap_abstract0_check_dim_array(funid,man,dimension,tdim,size) &&
@@ -1118,6 +1572,25 @@ ap_abstract0_t* ap_abstract0_asssub_texpr_array(ap_funid_t funid,
 						size_t size,
 						ap_abstract0_t* dest)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,funid);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dim_array(t,tdim,size);
+    ap_trace_put_texpr0_array(t,texpr,size);
+    ap_trace_put_bool(t,dest!=NULL);
+    if (dest) ap_trace_put_value(t,dest);
+    res = ap_abstract0_asssub_texpr_array(funid,man,destructive,a,tdim,texpr,size,dest);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,funid)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_asssub_texpr_array(funid,man,destructive,a,tdim,texpr,size,dest);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (size==0){
     if (dest){
       return ap_abstract0_meet(man,destructive,a,dest);
@@ -1130,7 +1603,7 @@ ap_abstract0_t* ap_abstract0_asssub_texpr_array(ap_funid_t funid,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     if (ap_abstract0_checkman1(funid,man,a) &&
 	(dest!=NULL ? (ap_abstract0_checkman1(funid,man,dest) && ap_abstract0_check_abstract2(funid,man,a,dest)) : true) &&
 	ap_abstract0_check_dim_array(funid,man,dimension,tdim,size) &&
@@ -1180,6 +1653,23 @@ ap_abstract0_t* ap_abstract0_forget_array(ap_manager_t* man,
 					  ap_dim_t* tdim, size_t size,
 					  bool project)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_FORGET_ARRAY);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dim_array(t,tdim,size);
+    ap_trace_put_bool(t,project);
+    res = ap_abstract0_forget_array(man,destructive,a,tdim,size,project);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_FORGET_ARRAY)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_forget_array(man,destructive,a,tdim,size,project);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (size==0){
     if (destructive){
       return a;
@@ -1189,7 +1679,7 @@ ap_abstract0_t* ap_abstract0_forget_array(ap_manager_t* man,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     if (ap_abstract0_checkman1(AP_FUNID_FORGET_ARRAY,man,a) &&
 	ap_abstract0_check_dim_array(AP_FUNID_FORGET_ARRAY,man,dimension,tdim,size)){
       void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_FORGET_ARRAY];
@@ -1215,6 +1705,23 @@ ap_abstract0_t* ap_abstract0_add_dimensions(ap_manager_t* man,
 					    ap_dimchange_t* dimchange,
 					    bool project)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_ADD_DIMENSIONS);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dimchange(t,dimchange);
+    ap_trace_put_bool(t,project);
+    res = ap_abstract0_add_dimensions(man,destructive,a,dimchange,project);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_ADD_DIMENSIONS)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_add_dimensions(man,destructive,a,dimchange,project);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (dimchange->intdim+dimchange->realdim==0){
     if (destructive){
       return a;
@@ -1224,7 +1731,7 @@ ap_abstract0_t* ap_abstract0_add_dimensions(ap_manager_t* man,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     if (ap_abstract0_checkman1(AP_FUNID_ADD_DIMENSIONS,man,a) &&
 	ap_abstract0_check_ap_dimchange_add(AP_FUNID_ADD_DIMENSIONS,man,dimension,dimchange)){
       void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_ADD_DIMENSIONS];
@@ -1244,6 +1751,22 @@ ap_abstract0_t* ap_abstract0_remove_dimensions(ap_manager_t* man,
 					       ap_abstract0_t* a,
 					       ap_dimchange_t* dimchange)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_REMOVE_DIMENSIONS);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dimchange(t,dimchange);
+    res = ap_abstract0_remove_dimensions(man,destructive,a,dimchange);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_REMOVE_DIMENSIONS)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_remove_dimensions(man,destructive,a,dimchange);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (dimchange->intdim+dimchange->realdim==0){
     if (destructive){
       return a;
@@ -1253,7 +1776,7 @@ ap_abstract0_t* ap_abstract0_remove_dimensions(ap_manager_t* man,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     if (ap_abstract0_checkman1(AP_FUNID_REMOVE_DIMENSIONS,man,a) &&
 	ap_abstract0_check_ap_dimchange_remove(AP_FUNID_REMOVE_DIMENSIONS,man,dimension,dimchange)){
       void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_REMOVE_DIMENSIONS];
@@ -1273,7 +1796,23 @@ ap_abstract0_t* ap_abstract0_permute_dimensions(ap_manager_t* man,
 						ap_abstract0_t* a,
 						ap_dimperm_t* perm)
 {
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_PERMUTE_DIMENSIONS);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dimperm(t,perm);
+    res = ap_abstract0_permute_dimensions(man,destructive,a,perm);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_PERMUTE_DIMENSIONS)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_permute_dimensions(man,destructive,a,perm);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
   if (ap_abstract0_checkman1(AP_FUNID_PERMUTE_DIMENSIONS,man,a) &&
       ap_abstract0_check_dimperm(AP_FUNID_PERMUTE_DIMENSIONS,man,dimension,perm)){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_PERMUTE_DIMENSIONS];
@@ -1297,6 +1836,23 @@ ap_abstract0_t* ap_abstract0_expand(ap_manager_t* man,
 				    ap_dim_t dim,
 				    size_t n)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_EXPAND);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_size(t,dim);
+    ap_trace_put_size(t,n);
+    res = ap_abstract0_expand(man,destructive,a,dim,n);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_EXPAND)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_expand(man,destructive,a,dim,n);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (n==0){
     if (destructive){
 	return a;
@@ -1306,7 +1862,7 @@ ap_abstract0_t* ap_abstract0_expand(ap_manager_t* man,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
     if (ap_abstract0_checkman1(AP_FUNID_EXPAND,man,a) &&
 	ap_abstract0_check_dim(AP_FUNID_EXPAND,man,dimension,dim)){
       void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_EXPAND];
@@ -1327,7 +1883,23 @@ ap_abstract0_t* ap_abstract0_fold(ap_manager_t* man,
 				  ap_dim_t* tdim,
 				  size_t size)
 {
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_FOLD);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    ap_trace_put_dim_array(t,tdim,size);
+    res = ap_abstract0_fold(man,destructive,a,tdim,size);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_FOLD)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_fold(man,destructive,a,tdim,size);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
   if (ap_abstract0_checkman1(AP_FUNID_FOLD,man,a) &&
       ap_abstract0_check_dim_array(AP_FUNID_FOLD,man,dimension,tdim,size)){
     if (size==0){
@@ -1386,6 +1958,21 @@ ap_abstract0_t* ap_abstract0_fold(ap_manager_t* man,
 ap_abstract0_t* ap_abstract0_widening(ap_manager_t* man,
 				      ap_abstract0_t* a1, ap_abstract0_t* a2)
 {
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_WIDENING);
+    ap_abstract0_t* res;
+    ap_trace_put_value(t,a1);
+    ap_trace_put_value(t,a2);
+    res = ap_abstract0_widening(man,a1,a2);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_WIDENING)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_widening(man,a1,a2);
+    ap_manager_timer_exit(man);
+    return res;
+  }
   if (ap_abstract0_checkman2(AP_FUNID_WIDENING,man,a1,a2) &&
       ap_abstract0_check_abstract2(AP_FUNID_WIDENING,man,a1,a2)){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_WIDENING];
@@ -1393,7 +1980,7 @@ ap_abstract0_t* ap_abstract0_widening(ap_manager_t* man,
     return ap_abstract0_cons(man,value);
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a1);
+    ap_dimension_t dimension = _ap_abstract0_dimension(man,a1);
     return ap_abstract0_top(man,
 			    dimension.intdim,
 			    dimension.realdim);
@@ -1405,7 +1992,22 @@ ap_abstract0_t* ap_abstract0_widening(ap_manager_t* man,
 /* ============================================================ */
 ap_abstract0_t* ap_abstract0_closure(ap_manager_t* man, bool destructive, ap_abstract0_t* a)
 {
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,AP_FUNID_CLOSURE);
+    ap_abstract0_t* res;
+    ap_trace_put_bool(t,destructive);
+    ap_trace_put_value(t,a);
+    res = ap_abstract0_closure(man,destructive,a);
+    ap_trace_end(t,destructive ? a : NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_CLOSURE)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_closure(man,destructive,a);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  ap_dimension_t dimension = _ap_abstract0_dimension(man,a);
   if (ap_abstract0_checkman1(AP_FUNID_CLOSURE,man,a)){
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_CLOSURE];
     void* value = ptr(man,destructive,a->value);
@@ -1525,8 +2127,25 @@ ap_abstract0_t* ap_abstract0_widening_threshold(ap_manager_t* man,
   void* value;
   size_t i,j,size;
   ap_lincons0_t tmp;
+  ap_dimension_t dimension;
 
-  ap_dimension_t dimension = _ap_abstract0_dimension(a1);
+  if (ap_trace_on(man)){
+    ap_trace_t* t = ap_trace_begin(man,(ap_funid_t)AP_TRACE_WIDENING_THRESHOLD);
+    ap_abstract0_t* res;
+    ap_trace_put_value(t,a1);
+    ap_trace_put_value(t,a2);
+    ap_trace_put_lincons0_array(t,array);
+    res = ap_abstract0_widening_threshold(man,a1,a2,array);
+    ap_trace_end(t,NULL,res);
+    return res;
+  }
+  if (ap_manager_timer_enter(man,AP_FUNID_WIDENING)){
+    ap_abstract0_t* res;
+    res = ap_abstract0_widening_threshold(man,a1,a2,array);
+    ap_manager_timer_exit(man);
+    return res;
+  }
+  dimension = _ap_abstract0_dimension(man,a1);
   if (ap_abstract0_checkman2(AP_FUNID_WIDENING,man,a1,a2) &&
       ap_abstract0_check_abstract2(AP_FUNID_WIDENING,man,a1,a2) &&
       ap_abstract0_check_lincons_array(AP_FUNID_WIDENING,man,dimension,array) ){
@@ -107,8 +107,9 @@ ap_membuf_t ap_abstract0_serialize_raw(ap_manager_t* man, ap_abstract0_t* a);
 
 
 ap_abstract0_t* ap_abstract0_deserialize_raw(ap_manager_t* man, void* ptr, size_t* size);
-  /* Return the abstract value read in raw binary format from the input stream
-     and store in size the number of bytes read */
+  /* Return the abstract value read in raw binary format from the buffer ptr,
+     whose size in bytes is given in *size, and store in *size the number of
+     bytes read. Return NULL if the buffer cannot be read. */
 
 /* ********************************************************************** */
 /* II. Constructor, accessors, tests and property extraction */
@@ -509,12 +510,16 @@ bool ap_abstract0_checkman_array(ap_funid_t funid,
 /* 0.2 Checking compatibility of arguments: abstract values */
 /* ====================================================================== */
 
-/* Getting dimensions without checks */
+/* Getting dimensions without checks, with the manager man of the call if it
+   belongs to the library of a, so that a value created under a manager can
+   be used under its clones without touching the working space of the
+   manager which created it */
 static inline
-ap_dimension_t _ap_abstract0_dimension(ap_abstract0_t* a)
+ap_dimension_t _ap_abstract0_dimension(ap_manager_t* man, ap_abstract0_t* a)
 {
-  ap_dimension_t (*ptr)(ap_manager_t*,...) = (ap_dimension_t (*) (ap_manager_t*,...))(a->man->funptr[AP_FUNID_DIMENSION]);
-  return ptr(a->man,a->value);
+  ap_manager_t* m = man->library==a->man->library ? man : a->man;
+  ap_dimension_t (*ptr)(ap_manager_t*,...) = (ap_dimension_t (*) (ap_manager_t*,...))(m->funptr[AP_FUNID_DIMENSION]);
+  return ptr(m,a->value);
 }
 
 /* Check that the 2 abstract values have the same dimensionality */
@@ -608,6 +613,11 @@ ap_abstract0_meetjoin(ap_funid_t funid,
 		      ap_manager_t* man, bool destructive,
 		      ap_abstract0_t* a1, ap_abstract0_t* a2);
 ap_abstract0_t*
+ap_abstract0_meetjoin_array(ap_funid_t funid,
+			    /* either meet_array or join_array */
+			    ap_manager_t* man,
+			    ap_abstract0_t** tab, size_t size);
+ap_abstract0_t*
 ap_abstract0_asssub_linexpr(ap_funid_t funid,
 			    /* either assign or substitute */
 			    ap_manager_t* man,
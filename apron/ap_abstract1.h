@@ -25,6 +25,10 @@ typedef struct ap_abstract1_t {
   /* data structure invariant:
      ap_abstract0_integer_dimension(man,abstract0)== env->intdim &&
      ap_abstract0_real_dimension(man,abstract0)== env->realdim */
+  /* The environment is shared between the values, with an atomic reference
+     counter: values of different threads may share their environment.
+     Sharing the same value between threads is subject to the contract
+     documented with ap_manager_clone_for_thread in ap_manager.h. */
 
 typedef struct ap_box1_t {
   ap_interval_t** p;
@@ -109,8 +113,9 @@ ap_membuf_t ap_abstract1_serialize_raw(ap_manager_t* man, ap_abstract1_t* a);
    afterwards (with free). */
 
 ap_abstract1_t ap_abstract1_deserialize_raw(ap_manager_t* man, void* ptr, size_t* size);
-/* Return the abstract value read in raw binary format from the input stream
-   and store in size the number of bytes read */
+/* Return the abstract value read in raw binary format from the buffer ptr,
+   whose size in bytes is given in *size, and store in *size the number of
+   bytes read */
 
 /* ********************************************************************** */
 /* II. Constructor, accessors, tests and property extraction */
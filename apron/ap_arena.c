@@ -0,0 +1,205 @@
+/* ************************************************************************* */
+/* ap_arena.c: arenas for transient objects */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "ap_arena.h"
+
+/* ====================================================================== */
+/* I. Memory management */
+/* ====================================================================== */
+
+void ap_arena_init(ap_arena_t* arena, size_t blocksize)
+{
+  arena->first = NULL;
+  arena->block = NULL;
+  arena->pos = 0;
+  arena->blocksize = blocksize ? blocksize : 4096;
+}
+void ap_arena_clear(ap_arena_t* arena)
+{
+  ap_arena_block_t* block = arena->first;
+  while (block!=NULL){
+    ap_arena_block_t* next = block->next;
+    free(block);
+    block = next;
+  }
+  arena->first = NULL;
+  arena->block = NULL;
+  arena->pos = 0;
+}
+ap_arena_t* ap_arena_alloc(size_t blocksize)
+{
+  ap_arena_t* arena = (ap_arena_t*)malloc(sizeof(ap_arena_t));
+  ap_arena_init(arena,blocksize);
+  return arena;
+}
+void ap_arena_free(ap_arena_t* arena)
+{
+  ap_arena_clear(arena);
+  free(arena);
+}
+
+static ap_arena_block_t* ap_arena_block_alloc(size_t size)
+{
+  ap_arena_block_t* block =
+    (ap_arena_block_t*)malloc(AP_ARENA_HEADER+size);
+  block->next = NULL;
+  block->size = size;
+  return block;
+}
+
+/* The current block is full (or there is none yet): continue in the next
+   block if it is large enough, or insert a new block after the current one.
+   Blocks are never freed before ap_arena_clear, so that a mark remains
+   valid until the arena is brought back before it. */
+void* ap_arena_malloc_block(ap_arena_t* arena, size_t size)
+{
+  ap_arena_block_t* next;
+
+  next = arena->block==NULL ? arena->first : arena->block->next;
+  if (next==NULL || next->size < size){
+    ap_arena_block_t* block =
+      ap_arena_block_alloc(size > arena->blocksize ? size : arena->blocksize);
+    block->next = next;
+    if (arena->block==NULL)
+      arena->first = block;
+    else
+      arena->block->next = block;
+    next = block;
+  }
+  arena->block = next;
+  arena->pos = size;
+  return (char*)next + AP_ARENA_HEADER;
+}
+
+size_t ap_arena_size(ap_arena_t* arena)
+{
+  ap_arena_block_t* block;
+  size_t size = 0;
+  for (block=arena->first; block!=NULL; block=block->next)
+    size += block->size;
+  return size;
+}
+
+void ap_arena_fprint(FILE* stream, ap_arena_t* arena)
+{
+  ap_arena_block_t* block;
+  size_t i = 0;
+  fprintf(stream,"arena: blocksize = %lu, size = %lu\n",
+	  (unsigned long)arena->blocksize,(unsigned long)ap_arena_size(arena));
+  for (block=arena->first; block!=NULL; block=block->next, i++){
+    fprintf(stream,"%2lu: %lu bytes%s\n",
+	    (unsigned long)i,(unsigned long)block->size,
+	    block==arena->block ? " (current)" : "");
+  }
+  if (arena->block!=NULL)
+    fprintf(stream,"position in current block: %lu\n",
+	    (unsigned long)arena->pos);
+}
+
+/* ====================================================================== */
+/* II. Transient objects */
+/* ====================================================================== */
+
+ap_scalar_t* ap_arena_scalar_alloc(ap_arena_t* arena)
+{
+  ap_scalar_t* scalar =
+    (ap_scalar_t*)ap_arena_malloc(arena,sizeof(ap_scalar_t));
+  scalar->discr = AP_SCALAR_DOUBLE;
+  scalar->val.dbl = 0.0;
+  return scalar;
+}
+ap_scalar_t* ap_arena_scalar_alloc_set_double(ap_arena_t* arena, double k)
+{
+  ap_scalar_t* scalar = ap_arena_scalar_alloc(arena);
+  scalar->val.dbl = k;
+  return scalar;
+}
+
+ap_interval_t* ap_arena_interval_alloc(ap_arena_t* arena)
+{
+  ap_interval_t* itv =
+    (ap_interval_t*)ap_arena_malloc(arena,sizeof(ap_interval_t));
+  itv->inf = ap_arena_scalar_alloc(arena);
+  itv->sup = ap_arena_scalar_alloc(arena);
+  return itv;
+}
+ap_interval_t** ap_arena_interval_array_alloc(ap_arena_t* arena, size_t size)
+{
+  size_t i;
+  ap_interval_t** array =
+    (ap_interval_t**)ap_arena_malloc(arena,size*sizeof(ap_interval_t*));
+  for (i=0; i<size; i++)
+    array[i] = ap_arena_interval_alloc(arena);
+  return array;
+}
+
+void ap_arena_coeff_init(ap_arena_t* arena,
+			 ap_coeff_t* coeff, ap_coeff_discr_t discr)
+{
+  coeff->discr = discr;
+  switch (discr){
+  case AP_COEFF_SCALAR:
+    coeff->val.scalar = ap_arena_scalar_alloc(arena);
+    break;
+  case AP_COEFF_INTERVAL:
+    coeff->val.interval = ap_arena_interval_alloc(arena);
+    break;
+  }
+}
+void ap_arena_coeff_reinit(ap_arena_t* arena,
+			   ap_coeff_t* coeff, ap_coeff_discr_t discr)
+{
+  if (coeff->discr!=discr)
+    ap_arena_coeff_init(arena,coeff,discr);
+}
+
+ap_linexpr0_t* ap_arena_linexpr0_alloc(ap_arena_t* arena,
+				       ap_linexpr_discr_t lin_discr,
+				       size_t size)
+{
+  ap_linexpr0_t* e;
+  size_t i;
+
+  e = (ap_linexpr0_t*)ap_arena_malloc(arena,sizeof(ap_linexpr0_t));
+  ap_arena_coeff_init(arena,&e->cst,AP_COEFF_SCALAR);
+  e->discr = lin_discr;
+  e->size = size;
+  switch (lin_discr){
+  case AP_LINEXPR_DENSE:
+    e->p.coeff = size==0 ? NULL :
+      (ap_coeff_t*)ap_arena_malloc(arena,size*sizeof(ap_coeff_t));
+    for (i=0; i<size; i++)
+      ap_arena_coeff_init(arena,&e->p.coeff[i],AP_COEFF_SCALAR);
+    break;
+  case AP_LINEXPR_SPARSE:
+    e->p.linterm = size==0 ? NULL :
+      (ap_linterm_t*)ap_arena_malloc(arena,size*sizeof(ap_linterm_t));
+    for (i=0; i<size; i++){
+      ap_arena_coeff_init(arena,&e->p.linterm[i].coeff,AP_COEFF_SCALAR);
+      e->p.linterm[i].dim = AP_DIM_MAX;
+    }
+    break;
+  }
+  return e;
+}
+
+ap_lincons0_array_t ap_arena_lincons0_array_make(ap_arena_t* arena,
+						 size_t size)
+{
+  ap_lincons0_array_t array;
+  size_t i;
+  array.size = size;
+  array.p = size==0 ? NULL :
+    (ap_lincons0_t*)ap_arena_malloc(arena,size*sizeof(ap_lincons0_t));
+  for (i=0; i<size; i++){
+    array.p[i].linexpr0 = NULL;
+    array.p[i].scalar = NULL;
+  }
+  return array;
+}
@@ -0,0 +1,189 @@
+/* ************************************************************************* */
+/* ap_arena.h: arenas for transient objects */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* normally included from ap_expr0.h */
+
+/* An arena is a list of memory blocks in which objects are allocated by
+   incrementing a pointer. They cannot be freed individually: all the objects
+   allocated since a mark are released at once, in constant time, by
+   ap_arena_release (or ap_arena_reset for all of them). The blocks are kept
+   and reused by the next allocations, until the arena is cleared.
+
+   The arena is meant for the many small objects built during a transfer step
+   and freed at its end: the scalars, intervals, linear expressions and
+   constraints built by the ap_arena_* constructors below only reference
+   memory of the arena. Their scalars are of type AP_SCALAR_DOUBLE, since the
+   memory used by GMP and MPFR numbers cannot be released with the arena.
+
+   These objects can be read and modified in place by all the usual functions,
+   as long as the scalars remain doubles. They should not be passed to a
+   function which frees or reallocates them, or a part of them:
+   ap_*_free, ap_*_clear, ap_*_realloc, ap_*_reinit (with another type),
+   ap_coeff_set_interval on a scalar coefficient or conversely...
+   ap_arena_coeff_reinit changes the type of a coefficient of the arena.
+
+   An arena is not thread-safe: each thread should use its own arenas. */
+
+#ifndef _AP_ARENA_H_
+#define _AP_ARENA_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_coeff.h"
+#include "ap_linexpr0.h"
+#include "ap_lincons0.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ====================================================================== */
+/* Datatypes */
+/* ====================================================================== */
+
+/* (internal) block of memory, followed by its data */
+typedef struct ap_arena_block_t {
+  struct ap_arena_block_t* next;
+  size_t size;              /* size of the data, in bytes */
+} ap_arena_block_t;
+
+typedef struct ap_arena_t {
+  ap_arena_block_t* first;  /* list of blocks */
+  ap_arena_block_t* block;  /* block being filled, NULL if first==NULL */
+  size_t pos;               /* first free byte of block */
+  size_t blocksize;         /* size of the blocks allocated by default */
+} ap_arena_t;
+
+/* Position of an arena, to which it can be brought back */
+typedef struct ap_arena_mark_t {
+  ap_arena_block_t* block;
+  size_t pos;
+} ap_arena_mark_t;
+
+/* ====================================================================== */
+/* I. Memory management */
+/* ====================================================================== */
+
+void ap_arena_init(ap_arena_t* arena, size_t blocksize);
+  /* Initialize an empty arena, which will allocate memory by blocks of
+     blocksize bytes, or more for larger objects. 0 selects a default size
+     of 4096 bytes. No memory is allocated until the first object. */
+void ap_arena_clear(ap_arena_t* arena);
+  /* Free all the blocks of the arena */
+
+ap_arena_t* ap_arena_alloc(size_t blocksize);
+void ap_arena_free(ap_arena_t* arena);
+  /* Same as above, for an arena allocated on the heap */
+
+static inline
+void* ap_arena_malloc(ap_arena_t* arena, size_t size);
+  /* Allocate size bytes, aligned on 16 bytes (or as malloc if less) */
+
+static inline
+ap_arena_mark_t ap_arena_mark(ap_arena_t* arena);
+  /* Current position of the arena */
+static inline
+void ap_arena_release(ap_arena_t* arena, ap_arena_mark_t mark);
+  /* Release all the objects allocated since mark was taken. The marks taken
+     after mark are invalidated. */
+static inline
+void ap_arena_reset(ap_arena_t* arena);
+  /* Release all the objects of the arena */
+
+size_t ap_arena_size(ap_arena_t* arena);
+  /* Sum of the sizes of the blocks of the arena, in bytes */
+
+void ap_arena_fprint(FILE* stream, ap_arena_t* arena);
+  /* Print the blocks of the arena and their occupation */
+
+/* ====================================================================== */
+/* II. Transient objects */
+/* ====================================================================== */
+
+ap_scalar_t* ap_arena_scalar_alloc(ap_arena_t* arena);
+  /* Allocate a scalar of type AP_SCALAR_DOUBLE, initialized to 0 */
+ap_scalar_t* ap_arena_scalar_alloc_set_double(ap_arena_t* arena, double k);
+
+ap_interval_t* ap_arena_interval_alloc(ap_arena_t* arena);
+  /* Allocate an interval of doubles, initialized to [0,0] */
+ap_interval_t** ap_arena_interval_array_alloc(ap_arena_t* arena, size_t size);
+
+void ap_arena_coeff_init(ap_arena_t* arena,
+			 ap_coeff_t* coeff, ap_coeff_discr_t discr);
+  /* Initialize a coefficient with a scalar or an interval of the arena,
+     equal to 0 */
+void ap_arena_coeff_reinit(ap_arena_t* arena,
+			   ap_coeff_t* coeff, ap_coeff_discr_t discr);
+  /* Change the type of a coefficient of the arena, if necessary. The new
+     scalar or interval is equal to 0. */
+
+ap_linexpr0_t* ap_arena_linexpr0_alloc(ap_arena_t* arena,
+				       ap_linexpr_discr_t lin_discr,
+				       size_t size);
+  /* Allocate a linear expression, with scalar coefficients equal to 0, as
+     ap_linexpr0_alloc does. The size of the expression is fixed. */
+
+ap_lincons0_array_t ap_arena_lincons0_array_make(ap_arena_t* arena,
+						 size_t size);
+  /* Allocate an array of constraints, initialized with NULL expressions and
+     scalars, as ap_lincons0_array_make does. */
+
+/* ====================================================================== */
+/* Definition of inline functions */
+/* ====================================================================== */
+
+void* ap_arena_malloc_block(ap_arena_t* arena, size_t size);
+  /* (internal) slow path of ap_arena_malloc, when the block is full */
+
+/* (internal) alignment of the objects, and offset of the data of a block */
+#define AP_ARENA_ALIGN ((size_t)16)
+#define AP_ARENA_HEADER \
+  ((sizeof(ap_arena_block_t)+AP_ARENA_ALIGN-1) & ~(AP_ARENA_ALIGN-1))
+
+static inline
+void* ap_arena_malloc(ap_arena_t* arena, size_t size)
+{
+  size_t pos = (arena->pos+AP_ARENA_ALIGN-1) & ~(AP_ARENA_ALIGN-1);
+  if (arena->block!=NULL && pos+size <= arena->block->size){
+    arena->pos = pos+size;
+    return (char*)arena->block + AP_ARENA_HEADER + pos;
+  }
+  else
+    return ap_arena_malloc_block(arena,size);
+}
+static inline
+ap_arena_mark_t ap_arena_mark(ap_arena_t* arena)
+{
+  ap_arena_mark_t mark;
+  mark.block = arena->block;
+  mark.pos = arena->pos;
+  return mark;
+}
+static inline
+void ap_arena_release(ap_arena_t* arena, ap_arena_mark_t mark)
+{
+  if (mark.block==NULL){
+    arena->block = arena->first;
+    arena->pos = 0;
+  }
+  else {
+    arena->block = mark.block;
+    arena->pos = mark.pos;
+  }
+}
+static inline
+void ap_arena_reset(ap_arena_t* arena)
+{
+  arena->block = arena->first;
+  arena->pos = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
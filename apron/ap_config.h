@@ -34,6 +34,22 @@ static inline char* strdup(const char* s){
 }
 #endif
 
+/* Reference counters (of environments and managers) are updated with atomic
+   operations when the compiler provides them, so that objects referring to
+   the same environment or manager can be copied and freed by several threads
+   at the same time. */
+#if defined(__GNUC__) || defined(__clang__)
+static inline size_t ap_refcount_incr(size_t* count)
+{ return __atomic_add_fetch(count,1,__ATOMIC_RELAXED); }
+static inline size_t ap_refcount_decr(size_t* count)
+{ return __atomic_sub_fetch(count,1,__ATOMIC_ACQ_REL); }
+#else
+static inline size_t ap_refcount_incr(size_t* count)
+{ return ++(*count); }
+static inline size_t ap_refcount_decr(size_t* count)
+{ return --(*count); }
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 #include "ap_global0.h"
 #include "ap_disjunction.h"
 
@@ -165,6 +166,181 @@ static void ap_disjunction_elim_redundant(ap_disjunction_internal_t* intern,
   ap_disjunction_resize(a);
 }
 
+/* ------------------------------------------------------------ */
+/* Bounding the number of disjuncts */
+/* ------------------------------------------------------------ */
+
+typedef struct ap_disjunction_leq_task_t {
+  ap_manager_t* man;    /* manager of the base domain used by the task */
+  ap_disjunction_t* a;
+  bool* leq;            /* leq[i*a->size+j] iff a->p[i] <= a->p[j] */
+  size_t first,last;    /* rows computed by the task */
+} ap_disjunction_leq_task_t;
+
+static void* ap_disjunction_leq_task(void* arg)
+{
+  ap_disjunction_leq_task_t* task = (ap_disjunction_leq_task_t*)arg;
+  ap_manager_t* man = task->man;
+  ap_disjunction_t* a = task->a;
+  bool (*is_leq)(ap_manager_t*,...) = man->funptr[AP_FUNID_IS_LEQ];
+  size_t i,j;
+
+  for (i=task->first; i<task->last; i++){
+    for (j=0; j<a->size; j++){
+      task->leq[i*a->size+j] = i!=j && is_leq(man,a->p[i],a->p[j]);
+    }
+  }
+  return NULL;
+}
+
+/* Removes the disjuncts included in another one.  Among equal disjuncts,
+   the first one is kept.
+
+   The rows of the inclusion matrix are split into contiguous ranges,
+   distributed among the manager of the base domain and the workers, each
+   one in its own thread.  Tests may complete the representation of their
+   arguments (polyhedra compute their missing constraints or generators,
+   octagons their closure).  Each disjunct is therefore first tested against
+   itself by the manager of the base domain, before the threads are
+   started, so that the tests of the threads only read the disjuncts. */
+static void ap_disjunction_elim_subsumed(ap_disjunction_internal_t* intern,
+					 ap_disjunction_t* a)
+{
+  ap_manager_t* man = intern->manager;
+  void (*absfree)(ap_manager_t*, ...) = man->funptr[AP_FUNID_FREE];
+  bool (*is_leq)(ap_manager_t*,...) = man->funptr[AP_FUNID_IS_LEQ];
+  size_t size = a->size;
+  size_t nbtasks = 1+intern->nbworkers;
+  size_t i,j,t;
+  bool* leq;
+
+  if (size<=1) return;
+  if (nbtasks>size) nbtasks = size;
+  if (nbtasks>1){
+    for (i=0; i<size; i++)
+      is_leq(man,a->p[i],a->p[i]);
+  }
+  leq = malloc(size*size*sizeof(bool));
+  {
+    ap_disjunction_leq_task_t task[nbtasks];
+    pthread_t thread[nbtasks];
+    bool started[nbtasks];
+    for (t=0; t<nbtasks; t++){
+      task[t].man = t==0 ? man : intern->workers[t-1];
+      task[t].a = a;
+      task[t].leq = leq;
+      task[t].first = t*size/nbtasks;
+      task[t].last = (t+1)*size/nbtasks;
+      started[t] = false;
+    }
+    for (t=1; t<nbtasks; t++){
+      started[t] =
+	pthread_create(&thread[t],NULL,&ap_disjunction_leq_task,&task[t])==0;
+    }
+    ap_disjunction_leq_task(&task[0]);
+    for (t=1; t<nbtasks; t++){
+      if (started[t])
+	pthread_join(thread[t],NULL);
+      else
+	ap_disjunction_leq_task(&task[t]);
+    }
+  }
+  /* a disjunct is removed only in favour of a greater one, or of an equal
+     one of smaller index, so that some greater disjunct always remains */
+  for (i=0; i<size; i++){
+    for (j=0; j<size; j++){
+      if (leq[i*size+j] && (!leq[j*size+i] || j<i)){
+	absfree(man,a->p[i]);
+	a->p[i] = NULL;
+	break;
+      }
+    }
+  }
+  free(leq);
+  ap_disjunction_resize(a);
+}
+
+/* Distance between two boxes: sum on dimensions of the gaps between
+   intervals, 0 for overlapping intervals */
+static double ap_disjunction_box_distance(ap_interval_t** b1,
+					  ap_interval_t** b2,
+					  size_t nbdims)
+{
+  double res = 0.0;
+  double inf,sup;
+  size_t i;
+
+  for (i=0; i<nbdims; i++){
+    ap_double_set_scalar(&sup,b1[i]->sup,GMP_RNDU);
+    ap_double_set_scalar(&inf,b2[i]->inf,GMP_RNDD);
+    if (inf-sup>0) res += inf-sup;
+    ap_double_set_scalar(&sup,b2[i]->sup,GMP_RNDU);
+    ap_double_set_scalar(&inf,b1[i]->inf,GMP_RNDD);
+    if (inf-sup>0) res += inf-sup;
+  }
+  return res;
+}
+
+/* Joins the two disjuncts with the closest bounding boxes until at most
+   maxsize disjuncts remain */
+static void ap_disjunction_merge_closest(ap_disjunction_internal_t* intern,
+					 ap_disjunction_t* a, size_t maxsize)
+{
+  ap_manager_t* man = intern->manager;
+  void (*absfree)(ap_manager_t*, ...) = man->funptr[AP_FUNID_FREE];
+  void* (*join)(ap_manager_t*, ...) = man->funptr[AP_FUNID_JOIN];
+  ap_interval_t** (*to_box)(ap_manager_t*, ...) = man->funptr[AP_FUNID_TO_BOX];
+  ap_dimension_t (*dimension)(ap_manager_t*, ...) = man->funptr[AP_FUNID_DIMENSION];
+  ap_dimension_t dim = dimension(man,a->p[0]);
+  size_t nbdims = dim.intdim+dim.realdim;
+  size_t size = a->size;
+  size_t i,j,bi,bj;
+  double d,best;
+  ap_interval_t*** tbox;
+
+  tbox = malloc(size*sizeof(ap_interval_t**));
+  for (i=0; i<size; i++){
+    tbox[i] = to_box(man,a->p[i]);
+  }
+  while (size>maxsize && size>1){
+    bi = 0; bj = 1;
+    best = ap_disjunction_box_distance(tbox[0],tbox[1],nbdims);
+    for (i=0; i<size; i++){
+      for (j=i+1; j<size; j++){
+	d = ap_disjunction_box_distance(tbox[i],tbox[j],nbdims);
+	if (d<best){
+	  best = d; bi = i; bj = j;
+	}
+      }
+    }
+    a->p[bi] = join(man,true,a->p[bi],a->p[bj]);
+    ap_interval_array_free(tbox[bi],nbdims);
+    tbox[bi] = to_box(man,a->p[bi]);
+    absfree(man,a->p[bj]);
+    ap_interval_array_free(tbox[bj],nbdims);
+    size--;
+    a->p[bj] = a->p[size];
+    tbox[bj] = tbox[size];
+    a->p[size] = NULL;
+  }
+  for (i=0; i<size; i++){
+    ap_interval_array_free(tbox[i],nbdims);
+  }
+  free(tbox);
+  ap_disjunction_resize(a);
+}
+
+/* Enforces the maximum number of disjuncts, if any */
+static void ap_disjunction_bound(ap_disjunction_internal_t* intern,
+				 ap_disjunction_t* a)
+{
+  if (intern->maxsize==0 || a->size<=intern->maxsize)
+    return;
+  ap_disjunction_elim_subsumed(intern,a);
+  if (a->size>intern->maxsize)
+    ap_disjunction_merge_closest(intern,a,intern->maxsize);
+}
+
 
 /* ============================================================ */
 /* I.1 Memory */
@@ -742,6 +918,7 @@ ap_disjunction_t* ap_disjunction_join(ap_manager_t* manager,
   /*
   ap_disjunction_elim_redundant(intern, res);
   */
+  ap_disjunction_bound(intern,res);
   return res;
 }
 
@@ -800,6 +977,7 @@ ap_disjunction_t* ap_disjunction_join_array(ap_manager_t* manager,
       /*
 	ap_disjunction_elim_redundant(intern, res);
       */
+      ap_disjunction_bound(intern,res);
       return res;
     }
   }
@@ -822,6 +1000,7 @@ ap_disjunction_t* ap_disjunction_meet(ap_manager_t* manager, bool destructive,
   ap_manager_t* man = intern->manager;
   void* (*meet)(ap_manager_t*, ...) = man->funptr[AP_FUNID_MEET];
   void* (*is_bottom)(ap_manager_t*, ...) = man->funptr[AP_FUNID_IS_BOTTOM];
+  void (*absfree)(ap_manager_t*, ...) = man->funptr[AP_FUNID_FREE];
 
   ap_disjunction_elim_redundant(intern, a1);
   ap_disjunction_elim_redundant(intern, a2);
@@ -836,6 +1015,8 @@ ap_disjunction_t* ap_disjunction_meet(ap_manager_t* manager, bool destructive,
 	res->p[k] = res1;
 	k++;
       }
+      else
+	absfree(man,res1);
     }
   }
   if (k==0){
@@ -847,6 +1028,7 @@ ap_disjunction_t* ap_disjunction_meet(ap_manager_t* manager, bool destructive,
   else {
     res->size = k;
     ap_disjunction_elim_redundant(intern, res);
+    ap_disjunction_bound(intern, res);
   }
   if (destructive){
     ap_disjunction_free(manager,a1);
@@ -1213,8 +1395,14 @@ void ap_disjunction_internal_free(void* p)
 {
   ap_disjunction_internal_t* intern = (ap_disjunction_internal_t*) p;
 
+  size_t i;
+
   ap_manager_free(intern->manager);
   intern->manager = NULL;
+  for (i=0; i<intern->nbworkers; i++){
+    ap_manager_free(intern->workers[i]);
+  }
+  free(intern->workers);
   free(intern->library);
   free(intern);
 }
@@ -1233,6 +1421,9 @@ ap_manager_t* ap_disjunction_manager_alloc(
   internal = malloc(sizeof(ap_disjunction_internal_t));
   internal->manager = ap_manager_copy(underlying);
   internal->merge = merge;
+  internal->maxsize = 0;
+  internal->workers = NULL;
+  internal->nbworkers = 0;
 
   internal->library = malloc(20+strlen(underlying->library));
   sprintf(internal->library,"disjunction of %s",underlying->library);
@@ -1332,6 +1523,29 @@ ap_manager_t* ap_disjunction_manager_alloc(
   return man;
 }
 
+void ap_disjunction_set_maxsize(ap_manager_t* manager, size_t maxsize)
+{
+  ap_disjunction_internal_t* intern = get_internal(manager);
+  intern->maxsize = maxsize;
+}
+
+void ap_disjunction_set_workers(ap_manager_t* manager,
+				ap_manager_t** tab, size_t size)
+{
+  ap_disjunction_internal_t* intern = get_internal(manager);
+  size_t i;
+
+  for (i=0; i<intern->nbworkers; i++){
+    ap_manager_free(intern->workers[i]);
+  }
+  free(intern->workers);
+  intern->workers = size>0 ? malloc(size*sizeof(ap_manager_t*)) : NULL;
+  for (i=0; i<size; i++){
+    intern->workers[i] = ap_manager_copy(tab[i]);
+  }
+  intern->nbworkers = size;
+}
+
 /* ============================================================ */
 /* V. Extra functions */
 /* ============================================================ */
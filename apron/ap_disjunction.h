@@ -29,6 +29,10 @@ typedef struct ap_disjunction_internal_t {
 						      NULL */
   char* library;               /* (constructed) library name  */
   ap_manager_t* manager;   /* Manager of the base domain */
+  size_t maxsize;          /* maximum number of disjuncts, 0 if unbounded */
+  ap_manager_t** workers;  /* additional managers of the base domain,
+			      used concurrently with manager */
+  size_t nbworkers;        /* size of workers */
 } ap_disjunction_internal_t;
 
 /* ============================================================ */
@@ -42,6 +46,21 @@ ap_manager_t* ap_disjunction_manager_alloc
     /* merge function */
 );
 
+void ap_disjunction_set_maxsize(ap_manager_t* manager, size_t maxsize);
+  /* Bound the number of disjuncts produced by join, join_array and meet
+     (0, the default, means unbounded).
+
+     When the bound is exceeded, the disjuncts included in another one are
+     first removed; then the two disjuncts with the closest bounding boxes
+     are repeatedly joined until the bound is met. */
+
+void ap_disjunction_set_workers(ap_manager_t* manager,
+				ap_manager_t** tab, size_t size);
+  /* Give size managers of the base domain, distinct from the one of the
+     disjunctive manager and from each other, so that inclusion tests
+     between disjuncts are run in size+1 threads. size==0 restores the
+     sequential behaviour. */
+
 /* ============================================================ */
 /* V. Extra functions */
 /* ============================================================ */
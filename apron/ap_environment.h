@@ -32,6 +32,12 @@ extern "C" {
    - environment_copy increments the counter and return its argument
    - environment_free decrements it and free the environment
      in case of zero or negative number.
+
+   The counter is updated atomically (see ap_refcount_incr in ap_config.h),
+   and an environment is never modified after its creation: an environment
+   can be shared by several threads, which can query, copy and free it, and
+   use it as an argument of the functions creating new environments, without
+   synchronization.
 */
 
 typedef struct ap_environment_t {
@@ -242,14 +248,12 @@ ap_var_t ap_environment_var_of_dim(ap_environment_t* env, ap_dim_t dim){
 }
 static inline
 void ap_environment_free(ap_environment_t* env){
-  if (env->count<=1)
+  if (ap_refcount_decr(&env->count)==0)
     ap_environment_free2(env);
-  else
-    env->count--;
 }
 static inline
 ap_environment_t* ap_environment_copy(ap_environment_t* env){
-  env->count++;
+  ap_refcount_incr(&env->count);
   return env;
 }
 #ifdef __cplusplus
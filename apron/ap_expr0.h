@@ -10,6 +10,8 @@
 
 #include "ap_linexpr0.h"
 #include "ap_lincons0.h"
+#include "ap_linpack0.h"
+#include "ap_arena.h"
 #include "ap_generator0.h"
 #include "ap_texpr0.h"
 #include "ap_tcons0.h"
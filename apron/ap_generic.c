@@ -200,6 +200,19 @@ ap_generic_meet_intlinearize_tcons_array(ap_manager_t* man,
   if (is_bottom(man,abs) || array->size==0){
     res = destructive ? abs : copy(man,abs);
   }
+  else if (discr==AP_SCALAR_DOUBLE){
+    /* the linearized constraints are transient: allocate them in an arena */
+    ap_arena_t arena;
+    ap_arena_init(&arena,0);
+    a0.value = abs;
+    a0.man = man;
+    array2 = ap_intlinearize_tcons0_array_arena(man,&a0,array,&exact,&arena,linearize,true,true,2,false);
+    res = meet_lincons_array(man,destructive,abs,&array2);
+    if (!exact){
+      man->result.flag_exact = man->result.flag_best = false;
+    }
+    ap_arena_clear(&arena);
+  }
   else {
     a0.value = abs;
     a0.man = man;
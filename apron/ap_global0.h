@@ -15,10 +15,13 @@
 #include "ap_dimension.h"
 #include "ap_linexpr0.h"
 #include "ap_lincons0.h"
+#include "ap_linpack0.h"
+#include "ap_arena.h"
 #include "ap_generator0.h"
 #include "ap_texpr0.h"
 #include "ap_tcons0.h"
 #include "ap_manager.h"
 #include "ap_abstract0.h"
+#include "ap_trace.h"
 
 #endif
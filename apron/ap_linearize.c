@@ -305,3 +305,14 @@ ap_lincons0_array_t ap_intlinearize_tcons0_array(ap_manager_t* man,
     return ap_lincons0_array_make(0);
   }
 }
+
+ap_lincons0_array_t ap_intlinearize_tcons0_array_arena(ap_manager_t* man,
+						       ap_abstract0_t* abs,
+						       ap_tcons0_array_t* array,
+						       bool* pexact,
+						       ap_arena_t* arena,
+						       ap_linexpr_type_t linearize, bool meet,
+						       bool boxize, size_t kmax, bool intervalonly)
+{
+  return ap_intlinearize_tcons0_array_arena_D(man,abs,array,pexact,arena,linearize,meet,boxize,kmax,intervalonly);
+}
@@ -154,6 +154,17 @@ ap_lincons0_array_t ap_intlinearize_tcons0_array(ap_manager_t* man,
 						 ap_linexpr_type_t type, bool meet,
 						 bool boxize, size_t kmax, bool intervalonly);
 
+ap_lincons0_array_t ap_intlinearize_tcons0_array_arena(ap_manager_t* man,
+						       ap_abstract0_t* abs,
+						       ap_tcons0_array_t* array,
+						       bool* pexact,
+						       ap_arena_t* arena,
+						       ap_linexpr_type_t type, bool meet,
+						       bool boxize, size_t kmax, bool intervalonly);
+  /* Same as ap_intlinearize_tcons0_array with discr==AP_SCALAR_DOUBLE, but
+     the resulting constraints are allocated in arena (see ap_arena.h): they
+     are released with the arena, and should not be cleared. */
+
 #ifdef __cplusplus
 }
 #endif
@@ -414,27 +414,23 @@ ITVFUN(ap_intlinearize_tcons0)(ap_manager_t* man,
   return res;
 }
 
-ap_lincons0_array_t
-ITVFUN(ap_intlinearize_tcons0_array)(ap_manager_t* man,
-				     ap_abstract0_t* abs, ap_tcons0_array_t* array,
-				     bool* pexact, 
-				     ap_linexpr_type_t linearize, bool meet,
-				     bool boxize, size_t kmax, bool intervalonly)
+/* Compute in *ptlincons the linearization of array, common part of
+   ap_intlinearize_tcons0_array and ap_intlinearize_tcons0_array_arena */
+static
+void intlinearize_tcons0_array(itv_internal_t* intern,
+			       itv_lincons_array_t* ptlincons,
+			       ap_tcons0_array_t* array,
+			       itv_t* env, ap_dimension_t dim,
+			       ap_linexpr_type_t linearize, bool meet,
+			       bool boxize, size_t kmax, bool intervalonly)
 {
-  itv_internal_t intern;
-  ap_dimension_t dim = {0,0};
-  itv_t* env = NULL;
   itv_lincons_array_t tlincons;
-  ap_lincons0_array_t res;
   size_t i;
   bool change = false;
   bool* tchange = NULL;
 
-  if (pexact) *pexact = false;
-  itv_internal_init(&intern);
-  intlinearize_alloc(man,abs,&intern,&env,&dim);
   itv_lincons_array_init(&tlincons,array->size);
-  itv_intlinearize_ap_tcons0_array(&intern,&tlincons,
+  itv_intlinearize_ap_tcons0_array(intern,&tlincons,
 				   array,env, dim.intdim);
   if (tlincons.size==1 && 
       tlincons.p[0].linexpr.size==0)
@@ -443,26 +439,26 @@ ITVFUN(ap_intlinearize_tcons0_array)(ap_manager_t* man,
       (intervalonly ? !itv_lincons_array_is_quasilinear(&tlincons) : true)){
     tchange = malloc((dim.intdim+dim.realdim)*2);
     for (i=0;i<(dim.intdim+dim.realdim)*2;i++) tchange[i]=false;
-    change = itv_boxize_lincons_array(&intern,env,tchange,&tlincons,env,dim.intdim,kmax,intervalonly);
+    change = itv_boxize_lincons_array(intern,env,tchange,&tlincons,env,dim.intdim,kmax,intervalonly);
   }
   switch(linearize){
   case AP_LINEXPR_INTLINEAR:
     break;
   case AP_LINEXPR_QUASILINEAR:
-    itv_quasilinearize_lincons_array(&intern,&tlincons,env,meet);
+    itv_quasilinearize_lincons_array(intern,&tlincons,env,meet);
     break;
   case AP_LINEXPR_LINEAR:
-    itv_quasilinearize_lincons_array(&intern,&tlincons,env,meet);
-    itv_linearize_lincons_array(&intern,&tlincons,meet);
+    itv_quasilinearize_lincons_array(intern,&tlincons,env,meet);
+    itv_linearize_lincons_array(intern,&tlincons,meet);
     break;
   }
   if (tlincons.size==1 && 
       tlincons.p[0].linexpr.size==0 &&
-      itv_eval_cstlincons(&intern,&tlincons.p[0])==tbool_false)
+      itv_eval_cstlincons(intern,&tlincons.p[0])==tbool_false)
     goto ap_intlinearize_tcons0_array_exit;
   
   if (change){
-    if (itv_is_bottom(&intern,env[0])){
+    if (itv_is_bottom(intern,env[0])){
       itv_lincons_array_reinit(&tlincons,1);
       itv_lincons_set_bool(&tlincons.p[0],false);
       goto ap_intlinearize_tcons0_array_exit;
@@ -478,7 +474,7 @@ ITVFUN(ap_intlinearize_tcons0_array)(ap_manager_t* man,
 	tlincons.p[size].linexpr.linterm[0].equality = true;
 	tlincons.p[size].linexpr.equality = true;
       }	
-      if ((tchange[2*i] || tchange[2*i+1]) && itv_is_point(&intern,env[i])){
+      if ((tchange[2*i] || tchange[2*i+1]) && itv_is_point(intern,env[i])){
 	/* We have a point */
 	tlincons.p[size].constyp = AP_CONS_EQ;
 	itv_set_int(tlincons.p[size].linexpr.linterm[0].itv,-1);
@@ -516,12 +512,117 @@ ITVFUN(ap_intlinearize_tcons0_array)(ap_manager_t* man,
     itv_lincons_array_reinit(&tlincons,size);
   }
  ap_intlinearize_tcons0_array_exit:
+  if (tchange) free(tchange);
+  *ptlincons = tlincons;
+}
+
+ap_lincons0_array_t
+ITVFUN(ap_intlinearize_tcons0_array)(ap_manager_t* man,
+				     ap_abstract0_t* abs, ap_tcons0_array_t* array,
+				     bool* pexact, 
+				     ap_linexpr_type_t linearize, bool meet,
+				     bool boxize, size_t kmax, bool intervalonly)
+{
+  itv_internal_t intern;
+  ap_dimension_t dim = {0,0};
+  itv_t* env = NULL;
+  itv_lincons_array_t tlincons;
+  ap_lincons0_array_t res;
+  size_t i;
+
+  if (pexact) *pexact = false;
+  itv_internal_init(&intern);
+  intlinearize_alloc(man,abs,&intern,&env,&dim);
+  intlinearize_tcons0_array(&intern,&tlincons,array,env,dim,
+			    linearize,meet,boxize,kmax,intervalonly);
   res = ap_lincons0_array_make(tlincons.size);
   for (i=0;i<tlincons.size;i++){
     ap_lincons0_set_itv_lincons(&intern,&res.p[i],&tlincons.p[i]);
   }
-  if (tchange) free(tchange);
   itv_lincons_array_clear(&tlincons);
   intlinearize_free(&intern,env,dim);
   return res;
 }
+
+#if defined(NUM_DOUBLE)
+/* Conversions to objects of an arena. With NUM_DOUBLE, bounds are doubles,
+   so that they are exact and do not change the type of the scalars. */
+static
+void ap_coeff_set_itv_arena(itv_internal_t* intern, ap_arena_t* arena,
+			    ap_coeff_t* coeff, itv_t itv)
+{
+  if (itv_is_point(intern,itv)){
+    ap_arena_coeff_init(arena,coeff,AP_COEFF_SCALAR);
+    ap_scalar_set_bound(coeff->val.scalar,itv->sup);
+  }
+  else {
+    ap_arena_coeff_init(arena,coeff,AP_COEFF_INTERVAL);
+    ap_interval_set_itv(intern,coeff->val.interval,itv);
+  }
+}
+static
+void ap_lincons0_set_itv_lincons_arena(itv_internal_t* intern,
+				       ap_arena_t* arena,
+				       ap_lincons0_t* plincons0,
+				       itv_lincons_t* lincons)
+{
+  itv_linexpr_t* linexpr = &lincons->linexpr;
+  ap_linexpr0_t* linexpr0;
+  size_t i,k;
+  ap_dim_t dim;
+  bool* peq;
+  itv_ptr pitv;
+
+  linexpr0 = (ap_linexpr0_t*)ap_arena_malloc(arena,sizeof(ap_linexpr0_t));
+  linexpr0->discr = AP_LINEXPR_SPARSE;
+  linexpr0->size = 0;
+  itv_linexpr_ForeachLinterm(linexpr,i,dim,pitv,peq){
+    linexpr0->size++;
+  }
+  linexpr0->p.linterm = linexpr0->size==0 ? NULL :
+    (ap_linterm_t*)ap_arena_malloc(arena,linexpr0->size*sizeof(ap_linterm_t));
+  ap_coeff_set_itv_arena(intern,arena,&linexpr0->cst,linexpr->cst);
+  k = 0;
+  itv_linexpr_ForeachLinterm(linexpr,i,dim,pitv,peq){
+    linexpr0->p.linterm[k].dim = dim;
+    ap_coeff_set_itv_arena(intern,arena,&linexpr0->p.linterm[k].coeff,pitv);
+    k++;
+  }
+  plincons0->linexpr0 = linexpr0;
+  plincons0->constyp = lincons->constyp;
+  if (num_sgn(lincons->num)){
+    plincons0->scalar = ap_arena_scalar_alloc(arena);
+    ap_scalar_set_num(plincons0->scalar,lincons->num);
+  }
+  else
+    plincons0->scalar = NULL;
+}
+
+ap_lincons0_array_t
+ITVFUN(ap_intlinearize_tcons0_array_arena)(ap_manager_t* man,
+					   ap_abstract0_t* abs, ap_tcons0_array_t* array,
+					   bool* pexact, ap_arena_t* arena,
+					   ap_linexpr_type_t linearize, bool meet,
+					   bool boxize, size_t kmax, bool intervalonly)
+{
+  itv_internal_t intern;
+  ap_dimension_t dim = {0,0};
+  itv_t* env = NULL;
+  itv_lincons_array_t tlincons;
+  ap_lincons0_array_t res;
+  size_t i;
+
+  if (pexact) *pexact = false;
+  itv_internal_init(&intern);
+  intlinearize_alloc(man,abs,&intern,&env,&dim);
+  intlinearize_tcons0_array(&intern,&tlincons,array,env,dim,
+			    linearize,meet,boxize,kmax,intervalonly);
+  res = ap_arena_lincons0_array_make(arena,tlincons.size);
+  for (i=0;i<tlincons.size;i++){
+    ap_lincons0_set_itv_lincons_arena(&intern,arena,&res.p[i],&tlincons.p[i]);
+  }
+  itv_lincons_array_clear(&tlincons);
+  intlinearize_free(&intern,env,dim);
+  return res;
+}
+#endif
@@ -106,6 +106,15 @@ ITVFUN(ap_intlinearize_tcons0_array)(ap_manager_t* man,
 				     ap_linexpr_type_t linearize, bool meet,
 				     bool boxize, size_t kmax, bool intervalonly);
 
+#if defined(NUM_DOUBLE)
+ap_lincons0_array_t
+ITVFUN(ap_intlinearize_tcons0_array_arena)(ap_manager_t* man,
+					   ap_abstract0_t* abs, ap_tcons0_array_t* array,
+					   bool* pexact, ap_arena_t* arena,
+					   ap_linexpr_type_t linearize, bool meet,
+					   bool boxize, size_t kmax, bool intervalonly);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
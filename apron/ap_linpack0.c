@@ -0,0 +1,506 @@
+/* ************************************************************************* */
+/* ap_linpack0.c: packed arrays of linear expressions and constraints */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "ap_linpack0.h"
+
+/* ********************************************************************** */
+/* 0. Arena layout and numeric slots */
+/* ********************************************************************** */
+
+static inline size_t ap_linpack0_align(size_t n)
+{ return (n+7) & ~(size_t)7; }
+
+static inline size_t ap_linpack0_slotsize(ap_scalar_discr_t discr)
+{ return discr==AP_SCALAR_DOUBLE ? sizeof(double) : sizeof(__mpq_struct); }
+
+/* Size of the arena, and if arena!=NULL, set the pointers of pack into it */
+static size_t ap_linpack0_layout(ap_linpack0_t* pack, char* arena,
+				 size_t maxsize, size_t maxterms)
+{
+  size_t s = ap_linpack0_slotsize(pack->discr);
+  size_t offset = 0;
+
+#define AP_LINPACK0_SECTION(field,size)		\
+  if (arena) field = (void*)(arena+offset);		\
+  offset += ap_linpack0_align(size);
+
+  AP_LINPACK0_SECTION(pack->cst.dbl,2*maxsize*s);
+  AP_LINPACK0_SECTION(pack->coeff.dbl,2*maxterms*s);
+  AP_LINPACK0_SECTION(pack->modulo.dbl,maxsize*s);
+  AP_LINPACK0_SECTION(pack->start,(maxsize+1)*sizeof(size_t));
+  AP_LINPACK0_SECTION(pack->dim,maxterms*sizeof(ap_dim_t));
+  AP_LINPACK0_SECTION(pack->constyp,maxsize*sizeof(ap_constyp_t));
+  AP_LINPACK0_SECTION(pack->cstkind,maxsize);
+  AP_LINPACK0_SECTION(pack->kind,maxterms);
+#undef AP_LINPACK0_SECTION
+  return offset;
+}
+
+static void ap_linpack0_val_init(ap_scalar_discr_t discr,
+				 ap_linpack0_val_t val, size_t first, size_t last)
+{
+  size_t i;
+  if (discr==AP_SCALAR_MPQ){
+    for (i=first; i<last; i++) mpq_init(&val.mpq[i]);
+  }
+}
+static void ap_linpack0_val_clear(ap_scalar_discr_t discr,
+				  ap_linpack0_val_t val, size_t size)
+{
+  size_t i;
+  if (discr==AP_SCALAR_MPQ){
+    for (i=0; i<size; i++) mpq_clear(&val.mpq[i]);
+  }
+}
+
+static inline void ap_linpack0_slot_set_double(ap_linpack0_t* pack,
+					       ap_linpack0_val_t val, size_t i,
+					       double k)
+{
+  if (pack->discr==AP_SCALAR_DOUBLE)
+    val.dbl[i] = k;
+  else if (isinf(k)){
+    mpz_set_si(mpq_numref(&val.mpq[i]), k>0 ? 1 : -1);
+    mpz_set_ui(mpq_denref(&val.mpq[i]), 0);
+  }
+  else
+    mpq_set_d(&val.mpq[i],k);
+}
+
+/* Store the scalar in slot i, rounding in the given direction if needed.
+   Return true if exact. */
+static bool ap_linpack0_slot_set_scalar(ap_linpack0_t* pack,
+					ap_linpack0_val_t val, size_t i,
+					ap_scalar_t* scalar, mp_rnd_t round)
+{
+  int sgn = ap_scalar_infty(scalar);
+  if (pack->discr==AP_SCALAR_DOUBLE){
+    if (sgn){
+      val.dbl[i] = sgn>0 ? INFINITY : -INFINITY;
+      return true;
+    }
+    return ap_double_set_scalar(&val.dbl[i],scalar,round)==0;
+  }
+  else {
+    if (sgn){
+      mpz_set_si(mpq_numref(&val.mpq[i]), sgn);
+      mpz_set_ui(mpq_denref(&val.mpq[i]), 0);
+      return true;
+    }
+    return ap_mpq_set_scalar(&val.mpq[i],scalar,round)==0;
+  }
+}
+
+/* Store the coefficient in slots 2k and 2k+1. Return true if exact. */
+static bool ap_linpack0_slots_set_coeff(ap_linpack0_t* pack,
+					ap_linpack0_val_t val, unsigned char* pkind,
+					size_t k, ap_coeff_t* coeff)
+{
+  bool exact1,exact2;
+  switch (coeff->discr){
+  case AP_COEFF_SCALAR:
+    exact1 = ap_linpack0_slot_set_scalar(pack,val,2*k,coeff->val.scalar,GMP_RNDD);
+    if (exact1){
+      *pkind = AP_COEFF_SCALAR;
+      if (pack->discr==AP_SCALAR_DOUBLE)
+	val.dbl[2*k+1] = val.dbl[2*k];
+      else
+	mpq_set(&val.mpq[2*k+1],&val.mpq[2*k]);
+      return true;
+    }
+    else {
+      *pkind = AP_COEFF_INTERVAL;
+      ap_linpack0_slot_set_scalar(pack,val,2*k+1,coeff->val.scalar,GMP_RNDU);
+      return false;
+    }
+  case AP_COEFF_INTERVAL:
+    *pkind = AP_COEFF_INTERVAL;
+    exact1 = ap_linpack0_slot_set_scalar(pack,val,2*k,coeff->val.interval->inf,GMP_RNDD);
+    exact2 = ap_linpack0_slot_set_scalar(pack,val,2*k+1,coeff->val.interval->sup,GMP_RNDU);
+    return exact1 && exact2;
+  default:
+    abort();
+  }
+}
+
+static void ap_linpack0_slots_get_coeff(ap_coeff_t* coeff, ap_linpack0_t* pack,
+					ap_linpack0_val_t val, unsigned char kind,
+					size_t k)
+{
+  if (pack->discr==AP_SCALAR_DOUBLE){
+    if (kind==AP_COEFF_SCALAR)
+      ap_coeff_set_scalar_double(coeff,val.dbl[2*k]);
+    else
+      ap_coeff_set_interval_double(coeff,val.dbl[2*k],val.dbl[2*k+1]);
+  }
+  else {
+    if (kind==AP_COEFF_SCALAR)
+      ap_coeff_set_scalar_mpq(coeff,&val.mpq[2*k]);
+    else
+      ap_coeff_set_interval_mpq(coeff,&val.mpq[2*k],&val.mpq[2*k+1]);
+  }
+}
+
+/* ********************************************************************** */
+/* I. Memory management and printing */
+/* ********************************************************************** */
+
+ap_linpack0_t* ap_linpack0_alloc(ap_scalar_discr_t discr,
+				 size_t maxsize, size_t maxterms)
+{
+  ap_linpack0_t* pack;
+
+  assert(discr==AP_SCALAR_DOUBLE || discr==AP_SCALAR_MPQ);
+  pack = (ap_linpack0_t*)malloc(sizeof(ap_linpack0_t));
+  pack->discr = discr;
+  pack->size = 0;
+  pack->nbterms = 0;
+  pack->maxsize = maxsize;
+  pack->maxterms = maxterms;
+  pack->arena = malloc(ap_linpack0_layout(pack,NULL,maxsize,maxterms));
+  ap_linpack0_layout(pack,pack->arena,maxsize,maxterms);
+  ap_linpack0_val_init(discr,pack->cst,0,2*maxsize);
+  ap_linpack0_val_init(discr,pack->coeff,0,2*maxterms);
+  ap_linpack0_val_init(discr,pack->modulo,0,maxsize);
+  pack->start[0] = 0;
+  return pack;
+}
+
+void ap_linpack0_reserve(ap_linpack0_t* pack, size_t maxsize, size_t maxterms)
+{
+  ap_linpack0_t old;
+  size_t s;
+
+  if (maxsize<=pack->maxsize && maxterms<=pack->maxterms)
+    return;
+  if (maxsize<pack->maxsize) maxsize = pack->maxsize;
+  if (maxterms<pack->maxterms) maxterms = pack->maxterms;
+
+  old = *pack;
+  s = ap_linpack0_slotsize(pack->discr);
+  pack->maxsize = maxsize;
+  pack->maxterms = maxterms;
+  pack->arena = malloc(ap_linpack0_layout(pack,NULL,maxsize,maxterms));
+  ap_linpack0_layout(pack,pack->arena,maxsize,maxterms);
+  /* mpq_t objects are moved bitwise, and new slots are initialized */
+  memcpy(pack->cst.dbl,old.cst.dbl,2*old.maxsize*s);
+  memcpy(pack->coeff.dbl,old.coeff.dbl,2*old.maxterms*s);
+  memcpy(pack->modulo.dbl,old.modulo.dbl,old.maxsize*s);
+  ap_linpack0_val_init(pack->discr,pack->cst,2*old.maxsize,2*maxsize);
+  ap_linpack0_val_init(pack->discr,pack->coeff,2*old.maxterms,2*maxterms);
+  ap_linpack0_val_init(pack->discr,pack->modulo,old.maxsize,maxsize);
+  memcpy(pack->start,old.start,(old.size+1)*sizeof(size_t));
+  memcpy(pack->dim,old.dim,old.nbterms*sizeof(ap_dim_t));
+  memcpy(pack->constyp,old.constyp,old.size*sizeof(ap_constyp_t));
+  memcpy(pack->cstkind,old.cstkind,old.size);
+  memcpy(pack->kind,old.kind,old.nbterms);
+  free(old.arena);
+}
+
+void ap_linpack0_reset(ap_linpack0_t* pack)
+{
+  pack->size = 0;
+  pack->nbterms = 0;
+  pack->start[0] = 0;
+}
+
+void ap_linpack0_free(ap_linpack0_t* pack)
+{
+  ap_linpack0_val_clear(pack->discr,pack->cst,2*pack->maxsize);
+  ap_linpack0_val_clear(pack->discr,pack->coeff,2*pack->maxterms);
+  ap_linpack0_val_clear(pack->discr,pack->modulo,pack->maxsize);
+  free(pack->arena);
+  free(pack);
+}
+
+ap_linpack0_t* ap_linpack0_copy(ap_linpack0_t* pack)
+{
+  ap_linpack0_t* res;
+  size_t i;
+
+  res = ap_linpack0_alloc(pack->discr,pack->size,pack->nbterms);
+  res->size = pack->size;
+  res->nbterms = pack->nbterms;
+  if (pack->discr==AP_SCALAR_DOUBLE){
+    memcpy(res->cst.dbl,pack->cst.dbl,2*pack->size*sizeof(double));
+    memcpy(res->coeff.dbl,pack->coeff.dbl,2*pack->nbterms*sizeof(double));
+    memcpy(res->modulo.dbl,pack->modulo.dbl,pack->size*sizeof(double));
+  }
+  else {
+    for (i=0; i<2*pack->size; i++) mpq_set(&res->cst.mpq[i],&pack->cst.mpq[i]);
+    for (i=0; i<2*pack->nbterms; i++) mpq_set(&res->coeff.mpq[i],&pack->coeff.mpq[i]);
+    for (i=0; i<pack->size; i++) mpq_set(&res->modulo.mpq[i],&pack->modulo.mpq[i]);
+  }
+  memcpy(res->start,pack->start,(pack->size+1)*sizeof(size_t));
+  memcpy(res->dim,pack->dim,pack->nbterms*sizeof(ap_dim_t));
+  memcpy(res->constyp,pack->constyp,pack->size*sizeof(ap_constyp_t));
+  memcpy(res->cstkind,pack->cstkind,pack->size);
+  memcpy(res->kind,pack->kind,pack->nbterms);
+  return res;
+}
+
+void ap_linpack0_print(ap_linpack0_t* pack, char** name_of_dim)
+{ ap_linpack0_fprint(stdout,pack,name_of_dim); }
+void ap_linpack0_fprint(FILE* stream, ap_linpack0_t* pack, char** name_of_dim)
+{
+  size_t i;
+  ap_lincons0_t cons;
+
+  if (pack->size==0){
+    fprintf(stream,"empty pack of linear constraints\n");
+    return;
+  }
+  fprintf(stream,"pack of linear constraints of size %lu\n",
+	  (unsigned long)pack->size);
+  for (i=0; i<pack->size; i++){
+    fprintf(stream,"%2lu: ",(unsigned long)i);
+    cons = ap_linpack0_get_lincons0(pack,i);
+    ap_lincons0_fprint(stream,&cons,name_of_dim);
+    ap_lincons0_clear(&cons);
+    fprintf(stream,"\n");
+  }
+}
+
+/* ********************************************************************** */
+/* II. Building rows */
+/* ********************************************************************** */
+
+size_t ap_linpack0_add_row(ap_linpack0_t* pack, ap_constyp_t constyp)
+{
+  size_t row = pack->size;
+  if (row==pack->maxsize)
+    ap_linpack0_reserve(pack, pack->maxsize ? 2*pack->maxsize : 4, pack->maxterms);
+  pack->constyp[row] = constyp;
+  pack->cstkind[row] = AP_COEFF_SCALAR;
+  ap_linpack0_slot_set_double(pack,pack->cst,2*row,0.0);
+  ap_linpack0_slot_set_double(pack,pack->cst,2*row+1,0.0);
+  ap_linpack0_slot_set_double(pack,pack->modulo,row,0.0);
+  pack->start[row+1] = pack->nbterms;
+  pack->size++;
+  return row;
+}
+
+/* Append an uninitialized linear term to the last row, return its index */
+static size_t ap_linpack0_push_term(ap_linpack0_t* pack, ap_dim_t dim)
+{
+  size_t term = pack->nbterms;
+  assert(pack->size>0);
+  assert(dim!=AP_DIM_MAX);
+  assert(term==pack->start[pack->size-1] || pack->dim[term-1]<dim);
+  if (term==pack->maxterms)
+    ap_linpack0_reserve(pack, pack->maxsize, pack->maxterms ? 2*pack->maxterms : 8);
+  pack->dim[term] = dim;
+  pack->nbterms++;
+  pack->start[pack->size] = pack->nbterms;
+  return term;
+}
+
+void ap_linpack0_set_cst_scalar_double(ap_linpack0_t* pack, double num)
+{
+  size_t row = pack->size-1;
+  pack->cstkind[row] = AP_COEFF_SCALAR;
+  ap_linpack0_slot_set_double(pack,pack->cst,2*row,num);
+  ap_linpack0_slot_set_double(pack,pack->cst,2*row+1,num);
+}
+void ap_linpack0_set_cst_interval_double(ap_linpack0_t* pack, double inf, double sup)
+{
+  size_t row = pack->size-1;
+  pack->cstkind[row] = AP_COEFF_INTERVAL;
+  ap_linpack0_slot_set_double(pack,pack->cst,2*row,inf);
+  ap_linpack0_slot_set_double(pack,pack->cst,2*row+1,sup);
+}
+void ap_linpack0_add_term_scalar_double(ap_linpack0_t* pack, ap_dim_t dim, double num)
+{
+  size_t term = ap_linpack0_push_term(pack,dim);
+  pack->kind[term] = AP_COEFF_SCALAR;
+  ap_linpack0_slot_set_double(pack,pack->coeff,2*term,num);
+  ap_linpack0_slot_set_double(pack,pack->coeff,2*term+1,num);
+}
+void ap_linpack0_add_term_interval_double(ap_linpack0_t* pack, ap_dim_t dim, double inf, double sup)
+{
+  size_t term = ap_linpack0_push_term(pack,dim);
+  pack->kind[term] = AP_COEFF_INTERVAL;
+  ap_linpack0_slot_set_double(pack,pack->coeff,2*term,inf);
+  ap_linpack0_slot_set_double(pack,pack->coeff,2*term+1,sup);
+}
+
+bool ap_linpack0_set_cst(ap_linpack0_t* pack, ap_coeff_t* coeff)
+{
+  size_t row = pack->size-1;
+  return ap_linpack0_slots_set_coeff(pack,pack->cst,&pack->cstkind[row],row,coeff);
+}
+bool ap_linpack0_add_term(ap_linpack0_t* pack, ap_dim_t dim, ap_coeff_t* coeff)
+{
+  size_t term = ap_linpack0_push_term(pack,dim);
+  return ap_linpack0_slots_set_coeff(pack,pack->coeff,&pack->kind[term],term,coeff);
+}
+
+bool ap_linpack0_set_modulo(ap_linpack0_t* pack, ap_scalar_t* scalar)
+{
+  size_t row = pack->size-1;
+  return ap_linpack0_slot_set_scalar(pack,pack->modulo,row,scalar,GMP_RNDN);
+}
+
+/* ********************************************************************** */
+/* III. Access and tests */
+/* ********************************************************************** */
+
+void ap_linpack0_get_cst(ap_coeff_t* coeff, ap_linpack0_t* pack, size_t row)
+{
+  assert(row<pack->size);
+  ap_linpack0_slots_get_coeff(coeff,pack,pack->cst,pack->cstkind[row],row);
+}
+void ap_linpack0_get_term(ap_coeff_t* coeff, ap_linpack0_t* pack, size_t term)
+{
+  assert(term<pack->nbterms);
+  ap_linpack0_slots_get_coeff(coeff,pack,pack->coeff,pack->kind[term],term);
+}
+
+bool ap_linpack0_is_quasilinear(ap_linpack0_t* pack)
+{
+  size_t i;
+  for (i=0; i<pack->nbterms; i++){
+    if (pack->kind[i]!=AP_COEFF_SCALAR) return false;
+  }
+  return true;
+}
+bool ap_linpack0_is_linear(ap_linpack0_t* pack)
+{
+  size_t i;
+  for (i=0; i<pack->size; i++){
+    if (pack->cstkind[i]!=AP_COEFF_SCALAR) return false;
+  }
+  return ap_linpack0_is_quasilinear(pack);
+}
+
+/* ********************************************************************** */
+/* IV. Conversions */
+/* ********************************************************************** */
+
+static size_t ap_linpack0_count_terms(ap_linexpr0_t* expr)
+{
+  size_t i,n;
+  ap_dim_t dim;
+  ap_coeff_t* coeff;
+
+  n = 0;
+  ap_linexpr0_ForeachLinterm(expr,i,dim,coeff){
+    if (!ap_coeff_zero(coeff)) n++;
+  }
+  return n;
+}
+
+static void ap_linpack0_add_linexpr0(ap_linpack0_t* pack, ap_linexpr0_t* expr)
+{
+  size_t i;
+  ap_dim_t dim;
+  ap_coeff_t* coeff;
+
+  ap_linpack0_set_cst(pack,&expr->cst);
+  ap_linexpr0_ForeachLinterm(expr,i,dim,coeff){
+    if (!ap_coeff_zero(coeff))
+      ap_linpack0_add_term(pack,dim,coeff);
+  }
+}
+
+ap_linpack0_t* ap_linpack0_of_linexpr0_array(ap_scalar_discr_t discr,
+					     ap_linexpr0_t** texpr, size_t size)
+{
+  ap_linpack0_t* pack;
+  size_t i,nbterms;
+
+  nbterms = 0;
+  for (i=0; i<size; i++){
+    nbterms += ap_linpack0_count_terms(texpr[i]);
+  }
+  pack = ap_linpack0_alloc(discr,size,nbterms);
+  for (i=0; i<size; i++){
+    ap_linpack0_add_row(pack,AP_CONS_EQ);
+    ap_linpack0_add_linexpr0(pack,texpr[i]);
+  }
+  return pack;
+}
+
+ap_linpack0_t* ap_linpack0_of_lincons0_array(ap_scalar_discr_t discr,
+					     ap_lincons0_array_t* array)
+{
+  ap_linpack0_t* pack;
+  size_t i,nbterms;
+
+  nbterms = 0;
+  for (i=0; i<array->size; i++){
+    nbterms += ap_linpack0_count_terms(array->p[i].linexpr0);
+  }
+  pack = ap_linpack0_alloc(discr,array->size,nbterms);
+  for (i=0; i<array->size; i++){
+    ap_linpack0_add_row(pack,array->p[i].constyp);
+    ap_linpack0_add_linexpr0(pack,array->p[i].linexpr0);
+    if (array->p[i].scalar)
+      ap_linpack0_set_modulo(pack,array->p[i].scalar);
+  }
+  return pack;
+}
+
+ap_linexpr0_t* ap_linpack0_get_linexpr0(ap_linpack0_t* pack, size_t row)
+{
+  ap_linexpr0_t* expr;
+  size_t i,k,size;
+
+  assert(row<pack->size);
+  size = ap_linpack0_row_size(pack,row);
+  expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,size);
+  ap_linpack0_get_cst(&expr->cst,pack,row);
+  for (i=0, k=pack->start[row]; i<size; i++, k++){
+    expr->p.linterm[i].dim = pack->dim[k];
+    ap_linpack0_get_term(&expr->p.linterm[i].coeff,pack,k);
+  }
+  return expr;
+}
+
+ap_lincons0_t ap_linpack0_get_lincons0(ap_linpack0_t* pack, size_t row)
+{
+  ap_scalar_t* scalar = NULL;
+
+  if (pack->constyp[row]==AP_CONS_EQMOD){
+    scalar = ap_scalar_alloc();
+    if (pack->discr==AP_SCALAR_DOUBLE)
+      ap_scalar_set_double(scalar,pack->modulo.dbl[row]);
+    else
+      ap_scalar_set_mpq(scalar,&pack->modulo.mpq[row]);
+  }
+  return ap_lincons0_make(pack->constyp[row],
+			  ap_linpack0_get_linexpr0(pack,row),
+			  scalar);
+}
+
+ap_linexpr0_t** ap_linexpr0_array_of_linpack0(ap_linpack0_t* pack)
+{
+  ap_linexpr0_t** texpr;
+  size_t i;
+
+  texpr = (ap_linexpr0_t**)malloc(pack->size*sizeof(ap_linexpr0_t*));
+  for (i=0; i<pack->size; i++){
+    texpr[i] = ap_linpack0_get_linexpr0(pack,i);
+  }
+  return texpr;
+}
+
+ap_lincons0_array_t ap_lincons0_array_of_linpack0(ap_linpack0_t* pack)
+{
+  ap_lincons0_array_t array;
+  size_t i;
+
+  array = ap_lincons0_array_make(pack->size);
+  for (i=0; i<pack->size; i++){
+    array.p[i] = ap_linpack0_get_lincons0(pack,i);
+  }
+  return array;
+}
@@ -0,0 +1,182 @@
+/* ************************************************************************* */
+/* ap_linpack0.h: packed arrays of linear expressions and constraints */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* normally included from ap_expr0.h */
+
+#ifndef _AP_LINPACK0_H_
+#define _AP_LINPACK0_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_coeff.h"
+#include "ap_linexpr0.h"
+#include "ap_lincons0.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ====================================================================== */
+/* Datatypes */
+/* ====================================================================== */
+
+/* Numeric payload of a pack: an array of doubles or of mpq_t, depending on
+   the discriminant of the pack.
+
+   Each coefficient occupies two consecutive slots (inf,sup). For a scalar
+   coefficient, the two slots are equal. +oo (resp. -oo) is coded as INFINITY
+   (resp. -INFINITY) for doubles, and as 1/0 (resp. -1/0) for mpq_t, as in
+   ap_scalar_t. */
+typedef union ap_linpack0_val_t {
+  double* dbl;
+  __mpq_struct* mpq;
+} ap_linpack0_val_t;
+
+/* A batch of linear expressions or constraints (a row per expression or
+   constraint), stored in a single contiguous arena.
+
+   Meant to be an abstract datatype ! */
+typedef struct ap_linpack0_t {
+  ap_scalar_discr_t discr;  /* AP_SCALAR_DOUBLE or AP_SCALAR_MPQ */
+  size_t size;              /* number of rows */
+  size_t nbterms;           /* number of linear terms, constants excluded */
+  size_t maxsize;           /* capacity in rows */
+  size_t maxterms;          /* capacity in linear terms */
+
+  size_t* start;            /* maxsize+1 offsets: the linear terms of row i
+			       are start[i],...,start[i+1]-1 */
+  ap_constyp_t* constyp;    /* type of each row, if seen as a constraint */
+  unsigned char* cstkind;   /* ap_coeff_discr_t of each constant */
+  unsigned char* kind;      /* ap_coeff_discr_t of each linear term */
+  ap_dim_t* dim;            /* dimension of each linear term */
+  ap_linpack0_val_t cst;    /* 2*maxsize slots for the constants */
+  ap_linpack0_val_t coeff;  /* 2*maxterms slots for the linear terms */
+  ap_linpack0_val_t modulo; /* maxsize slots, meaningful only for
+			       AP_CONS_EQMOD rows, 0 otherwise */
+  void* arena;              /* single block holding all the above arrays */
+} ap_linpack0_t;
+/* Important invariant:
+   the linear terms of a row are sorted in strictly increasing order
+   wrt their dimension, and none of them is AP_DIM_MAX.
+*/
+
+/* ====================================================================== */
+/* I. Memory management and printing */
+/* ====================================================================== */
+
+ap_linpack0_t* ap_linpack0_alloc(ap_scalar_discr_t discr,
+				 size_t maxsize, size_t maxterms);
+  /* Allocate an empty pack able to hold maxsize rows and maxterms linear
+     terms without reallocation. discr is either AP_SCALAR_DOUBLE or
+     AP_SCALAR_MPQ. */
+
+void ap_linpack0_reserve(ap_linpack0_t* pack, size_t maxsize, size_t maxterms);
+  /* Ensure that the pack can hold maxsize rows and maxterms linear terms.
+     Existing rows are preserved. */
+
+void ap_linpack0_reset(ap_linpack0_t* pack);
+  /* Remove all rows, keeping the arena for reuse */
+
+void ap_linpack0_free(ap_linpack0_t* pack);
+  /* Free the pack */
+
+ap_linpack0_t* ap_linpack0_copy(ap_linpack0_t* pack);
+  /* Duplication */
+
+void ap_linpack0_fprint(FILE* stream, ap_linpack0_t* pack, char** name_of_dim);
+void ap_linpack0_print(ap_linpack0_t* pack, char** name_of_dim);
+  /* Printing, as an array of constraints */
+
+/* ====================================================================== */
+/* II. Building rows */
+/* ====================================================================== */
+
+/* A row is started with ap_linpack0_add_row, which returns its index, and
+   then filled by setting its constant and appending its linear terms in
+   increasing order of dimensions. All the following functions act on the
+   last row of the pack. The pack is grown as needed. */
+
+size_t ap_linpack0_add_row(ap_linpack0_t* pack, ap_constyp_t constyp);
+  /* Start a new row with a null constant and no linear term */
+
+void ap_linpack0_set_cst_scalar_double(ap_linpack0_t* pack, double num);
+void ap_linpack0_set_cst_interval_double(ap_linpack0_t* pack, double inf, double sup);
+void ap_linpack0_add_term_scalar_double(ap_linpack0_t* pack, ap_dim_t dim, double num);
+void ap_linpack0_add_term_interval_double(ap_linpack0_t* pack, ap_dim_t dim, double inf, double sup);
+  /* Set the constant or append a linear term, from doubles */
+
+bool ap_linpack0_set_cst(ap_linpack0_t* pack, ap_coeff_t* coeff);
+bool ap_linpack0_add_term(ap_linpack0_t* pack, ap_dim_t dim, ap_coeff_t* coeff);
+  /* Set the constant or append a linear term, from a coefficient.
+     In a double pack, a scalar that is not exactly representable is stored
+     as the smallest enclosing interval of doubles.
+     Return true if the conversion is exact */
+
+bool ap_linpack0_set_modulo(ap_linpack0_t* pack, ap_scalar_t* scalar);
+  /* Set the modulo of an AP_CONS_EQMOD row.
+     Return true if the conversion is exact */
+
+/* ====================================================================== */
+/* III. Access and tests */
+/* ====================================================================== */
+
+static inline
+size_t ap_linpack0_size(ap_linpack0_t* pack);
+  /* Number of rows */
+
+static inline
+size_t ap_linpack0_row_size(ap_linpack0_t* pack, size_t row);
+  /* Number of linear terms of the row */
+
+void ap_linpack0_get_cst(ap_coeff_t* coeff, ap_linpack0_t* pack, size_t row);
+  /* Assign coeff with the constant of the row */
+void ap_linpack0_get_term(ap_coeff_t* coeff, ap_linpack0_t* pack, size_t term);
+  /* Assign coeff with the coefficient of the linear term of absolute index
+     term, which belongs to [start[row],start[row+1]) */
+
+bool ap_linpack0_is_linear(ap_linpack0_t* pack);
+  /* Return true iff all involved coefficients are scalars */
+bool ap_linpack0_is_quasilinear(ap_linpack0_t* pack);
+  /* Return true iff all involved coefficients but the constants are scalars */
+
+/* ====================================================================== */
+/* IV. Conversions from and to ap_linexpr0_t and ap_lincons0_t */
+/* ====================================================================== */
+
+ap_linpack0_t* ap_linpack0_of_linexpr0_array(ap_scalar_discr_t discr,
+					     ap_linexpr0_t** texpr, size_t size);
+ap_linpack0_t* ap_linpack0_of_lincons0_array(ap_scalar_discr_t discr,
+					     ap_lincons0_array_t* array);
+  /* Pack an array of expressions (resp. constraints).
+     The rows of an expression pack are of type AP_CONS_EQ. */
+
+ap_linexpr0_t* ap_linpack0_get_linexpr0(ap_linpack0_t* pack, size_t row);
+ap_lincons0_t ap_linpack0_get_lincons0(ap_linpack0_t* pack, size_t row);
+  /* Allocate the (sparse) expression (resp. constraint) of the row */
+
+ap_linexpr0_t** ap_linexpr0_array_of_linpack0(ap_linpack0_t* pack);
+ap_lincons0_array_t ap_lincons0_array_of_linpack0(ap_linpack0_t* pack);
+  /* Unpack all the rows. The array of expressions is of size pack->size,
+     to be freed with ap_linexpr0_array_free. */
+
+/* ====================================================================== */
+/* V. Inline function definitions */
+/* ====================================================================== */
+
+static inline
+size_t ap_linpack0_size(ap_linpack0_t* pack)
+  { return pack->size; }
+
+static inline
+size_t ap_linpack0_row_size(ap_linpack0_t* pack, size_t row)
+  { return pack->start[row+1]-pack->start[row]; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
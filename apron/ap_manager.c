@@ -9,7 +9,9 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 #include "ap_manager.h"
+#include "ap_trace.h"
 
 const char* ap_name_of_funid[AP_FUNID_SIZE2] = {
   "unknown",
@@ -170,17 +172,78 @@ ap_manager_t* ap_manager_alloc(const char* library, const char* version,
   man->internal = internal;
   man->internal_free = internal_free;
   man->count = 1;
+  man->internal_clone = NULL;
+  man->trace = NULL;
+  man->timer.deadline = 0.0;
+  man->timer.expired = false;
+  man->timer.running = false;
   ap_option_init(&man->option);
   ap_result_init(&man->result);
   return man;
 }
+void ap_manager_set_internal_clone(ap_manager_t* man,
+				   void* (*internal_clone)(void*, ap_manager_t*))
+{ man->internal_clone = internal_clone; }
+ap_manager_t* ap_manager_clone_for_thread(ap_manager_t* man)
+{
+  ap_manager_t* res;
+
+  if (man->internal_clone==NULL) return NULL;
+  res = ap_manager_alloc(man->library,man->version,NULL,man->internal_free);
+  memcpy(res->funptr,man->funptr,sizeof(man->funptr));
+  res->option = man->option;
+  res->internal_clone = man->internal_clone;
+  res->internal = man->internal_clone(man->internal,res);
+  if (res->internal==NULL){
+    ap_manager_free(res);
+    return NULL;
+  }
+  return res;
+}
+
+static double ap_manager_clock(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+}
+void ap_manager_timer_start(ap_manager_t* man, ap_funid_t funid)
+{
+  size_t timeout = man->option.funopt[funid].timeout;
+  man->timer.deadline = timeout ? ap_manager_clock() + 1e-3*(double)timeout : 0.0;
+  man->timer.expired = false;
+}
+bool ap_manager_timer_enter(ap_manager_t* man, ap_funid_t funid)
+{
+  if (man->timer.running) return false;
+  man->timer.running = true;
+  ap_manager_timer_start(man,funid);
+  return true;
+}
+void ap_manager_timer_exit(ap_manager_t* man)
+{
+  man->timer.running = false;
+  man->timer.deadline = 0.0;
+  man->timer.expired = false;
+}
+bool ap_manager_timer_check(ap_manager_t* man)
+{
+  return ap_timer_check(&man->timer);
+}
+bool ap_timer_check(ap_timer_t* timer)
+{
+  if (timer->deadline!=0.0 && ap_manager_clock() >= timer->deadline)
+    timer->expired = true;
+  return timer->expired;
+}
+
 void ap_manager_free(ap_manager_t* man)
 {
   assert(man->count>=1);
-  if (man->count>1){
-    man->count--;
-  }
-  else {
+  if (ap_refcount_decr(&man->count)==0){
+    if (man->trace != NULL){
+      ap_trace_stop(man);
+    }
     if (man->internal != NULL){
       man->internal_free(man->internal);
       man->internal = NULL;
@@ -158,9 +158,12 @@ typedef struct ap_funopt_t {
      - MIN_INT is most efficient available;
      - otherwise, no accuracy or speed meaning
   */
-  size_t timeout; /* unit !? */
+  size_t timeout; /* in milliseconds, 0 for no timeout */
   /* Above the given computation time, the function may abort with the
-     exception flag flag_time_out on.
+     exception AP_EXC_TIMEOUT, and return a sound approximation
+     (see ap_manager_timeout). Only the timeout of the outermost call
+     applies: the calls a library makes on the same manager while serving it
+     keep its deadline.
   */
   size_t max_object_size; /* in abstract object size unit. */
   /* If during the computation, the size of some object reach this limit, the
@@ -185,6 +188,13 @@ typedef struct ap_option_t {
 /* I.3 Manager */
 /* ====================================================================== */
 
+/* Deadline of the current call (see ap_manager_timer_start) */
+typedef struct ap_timer_t {
+  double deadline;  /* absolute monotonic time in seconds, 0.0 if none */
+  bool expired;     /* the deadline has been found passed */
+  bool running;     /* an outermost ap_abstract0_* call is running */
+} ap_timer_t;
+
 /* Manager (opaque type) */
 typedef struct ap_manager_t {
   const char* library;                 /* name of the effective library */
@@ -197,7 +207,13 @@ typedef struct ap_manager_t {
   ap_option_t option;            /* Options (in) */
   ap_result_t result;            /* Exceptions and other indications (out) */
   void (*internal_free)(void*);  /* deallocation function for internal */
-  size_t count;                  /* reference counter */
+  size_t count;                  /* reference counter (atomic) */
+  void* (*internal_clone)(void*, struct ap_manager_t*);
+                                 /* allocation of a fresh internal field
+				    for a clone of the manager (may be NULL) */
+  struct ap_trace_t* trace;      /* recording of the calls (see ap_trace.h),
+				    NULL if not traced */
+  ap_timer_t timer;              /* deadline of the current call */
 } ap_manager_t;
 
 /* ********************************************************************** */
@@ -229,9 +245,63 @@ void ap_funopt_init(ap_funopt_t* fopt);
 void ap_manager_set_funopt(ap_manager_t* man, ap_funid_t funid, ap_funopt_t* funopt);
 void ap_manager_set_abort_if_exception(ap_manager_t* man, ap_exc_t exn, bool flag);
 
+void ap_manager_timer_start(ap_manager_t* man, ap_funid_t funid);
+  /* Arm the deadline of man to option.funopt[funid].timeout milliseconds
+     from now, or disarm it if this timeout is 0. */
+bool ap_manager_timer_enter(ap_manager_t* man, ap_funid_t funid);
+  /* If no ap_abstract0_* call of man is running, arm the deadline with
+     ap_manager_timer_start, mark the call as running and return true; the
+     caller then performs the call and ends it with ap_manager_timer_exit.
+     Otherwise (nested call made by a library, e.g. the to_box of
+     ap_intlinearize_*), return false and leave the deadline of the
+     outermost call untouched. */
+void ap_manager_timer_exit(ap_manager_t* man);
+  /* End the call started by ap_manager_timer_enter and disarm the deadline */
+bool ap_manager_timer_check(ap_manager_t* man);
+  /* Read the clock and compare it to the armed deadline */
+bool ap_timer_check(ap_timer_t* timer);
+  /* Same on a copy of the timer of a manager: the threads that work for the
+     current call of a manager check their own copy, without writing to the
+     manager */
+static inline bool ap_manager_timeout(ap_manager_t* man);
+  /* Has the deadline of the current call passed ?
+
+     Costs a single test if no timeout is set, and a reading of the
+     monotonic clock otherwise. Libraries check it between the steps of
+     their expensive algorithms (closure pivots, conversion iterations,
+     propagation passes...); once it returns true, they stop refining, return
+     a sound approximation, and raise AP_EXC_TIMEOUT. */
+
 bool ap_fpu_init(void);
 /* tries to set the FPU rounding-mode towards +oo, returns true if successful */
 
+ap_manager_t* ap_manager_clone_for_thread(ap_manager_t* man);
+  /* Return a new manager of the same library, with the same options and a
+     fresh internal field (working space), or NULL if the library does not
+     support cloning. Box, oct, optoct, polka (with its decomposed and
+     equality variants) support it. Taylor1+ does not: its values refer to
+     the noise symbols allocated by the manager which created them.
+
+     Abstract values do not refer to the manager instance which created
+     them: a value created under a manager can be used, copied and freed
+     under any of its clones, as long as two threads do not use the same
+     manager at the same time.
+
+     Thread-safety contract:
+     - the reference counters of managers and environments are atomic, so
+       they can be copied and freed concurrently (ap_manager_copy,
+       ap_environment_copy, and the ap_abstract1_* functions which share the
+       environment of their arguments);
+     - a manager records the result of each call (exceptions, flags), and
+       holds the working space of the library: a manager, or a clone, is
+       used by one thread at a time;
+     - an abstract value (ap_abstract0_t or ap_abstract1_t) may be used as a
+       non-destructive argument by several threads at the same time only if
+       the domain does not update it in place on read-only operations. This
+       holds for boxes, and does not hold for octagons and polyhedra, which
+       close or minimize the value on demand: in that case, each thread
+       should work on its own copy. */
+
 
 /* ********************************************************************** */
 /* III. Implementor Functions */
@@ -240,6 +310,11 @@ bool ap_fpu_init(void);
 ap_manager_t* ap_manager_alloc(const char* library, const char* version,
 			       void* internal,
 			       void (*internal_free)(void*));
+void ap_manager_set_internal_clone(ap_manager_t* man,
+				   void* (*internal_clone)(void*, ap_manager_t*));
+  /* Register the function used by ap_manager_clone_for_thread.
+     internal_clone(internal,newman) should return a fresh internal field
+     configured as internal, newman being the manager which will own it. */
 static inline
 ap_manager_t* ap_manager_copy(ap_manager_t* man);
   /* Increment the reference counter and return its argument */
@@ -284,7 +359,12 @@ static inline tbool_t tbool_not(tbool_t a)
 }
 static inline
 ap_manager_t* ap_manager_copy(ap_manager_t* man)
-{ man->count++; return man; }
+{ ap_refcount_incr(&man->count); return man; }
+static inline bool ap_manager_timeout(ap_manager_t* man)
+{
+  return man->timer.deadline!=0.0 &&
+    (man->timer.expired || ap_manager_timer_check(man));
+}
 #ifdef __cplusplus
 }
 #endif
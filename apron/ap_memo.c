@@ -0,0 +1,1106 @@
+/* ************************************************************************* */
+/* ap_memo.c: hash-consing of abstract values and memoization of operations */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ap_global0.h"
+#include "ap_memo.h"
+
+static inline
+ap_memo_internal_t* get_internal(ap_manager_t* manager)
+{
+  return (ap_memo_internal_t*)manager->internal;
+}
+
+/* ============================================================ */
+/* Calls to the underlying manager */
+/* ============================================================ */
+
+/* Prepare a call of function funid of the underlying manager */
+static ap_manager_t* ap_memo_prepare(ap_manager_t* manager, ap_funid_t funid)
+{
+  ap_manager_t* man = get_internal(manager)->manager;
+  man->result.exn = AP_EXC_NONE;
+  ap_manager_timer_start(man,funid);
+  return man;
+}
+
+/* Transfer the flags and the exceptions of the last call of the underlying
+   manager to the memo manager. Return true if an exception was raised. */
+static bool ap_memo_collect(ap_manager_t* manager)
+{
+  ap_manager_t* man = get_internal(manager)->manager;
+  ap_result_t* result = &man->result;
+
+  manager->result.flag_exact = result->flag_exact;
+  manager->result.flag_best = result->flag_best;
+  if (result->exclog!=NULL){
+    ap_exclog_t* last = result->exclog;
+    while (last->tail) last = last->tail;
+    last->tail = manager->result.exclog;
+    manager->result.exclog = result->exclog;
+    result->exclog = NULL;
+  }
+  if (result->exn!=AP_EXC_NONE){
+    manager->result.exn = result->exn;
+    result->exn = AP_EXC_NONE;
+    return true;
+  }
+  return false;
+}
+
+/* Discard the flags and the exceptions of the underlying manager (for the
+   internal calls to hash and is_eq) */
+static void ap_memo_discard(ap_manager_t* manager)
+{
+  ap_manager_t* man = get_internal(manager)->manager;
+  ap_manager_clear_exclog(man);
+  man->result.exn = AP_EXC_NONE;
+}
+
+/* ============================================================ */
+/* Abstract values */
+/* ============================================================ */
+
+static ap_memo_t* ap_memo_alloc(void* value)
+{
+  ap_memo_t* res = malloc(sizeof(ap_memo_t));
+  res->value = value;
+  res->count = 1;
+  res->id = 0;
+  res->hash = 0;
+  res->interned = false;
+  res->next = NULL;
+  return res;
+}
+
+/* Remove a from the table of hash-consed values, if it is there. Its
+   identifier is forgotten, as its value is going to change. */
+static void ap_memo_unintern(ap_memo_internal_t* intern, ap_memo_t* a)
+{
+  if (a->interned){
+    ap_memo_t** p = &intern->values[(unsigned int)a->hash % intern->nbvalues];
+    while (*p!=a) p = &(*p)->next;
+    *p = a->next;
+    a->next = NULL;
+    a->interned = false;
+    intern->stat.values--;
+  }
+  a->id = 0;
+}
+
+/* Dereference a, and free it if it is not referenced any more */
+static void ap_memo_release(ap_memo_internal_t* intern, ap_memo_t* a)
+{
+  assert(a->count>0);
+  a->count--;
+  if (a->count==0){
+    ap_manager_t* man = intern->manager;
+    void (*absfree)(ap_manager_t*,...) = man->funptr[AP_FUNID_FREE];
+    ap_memo_unintern(intern,a);
+    absfree(man,a->value);
+    free(a);
+  }
+}
+
+/* Value of a to be given to a destructive operation of the underlying
+   domain: a is dereferenced, and its value is copied if it is shared */
+static void* ap_memo_own(ap_memo_internal_t* intern, ap_memo_t* a)
+{
+  void* res;
+  if (a->count==1){
+    ap_memo_unintern(intern,a);
+    res = a->value;
+    free(a);
+  }
+  else {
+    ap_manager_t* man = intern->manager;
+    void* (*copy)(ap_manager_t*,...) = man->funptr[AP_FUNID_COPY];
+    a->count--;
+    res = copy(man,a->value);
+  }
+  return res;
+}
+
+/* Argument of an operation of the underlying domain */
+static inline
+void* ap_memo_arg(ap_memo_internal_t* intern, bool destructive, ap_memo_t* a)
+{
+  return destructive ? ap_memo_own(intern,a) : a->value;
+}
+
+/* Wrap the result of the last call of the underlying manager */
+static inline
+ap_memo_t* ap_memo_result(ap_manager_t* manager, void* value)
+{
+  ap_memo_collect(manager);
+  return ap_memo_alloc(value);
+}
+
+/* ============================================================ */
+/* Hash-consing */
+/* ============================================================ */
+
+static void ap_memo_values_resize(ap_memo_internal_t* intern, size_t size)
+{
+  ap_memo_t** values = calloc(size,sizeof(ap_memo_t*));
+  size_t i;
+  for (i=0; i<intern->nbvalues; i++){
+    ap_memo_t* a = intern->values[i];
+    while (a){
+      ap_memo_t* next = a->next;
+      size_t h = (unsigned int)a->hash % size;
+      a->next = values[h];
+      values[h] = a;
+      a = next;
+    }
+  }
+  free(intern->values);
+  intern->values = values;
+  intern->nbvalues = size;
+}
+
+/* Give an identifier to a, if it has none, and return the hash-consed value
+   equal to a: a itself if no such value existed before, in which case a is
+   put in the table. Otherwise, a receives the identifier of the existing
+   value. */
+static ap_memo_t* ap_memo_hashcons(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_manager_t* man;
+  int (*hash)(ap_manager_t*,...);
+  bool (*is_eq)(ap_manager_t*,...);
+  ap_dimension_t (*dimension)(ap_manager_t*,...);
+  ap_dimension_t dim,dim2;
+  ap_memo_t* p;
+  size_t h;
+
+  if (a->id) return a;
+  man = ap_memo_prepare(manager,AP_FUNID_HASH);
+  hash = man->funptr[AP_FUNID_HASH];
+  is_eq = man->funptr[AP_FUNID_IS_EQ];
+  dimension = man->funptr[AP_FUNID_DIMENSION];
+  a->hash = hash ? hash(man,a->value) : 0;
+  if (man->result.exn!=AP_EXC_NONE) a->hash = 0;
+  dim = dimension(man,a->value);
+  h = (unsigned int)a->hash % intern->nbvalues;
+  for (p=intern->values[h]; p!=NULL; p=p->next){
+    if (p->hash==a->hash){
+      dim2 = dimension(man,p->value);
+      if (dim.intdim==dim2.intdim && dim.realdim==dim2.realdim){
+	man->result.exn = AP_EXC_NONE;
+	if (is_eq(man,p->value,a->value) &&
+	    man->result.exn==AP_EXC_NONE){
+	  a->id = p->id;
+	  ap_memo_discard(manager);
+	  return p;
+	}
+      }
+    }
+  }
+  intern->id++;
+  a->id = intern->id;
+  a->interned = true;
+  a->next = intern->values[h];
+  intern->values[h] = a;
+  intern->stat.values++;
+  if (intern->stat.values > 2*intern->nbvalues)
+    ap_memo_values_resize(intern,2*intern->nbvalues);
+  ap_memo_discard(manager);
+  return a;
+}
+
+/* Hash-cons a result (referenced once): return the hash-consed value equal
+   to it, and free it if it is not this value */
+static ap_memo_t* ap_memo_share(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_memo_t* res = ap_memo_hashcons(manager,a);
+  if (res!=a){
+    res->count++;
+    ap_memo_release(intern,a);
+    intern->stat.shared++;
+  }
+  return res;
+}
+
+/* ============================================================ */
+/* Cache */
+/* ============================================================ */
+
+static inline
+size_t ap_memo_entry_hash(ap_memo_internal_t* intern,
+			  ap_funid_t funid, size_t id1, size_t id2)
+{
+  size_t h = ((size_t)funid*31 + id1)*1000003 + id2;
+  return h % intern->nbentries;
+}
+
+static void ap_memo_lru_remove(ap_memo_internal_t* intern,
+			       ap_memo_entry_t* e)
+{
+  if (e->newer) e->newer->older = e->older; else intern->newest = e->older;
+  if (e->older) e->older->newer = e->newer; else intern->oldest = e->newer;
+  e->newer = e->older = NULL;
+}
+static void ap_memo_lru_push(ap_memo_internal_t* intern,
+			     ap_memo_entry_t* e)
+{
+  e->older = intern->newest;
+  e->newer = NULL;
+  if (intern->newest) intern->newest->newer = e; else intern->oldest = e;
+  intern->newest = e;
+}
+
+/* Remove an entry from the cache and free it */
+static void ap_memo_entry_free(ap_memo_internal_t* intern,
+			       ap_memo_entry_t* e)
+{
+  ap_memo_entry_t** p =
+    &intern->entries[ap_memo_entry_hash(intern,e->funid,e->id1,e->id2)];
+  while (*p!=e) p = &(*p)->next;
+  *p = e->next;
+  ap_memo_lru_remove(intern,e);
+  if (e->res) ap_memo_release(intern,e->res);
+  intern->stat.entries--;
+  intern->stat.size -= e->size;
+  free(e);
+}
+
+/* Evict the least recently used entries until the bounds are respected */
+static void ap_memo_evict(ap_memo_internal_t* intern)
+{
+  while (intern->oldest &&
+	 (intern->stat.entries > intern->maxentries ||
+	  (intern->maxsize && intern->stat.size > intern->maxsize))){
+    ap_memo_entry_free(intern,intern->oldest);
+    intern->stat.evictions++;
+  }
+}
+
+static ap_memo_entry_t* ap_memo_lookup(ap_memo_internal_t* intern,
+				       ap_funid_t funid,
+				       size_t id1, size_t id2)
+{
+  ap_memo_entry_t* e =
+    intern->entries[ap_memo_entry_hash(intern,funid,id1,id2)];
+  while (e && !(e->funid==funid && e->id1==id1 && e->id2==id2))
+    e = e->next;
+  if (e){
+    intern->stat.hits++;
+    ap_memo_lru_remove(intern,e);
+    ap_memo_lru_push(intern,e);
+  }
+  else
+    intern->stat.misses++;
+  return e;
+}
+
+/* Cache the result of a call of the underlying manager, with its flags. res
+   (NULL for IS_LEQ) gets a new reference. */
+static void ap_memo_insert(ap_manager_t* manager,
+			   ap_funid_t funid, size_t id1, size_t id2,
+			   ap_memo_t* res, bool leq)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_memo_entry_t* e = malloc(sizeof(ap_memo_entry_t));
+  size_t h = ap_memo_entry_hash(intern,funid,id1,id2);
+
+  e->funid = funid;
+  e->id1 = id1;
+  e->id2 = id2;
+  e->res = res;
+  e->leq = leq;
+  e->flag_exact = manager->result.flag_exact;
+  e->flag_best = manager->result.flag_best;
+  e->size = 0;
+  if (res){
+    ap_manager_t* man = intern->manager;
+    size_t (*size)(ap_manager_t*,...) = man->funptr[AP_FUNID_ASIZE];
+    res->count++;
+    e->size = size(man,res->value);
+  }
+  e->next = intern->entries[h];
+  intern->entries[h] = e;
+  ap_memo_lru_push(intern,e);
+  intern->stat.entries++;
+  intern->stat.size += e->size;
+  ap_memo_evict(intern);
+}
+
+/* Key of a binary operation: join and meet are commutative */
+static void ap_memo_key(ap_manager_t* manager, ap_funid_t funid,
+			ap_memo_t* a1, ap_memo_t* a2,
+			size_t* id1, size_t* id2)
+{
+  ap_memo_hashcons(manager,a1);
+  ap_memo_hashcons(manager,a2);
+  if ((funid==AP_FUNID_JOIN || funid==AP_FUNID_MEET) && a1->id > a2->id){
+    *id1 = a2->id; *id2 = a1->id;
+  }
+  else {
+    *id1 = a1->id; *id2 = a2->id;
+  }
+}
+
+/* Memoized join and meet */
+static ap_memo_t* ap_memo_binop(ap_manager_t* manager, ap_funid_t funid,
+				bool destructive,
+				ap_memo_t* a1, ap_memo_t* a2)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_memo_entry_t* e = NULL;
+  ap_memo_t* res;
+  size_t id1=0,id2=0;
+
+  if (intern->maxentries>0){
+    ap_memo_key(manager,funid,a1,a2,&id1,&id2);
+    e = ap_memo_lookup(intern,funid,id1,id2);
+  }
+  if (e){
+    res = e->res;
+    res->count++;
+    manager->result.flag_exact = e->flag_exact;
+    manager->result.flag_best = e->flag_best;
+  }
+  else {
+    ap_manager_t* man = ap_memo_prepare(manager,funid);
+    void* (*ptr)(ap_manager_t*,...) = man->funptr[funid];
+    res = ap_memo_alloc(ptr(man,false,a1->value,a2->value));
+    if (!ap_memo_collect(manager) && intern->maxentries>0){
+      bool flag_exact = manager->result.flag_exact;
+      bool flag_best = manager->result.flag_best;
+      res = ap_memo_share(manager,res);
+      manager->result.flag_exact = flag_exact;
+      manager->result.flag_best = flag_best;
+      ap_memo_insert(manager,funid,id1,id2,res,false);
+    }
+  }
+  if (destructive) ap_memo_release(intern,a1);
+  return res;
+}
+
+/* ============================================================ */
+/* I.1 Memory */
+/* ============================================================ */
+
+ap_memo_t* ap_memo_copy(ap_manager_t* manager, ap_memo_t* a)
+{
+  a->count++;
+  manager->result.flag_exact = manager->result.flag_best = true;
+  return a;
+}
+
+void ap_memo_free(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_memo_release(get_internal(manager),a);
+}
+
+size_t ap_memo_size(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_ASIZE);
+  size_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_ASIZE];
+  size_t res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+/* ============================================================ */
+/* I.2 Control of internal representation */
+/* ============================================================ */
+
+/* minimize and canonicalize do not change the meaning of a, and are
+   applied to shared values */
+#define VOID_MAN_VAL(NAME,FUNID)					\
+void ap_memo_##NAME(ap_manager_t* manager, ap_memo_t* a)		\
+{									\
+  ap_manager_t* man = ap_memo_prepare(manager,FUNID);			\
+  void (*ptr)(ap_manager_t*,...) = man->funptr[FUNID];			\
+  ptr(man,a->value);							\
+  ap_memo_collect(manager);						\
+}
+
+VOID_MAN_VAL(minimize,AP_FUNID_MINIMIZE)
+VOID_MAN_VAL(canonicalize,AP_FUNID_CANONICALIZE)
+
+int ap_memo_hash(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_HASH);
+  int (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_HASH];
+  int res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+/* approximate may lose information, and is thus applied only to values
+   which are not shared */
+void ap_memo_approximate(ap_manager_t* manager, ap_memo_t* a, int algorithm)
+{
+  if (a->count==1){
+    ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_APPROXIMATE);
+    void (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_APPROXIMATE];
+    ap_memo_unintern(get_internal(manager),a);
+    ptr(man,a->value,algorithm);
+    ap_memo_collect(manager);
+  }
+  else {
+    manager->result.flag_exact = manager->result.flag_best = true;
+  }
+}
+
+/* ============================================================ */
+/* I.3 Printing */
+/* ============================================================ */
+
+void ap_memo_fprint(FILE* stream, ap_manager_t* manager,
+		    ap_memo_t* a,
+		    char** name_of_dim)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_FPRINT);
+  void (*ptr)(FILE*,ap_manager_t*,...) = man->funptr[AP_FUNID_FPRINT];
+  ptr(stream,man,a->value,name_of_dim);
+  ap_memo_collect(manager);
+}
+
+void ap_memo_fprintdiff(FILE* stream, ap_manager_t* manager,
+			ap_memo_t* a1, ap_memo_t* a2,
+			char** name_of_dim)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_FPRINTDIFF);
+  void (*ptr)(FILE*,ap_manager_t*,...) = man->funptr[AP_FUNID_FPRINTDIFF];
+  ptr(stream,man,a1->value,a2->value,name_of_dim);
+  ap_memo_collect(manager);
+}
+
+void ap_memo_fdump(FILE* stream, ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_FDUMP);
+  void (*ptr)(FILE*,ap_manager_t*,...) = man->funptr[AP_FUNID_FDUMP];
+  fprintf(stream,"memo of library %s: id %lu, count %lu\n",
+	  man->library,(unsigned long)a->id,(unsigned long)a->count);
+  ptr(stream,man,a->value);
+  ap_memo_collect(manager);
+}
+
+/* ============================================================ */
+/* I.4 Serialization */
+/* ============================================================ */
+
+ap_membuf_t ap_memo_serialize_raw(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_SERIALIZE_RAW);
+  ap_membuf_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SERIALIZE_RAW];
+  ap_membuf_t res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_memo_t* ap_memo_deserialize_raw(ap_manager_t* manager,
+				   void* p, size_t* size)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_DESERIALIZE_RAW);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_DESERIALIZE_RAW];
+  void* value = ptr(man,p,size);
+  if (value==NULL){
+    ap_memo_collect(manager);
+    return NULL;
+  }
+  return ap_memo_result(manager,value);
+}
+
+/* ********************************************************************** */
+/* II. Constructor, accessors, tests and property extraction */
+/* ********************************************************************** */
+
+/* ============================================================ */
+/* II.1 Basic constructors */
+/* ============================================================ */
+
+#define BOTTOM_TOP(NAME,FUNID)						\
+ap_memo_t* ap_memo_##NAME(ap_manager_t* manager, size_t intdim, size_t realdim) \
+{									\
+  ap_manager_t* man = ap_memo_prepare(manager,FUNID);			\
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[FUNID];			\
+  return ap_memo_result(manager,ptr(man,intdim,realdim));		\
+}
+
+BOTTOM_TOP(bottom,AP_FUNID_BOTTOM)
+BOTTOM_TOP(top,AP_FUNID_TOP)
+
+ap_memo_t* ap_memo_of_box(ap_manager_t* manager,
+			  size_t intdim, size_t realdim,
+			  ap_interval_t** tinterval)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_OF_BOX);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_OF_BOX];
+  return ap_memo_result(manager,ptr(man,intdim,realdim,tinterval));
+}
+
+/* ============================================================ */
+/* II.2 Accessors */
+/* ============================================================ */
+
+ap_dimension_t ap_memo_dimension(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_manager_t* man = get_internal(manager)->manager;
+  ap_dimension_t (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_DIMENSION];
+  return ptr(man,a->value);
+}
+
+/* ============================================================ */
+/* II.3 Tests */
+/* ============================================================ */
+
+#define BOOL_MAN_VAL(NAME,FUNID)					\
+bool ap_memo_##NAME(ap_manager_t* manager, ap_memo_t* a)		\
+{									\
+  ap_manager_t* man = ap_memo_prepare(manager,FUNID);			\
+  bool (*ptr)(ap_manager_t*,...) = man->funptr[FUNID];			\
+  bool res = ptr(man,a->value);						\
+  ap_memo_collect(manager);						\
+  return res;								\
+}
+
+BOOL_MAN_VAL(is_bottom,AP_FUNID_IS_BOTTOM)
+BOOL_MAN_VAL(is_top,AP_FUNID_IS_TOP)
+
+bool ap_memo_is_leq(ap_manager_t* manager, ap_memo_t* a1, ap_memo_t* a2)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_memo_entry_t* e = NULL;
+  ap_manager_t* man;
+  bool (*ptr)(ap_manager_t*,...);
+  size_t id1=0,id2=0;
+  bool res;
+
+  if (a1==a2 || (a1->id && a1->id==a2->id)){
+    manager->result.flag_exact = manager->result.flag_best = true;
+    return true;
+  }
+  if (intern->maxentries>0){
+    ap_memo_key(manager,AP_FUNID_IS_LEQ,a1,a2,&id1,&id2);
+    if (id1==id2){
+      manager->result.flag_exact = manager->result.flag_best = true;
+      return true;
+    }
+    e = ap_memo_lookup(intern,AP_FUNID_IS_LEQ,id1,id2);
+  }
+  if (e){
+    manager->result.flag_exact = e->flag_exact;
+    manager->result.flag_best = e->flag_best;
+    return e->leq;
+  }
+  man = ap_memo_prepare(manager,AP_FUNID_IS_LEQ);
+  ptr = man->funptr[AP_FUNID_IS_LEQ];
+  res = ptr(man,a1->value,a2->value);
+  if (!ap_memo_collect(manager) && intern->maxentries>0)
+    ap_memo_insert(manager,AP_FUNID_IS_LEQ,id1,id2,NULL,res);
+  return res;
+}
+
+/* Equal identifiers imply equality, distinct ones do not imply anything if
+   the hash function is not compatible with is_eq */
+bool ap_memo_is_eq(ap_manager_t* manager, ap_memo_t* a1, ap_memo_t* a2)
+{
+  ap_manager_t* man;
+  bool (*ptr)(ap_manager_t*,...);
+  bool res;
+
+  if (a1==a2 || (a1->id && a1->id==a2->id)){
+    manager->result.flag_exact = manager->result.flag_best = true;
+    return true;
+  }
+  man = ap_memo_prepare(manager,AP_FUNID_IS_EQ);
+  ptr = man->funptr[AP_FUNID_IS_EQ];
+  res = ptr(man,a1->value,a2->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+bool ap_memo_sat_lincons(ap_manager_t* manager, ap_memo_t* a,
+			 ap_lincons0_t* lincons)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_SAT_LINCONS);
+  bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_LINCONS];
+  bool res = ptr(man,a->value,lincons);
+  ap_memo_collect(manager);
+  return res;
+}
+
+bool ap_memo_sat_tcons(ap_manager_t* manager, ap_memo_t* a,
+		       ap_tcons0_t* tcons)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_SAT_TCONS);
+  bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_TCONS];
+  bool res = ptr(man,a->value,tcons);
+  ap_memo_collect(manager);
+  return res;
+}
+
+bool ap_memo_sat_interval(ap_manager_t* manager, ap_memo_t* a,
+			  ap_dim_t dim, ap_interval_t* interval)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_SAT_INTERVAL);
+  bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_INTERVAL];
+  bool res = ptr(man,a->value,dim,interval);
+  ap_memo_collect(manager);
+  return res;
+}
+
+bool ap_memo_is_dimension_unconstrained(ap_manager_t* manager, ap_memo_t* a,
+					ap_dim_t dim)
+{
+  ap_manager_t* man =
+    ap_memo_prepare(manager,AP_FUNID_IS_DIMENSION_UNCONSTRAINED);
+  bool (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_IS_DIMENSION_UNCONSTRAINED];
+  bool res = ptr(man,a->value,dim);
+  ap_memo_collect(manager);
+  return res;
+}
+
+/* ============================================================ */
+/* II.4 Extraction of properties */
+/* ============================================================ */
+
+ap_interval_t* ap_memo_bound_dimension(ap_manager_t* manager, ap_memo_t* a,
+				       ap_dim_t dim)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_BOUND_DIMENSION);
+  ap_interval_t* (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_BOUND_DIMENSION];
+  ap_interval_t* res = ptr(man,a->value,dim);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_interval_t* ap_memo_bound_linexpr(ap_manager_t* manager, ap_memo_t* a,
+				     ap_linexpr0_t* expr)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_BOUND_LINEXPR);
+  ap_interval_t* (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_BOUND_LINEXPR];
+  ap_interval_t* res = ptr(man,a->value,expr);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_interval_t* ap_memo_bound_texpr(ap_manager_t* manager, ap_memo_t* a,
+				   ap_texpr0_t* expr)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_BOUND_TEXPR);
+  ap_interval_t* (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_BOUND_TEXPR];
+  ap_interval_t* res = ptr(man,a->value,expr);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_interval_t** ap_memo_to_box(ap_manager_t* manager, ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_TO_BOX);
+  ap_interval_t** (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_TO_BOX];
+  ap_interval_t** res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_lincons0_array_t ap_memo_to_lincons_array(ap_manager_t* manager,
+					     ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_TO_LINCONS_ARRAY);
+  ap_lincons0_array_t (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_TO_LINCONS_ARRAY];
+  ap_lincons0_array_t res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_tcons0_array_t ap_memo_to_tcons_array(ap_manager_t* manager,
+					 ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_TO_TCONS_ARRAY);
+  ap_tcons0_array_t (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_TO_TCONS_ARRAY];
+  ap_tcons0_array_t res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+ap_generator0_array_t ap_memo_to_generator_array(ap_manager_t* manager,
+						 ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_TO_GENERATOR_ARRAY);
+  ap_generator0_array_t (*ptr)(ap_manager_t*,...) =
+    man->funptr[AP_FUNID_TO_GENERATOR_ARRAY];
+  ap_generator0_array_t res = ptr(man,a->value);
+  ap_memo_collect(manager);
+  return res;
+}
+
+/* ********************************************************************** */
+/* III. Operations */
+/* ********************************************************************** */
+
+/* ============================================================ */
+/* III.1 Meet and Join */
+/* ============================================================ */
+
+ap_memo_t* ap_memo_meet(ap_manager_t* manager, bool destructive,
+			ap_memo_t* a1, ap_memo_t* a2)
+{
+  return ap_memo_binop(manager,AP_FUNID_MEET,destructive,a1,a2);
+}
+
+ap_memo_t* ap_memo_join(ap_manager_t* manager, bool destructive,
+			ap_memo_t* a1, ap_memo_t* a2)
+{
+  return ap_memo_binop(manager,AP_FUNID_JOIN,destructive,a1,a2);
+}
+
+#define MEET_JOIN_ARRAY(NAME,FUNID)					\
+ap_memo_t* ap_memo_##NAME(ap_manager_t* manager, ap_memo_t** tab, size_t size) \
+{									\
+  ap_manager_t* man = ap_memo_prepare(manager,FUNID);			\
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[FUNID];			\
+  void** ntab = malloc(size*sizeof(void*));				\
+  void* res;								\
+  size_t i;								\
+  for (i=0; i<size; i++) ntab[i] = tab[i]->value;			\
+  res = ptr(man,ntab,size);						\
+  free(ntab);								\
+  return ap_memo_result(manager,res);					\
+}
+
+MEET_JOIN_ARRAY(meet_array,AP_FUNID_MEET_ARRAY)
+MEET_JOIN_ARRAY(join_array,AP_FUNID_JOIN_ARRAY)
+
+ap_memo_t* ap_memo_meet_lincons_array(ap_manager_t* manager, bool destructive,
+				      ap_memo_t* a,
+				      ap_lincons0_array_t* array)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_MEET_LINCONS_ARRAY);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MEET_LINCONS_ARRAY];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),array);
+  return ap_memo_result(manager,res);
+}
+
+ap_memo_t* ap_memo_meet_tcons_array(ap_manager_t* manager, bool destructive,
+				    ap_memo_t* a,
+				    ap_tcons0_array_t* array)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_MEET_TCONS_ARRAY);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MEET_TCONS_ARRAY];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),array);
+  return ap_memo_result(manager,res);
+}
+
+ap_memo_t* ap_memo_add_ray_array(ap_manager_t* manager, bool destructive,
+				 ap_memo_t* a,
+				 ap_generator0_array_t* array)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_ADD_RAY_ARRAY);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_ADD_RAY_ARRAY];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),array);
+  return ap_memo_result(manager,res);
+}
+
+/* ============================================================ */
+/* III.2 Assignement and Substitutions */
+/* ============================================================ */
+
+#define ASSIGN_SUBSTITUTE(NAME,FUNID,EXPR)				\
+ap_memo_t* ap_memo_##NAME(ap_manager_t* manager, bool destructive,	\
+			  ap_memo_t* a,					\
+			  ap_dim_t* tdim, EXPR** texpr, size_t size,	\
+			  ap_memo_t* dest)				\
+{									\
+  ap_manager_t* man = ap_memo_prepare(manager,FUNID);			\
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[FUNID];			\
+  void* vdest = dest ? dest->value : NULL;				\
+  void* res = ptr(man,destructive,					\
+		  ap_memo_arg(get_internal(manager),destructive,a),	\
+		  tdim,texpr,size,vdest);				\
+  return ap_memo_result(manager,res);					\
+}
+
+ASSIGN_SUBSTITUTE(assign_linexpr_array,AP_FUNID_ASSIGN_LINEXPR_ARRAY,ap_linexpr0_t)
+ASSIGN_SUBSTITUTE(substitute_linexpr_array,AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY,ap_linexpr0_t)
+ASSIGN_SUBSTITUTE(assign_texpr_array,AP_FUNID_ASSIGN_TEXPR_ARRAY,ap_texpr0_t)
+ASSIGN_SUBSTITUTE(substitute_texpr_array,AP_FUNID_SUBSTITUTE_TEXPR_ARRAY,ap_texpr0_t)
+
+/* ============================================================ */
+/* III.3 Projections */
+/* ============================================================ */
+
+ap_memo_t* ap_memo_forget_array(ap_manager_t* manager, bool destructive,
+				ap_memo_t* a,
+				ap_dim_t* tdim, size_t size,
+				bool project)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_FORGET_ARRAY);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_FORGET_ARRAY];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),
+		  tdim,size,project);
+  return ap_memo_result(manager,res);
+}
+
+/* ============================================================ */
+/* III.4 Change and permutation of dimensions */
+/* ============================================================ */
+
+ap_memo_t* ap_memo_add_dimensions(ap_manager_t* manager, bool destructive,
+				  ap_memo_t* a,
+				  ap_dimchange_t* dimchange,
+				  bool project)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_ADD_DIMENSIONS);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_ADD_DIMENSIONS];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),
+		  dimchange,project);
+  return ap_memo_result(manager,res);
+}
+
+ap_memo_t* ap_memo_remove_dimensions(ap_manager_t* manager, bool destructive,
+				     ap_memo_t* a,
+				     ap_dimchange_t* dimchange)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_REMOVE_DIMENSIONS);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_REMOVE_DIMENSIONS];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),
+		  dimchange);
+  return ap_memo_result(manager,res);
+}
+
+ap_memo_t* ap_memo_permute_dimensions(ap_manager_t* manager, bool destructive,
+				      ap_memo_t* a,
+				      ap_dimperm_t* perm)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_PERMUTE_DIMENSIONS);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_PERMUTE_DIMENSIONS];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),
+		  perm);
+  return ap_memo_result(manager,res);
+}
+
+/* ============================================================ */
+/* III.5 Expansion and folding of dimensions */
+/* ============================================================ */
+
+ap_memo_t* ap_memo_expand(ap_manager_t* manager, bool destructive,
+			  ap_memo_t* a,
+			  ap_dim_t dim, size_t n)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_EXPAND);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_EXPAND];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),
+		  dim,n);
+  return ap_memo_result(manager,res);
+}
+
+ap_memo_t* ap_memo_fold(ap_manager_t* manager, bool destructive,
+			ap_memo_t* a,
+			ap_dim_t* tdim, size_t size)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_FOLD);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_FOLD];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a),
+		  tdim,size);
+  return ap_memo_result(manager,res);
+}
+
+/* ============================================================ */
+/* III.6 Widening, Closure */
+/* ============================================================ */
+
+/* Neither memoized nor shared: the termination of a widening may rely on
+   the representation of its result (e.g. a non-closed octagon), which an
+   equal value of the table would not have */
+ap_memo_t* ap_memo_widening(ap_manager_t* manager,
+			    ap_memo_t* a1, ap_memo_t* a2)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_WIDENING);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_WIDENING];
+  void* res = ptr(man,a1->value,a2->value);
+  return ap_memo_result(manager,res);
+}
+
+ap_memo_t* ap_memo_closure(ap_manager_t* manager, bool destructive,
+			   ap_memo_t* a)
+{
+  ap_manager_t* man = ap_memo_prepare(manager,AP_FUNID_CLOSURE);
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_CLOSURE];
+  void* res = ptr(man,destructive,
+		  ap_memo_arg(get_internal(manager),destructive,a));
+  return ap_memo_result(manager,res);
+}
+
+/* ********************************************************************** */
+/* IV. Manager */
+/* ********************************************************************** */
+
+static void ap_memo_internal_free(void* p)
+{
+  ap_memo_internal_t* intern = (ap_memo_internal_t*)p;
+
+  while (intern->oldest) ap_memo_entry_free(intern,intern->oldest);
+  ap_manager_free(intern->manager);
+  intern->manager = NULL;
+  free(intern->values);
+  free(intern->entries);
+  free(intern->library);
+  free(intern);
+}
+
+ap_manager_t* ap_memo_manager_alloc(ap_manager_t* underlying)
+{
+  ap_memo_internal_t* internal;
+  ap_manager_t* man;
+  void** funptr;
+
+  /* creating internal */
+  internal = malloc(sizeof(ap_memo_internal_t));
+  internal->manager = ap_manager_copy(underlying);
+  internal->nbvalues = 64;
+  internal->values = calloc(internal->nbvalues,sizeof(ap_memo_t*));
+  internal->id = 0;
+  internal->maxentries = 1024;
+  internal->maxsize = 0;
+  internal->nbentries = internal->maxentries;
+  internal->entries = calloc(internal->nbentries,sizeof(ap_memo_entry_t*));
+  internal->newest = internal->oldest = NULL;
+  memset(&internal->stat,0,sizeof(ap_memo_stat_t));
+
+  internal->library = malloc(10+strlen(underlying->library));
+  sprintf(internal->library,"memo of %s",underlying->library);
+
+  /* allocating managers */
+  man = ap_manager_alloc(internal->library, underlying->version, internal,
+			 &ap_memo_internal_free);
+
+  /* Virtual table */
+  funptr = man->funptr;
+
+  funptr[AP_FUNID_COPY] = &ap_memo_copy;
+  funptr[AP_FUNID_FREE] = &ap_memo_free;
+  funptr[AP_FUNID_ASIZE] = &ap_memo_size;
+  funptr[AP_FUNID_MINIMIZE] = &ap_memo_minimize;
+  funptr[AP_FUNID_CANONICALIZE] = &ap_memo_canonicalize;
+  funptr[AP_FUNID_HASH] = &ap_memo_hash;
+  funptr[AP_FUNID_APPROXIMATE] = &ap_memo_approximate;
+  funptr[AP_FUNID_FPRINT] = &ap_memo_fprint;
+  funptr[AP_FUNID_FPRINTDIFF] = &ap_memo_fprintdiff;
+  funptr[AP_FUNID_FDUMP] = &ap_memo_fdump;
+  funptr[AP_FUNID_SERIALIZE_RAW] = &ap_memo_serialize_raw;
+  funptr[AP_FUNID_DESERIALIZE_RAW] = &ap_memo_deserialize_raw;
+  funptr[AP_FUNID_BOTTOM] = &ap_memo_bottom;
+  funptr[AP_FUNID_TOP] = &ap_memo_top;
+  funptr[AP_FUNID_OF_BOX] = &ap_memo_of_box;
+  funptr[AP_FUNID_DIMENSION] = &ap_memo_dimension;
+  funptr[AP_FUNID_IS_BOTTOM] = &ap_memo_is_bottom;
+  funptr[AP_FUNID_IS_TOP] = &ap_memo_is_top;
+  funptr[AP_FUNID_IS_LEQ] = &ap_memo_is_leq;
+  funptr[AP_FUNID_IS_EQ] = &ap_memo_is_eq;
+  funptr[AP_FUNID_IS_DIMENSION_UNCONSTRAINED]
+    = &ap_memo_is_dimension_unconstrained;
+  funptr[AP_FUNID_SAT_INTERVAL] = &ap_memo_sat_interval;
+  funptr[AP_FUNID_SAT_LINCONS] = &ap_memo_sat_lincons;
+  funptr[AP_FUNID_SAT_TCONS] = &ap_memo_sat_tcons;
+  funptr[AP_FUNID_BOUND_DIMENSION] = &ap_memo_bound_dimension;
+  funptr[AP_FUNID_BOUND_LINEXPR] = &ap_memo_bound_linexpr;
+  funptr[AP_FUNID_BOUND_TEXPR] = &ap_memo_bound_texpr;
+  funptr[AP_FUNID_TO_BOX] = &ap_memo_to_box;
+  funptr[AP_FUNID_TO_LINCONS_ARRAY] = &ap_memo_to_lincons_array;
+  funptr[AP_FUNID_TO_TCONS_ARRAY] = &ap_memo_to_tcons_array;
+  funptr[AP_FUNID_TO_GENERATOR_ARRAY] = &ap_memo_to_generator_array;
+  funptr[AP_FUNID_MEET] = &ap_memo_meet;
+  funptr[AP_FUNID_MEET_ARRAY] = &ap_memo_meet_array;
+  funptr[AP_FUNID_MEET_LINCONS_ARRAY] = &ap_memo_meet_lincons_array;
+  funptr[AP_FUNID_MEET_TCONS_ARRAY] = &ap_memo_meet_tcons_array;
+  funptr[AP_FUNID_JOIN] = &ap_memo_join;
+  funptr[AP_FUNID_JOIN_ARRAY] = &ap_memo_join_array;
+  funptr[AP_FUNID_ADD_RAY_ARRAY] = &ap_memo_add_ray_array;
+  funptr[AP_FUNID_ASSIGN_LINEXPR_ARRAY] = &ap_memo_assign_linexpr_array;
+  funptr[AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY]
+    = &ap_memo_substitute_linexpr_array;
+  funptr[AP_FUNID_ASSIGN_TEXPR_ARRAY] = &ap_memo_assign_texpr_array;
+  funptr[AP_FUNID_SUBSTITUTE_TEXPR_ARRAY] = &ap_memo_substitute_texpr_array;
+  funptr[AP_FUNID_ADD_DIMENSIONS] = &ap_memo_add_dimensions;
+  funptr[AP_FUNID_REMOVE_DIMENSIONS] = &ap_memo_remove_dimensions;
+  funptr[AP_FUNID_PERMUTE_DIMENSIONS] = &ap_memo_permute_dimensions;
+  funptr[AP_FUNID_FORGET_ARRAY] = &ap_memo_forget_array;
+  funptr[AP_FUNID_EXPAND] = &ap_memo_expand;
+  funptr[AP_FUNID_FOLD] = &ap_memo_fold;
+  funptr[AP_FUNID_WIDENING] = &ap_memo_widening;
+  funptr[AP_FUNID_CLOSURE] = &ap_memo_closure;
+
+  return man;
+}
+
+void ap_memo_set_bounds(ap_manager_t* manager,
+			size_t maxentries, size_t maxsize)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_memo_entry_t* e;
+
+  intern->maxentries = maxentries;
+  intern->maxsize = maxsize;
+  ap_memo_evict(intern);
+  /* rehash the remaining entries */
+  free(intern->entries);
+  intern->nbentries = maxentries>0 ? maxentries : 1;
+  intern->entries = calloc(intern->nbentries,sizeof(ap_memo_entry_t*));
+  for (e=intern->newest; e!=NULL; e=e->older){
+    size_t h = ap_memo_entry_hash(intern,e->funid,e->id1,e->id2);
+    e->next = intern->entries[h];
+    intern->entries[h] = e;
+  }
+}
+
+void ap_memo_clear(ap_manager_t* manager)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  while (intern->oldest) ap_memo_entry_free(intern,intern->oldest);
+}
+
+ap_memo_stat_t ap_memo_get_stat(ap_manager_t* manager)
+{
+  return get_internal(manager)->stat;
+}
+
+/* ============================================================ */
+/* V. Extra functions */
+/* ============================================================ */
+
+void* ap_memo_decompose(ap_manager_t* manager, bool destructive,
+			ap_memo_t* a)
+{
+  ap_memo_internal_t* intern = get_internal(manager);
+  ap_manager_t* man = intern->manager;
+  void* (*copy)(ap_manager_t*,...) = man->funptr[AP_FUNID_COPY];
+
+  return destructive ? ap_memo_own(intern,a) : copy(man,a->value);
+}
+
+ap_memo_t* ap_memo_compose(ap_manager_t* manager, bool destructive,
+			   void* value)
+{
+  ap_manager_t* man = get_internal(manager)->manager;
+  void* (*copy)(ap_manager_t*,...) = man->funptr[AP_FUNID_COPY];
+
+  return ap_memo_alloc(destructive ? value : copy(man,value));
+}
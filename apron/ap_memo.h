@@ -0,0 +1,151 @@
+/* ************************************************************************* */
+/* ap_memo.h: hash-consing of abstract values and memoization of operations */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* The manager returned by ap_memo_manager_alloc wraps the manager of an
+   underlying domain, and has the same semantics. Its abstract values
+   (ap_memo_t) wrap values of the underlying domain:
+
+   - copies are shared, with a reference counter, and a shared value is
+     copied only when it is modified by a destructive operation;
+
+   - the values which are argument or result of a join, meet or is_leq are
+     hash-consed: they are looked up in a table of unique values,
+     using AP_FUNID_HASH and AP_FUNID_IS_EQ of the underlying domain, and
+     receive the identifier of the equal value of the table, or a fresh one
+     which is never reused. Values with the same identifier are equal, which
+     is_leq and is_eq use as a shortcut, and results equal to an existing
+     value are replaced by it;
+
+   - the results of these operations are memoized in a cache keyed by the
+     identifiers of the arguments. The cache is bounded by a number of
+     entries and by the sum of the sizes (AP_FUNID_ASIZE) of the cached
+     results, and the least recently used entries are evicted first.
+
+   The widening (and thus ap_abstract0_widening_threshold) is neither
+   memoized nor shared: its termination may depend on the representation of
+   its result, such as a non-closed octagon, and an equal value of the table
+   may not have the same one.
+
+   Sharing is only as good as the hash function of the underlying domain:
+   equal values with different hash codes are not identified (the result is
+   still correct, but not found in the cache), and a domain which does not
+   implement AP_FUNID_HASH puts all the values in the same bucket.
+
+   Results which raised an exception are not cached, and approximate is only
+   applied to values which are not shared. The options of the underlying
+   manager apply to the calls made by the memo manager. */
+
+#ifndef _AP_MEMO_H_
+#define _AP_MEMO_H_
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "ap_global0.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* (internal) abstract value */
+typedef struct ap_memo_t {
+  void* value;            /* value of the underlying domain */
+  size_t count;           /* reference counter */
+  size_t id;              /* identifier if hash-consed, 0 otherwise */
+  int hash;               /* hash code, valid if hash-consed */
+  bool interned;          /* belongs to the table of hash-consed values
+			     (otherwise, it is equal to the value of the
+			     table with the same identifier) */
+  struct ap_memo_t* next; /* next value of the same bucket */
+} ap_memo_t;
+
+/* (internal) memoized result of a binary operation */
+typedef struct ap_memo_entry_t {
+  ap_funid_t funid;       /* AP_FUNID_JOIN, MEET or IS_LEQ */
+  size_t id1,id2;         /* identifiers of the arguments */
+  ap_memo_t* res;         /* result (referenced), NULL for IS_LEQ */
+  bool leq;               /* result of IS_LEQ */
+  bool flag_exact,flag_best;
+  size_t size;            /* size of res */
+  struct ap_memo_entry_t* next;  /* next entry of the same bucket */
+  struct ap_memo_entry_t* older; /* LRU list */
+  struct ap_memo_entry_t* newer;
+} ap_memo_entry_t;
+
+/* Statistics of a memo manager */
+typedef struct ap_memo_stat_t {
+  size_t values;          /* number of hash-consed values */
+  size_t entries;         /* number of cached results */
+  size_t size;            /* sum of the sizes of the cached results */
+  size_t hits,misses;     /* lookups in the cache */
+  size_t shared;          /* results identified with an existing value */
+  size_t evictions;       /* entries evicted to respect the bounds */
+} ap_memo_stat_t;
+
+/* internal fields of manager */
+typedef struct ap_memo_internal_t {
+  char* library;          /* (constructed) library name */
+  ap_manager_t* manager;  /* manager of the underlying domain */
+  ap_memo_t** values;     /* table of hash-consed values */
+  size_t nbvalues;        /* size of values */
+  size_t id;              /* last identifier */
+  ap_memo_entry_t** entries; /* cache */
+  size_t nbentries;       /* size of entries */
+  ap_memo_entry_t* newest; /* LRU list of entries */
+  ap_memo_entry_t* oldest;
+  size_t maxentries;      /* maximum number of entries */
+  size_t maxsize;         /* maximum sum of the sizes of the results,
+			     0 if unbounded */
+  ap_memo_stat_t stat;
+} ap_memo_internal_t;
+
+/* ============================================================ */
+/* Allocating a manager */
+/* ============================================================ */
+
+ap_manager_t* ap_memo_manager_alloc(ap_manager_t* underlying);
+  /* Wrap the manager of an underlying domain. The cache is bounded by
+     1024 entries, and its size is not bounded. */
+
+void ap_memo_set_bounds(ap_manager_t* manager,
+			size_t maxentries, size_t maxsize);
+  /* Bound the number of entries of the cache (0 disables the cache), and the
+     sum of the sizes of the results it holds (0 means unbounded). The least
+     recently used entries are evicted to respect the new bounds. */
+
+void ap_memo_clear(ap_manager_t* manager);
+  /* Empty the cache. The hash-consed values remain as long as they are
+     referenced. */
+
+ap_memo_stat_t ap_memo_get_stat(ap_manager_t* manager);
+  /* Statistics */
+
+/* ============================================================ */
+/* Extra functions */
+/* ============================================================ */
+
+void* ap_memo_decompose(ap_manager_t* manager, bool destructive,
+			ap_memo_t* a);
+  /* Return the value of the underlying domain wrapped by a.
+
+     Be cautious: no type checking is performed.
+
+     If destructive is true, then a is freed at the end of the call.
+     Otherwise, the value is copied into the result. */
+
+ap_memo_t* ap_memo_compose(ap_manager_t* manager, bool destructive,
+			   void* value);
+  /* Wrap a value of the underlying domain.
+
+     If destructive is true, value cannot be used any more. Otherwise, it is
+     copied into the result. */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
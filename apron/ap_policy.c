@@ -26,10 +26,7 @@ ap_policy_manager_t* ap_policy_manager_alloc(ap_manager_t* man,
 void ap_policy_manager_free(ap_policy_manager_t* pman)
 {
   assert(pman->count>=1 && pman->man->count>=1);
-  if (pman->count>1){
-    pman->count--;
-  }
-  else {
+  if (ap_refcount_decr(&pman->count)==0){
     ap_manager_free(pman->man);
     if (pman->internal != NULL){
       pman->internal_free(pman->internal);
@@ -222,7 +219,7 @@ ap_abstract0_policy_meet_apply(ap_policy_manager_t* pman,
     return ap_abstract0_cons2(pman->man,destructive,a1,value);
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a1);
+    ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a1);
     if (destructive) _ap_abstract0_free(a1);
     return ap_abstract0_top(pman->man,
 			    dimension.intdim,
@@ -251,7 +248,7 @@ ap_abstract0_policy_meet_array_apply(ap_policy_manager_t* pman,
   else {
     ap_dimension_t dimension = { 0, 0};
     if (size>0){
-      dimension = _ap_abstract0_dimension(tab[0]);
+      dimension = _ap_abstract0_dimension(pman->man,tab[0]);
     }
     return ap_abstract0_top(pman->man,
 			    dimension.intdim,
@@ -265,7 +262,7 @@ ap_abstract0_policy_meet_lincons_array_apply(ap_policy_manager_t* pman,
 {
   ap_funid_t funid = AP_FUNID_MEET_LINCONS_ARRAY;
   ap_funpolicyid_t funpid = AP_FUNPOLICYID_MEET_LINCONS_ARRAY_APPLY;
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a);
   if (ap_abstract0_checkman1(funid,pman->man,a) &&
       ap_abstract0_check_lincons_array(funid,pman->man,dimension,array) &&
       ap_abstract0_policy_check_policy_abstract(funpid,pman,policy,a)){
@@ -287,7 +284,7 @@ ap_abstract0_policy_meet_tcons_array_apply(ap_policy_manager_t* pman,
 {
   ap_funid_t funid = AP_FUNID_MEET_TCONS_ARRAY;
   ap_funpolicyid_t funpid = AP_FUNPOLICYID_MEET_TCONS_ARRAY_APPLY;
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a);
   if (ap_abstract0_checkman1(funid,pman->man,a) &&
       ap_abstract0_check_tcons_array(funid,pman->man,dimension,array) &&
       ap_abstract0_policy_check_policy_abstract(funpid,pman,policy,a)){
@@ -350,7 +347,7 @@ ap_abstract0_policy_meet_lincons_array_improve(ap_policy_manager_t* pman,
 {
   ap_funid_t funid = AP_FUNID_MEET_LINCONS_ARRAY;
   ap_funpolicyid_t funpid = AP_FUNPOLICYID_MEET_LINCONS_ARRAY_IMPROVE;
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a);
   if (ap_abstract0_checkman1(funid,pman->man,a) &&
       ap_abstract0_check_lincons_array(funid,pman->man,dimension,array) &&
       ap_abstract0_policy_check_policy_abstract(funpid,pman,policy,a)){
@@ -369,7 +366,7 @@ ap_abstract0_policy_meet_tcons_array_improve(ap_policy_manager_t* pman,
 {
   ap_funid_t funid = AP_FUNID_MEET_TCONS_ARRAY;
   ap_funpolicyid_t funpid = AP_FUNPOLICYID_MEET_TCONS_ARRAY_IMPROVE;
-  ap_dimension_t dimension = _ap_abstract0_dimension(a);
+  ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a);
   if (ap_abstract0_checkman1(funid,pman->man,a) &&
       ap_abstract0_check_tcons_array(funid,pman->man,dimension,array) &&
       ap_abstract0_policy_check_policy_abstract(funpid,pman,policy,a)){
@@ -404,7 +401,7 @@ ap_abstract0_policy_asssub_linexpr_array(ap_funpolicyid_t funid,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a);
     if (ap_abstract0_checkman1(funid,man,a) &&
 	(dest!=NULL ? (ap_abstract0_checkman1(funid,man,dest) && ap_abstract0_check_abstract2(funid,man,a,dest)) : true) &&
 	ap_abstract0_check_dim_array(funid,man,dimension,tdim,size) &&
@@ -442,7 +439,7 @@ ap_abstract0_policy_asssub_texpr_array(ap_funpolicyid_t funid,
     }
   }
   else {
-    ap_dimension_t dimension = _ap_abstract0_dimension(a);
+    ap_dimension_t dimension = _ap_abstract0_dimension(pman->man,a);
     if (ap_abstract0_checkman1(funid,man,a) &&
 	(dest!=NULL ? (ap_abstract0_checkman1(funid,man,dest) && ap_abstract0_check_abstract2(funid,man,a,dest)) : true) &&
 	ap_abstract0_check_dim_array(funid,man,dimension,tdim,size) &&
@@ -170,7 +170,7 @@ ap_abstract1_policy_meet_tcons_array_improve(ap_policy_manager_t* pman,
 static inline
 ap_policy_manager_t* ap_policy_manager_copy(ap_policy_manager_t* pman)
 {
-  pman->count++;
+  ap_refcount_incr(&pman->count);
   return pman;
 }
 static inline
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 #include "ap_global0.h"
 #include "ap_reducedproduct.h"
 
@@ -138,6 +139,281 @@ static void set_bottom(ap_reducedproduct_internal_t* intern,
   a->reduced = true;
 }
 
+/* ------------------------------------------------------------ */
+/* Parallel evaluation of components */
+/* ------------------------------------------------------------ */
+
+/* Arguments of an operation, shared by all its component tasks */
+typedef struct ap_reducedproduct_env_t {
+  ap_funid_t funid;
+  bool destructive;
+  ap_reducedproduct_t* a;   /* first argument */
+  ap_reducedproduct_t* b;   /* second argument, dest, or NULL */
+  ap_reducedproduct_t** tab;/* array argument of meet/join_array */
+  void* array;              /* constraints or expressions */
+  ap_dim_t* tdim;
+  size_t size;              /* size of tab or of the expressions */
+  ap_reducedproduct_t* res; /* product result */
+  bool* tres;               /* boolean results of tests, of size intern->size */
+} ap_reducedproduct_env_t;
+
+typedef struct ap_reducedproduct_task_t {
+  ap_reducedproduct_env_t* env;
+  ap_manager_t* man;
+  size_t index;
+} ap_reducedproduct_task_t;
+
+/* Performs the operation on one component */
+static
+void* ap_reducedproduct_task(void* arg)
+{
+  ap_reducedproduct_task_t* task = (ap_reducedproduct_task_t*)arg;
+  ap_reducedproduct_env_t* env = task->env;
+  ap_manager_t* man = task->man;
+  size_t i = task->index;
+  size_t j;
+  void** tab;
+  void* (*ptr)(ap_manager_t*,...) = man->funptr[env->funid];
+  bool (*test)(ap_manager_t*,...) = man->funptr[env->funid];
+
+  switch (env->funid){
+  case AP_FUNID_MEET:
+  case AP_FUNID_JOIN:
+    env->res->p[i] = ptr(man,env->destructive,env->a->p[i],env->b->p[i]);
+    break;
+  case AP_FUNID_MEET_ARRAY:
+  case AP_FUNID_JOIN_ARRAY:
+    tab = (void**)malloc(env->size*sizeof(void*));
+    for (j=0;j<env->size;j++){
+      tab[j] = env->tab[j]->p[i];
+    }
+    env->res->p[i] = ptr(man,tab,env->size);
+    free(tab);
+    break;
+  case AP_FUNID_MEET_LINCONS_ARRAY:
+  case AP_FUNID_MEET_TCONS_ARRAY:
+    env->res->p[i] = ptr(man,env->destructive,env->a->p[i],env->array);
+    break;
+  case AP_FUNID_ASSIGN_LINEXPR_ARRAY:
+  case AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY:
+  case AP_FUNID_ASSIGN_TEXPR_ARRAY:
+  case AP_FUNID_SUBSTITUTE_TEXPR_ARRAY:
+    env->res->p[i] = ptr(man,env->destructive,env->a->p[i],
+			 env->tdim,env->array,env->size,
+			 env->b ? env->b->p[i] : NULL);
+    break;
+  case AP_FUNID_WIDENING:
+    env->res->p[i] = ptr(man,env->a->p[i],env->b->p[i]);
+    break;
+  case AP_FUNID_IS_LEQ:
+  case AP_FUNID_IS_EQ:
+    env->tres[i] = test(man,env->a->p[i],env->b->p[i]);
+    break;
+  case AP_FUNID_SAT_LINCONS:
+  case AP_FUNID_SAT_TCONS:
+    env->tres[i] = test(man,env->a->p[i],env->array);
+    break;
+  default:
+    abort();
+  }
+  return NULL;
+}
+
+/* Threads of the components 1 to size-1, created by
+   ap_reducedproduct_set_parallel and reused by all the operations: each one
+   waits for a new operation, performs it on its component and signals its
+   completion. */
+typedef struct ap_reducedproduct_pool_t {
+  pthread_mutex_t mutex;
+  pthread_cond_t start;     /* a new operation is posted, or quit */
+  pthread_cond_t done;      /* the last pending task is completed */
+  unsigned long generation; /* number of operations posted so far */
+  size_t pending;           /* number of tasks of the operation in progress */
+  bool quit;
+  size_t size;
+  bool* started;            /* started[i] iff thread[i] runs */
+  pthread_t* thread;
+  ap_reducedproduct_task_t task[0];
+} ap_reducedproduct_pool_t;
+
+typedef struct ap_reducedproduct_worker_t {
+  ap_reducedproduct_pool_t* pool;
+  size_t index;
+} ap_reducedproduct_worker_t;
+
+static
+void* ap_reducedproduct_worker(void* arg)
+{
+  ap_reducedproduct_pool_t* pool = ((ap_reducedproduct_worker_t*)arg)->pool;
+  size_t i = ((ap_reducedproduct_worker_t*)arg)->index;
+  unsigned long generation = 0;
+
+  free(arg);
+  pthread_mutex_lock(&pool->mutex);
+  for (;;){
+    while (!pool->quit && pool->generation==generation)
+      pthread_cond_wait(&pool->start,&pool->mutex);
+    if (pool->quit) break;
+    generation = pool->generation;
+    pthread_mutex_unlock(&pool->mutex);
+    ap_reducedproduct_task(&pool->task[i]);
+    pthread_mutex_lock(&pool->mutex);
+    pool->pending--;
+    if (pool->pending==0) pthread_cond_signal(&pool->done);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return NULL;
+}
+
+static
+ap_reducedproduct_pool_t* ap_reducedproduct_pool_alloc(ap_reducedproduct_internal_t* intern)
+{
+  size_t i;
+  size_t size = intern->size;
+  ap_reducedproduct_pool_t* pool =
+    malloc(sizeof(ap_reducedproduct_pool_t) +
+	   size*sizeof(ap_reducedproduct_task_t));
+
+  pthread_mutex_init(&pool->mutex,NULL);
+  pthread_cond_init(&pool->start,NULL);
+  pthread_cond_init(&pool->done,NULL);
+  pool->generation = 0;
+  pool->pending = 0;
+  pool->quit = false;
+  pool->size = size;
+  pool->started = malloc(size*sizeof(bool));
+  pool->thread = malloc(size*sizeof(pthread_t));
+  for (i=0;i<size;i++){
+    pool->task[i].env = NULL;
+    pool->task[i].man = intern->tmanagers[i];
+    pool->task[i].index = i;
+    pool->started[i] = false;
+    if (i>0){
+      ap_reducedproduct_worker_t* worker =
+	malloc(sizeof(ap_reducedproduct_worker_t));
+      worker->pool = pool;
+      worker->index = i;
+      pool->started[i] =
+	pthread_create(&pool->thread[i],NULL,
+		       &ap_reducedproduct_worker,worker)==0;
+      if (!pool->started[i]) free(worker);
+    }
+  }
+  return pool;
+}
+
+static
+void ap_reducedproduct_pool_free(ap_reducedproduct_pool_t* pool)
+{
+  size_t i;
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->quit = true;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->mutex);
+  for (i=1;i<pool->size;i++){
+    if (pool->started[i]) pthread_join(pool->thread[i],NULL);
+  }
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->start);
+  pthread_mutex_destroy(&pool->mutex);
+  free(pool->thread);
+  free(pool->started);
+  free(pool);
+}
+
+/* Replaces in place the singleton intervals of the expression by scalars,
+   as some domains (octagons) do while reading it. */
+static
+void ap_reducedproduct_reduce_linexpr(ap_linexpr0_t* e)
+{
+  size_t i;
+
+  if (e==NULL) return;
+  ap_coeff_reduce(&e->cst);
+  switch (e->discr){
+  case AP_LINEXPR_DENSE:
+    for (i=0;i<e->size;i++) ap_coeff_reduce(&e->p.coeff[i]);
+    break;
+  case AP_LINEXPR_SPARSE:
+    for (i=0;i<e->size;i++) ap_coeff_reduce(&e->p.linterm[i].coeff);
+    break;
+  }
+}
+
+/* Performs the operation on all components, each one in a thread of the
+   pool (the first one in the calling thread), and waits for all of them.
+   Components for which no thread could be created are run sequentially.
+
+   The arguments are shared by the components: the linear expressions are
+   reduced beforehand, so that the components only read them. */
+static
+void ap_reducedproduct_parallel(ap_reducedproduct_internal_t* intern,
+				ap_reducedproduct_env_t* env)
+{
+  ap_reducedproduct_pool_t* pool = intern->pool;
+  size_t i;
+  size_t size = intern->size;
+
+  switch (env->funid){
+  case AP_FUNID_MEET_LINCONS_ARRAY:
+    {
+      ap_lincons0_array_t* array = (ap_lincons0_array_t*)env->array;
+      for (i=0;i<array->size;i++)
+	ap_reducedproduct_reduce_linexpr(array->p[i].linexpr0);
+    }
+    break;
+  case AP_FUNID_SAT_LINCONS:
+    ap_reducedproduct_reduce_linexpr(((ap_lincons0_t*)env->array)->linexpr0);
+    break;
+  case AP_FUNID_ASSIGN_LINEXPR_ARRAY:
+  case AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY:
+    for (i=0;i<env->size;i++)
+      ap_reducedproduct_reduce_linexpr(((ap_linexpr0_t**)env->array)[i]);
+    break;
+  default:
+    break;
+  }
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->pending = 0;
+  for (i=0;i<size;i++){
+    pool->task[i].env = env;
+    if (pool->started[i]) pool->pending++;
+  }
+  if (pool->pending>0){
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  for (i=0;i<size;i++){
+    if (!pool->started[i]) ap_reducedproduct_task(&pool->task[i]);
+  }
+  pthread_mutex_lock(&pool->mutex);
+  while (pool->pending>0)
+    pthread_cond_wait(&pool->done,&pool->mutex);
+  pthread_mutex_unlock(&pool->mutex);
+}
+
+/* Once all components have been computed, fills the value with bottom if
+   one of them is bottom. Return true in such a case. */
+static
+bool ap_reducedproduct_parallel_bottom(ap_reducedproduct_internal_t* intern,
+				       ap_reducedproduct_t* res)
+{
+  size_t i;
+  for (i=0;i<intern->size;i++){
+    ap_manager_t* man = intern->tmanagers[i];
+    bool (*is_bottom)(ap_manager_t*,...) = man->funptr[AP_FUNID_IS_BOTTOM];
+    if (is_bottom(man,res->p[i])){
+      /* all other components are computed, and should be freed */
+      set_bottom(intern,true,res,i);
+      return true;
+    }
+  }
+  return false;
+}
+
 /* ********************************************************************** */
 /* I. General management */
 /* ********************************************************************** */
@@ -310,16 +586,30 @@ ap_membuf_t ap_reducedproduct_serialize_raw(ap_manager_t* manager, ap_reducedpro
 ap_reducedproduct_t* ap_reducedproduct_deserialize_raw(ap_manager_t* manager, void* p, size_t* size)
 {
   ap_reducedproduct_internal_t* intern = get_internal_init0(manager);
-  size_t i,nb,dummy;
+  size_t i,length,dummy;
   ap_reducedproduct_t* res = ap_reducedproduct_alloc(intern->size);
 
-  if (size==NULL) size = &dummy;
+  if (size==NULL){ dummy = 0; size = &dummy; }
+  length = *size;
   *size = 0;
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_DESERIALIZE_RAW];
-    size_t nb;
+    size_t nb = length - *size;
     res->p[i] = ptr(man,((char*)p + *size), &nb);
+    if (res->p[i]==NULL){
+      /* free the components already read */
+      while (i>0){
+	i--;
+	man = intern->tmanagers[i];
+	void (*ptrfree)(ap_manager_t*,...) = man->funptr[AP_FUNID_FREE];
+	ptrfree(man,res->p[i]);
+      }
+      free(res);
+      *size = 0;
+      collect_results0(manager);
+      return NULL;
+    }
     *size += nb;
   }
   collect_results0(manager);
@@ -428,6 +718,14 @@ bool ap_reducedproduct_##NAME(ap_manager_t* manager, ap_reducedproduct_t* a,  ap
   size_t i;								\
   bool gres = true;							\
 									\
+  if (intern->parallel){						\
+    bool tres[intern->size];						\
+    ap_reducedproduct_env_t env = { FUNID, false, a, b, NULL, NULL,	\
+				    NULL, 0, NULL, tres };		\
+    ap_reducedproduct_parallel(intern,&env);				\
+    for (i=0;i<intern->size;i++) gres = gres && tres[i];		\
+  }									\
+  else									\
   for (i=0;i<intern->size;i++){						\
     ap_manager_t* man = intern->tmanagers[i];				\
     bool (*ptr)(ap_manager_t*,...) = man->funptr[FUNID];		\
@@ -448,6 +746,14 @@ bool ap_reducedproduct_sat_lincons(ap_manager_t* manager, ap_reducedproduct_t* a
   size_t i;
   bool gres = false;
 
+  if (intern->parallel){
+    bool tres[intern->size];
+    ap_reducedproduct_env_t env = { AP_FUNID_SAT_LINCONS, false, a, NULL, NULL, lincons,
+				    NULL, 0, NULL, tres };
+    ap_reducedproduct_parallel(intern,&env);
+    for (i=0;i<intern->size;i++) gres = gres || tres[i];
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_LINCONS];
@@ -464,6 +770,14 @@ bool ap_reducedproduct_sat_tcons(ap_manager_t* manager, ap_reducedproduct_t* a,
   size_t i;
   bool gres = false;
 
+  if (intern->parallel){
+    bool tres[intern->size];
+    ap_reducedproduct_env_t env = { AP_FUNID_SAT_TCONS, false, a, NULL, NULL, tcons,
+				    NULL, 0, NULL, tres };
+    ap_reducedproduct_parallel(intern,&env);
+    for (i=0;i<intern->size;i++) gres = gres || tres[i];
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     bool (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_SAT_TCONS];
@@ -699,6 +1013,14 @@ ap_reducedproduct_t* ap_reducedproduct_meetjoin(ap_funid_t funid,
 
   res = destructive ? a1 : ap_reducedproduct_alloc(intern->size);
 
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { funid, destructive, a1, a2, NULL, NULL,
+				    NULL, 0, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+    if (funid==AP_FUNID_MEET && ap_reducedproduct_parallel_bottom(intern,res))
+      goto ap_reducedproduct_meetjoin_exit;
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[funid];
@@ -739,6 +1061,14 @@ ap_reducedproduct_t* ap_reducedproduct_meetjoin_array(ap_funid_t funid,
 
   res = ap_reducedproduct_alloc(intern->size);
   a = (void**)malloc(size*sizeof(void*));
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { funid, false, NULL, NULL, tab, NULL,
+				    NULL, size, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+    if (funid==AP_FUNID_MEET_ARRAY && ap_reducedproduct_parallel_bottom(intern,res))
+      goto ap_reducedproduct_meetjoin_array_exit;
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[funid];
@@ -791,6 +1121,13 @@ ap_reducedproduct_t* ap_reducedproduct_meet_lincons_array(ap_manager_t* manager,
 
   res = destructive ? a : ap_reducedproduct_alloc(intern->size);
 
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { AP_FUNID_MEET_LINCONS_ARRAY, destructive, a, NULL, NULL,
+				    array, NULL, 0, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+    ap_reducedproduct_parallel_bottom(intern,res);
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MEET_LINCONS_ARRAY];
@@ -816,6 +1153,13 @@ ap_reducedproduct_t* ap_reducedproduct_meet_tcons_array(ap_manager_t* manager,
 
   res = destructive ? a : ap_reducedproduct_alloc(intern->size);
 
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { AP_FUNID_MEET_TCONS_ARRAY, destructive, a, NULL, NULL,
+				    array, NULL, 0, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+    ap_reducedproduct_parallel_bottom(intern,res);
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_MEET_TCONS_ARRAY];
@@ -870,6 +1214,14 @@ ap_reducedproduct_asssub_linexpr_array(ap_funid_t funid,
 
   res = destructive ? a : ap_reducedproduct_alloc(intern->size);
 
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { funid, destructive, a, dest, NULL,
+				    texpr, tdim, size, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+    if (dest || funid==AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY)
+      ap_reducedproduct_parallel_bottom(intern,res);
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[funid];
@@ -924,6 +1276,14 @@ ap_reducedproduct_asssub_texpr_array(ap_funid_t funid,
 
   res = destructive ? a : ap_reducedproduct_alloc(intern->size);
 
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { funid, destructive, a, dest, NULL,
+				    texpr, tdim, size, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+    if (dest || funid==AP_FUNID_SUBSTITUTE_TEXPR_ARRAY)
+      ap_reducedproduct_parallel_bottom(intern,res);
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[funid];
@@ -1112,6 +1472,12 @@ ap_reducedproduct_t* ap_reducedproduct_widening(ap_manager_t* manager,
 
   res = ap_reducedproduct_alloc(intern->size);
 
+  if (intern->parallel){
+    ap_reducedproduct_env_t env = { AP_FUNID_WIDENING, false, a1, a2, NULL,
+				    NULL, NULL, 0, res, NULL };
+    ap_reducedproduct_parallel(intern,&env);
+  }
+  else
   for (i=0;i<intern->size;i++){
     ap_manager_t* man = intern->tmanagers[i];
     void* (*ptr)(ap_manager_t*,...) = man->funptr[AP_FUNID_WIDENING];
@@ -1153,6 +1519,7 @@ void ap_reducedproduct_internal_free(void* p)
 {
   ap_reducedproduct_internal_t* intern = (ap_reducedproduct_internal_t*)p;
   size_t i;
+  if (intern->pool) ap_reducedproduct_pool_free(intern->pool);
   for (i=0;i<intern->size;i++){
     ap_manager_free(intern->tmanagers[i]);
     intern->tmanagers[i] = NULL;
@@ -1199,6 +1566,8 @@ ap_manager_t* ap_reducedproduct_manager_alloc
   for (i=0; i<size; i++){
     internal->tmanagers[i] = ap_manager_copy(tab[i]);
   }
+  internal->parallel = false;
+  internal->pool = NULL;
   internal->reduce = reduce;
   internal->approximate = approximate;
   internal->library = library;
@@ -1300,6 +1669,31 @@ ap_manager_t* ap_reducedproduct_manager_alloc
   return man;
 }
 
+bool ap_reducedproduct_set_parallel(ap_manager_t* manager, bool parallel)
+{
+  ap_reducedproduct_internal_t* intern = get_internal_init0(manager);
+  size_t i,j;
+
+  if (parallel){
+    /* components sharing their workspace cannot run concurrently */
+    for (i=0;i<intern->size;i++){
+      for (j=0;j<i;j++){
+	if (intern->tmanagers[i]->internal==intern->tmanagers[j]->internal){
+	  return intern->parallel;
+	}
+      }
+    }
+  }
+  if (parallel && intern->pool==NULL)
+    intern->pool = ap_reducedproduct_pool_alloc(intern);
+  else if (!parallel && intern->pool!=NULL){
+    ap_reducedproduct_pool_free(intern->pool);
+    intern->pool = NULL;
+  }
+  intern->parallel = parallel;
+  return intern->parallel;
+}
+
 /* ============================================================ */
 /* V. Extra functions */
 /* ============================================================ */
@@ -34,6 +34,9 @@ typedef struct ap_reducedproduct_internal_t {
   char* library;               /* (constructed) library name  */
   char* version;               /* (constructed) library version */
   size_t size;                 /* size of the product */
+  bool parallel;               /* are components evaluated concurrently ? */
+  struct ap_reducedproduct_pool_t* pool;
+                               /* threads of the components, if parallel */
   ap_manager_t* tmanagers[0];  /* of size size */
 } ap_reducedproduct_internal_t;
 
@@ -52,6 +55,22 @@ ap_manager_t* ap_reducedproduct_manager_alloc
    /* approximate function */
 );
 
+bool ap_reducedproduct_set_parallel(ap_manager_t* manager, bool parallel);
+  /* If parallel is true, meets, joins, assignments, substitutions, widening
+     and tests (is_leq, is_eq, sat_lincons, sat_tcons) run each component
+     operation in its own thread, and wait for all of them before the
+     (sequential) reduction. The default is false.
+
+     The threads are created when the option is set, and terminated when it
+     is unset or when the manager is freed. The linear expressions passed to
+     these operations may have their singleton intervals replaced by scalars,
+     before the components read them concurrently.
+
+     Requires the component managers to have pairwise distinct internal
+     parts. Otherwise, the option is not set.
+
+     Return the new value of the option. */
+
 /* ============================================================ */
 /* V. Extra functions */
 /* ============================================================ */
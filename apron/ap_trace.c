@@ -0,0 +1,1164 @@
+/* ************************************************************************* */
+/* ap_trace.c: recording and replaying sequences of calls to ap_abstract0 */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <string.h>
+#include <time.h>
+#include "ap_trace.h"
+
+#define AP_TRACE_VERSION 1
+
+/* ********************************************************************** */
+/* I. Encoding */
+/* ********************************************************************** */
+
+static void ap_trace_buf_reserve(ap_trace_buf_t* b, size_t n)
+{
+  if (b->size+n > b->alloc){
+    b->alloc = 2*(b->size+n);
+    b->p = (unsigned char*)realloc(b->p,b->alloc);
+  }
+}
+static void buf_put_byte(ap_trace_buf_t* b, unsigned char c)
+{
+  ap_trace_buf_reserve(b,1);
+  b->p[b->size++] = c;
+}
+static void buf_put_uint(ap_trace_buf_t* b, unsigned long long n)
+{
+  ap_trace_buf_reserve(b,10);
+  while (n>=0x80){
+    b->p[b->size++] = (unsigned char)(n | 0x80);
+    n >>= 7;
+  }
+  b->p[b->size++] = (unsigned char)n;
+}
+static void buf_put_sint(ap_trace_buf_t* b, long long n)
+{
+  buf_put_uint(b, n<0 ? 2*(unsigned long long)(-(n+1))+1 : 2*(unsigned long long)n);
+}
+static void buf_put_mpz(ap_trace_buf_t* b, mpz_t z)
+{
+  size_t n = (mpz_sizeinbase(z,2)+7)/8;
+  size_t count = 0;
+  buf_put_byte(b, mpz_sgn(z)<0);
+  buf_put_uint(b,n);
+  ap_trace_buf_reserve(b,n);
+  mpz_export(b->p+b->size,&count,-1,1,0,0,z);
+  /* count is 0 for 0, smaller than n never otherwise */
+  if (count<n) memset(b->p+b->size+count,0,n-count);
+  b->size += n;
+}
+
+/* Scalars: a tag byte, followed by the value */
+enum {
+  TRACE_SCALAR_DOUBLE,   /* 8 bytes */
+  TRACE_SCALAR_MPQ,      /* numerator and denominator */
+  TRACE_SCALAR_PINF,
+  TRACE_SCALAR_MINF
+};
+static void buf_put_scalar(ap_trace_buf_t* b, ap_scalar_t* s)
+{
+  int sgn = ap_scalar_infty(s);
+  if (sgn){
+    buf_put_byte(b, sgn>0 ? TRACE_SCALAR_PINF : TRACE_SCALAR_MINF);
+  }
+  else if (s->discr==AP_SCALAR_DOUBLE){
+    buf_put_byte(b,TRACE_SCALAR_DOUBLE);
+    ap_trace_buf_reserve(b,sizeof(double));
+    memcpy(b->p+b->size,&s->val.dbl,sizeof(double));
+    b->size += sizeof(double);
+  }
+  else {
+    /* MPQ, and MPFR converted exactly to MPQ */
+    mpq_t q;
+    mpq_init(q);
+    ap_mpq_set_scalar(q,s,GMP_RNDN);
+    buf_put_byte(b,TRACE_SCALAR_MPQ);
+    buf_put_mpz(b,mpq_numref(q));
+    buf_put_mpz(b,mpq_denref(q));
+    mpq_clear(q);
+  }
+}
+static void buf_put_interval(ap_trace_buf_t* b, ap_interval_t* itv)
+{
+  buf_put_scalar(b,itv->inf);
+  buf_put_scalar(b,itv->sup);
+}
+static void buf_put_coeff(ap_trace_buf_t* b, ap_coeff_t* c)
+{
+  buf_put_byte(b,(unsigned char)c->discr);
+  if (c->discr==AP_COEFF_SCALAR)
+    buf_put_scalar(b,c->val.scalar);
+  else
+    buf_put_interval(b,c->val.interval);
+}
+static void buf_put_linexpr0(ap_trace_buf_t* b, ap_linexpr0_t* e)
+{
+  size_t i;
+  buf_put_byte(b,(unsigned char)e->discr);
+  buf_put_uint(b,e->size);
+  buf_put_coeff(b,&e->cst);
+  for (i=0; i<e->size; i++){
+    if (e->discr==AP_LINEXPR_DENSE){
+      buf_put_coeff(b,&e->p.coeff[i]);
+    }
+    else {
+      buf_put_uint(b,e->p.linterm[i].dim);
+      buf_put_coeff(b,&e->p.linterm[i].coeff);
+    }
+  }
+}
+static void buf_put_lincons0(ap_trace_buf_t* b, ap_lincons0_t* cons)
+{
+  buf_put_byte(b,(unsigned char)cons->constyp);
+  buf_put_linexpr0(b,cons->linexpr0);
+  buf_put_byte(b,cons->scalar!=NULL);
+  if (cons->scalar) buf_put_scalar(b,cons->scalar);
+}
+static void buf_put_lincons0_array(ap_trace_buf_t* b, ap_lincons0_array_t* array)
+{
+  size_t i;
+  buf_put_uint(b,array->size);
+  for (i=0; i<array->size; i++) buf_put_lincons0(b,&array->p[i]);
+}
+static void buf_put_texpr0(ap_trace_buf_t* b, ap_texpr0_t* e)
+{
+  buf_put_byte(b,(unsigned char)e->discr);
+  switch (e->discr){
+  case AP_TEXPR_CST:
+    buf_put_coeff(b,&e->val.cst);
+    break;
+  case AP_TEXPR_DIM:
+    buf_put_uint(b,e->val.dim);
+    break;
+  case AP_TEXPR_NODE:
+    buf_put_byte(b,(unsigned char)e->val.node->op);
+    buf_put_byte(b,(unsigned char)e->val.node->type);
+    buf_put_byte(b,(unsigned char)e->val.node->dir);
+    buf_put_texpr0(b,e->val.node->exprA);
+    buf_put_byte(b,e->val.node->exprB!=NULL);
+    if (e->val.node->exprB) buf_put_texpr0(b,e->val.node->exprB);
+    break;
+  default:
+    abort();
+  }
+}
+
+/* ********************************************************************** */
+/* II. Recording */
+/* ********************************************************************** */
+
+#define TRACE_DELETED ((ap_abstract0_t*)1)
+
+static size_t ap_trace_slot(ap_trace_t* t, ap_abstract0_t* a)
+{
+  size_t h = ((size_t)a >> 4) * (size_t)0x9E3779B97F4A7C15ULL;
+  return (h ^ (h >> 29)) & (t->capacity-1);
+}
+/* Index of a in the table, or capacity if absent */
+static size_t ap_trace_find(ap_trace_t* t, ap_abstract0_t* a)
+{
+  size_t i = ap_trace_slot(t,a);
+  while (t->key[i]!=NULL){
+    if (t->key[i]==a) return i;
+    i = (i+1) & (t->capacity-1);
+  }
+  return t->capacity;
+}
+static void ap_trace_insert(ap_trace_t* t, ap_abstract0_t* a, size_t id);
+static void ap_trace_resize(ap_trace_t* t, size_t capacity)
+{
+  ap_abstract0_t** key = t->key;
+  size_t* id = t->id;
+  size_t i, oldcapacity = t->capacity;
+
+  t->capacity = capacity;
+  t->key = (ap_abstract0_t**)calloc(capacity,sizeof(ap_abstract0_t*));
+  t->id = (size_t*)malloc(capacity*sizeof(size_t));
+  t->nbused = 0;
+  for (i=0; i<oldcapacity; i++){
+    if (key[i]!=NULL && key[i]!=TRACE_DELETED)
+      ap_trace_insert(t,key[i],id[i]);
+  }
+  free(key);
+  free(id);
+}
+static void ap_trace_insert(ap_trace_t* t, ap_abstract0_t* a, size_t id)
+{
+  size_t i;
+  if (2*(t->nbused+1) > t->capacity){
+    ap_trace_resize(t,2*t->capacity);
+  }
+  i = ap_trace_slot(t,a);
+  while (t->key[i]!=NULL && t->key[i]!=TRACE_DELETED && t->key[i]!=a)
+    i = (i+1) & (t->capacity-1);
+  if (t->key[i]==NULL) t->nbused++;
+  t->key[i] = a;
+  t->id[i] = id;
+}
+static void ap_trace_remove(ap_trace_t* t, ap_abstract0_t* a)
+{
+  size_t i = ap_trace_find(t,a);
+  if (i<t->capacity) t->key[i] = TRACE_DELETED;
+}
+
+bool ap_trace_start(ap_manager_t* man, FILE* stream)
+{
+  ap_trace_t* t;
+  if (man->trace) return false;
+  t = (ap_trace_t*)malloc(sizeof(ap_trace_t));
+  t->man = man;
+  t->stream = stream;
+  t->busy = false;
+  t->buf.p = NULL; t->buf.size = t->buf.alloc = 0;
+  t->def.p = NULL; t->def.size = t->def.alloc = 0;
+  t->capacity = 256;
+  t->key = (ap_abstract0_t**)calloc(t->capacity,sizeof(ap_abstract0_t*));
+  t->id = (size_t*)malloc(t->capacity*sizeof(size_t));
+  t->nbused = 0;
+  t->nextid = 0;
+  fwrite("APTR",1,4,stream);
+  fputc(AP_TRACE_VERSION,stream);
+  man->trace = t;
+  return true;
+}
+
+void ap_trace_stop(ap_manager_t* man)
+{
+  ap_trace_t* t = man->trace;
+  if (t==NULL) return;
+  fflush(t->stream);
+  free(t->buf.p);
+  free(t->def.p);
+  free(t->key);
+  free(t->id);
+  free(t);
+  man->trace = NULL;
+}
+
+ap_trace_t* ap_trace_begin(ap_manager_t* man, ap_funid_t funid)
+{
+  ap_trace_t* t = man->trace;
+  t->busy = true;
+  t->buf.size = 0;
+  buf_put_byte(&t->buf,(unsigned char)funid);
+  return t;
+}
+
+void ap_trace_end(ap_trace_t* t, ap_abstract0_t* consumed, ap_abstract0_t* res)
+{
+  fwrite(t->buf.p,1,t->buf.size,t->stream);
+  t->buf.size = 0;
+  if (consumed) ap_trace_remove(t,consumed);
+  if (res){
+    ap_trace_insert(t,res,t->nextid);
+    t->nextid++;
+  }
+  t->busy = false;
+}
+
+bool ap_trace_has_value(ap_trace_t* t, ap_abstract0_t* a)
+{
+  return ap_trace_find(t,a)<t->capacity;
+}
+
+void ap_trace_forget(ap_trace_t* t, ap_abstract0_t* a)
+{
+  ap_trace_remove(t,a);
+}
+
+void ap_trace_put_bool(ap_trace_t* t, bool b)
+{ buf_put_byte(&t->buf,b); }
+void ap_trace_put_int(ap_trace_t* t, int n)
+{ buf_put_sint(&t->buf,n); }
+void ap_trace_put_size(ap_trace_t* t, size_t n)
+{ buf_put_uint(&t->buf,n); }
+
+void ap_trace_put_value(ap_trace_t* t, ap_abstract0_t* a)
+{
+  size_t i = ap_trace_find(t,a);
+  if (i==t->capacity){
+    /* Unknown value: define it by its constraints */
+    ap_dimension_t dim = ap_abstract0_dimension(a->man,a);
+    ap_lincons0_array_t array = ap_abstract0_to_lincons_array(a->man,a);
+    t->def.size = 0;
+    buf_put_byte(&t->def,AP_TRACE_DEFINE);
+    buf_put_uint(&t->def,dim.intdim);
+    buf_put_uint(&t->def,dim.realdim);
+    buf_put_lincons0_array(&t->def,&array);
+    fwrite(t->def.p,1,t->def.size,t->stream);
+    ap_lincons0_array_clear(&array);
+    ap_trace_insert(t,a,t->nextid);
+    t->nextid++;
+    i = ap_trace_find(t,a);
+  }
+  buf_put_uint(&t->buf,t->id[i]);
+}
+void ap_trace_put_value_array(ap_trace_t* t, ap_abstract0_t** tab, size_t size)
+{
+  size_t i;
+  buf_put_uint(&t->buf,size);
+  for (i=0; i<size; i++) ap_trace_put_value(t,tab[i]);
+}
+void ap_trace_put_dim_array(ap_trace_t* t, ap_dim_t* tdim, size_t size)
+{
+  size_t i;
+  buf_put_uint(&t->buf,size);
+  for (i=0; i<size; i++) buf_put_uint(&t->buf,tdim[i]);
+}
+void ap_trace_put_interval(ap_trace_t* t, ap_interval_t* itv)
+{ buf_put_interval(&t->buf,itv); }
+void ap_trace_put_interval_array(ap_trace_t* t, ap_interval_t** titv, size_t size)
+{
+  size_t i;
+  buf_put_uint(&t->buf,size);
+  for (i=0; i<size; i++) buf_put_interval(&t->buf,titv[i]);
+}
+void ap_trace_put_linexpr0(ap_trace_t* t, ap_linexpr0_t* e)
+{ buf_put_linexpr0(&t->buf,e); }
+void ap_trace_put_linexpr0_array(ap_trace_t* t, ap_linexpr0_t** tab, size_t size)
+{
+  size_t i;
+  buf_put_uint(&t->buf,size);
+  for (i=0; i<size; i++) buf_put_linexpr0(&t->buf,tab[i]);
+}
+void ap_trace_put_lincons0(ap_trace_t* t, ap_lincons0_t* cons)
+{ buf_put_lincons0(&t->buf,cons); }
+void ap_trace_put_lincons0_array(ap_trace_t* t, ap_lincons0_array_t* array)
+{ buf_put_lincons0_array(&t->buf,array); }
+void ap_trace_put_texpr0(ap_trace_t* t, ap_texpr0_t* e)
+{ buf_put_texpr0(&t->buf,e); }
+void ap_trace_put_texpr0_array(ap_trace_t* t, ap_texpr0_t** tab, size_t size)
+{
+  size_t i;
+  buf_put_uint(&t->buf,size);
+  for (i=0; i<size; i++) buf_put_texpr0(&t->buf,tab[i]);
+}
+void ap_trace_put_tcons0(ap_trace_t* t, ap_tcons0_t* cons)
+{
+  buf_put_byte(&t->buf,(unsigned char)cons->constyp);
+  buf_put_texpr0(&t->buf,cons->texpr0);
+  buf_put_byte(&t->buf,cons->scalar!=NULL);
+  if (cons->scalar) buf_put_scalar(&t->buf,cons->scalar);
+}
+void ap_trace_put_tcons0_array(ap_trace_t* t, ap_tcons0_array_t* array)
+{
+  size_t i;
+  buf_put_uint(&t->buf,array->size);
+  for (i=0; i<array->size; i++) ap_trace_put_tcons0(t,&array->p[i]);
+}
+void ap_trace_put_generator0_array(ap_trace_t* t, ap_generator0_array_t* array)
+{
+  size_t i;
+  buf_put_uint(&t->buf,array->size);
+  for (i=0; i<array->size; i++){
+    buf_put_byte(&t->buf,(unsigned char)array->p[i].gentyp);
+    buf_put_linexpr0(&t->buf,array->p[i].linexpr0);
+  }
+}
+void ap_trace_put_dimchange(ap_trace_t* t, ap_dimchange_t* dimchange)
+{
+  size_t i;
+  buf_put_uint(&t->buf,dimchange->intdim);
+  buf_put_uint(&t->buf,dimchange->realdim);
+  for (i=0; i<dimchange->intdim+dimchange->realdim; i++)
+    buf_put_uint(&t->buf,dimchange->dim[i]);
+}
+void ap_trace_put_dimperm(ap_trace_t* t, ap_dimperm_t* perm)
+{ ap_trace_put_dim_array(t,perm->dim,perm->size); }
+
+/* ********************************************************************** */
+/* III. Decoding */
+/* ********************************************************************** */
+
+typedef struct ap_trace_reader_t {
+  FILE* stream;
+  bool scalar_double;
+  bool error;             /* malformed trace */
+  ap_abstract0_t** value; /* values indexed by their number */
+  size_t nbvalue;
+  size_t maxvalue;
+  mpz_t z;
+} ap_trace_reader_t;
+
+static unsigned char get_byte(ap_trace_reader_t* r)
+{
+  int c = getc(r->stream);
+  if (c==EOF){ r->error = true; return 0; }
+  return (unsigned char)c;
+}
+static unsigned long long get_uint(ap_trace_reader_t* r)
+{
+  unsigned long long n = 0;
+  int shift = 0;
+  unsigned char c;
+  do {
+    c = get_byte(r);
+    if (shift<64) n |= (unsigned long long)(c & 0x7f) << shift;
+    shift += 7;
+  } while ((c & 0x80) && !r->error);
+  return n;
+}
+static long long get_sint(ap_trace_reader_t* r)
+{
+  unsigned long long n = get_uint(r);
+  return (n & 1) ? -(long long)(n>>1)-1 : (long long)(n>>1);
+}
+/* Sizes of arrays are bounded, so that a corrupted trace does not lead to
+   huge allocations */
+static size_t get_size(ap_trace_reader_t* r)
+{
+  unsigned long long n = get_uint(r);
+  if (n > (1ULL<<28)){ r->error = true; return 0; }
+  return (size_t)n;
+}
+static void get_mpz(ap_trace_reader_t* r, mpz_t z)
+{
+  bool neg = get_byte(r);
+  size_t n = get_size(r);
+  unsigned char* p;
+  if (r->error){ mpz_set_ui(z,0); return; }
+  p = (unsigned char*)malloc(n ? n : 1);
+  if (n && fread(p,1,n,r->stream)!=n) r->error = true;
+  mpz_import(z,n,-1,1,0,0,p);
+  if (neg) mpz_neg(z,z);
+  free(p);
+}
+static void get_scalar(ap_trace_reader_t* r, ap_scalar_t* s)
+{
+  unsigned char tag = get_byte(r);
+  switch (tag){
+  case TRACE_SCALAR_DOUBLE:
+    {
+      double d = 0.0;
+      if (fread(&d,sizeof(double),1,r->stream)!=1) r->error = true;
+      ap_scalar_set_double(s,d);
+    }
+    break;
+  case TRACE_SCALAR_MPQ:
+    {
+      mpq_t q;
+      mpq_init(q);
+      get_mpz(r,mpq_numref(q));
+      get_mpz(r,mpq_denref(q));
+      if (r->error || mpz_sgn(mpq_denref(q))==0){
+	r->error = true;
+	mpq_set_ui(q,0,1);
+      }
+      if (r->scalar_double)
+	ap_scalar_set_double(s,mpq_get_d(q));
+      else
+	ap_scalar_set_mpq(s,q);
+      mpq_clear(q);
+    }
+    break;
+  case TRACE_SCALAR_PINF:
+  case TRACE_SCALAR_MINF:
+    if (r->scalar_double) ap_scalar_reinit(s,AP_SCALAR_DOUBLE);
+    ap_scalar_set_infty(s, tag==TRACE_SCALAR_PINF ? 1 : -1);
+    break;
+  default:
+    r->error = true;
+    ap_scalar_set_int(s,0);
+  }
+}
+static void get_interval(ap_trace_reader_t* r, ap_interval_t* itv)
+{
+  get_scalar(r,itv->inf);
+  get_scalar(r,itv->sup);
+}
+static void get_coeff(ap_trace_reader_t* r, ap_coeff_t* c)
+{
+  unsigned char discr = get_byte(r);
+  if (discr==AP_COEFF_SCALAR){
+    ap_coeff_reinit(c,AP_COEFF_SCALAR,AP_SCALAR_DOUBLE);
+    get_scalar(r,c->val.scalar);
+  }
+  else if (discr==AP_COEFF_INTERVAL){
+    ap_coeff_reinit(c,AP_COEFF_INTERVAL,AP_SCALAR_DOUBLE);
+    get_interval(r,c->val.interval);
+  }
+  else {
+    r->error = true;
+  }
+}
+static ap_linexpr0_t* get_linexpr0(ap_trace_reader_t* r)
+{
+  unsigned char discr = get_byte(r);
+  size_t i,size = get_size(r);
+  ap_linexpr0_t* e;
+  if (r->error || discr>AP_LINEXPR_SPARSE){
+    r->error = true;
+    return ap_linexpr0_alloc(AP_LINEXPR_SPARSE,0);
+  }
+  e = ap_linexpr0_alloc((ap_linexpr_discr_t)discr,size);
+  get_coeff(r,&e->cst);
+  for (i=0; i<size && !r->error; i++){
+    if (discr==AP_LINEXPR_DENSE){
+      get_coeff(r,&e->p.coeff[i]);
+    }
+    else {
+      e->p.linterm[i].dim = (ap_dim_t)get_uint(r);
+      get_coeff(r,&e->p.linterm[i].coeff);
+    }
+  }
+  return e;
+}
+static ap_linexpr0_t** get_linexpr0_array(ap_trace_reader_t* r, size_t* size)
+{
+  size_t i;
+  ap_linexpr0_t** tab;
+  *size = get_size(r);
+  tab = (ap_linexpr0_t**)malloc((*size ? *size : 1)*sizeof(ap_linexpr0_t*));
+  for (i=0; i<*size; i++) tab[i] = get_linexpr0(r);
+  return tab;
+}
+static void free_linexpr0_array(ap_linexpr0_t** tab, size_t size)
+{
+  size_t i;
+  for (i=0; i<size; i++) ap_linexpr0_free(tab[i]);
+  free(tab);
+}
+static ap_lincons0_t get_lincons0(ap_trace_reader_t* r)
+{
+  unsigned char constyp = get_byte(r);
+  ap_linexpr0_t* e = get_linexpr0(r);
+  ap_scalar_t* scalar = NULL;
+  if (get_byte(r)){
+    scalar = ap_scalar_alloc();
+    get_scalar(r,scalar);
+  }
+  if (constyp>AP_CONS_DISEQ){
+    r->error = true;
+    constyp = AP_CONS_SUPEQ;
+  }
+  return ap_lincons0_make((ap_constyp_t)constyp,e,scalar);
+}
+static ap_lincons0_array_t get_lincons0_array(ap_trace_reader_t* r)
+{
+  size_t i,size = get_size(r);
+  ap_lincons0_array_t array = ap_lincons0_array_make(size);
+  for (i=0; i<size; i++) array.p[i] = get_lincons0(r);
+  return array;
+}
+static ap_texpr0_t* get_texpr0(ap_trace_reader_t* r, int depth)
+{
+  unsigned char discr = get_byte(r);
+  ap_texpr0_t* e;
+  if (r->error || depth>10000){
+    r->error = true;
+    return ap_texpr0_cst_scalar_int(0);
+  }
+  switch (discr){
+  case AP_TEXPR_CST:
+    e = ap_texpr0_cst_scalar_int(0);
+    get_coeff(r,&e->val.cst);
+    return e;
+  case AP_TEXPR_DIM:
+    return ap_texpr0_dim((ap_dim_t)get_uint(r));
+  case AP_TEXPR_NODE:
+    {
+      unsigned char op = get_byte(r);
+      unsigned char type = get_byte(r);
+      unsigned char dir = get_byte(r);
+      ap_texpr0_t* A;
+      ap_texpr0_t* B = NULL;
+      if (op>AP_TEXPR_SQRT || type>AP_RTYPE_QUAD || dir>AP_RDIR_RND){
+	r->error = true;
+	return ap_texpr0_cst_scalar_int(0);
+      }
+      A = get_texpr0(r,depth+1);
+      if (get_byte(r)) B = get_texpr0(r,depth+1);
+      return ap_texpr0_node((ap_texpr_op_t)op,(ap_texpr_rtype_t)type,
+			    (ap_texpr_rdir_t)dir,A,B);
+    }
+  default:
+    r->error = true;
+    return ap_texpr0_cst_scalar_int(0);
+  }
+}
+static ap_texpr0_t** get_texpr0_array(ap_trace_reader_t* r, size_t* size)
+{
+  size_t i;
+  ap_texpr0_t** tab;
+  *size = get_size(r);
+  tab = (ap_texpr0_t**)malloc((*size ? *size : 1)*sizeof(ap_texpr0_t*));
+  for (i=0; i<*size; i++) tab[i] = get_texpr0(r,0);
+  return tab;
+}
+static void free_texpr0_array(ap_texpr0_t** tab, size_t size)
+{
+  size_t i;
+  for (i=0; i<size; i++) ap_texpr0_free(tab[i]);
+  free(tab);
+}
+static ap_tcons0_t get_tcons0(ap_trace_reader_t* r)
+{
+  unsigned char constyp = get_byte(r);
+  ap_texpr0_t* e = get_texpr0(r,0);
+  ap_scalar_t* scalar = NULL;
+  if (get_byte(r)){
+    scalar = ap_scalar_alloc();
+    get_scalar(r,scalar);
+  }
+  if (constyp>AP_CONS_DISEQ){
+    r->error = true;
+    constyp = AP_CONS_SUPEQ;
+  }
+  return ap_tcons0_make((ap_constyp_t)constyp,e,scalar);
+}
+static ap_tcons0_array_t get_tcons0_array(ap_trace_reader_t* r)
+{
+  size_t i,size = get_size(r);
+  ap_tcons0_array_t array = ap_tcons0_array_make(size);
+  for (i=0; i<size; i++) array.p[i] = get_tcons0(r);
+  return array;
+}
+static ap_generator0_array_t get_generator0_array(ap_trace_reader_t* r)
+{
+  size_t i,size = get_size(r);
+  ap_generator0_array_t array = ap_generator0_array_make(size);
+  for (i=0; i<size; i++){
+    unsigned char gentyp = get_byte(r);
+    if (gentyp>AP_GEN_VERTEX){
+      r->error = true;
+      gentyp = AP_GEN_RAY;
+    }
+    array.p[i] = ap_generator0_make((ap_gentyp_t)gentyp,get_linexpr0(r));
+  }
+  return array;
+}
+static ap_dim_t* get_dim_array(ap_trace_reader_t* r, size_t* size)
+{
+  size_t i;
+  ap_dim_t* tdim;
+  *size = get_size(r);
+  tdim = (ap_dim_t*)malloc((*size ? *size : 1)*sizeof(ap_dim_t));
+  for (i=0; i<*size; i++) tdim[i] = (ap_dim_t)get_uint(r);
+  return tdim;
+}
+static ap_interval_t** get_interval_array(ap_trace_reader_t* r, size_t* size)
+{
+  size_t i;
+  ap_interval_t** titv;
+  *size = get_size(r);
+  titv = ap_interval_array_alloc(*size);
+  for (i=0; i<*size; i++) get_interval(r,titv[i]);
+  return titv;
+}
+static ap_dimchange_t* get_dimchange(ap_trace_reader_t* r)
+{
+  size_t i;
+  size_t intdim = get_size(r);
+  size_t realdim = get_size(r);
+  ap_dimchange_t* dimchange;
+  if (r->error) intdim = realdim = 0;
+  dimchange = ap_dimchange_alloc(intdim,realdim);
+  for (i=0; i<intdim+realdim; i++) dimchange->dim[i] = (ap_dim_t)get_uint(r);
+  return dimchange;
+}
+static ap_dimperm_t* get_dimperm(ap_trace_reader_t* r)
+{
+  size_t i,size = get_size(r);
+  ap_dimperm_t* perm = ap_dimperm_alloc(r->error ? 0 : size);
+  for (i=0; i<perm->size; i++) perm->dim[i] = (ap_dim_t)get_uint(r);
+  return perm;
+}
+
+/* Abstract values */
+static ap_abstract0_t* get_value(ap_trace_reader_t* r)
+{
+  unsigned long long id = get_uint(r);
+  if (r->error || id>=r->nbvalue || r->value[id]==NULL){
+    r->error = true;
+    return NULL;
+  }
+  return r->value[id];
+}
+static ap_abstract0_t** get_value_array(ap_trace_reader_t* r, size_t* size)
+{
+  size_t i;
+  ap_abstract0_t** tab;
+  *size = get_size(r);
+  tab = (ap_abstract0_t**)malloc((*size ? *size : 1)*sizeof(ap_abstract0_t*));
+  for (i=0; i<*size; i++) tab[i] = get_value(r);
+  return tab;
+}
+static void set_value(ap_trace_reader_t* r, ap_abstract0_t* a)
+{
+  if (r->nbvalue==r->maxvalue){
+    r->maxvalue = r->maxvalue ? 2*r->maxvalue : 256;
+    r->value = (ap_abstract0_t**)realloc(r->value,r->maxvalue*sizeof(ap_abstract0_t*));
+  }
+  r->value[r->nbvalue++] = a;
+}
+/* Forget the argument consumed by a destructive call */
+static void forget_value(ap_trace_reader_t* r, ap_abstract0_t* a)
+{
+  size_t i = r->nbvalue;
+  while (i>0){
+    i--;
+    if (r->value[i]==a){ r->value[i] = NULL; return; }
+  }
+}
+
+/* ********************************************************************** */
+/* IV. Replay */
+/* ********************************************************************** */
+
+static double ap_trace_clock(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+}
+
+/* Timed call to an ap_abstract0 function; the event is skipped if the
+   arguments are malformed */
+#define TRACE_CALL(funid,call)						\
+  if (!r->error){							\
+    double _t0;								\
+    man->result.exn = AP_EXC_NONE;					\
+    _t0 = ap_trace_clock();						\
+    call;								\
+    if (stat){								\
+      stat->time[funid] += ap_trace_clock()-_t0;			\
+      stat->count[funid]++;						\
+      if (man->result.exn!=AP_EXC_NONE) stat->nexc[funid]++;		\
+    }									\
+  }
+
+/* Destructive calls: consumed is the first abstract argument */
+#define TRACE_RES(destructive,consumed,res)				\
+  if (!r->error){							\
+    if (destructive) forget_value(r,consumed);				\
+    set_value(r,res);							\
+  }
+
+bool ap_trace_replay(ap_manager_t* man, FILE* stream,
+		     bool scalar_double,
+		     ap_trace_stat_t* stat)
+{
+  ap_trace_reader_t reader;
+  ap_trace_reader_t* r = &reader;
+  char header[5];
+  size_t i;
+  int c;
+
+  r->stream = stream;
+  r->scalar_double = scalar_double;
+  r->error = false;
+  r->value = NULL;
+  r->nbvalue = r->maxvalue = 0;
+
+  if (fread(header,1,5,stream)!=5 || memcmp(header,"APTR",4)!=0 ||
+      header[4]!=AP_TRACE_VERSION){
+    return false;
+  }
+  while (!r->error && (c=getc(stream))!=EOF){
+    ap_funid_t funid = (ap_funid_t)c;
+    ap_abstract0_t* res = NULL;
+    ap_abstract0_t* a = NULL;
+    ap_abstract0_t* a2 = NULL;
+    bool destructive = false;
+
+    switch (c){
+    case AP_TRACE_DEFINE:
+      {
+	size_t intdim = get_size(r);
+	size_t realdim = get_size(r);
+	ap_lincons0_array_t array = get_lincons0_array(r);
+	if (!r->error){
+	  set_value(r,ap_abstract0_of_lincons_array(man,intdim,realdim,&array));
+	}
+	ap_lincons0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_COPY:
+      a = get_value(r);
+      TRACE_CALL(funid,res = ap_abstract0_copy(man,a));
+      TRACE_RES(false,NULL,res);
+      break;
+    case AP_FUNID_FREE:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_free(man,a));
+      if (!r->error) forget_value(r,a);
+      break;
+    case AP_FUNID_ASIZE:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_size(man,a));
+      break;
+    case AP_FUNID_MINIMIZE:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_minimize(man,a));
+      break;
+    case AP_FUNID_CANONICALIZE:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_canonicalize(man,a));
+      break;
+    case AP_FUNID_HASH:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_hash(man,a));
+      break;
+    case AP_FUNID_APPROXIMATE:
+      {
+	int n;
+	a = get_value(r);
+	n = (int)get_sint(r);
+	TRACE_CALL(funid,ap_abstract0_approximate(man,a,n));
+      }
+      break;
+    case AP_FUNID_BOTTOM:
+    case AP_FUNID_TOP:
+      {
+	size_t intdim = get_size(r);
+	size_t realdim = get_size(r);
+	if (c==AP_FUNID_BOTTOM){
+	  TRACE_CALL(funid,res = ap_abstract0_bottom(man,intdim,realdim));
+	}
+	else {
+	  TRACE_CALL(funid,res = ap_abstract0_top(man,intdim,realdim));
+	}
+	TRACE_RES(false,NULL,res);
+      }
+      break;
+    case AP_FUNID_OF_BOX:
+      {
+	size_t intdim = get_size(r);
+	size_t realdim = get_size(r);
+	size_t size;
+	ap_interval_t** titv = get_interval_array(r,&size);
+	if (size!=intdim+realdim) r->error = true;
+	TRACE_CALL(funid,res = ap_abstract0_of_box(man,intdim,realdim,titv));
+	TRACE_RES(false,NULL,res);
+	ap_interval_array_free(titv,size);
+      }
+      break;
+    case AP_FUNID_IS_BOTTOM:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_is_bottom(man,a));
+      break;
+    case AP_FUNID_IS_TOP:
+      a = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_is_top(man,a));
+      break;
+    case AP_FUNID_IS_LEQ:
+      a = get_value(r);
+      a2 = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_is_leq(man,a,a2));
+      break;
+    case AP_FUNID_IS_EQ:
+      a = get_value(r);
+      a2 = get_value(r);
+      TRACE_CALL(funid,ap_abstract0_is_eq(man,a,a2));
+      break;
+    case AP_FUNID_SAT_LINCONS:
+      {
+	ap_lincons0_t cons;
+	a = get_value(r);
+	cons = get_lincons0(r);
+	TRACE_CALL(funid,ap_abstract0_sat_lincons(man,a,&cons));
+	ap_lincons0_clear(&cons);
+      }
+      break;
+    case AP_FUNID_SAT_TCONS:
+      {
+	ap_tcons0_t cons;
+	a = get_value(r);
+	cons = get_tcons0(r);
+	TRACE_CALL(funid,ap_abstract0_sat_tcons(man,a,&cons));
+	ap_tcons0_clear(&cons);
+      }
+      break;
+    case AP_FUNID_SAT_INTERVAL:
+      {
+	ap_dim_t dim;
+	ap_interval_t* itv = ap_interval_alloc();
+	a = get_value(r);
+	dim = (ap_dim_t)get_uint(r);
+	get_interval(r,itv);
+	TRACE_CALL(funid,ap_abstract0_sat_interval(man,a,dim,itv));
+	ap_interval_free(itv);
+      }
+      break;
+    case AP_FUNID_IS_DIMENSION_UNCONSTRAINED:
+      {
+	ap_dim_t dim;
+	a = get_value(r);
+	dim = (ap_dim_t)get_uint(r);
+	TRACE_CALL(funid,ap_abstract0_is_dimension_unconstrained(man,a,dim));
+      }
+      break;
+    case AP_FUNID_BOUND_LINEXPR:
+      {
+	ap_linexpr0_t* e;
+	ap_interval_t* itv = NULL;
+	a = get_value(r);
+	e = get_linexpr0(r);
+	TRACE_CALL(funid,itv = ap_abstract0_bound_linexpr(man,a,e));
+	if (itv) ap_interval_free(itv);
+	ap_linexpr0_free(e);
+      }
+      break;
+    case AP_FUNID_BOUND_TEXPR:
+      {
+	ap_texpr0_t* e;
+	ap_interval_t* itv = NULL;
+	a = get_value(r);
+	e = get_texpr0(r,0);
+	TRACE_CALL(funid,itv = ap_abstract0_bound_texpr(man,a,e));
+	if (itv) ap_interval_free(itv);
+	ap_texpr0_free(e);
+      }
+      break;
+    case AP_FUNID_BOUND_DIMENSION:
+      {
+	ap_dim_t dim;
+	ap_interval_t* itv = NULL;
+	a = get_value(r);
+	dim = (ap_dim_t)get_uint(r);
+	TRACE_CALL(funid,itv = ap_abstract0_bound_dimension(man,a,dim));
+	if (itv) ap_interval_free(itv);
+      }
+      break;
+    case AP_FUNID_TO_LINCONS_ARRAY:
+      {
+	ap_lincons0_array_t array = { NULL, 0 };
+	a = get_value(r);
+	TRACE_CALL(funid,array = ap_abstract0_to_lincons_array(man,a));
+	ap_lincons0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_TO_TCONS_ARRAY:
+      {
+	ap_tcons0_array_t array = { NULL, 0 };
+	a = get_value(r);
+	TRACE_CALL(funid,array = ap_abstract0_to_tcons_array(man,a));
+	ap_tcons0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_TO_BOX:
+      {
+	ap_interval_t** titv = NULL;
+	ap_dimension_t dim = { 0, 0 };
+	a = get_value(r);
+	if (!r->error) dim = ap_abstract0_dimension(man,a);
+	TRACE_CALL(funid,titv = ap_abstract0_to_box(man,a));
+	if (titv) ap_interval_array_free(titv,dim.intdim+dim.realdim);
+      }
+      break;
+    case AP_FUNID_TO_GENERATOR_ARRAY:
+      {
+	ap_generator0_array_t array = { NULL, 0 };
+	a = get_value(r);
+	TRACE_CALL(funid,array = ap_abstract0_to_generator_array(man,a));
+	ap_generator0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_MEET:
+    case AP_FUNID_JOIN:
+      destructive = get_byte(r);
+      a = get_value(r);
+      a2 = get_value(r);
+      TRACE_CALL(funid,res = ap_abstract0_meetjoin(funid,man,destructive,a,a2));
+      TRACE_RES(destructive,a,res);
+      break;
+    case AP_FUNID_MEET_ARRAY:
+    case AP_FUNID_JOIN_ARRAY:
+      {
+	size_t size;
+	ap_abstract0_t** tab = get_value_array(r,&size);
+	TRACE_CALL(funid,res = ap_abstract0_meetjoin_array(funid,man,tab,size));
+	TRACE_RES(false,NULL,res);
+	free(tab);
+      }
+      break;
+    case AP_FUNID_MEET_LINCONS_ARRAY:
+      {
+	ap_lincons0_array_t array;
+	destructive = get_byte(r);
+	a = get_value(r);
+	array = get_lincons0_array(r);
+	TRACE_CALL(funid,res = ap_abstract0_meet_lincons_array(man,destructive,a,&array));
+	TRACE_RES(destructive,a,res);
+	ap_lincons0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_MEET_TCONS_ARRAY:
+      {
+	ap_tcons0_array_t array;
+	destructive = get_byte(r);
+	a = get_value(r);
+	array = get_tcons0_array(r);
+	TRACE_CALL(funid,res = ap_abstract0_meet_tcons_array(man,destructive,a,&array));
+	TRACE_RES(destructive,a,res);
+	ap_tcons0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_ADD_RAY_ARRAY:
+      {
+	ap_generator0_array_t array;
+	destructive = get_byte(r);
+	a = get_value(r);
+	array = get_generator0_array(r);
+	TRACE_CALL(funid,res = ap_abstract0_add_ray_array(man,destructive,a,&array));
+	TRACE_RES(destructive,a,res);
+	ap_generator0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_ASSIGN_LINEXPR_ARRAY:
+    case AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY:
+      {
+	size_t size,size2;
+	ap_dim_t* tdim;
+	ap_linexpr0_t** texpr;
+	destructive = get_byte(r);
+	a = get_value(r);
+	tdim = get_dim_array(r,&size);
+	texpr = get_linexpr0_array(r,&size2);
+	if (size!=size2) r->error = true;
+	if (get_byte(r)) a2 = get_value(r);
+	TRACE_CALL(funid,res = ap_abstract0_asssub_linexpr_array(funid,man,destructive,a,tdim,texpr,size,a2));
+	TRACE_RES(destructive,a,res);
+	free(tdim);
+	free_linexpr0_array(texpr,size2);
+      }
+      break;
+    case AP_FUNID_ASSIGN_TEXPR_ARRAY:
+    case AP_FUNID_SUBSTITUTE_TEXPR_ARRAY:
+      {
+	size_t size,size2;
+	ap_dim_t* tdim;
+	ap_texpr0_t** texpr;
+	destructive = get_byte(r);
+	a = get_value(r);
+	tdim = get_dim_array(r,&size);
+	texpr = get_texpr0_array(r,&size2);
+	if (size!=size2) r->error = true;
+	if (get_byte(r)) a2 = get_value(r);
+	TRACE_CALL(funid,res = ap_abstract0_asssub_texpr_array(funid,man,destructive,a,tdim,texpr,size,a2));
+	TRACE_RES(destructive,a,res);
+	free(tdim);
+	free_texpr0_array(texpr,size2);
+      }
+      break;
+    case AP_FUNID_FORGET_ARRAY:
+      {
+	size_t size;
+	ap_dim_t* tdim;
+	bool project;
+	destructive = get_byte(r);
+	a = get_value(r);
+	tdim = get_dim_array(r,&size);
+	project = get_byte(r);
+	TRACE_CALL(funid,res = ap_abstract0_forget_array(man,destructive,a,tdim,size,project));
+	TRACE_RES(destructive,a,res);
+	free(tdim);
+      }
+      break;
+    case AP_FUNID_ADD_DIMENSIONS:
+    case AP_FUNID_REMOVE_DIMENSIONS:
+      {
+	ap_dimchange_t* dimchange;
+	bool project = false;
+	destructive = get_byte(r);
+	a = get_value(r);
+	dimchange = get_dimchange(r);
+	if (c==AP_FUNID_ADD_DIMENSIONS){
+	  project = get_byte(r);
+	  TRACE_CALL(funid,res = ap_abstract0_add_dimensions(man,destructive,a,dimchange,project));
+	}
+	else {
+	  TRACE_CALL(funid,res = ap_abstract0_remove_dimensions(man,destructive,a,dimchange));
+	}
+	TRACE_RES(destructive,a,res);
+	ap_dimchange_free(dimchange);
+      }
+      break;
+    case AP_FUNID_PERMUTE_DIMENSIONS:
+      {
+	ap_dimperm_t* perm;
+	destructive = get_byte(r);
+	a = get_value(r);
+	perm = get_dimperm(r);
+	TRACE_CALL(funid,res = ap_abstract0_permute_dimensions(man,destructive,a,perm));
+	TRACE_RES(destructive,a,res);
+	ap_dimperm_free(perm);
+      }
+      break;
+    case AP_FUNID_EXPAND:
+      {
+	ap_dim_t dim;
+	size_t n;
+	destructive = get_byte(r);
+	a = get_value(r);
+	dim = (ap_dim_t)get_uint(r);
+	n = get_size(r);
+	TRACE_CALL(funid,res = ap_abstract0_expand(man,destructive,a,dim,n));
+	TRACE_RES(destructive,a,res);
+      }
+      break;
+    case AP_FUNID_FOLD:
+      {
+	size_t size;
+	ap_dim_t* tdim;
+	destructive = get_byte(r);
+	a = get_value(r);
+	tdim = get_dim_array(r,&size);
+	TRACE_CALL(funid,res = ap_abstract0_fold(man,destructive,a,tdim,size));
+	TRACE_RES(destructive,a,res);
+	free(tdim);
+      }
+      break;
+    case AP_FUNID_WIDENING:
+      a = get_value(r);
+      a2 = get_value(r);
+      TRACE_CALL(funid,res = ap_abstract0_widening(man,a,a2));
+      TRACE_RES(false,NULL,res);
+      break;
+    case AP_TRACE_WIDENING_THRESHOLD:
+      {
+	ap_lincons0_array_t array;
+	a = get_value(r);
+	a2 = get_value(r);
+	array = get_lincons0_array(r);
+	TRACE_CALL(AP_FUNID_WIDENING,res = ap_abstract0_widening_threshold(man,a,a2,&array));
+	TRACE_RES(false,NULL,res);
+	ap_lincons0_array_clear(&array);
+      }
+      break;
+    case AP_FUNID_CLOSURE:
+      destructive = get_byte(r);
+      a = get_value(r);
+      TRACE_CALL(funid,res = ap_abstract0_closure(man,destructive,a));
+      TRACE_RES(destructive,a,res);
+      break;
+    default:
+      r->error = true;
+    }
+    if (r->error && res) ap_abstract0_free(man,res);
+  }
+  for (i=0; i<r->nbvalue; i++){
+    if (r->value[i]) ap_abstract0_free(man,r->value[i]);
+  }
+  free(r->value);
+  return !r->error;
+}
+
+void ap_trace_stat_fprint(FILE* stream, ap_trace_stat_t* stat)
+{
+  size_t i;
+  for (i=0; i<AP_FUNID_SIZE; i++){
+    if (stat->count[i]){
+      fprintf(stream,"%s,%lu,%.9f,%lu\n",
+	      ap_name_of_funid[i],
+	      (unsigned long)stat->count[i],
+	      stat->time[i],
+	      (unsigned long)stat->nexc[i]);
+    }
+  }
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************* */
+/* ap_trace.h: recording and replaying sequences of calls to ap_abstract0 */
+/* ************************************************************************* */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* A trace records the calls to the ap_abstract0_* functions made on a
+   manager, in a compact binary form that does not depend on the underlying
+   library: abstract values are identified by a number, and the other
+   arguments (expressions, constraints, dimensions, flags...) are stored by
+   value. A trace can then be replayed against any manager, which allows to
+   reproduce the workload of an analyzer on several domains.
+
+   Format:
+   - the header "APTR" followed by the version byte 1;
+   - a sequence of events, each one starting with an ap_funid_t byte (or
+     AP_TRACE_DEFINE, AP_TRACE_WIDENING_THRESHOLD) followed by the arguments
+     of the call, in the order of the ap_abstract0_* function.
+
+   Unsigned integers are coded in LEB128 (7 bits per byte, least significant
+   first), signed integers in zigzag LEB128. An abstract value is coded by
+   its number: the abstract values returned by the recorded calls are
+   numbered 0,1,2... in order. A value that has not been created by a
+   recorded call (because it has been created before the start of the trace
+   or by deserialization) is first defined by an AP_TRACE_DEFINE event, with
+   its dimensions and its ap_abstract0_to_lincons_array conversion; it is
+   thus only approximated if the domain is not exactly representable by
+   linear constraints.
+
+   Only the outermost call is recorded: the calls to ap_abstract0_*
+   functions made by the implementation of a recorded call are not. */
+
+#ifndef _AP_TRACE_H_
+#define _AP_TRACE_H_
+
+#include <stdio.h>
+#include "ap_manager.h"
+#include "ap_expr0.h"
+#include "ap_abstract0.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AP_TRACE_DEFINE 0xff
+#define AP_TRACE_WIDENING_THRESHOLD 0xfe
+  /* ap_abstract0_widening_threshold, which has no ap_funid_t of its own;
+     counted as AP_FUNID_WIDENING in the statistics of a replay */
+
+/* Growing buffer of bytes */
+typedef struct ap_trace_buf_t {
+  unsigned char* p;
+  size_t size;
+  size_t alloc;
+} ap_trace_buf_t;
+
+/* Recording state of a manager (see ap_manager_t.trace).
+   Meant to be an abstract datatype ! */
+typedef struct ap_trace_t {
+  ap_manager_t* man;    /* traced manager (not referenced) */
+  FILE* stream;         /* output stream */
+  bool busy;            /* a call is being recorded */
+  ap_trace_buf_t buf;   /* encoding of the current event */
+  ap_trace_buf_t def;   /* encoding of AP_TRACE_DEFINE events */
+  /* Numbers of the live abstract values: hashtable with linear probing */
+  ap_abstract0_t** key; /* NULL: empty, (ap_abstract0_t*)1: deleted */
+  size_t* id;
+  size_t capacity;      /* power of 2 */
+  size_t nbused;        /* number of non-empty slots */
+  size_t nextid;        /* number of the next defined value */
+} ap_trace_t;
+
+/* Cumulated statistics of a replay */
+typedef struct ap_trace_stat_t {
+  size_t count[AP_FUNID_SIZE];  /* number of calls */
+  double time[AP_FUNID_SIZE];   /* cumulated time, in seconds */
+  size_t nexc[AP_FUNID_SIZE];   /* number of calls raising an exception */
+} ap_trace_stat_t;
+
+/* ********************************************************************** */
+/* I. User functions */
+/* ********************************************************************** */
+
+bool ap_trace_start(ap_manager_t* man, FILE* stream);
+  /* Start recording the calls made on man into stream, which should be
+     opened in binary mode. Return false if man is already traced.
+
+     The trace is attached to the manager itself, not to its clones (see
+     ap_manager_clone_for_thread). It is not thread-safe. */
+
+void ap_trace_stop(ap_manager_t* man);
+  /* Stop recording and flush stream (which is not closed). Automatically
+     called when man is deallocated. */
+
+bool ap_trace_replay(ap_manager_t* man, FILE* stream,
+		     bool scalar_double,
+		     ap_trace_stat_t* stat);
+  /* Replay the calls recorded in stream on man, and accumulate in stat
+     (if not NULL) the number of calls and the time spent in the
+     ap_abstract0_* functions for each ap_funid_t (AP_TRACE_DEFINE events
+     are not counted).
+
+     If scalar_double is true, all the scalars of the trace are converted
+     to double, for libraries that only accept them (the results are then
+     only meaningful for benchmarking).
+
+     The values still alive at the end of the trace are freed. Return false
+     if the trace is malformed, in which case the events before the
+     offending one have been replayed. */
+
+void ap_trace_stat_fprint(FILE* stream, ap_trace_stat_t* stat);
+  /* Print the statistics, one line "function,count,time,exceptions" per
+     function called at least once */
+
+/* ********************************************************************** */
+/* II. Recording (used by ap_abstract0.c) */
+/* ********************************************************************** */
+
+/* Functions meant to be internal */
+
+static inline bool ap_trace_on(ap_manager_t* man);
+  /* Should the current call on man be recorded ? */
+
+ap_trace_t* ap_trace_begin(ap_manager_t* man, ap_funid_t funid);
+  /* Start the event of a call; nested calls are not recorded until
+     ap_trace_end. */
+void ap_trace_end(ap_trace_t* t, ap_abstract0_t* consumed, ap_abstract0_t* res);
+  /* Write the event, forget the consumed argument of a destructive call
+     (if not NULL) and number the returned value res (if not NULL). */
+
+bool ap_trace_has_value(ap_trace_t* t, ap_abstract0_t* a);
+  /* Has a been numbered ? */
+void ap_trace_forget(ap_trace_t* t, ap_abstract0_t* a);
+  /* Forget the number of a, without recording anything */
+
+void ap_trace_put_bool(ap_trace_t* t, bool b);
+void ap_trace_put_int(ap_trace_t* t, int n);
+void ap_trace_put_size(ap_trace_t* t, size_t n);
+void ap_trace_put_value(ap_trace_t* t, ap_abstract0_t* a);
+void ap_trace_put_value_array(ap_trace_t* t, ap_abstract0_t** tab, size_t size);
+void ap_trace_put_dim_array(ap_trace_t* t, ap_dim_t* tdim, size_t size);
+void ap_trace_put_interval(ap_trace_t* t, ap_interval_t* itv);
+void ap_trace_put_interval_array(ap_trace_t* t, ap_interval_t** titv, size_t size);
+void ap_trace_put_linexpr0(ap_trace_t* t, ap_linexpr0_t* e);
+void ap_trace_put_linexpr0_array(ap_trace_t* t, ap_linexpr0_t** tab, size_t size);
+void ap_trace_put_lincons0(ap_trace_t* t, ap_lincons0_t* cons);
+void ap_trace_put_lincons0_array(ap_trace_t* t, ap_lincons0_array_t* array);
+void ap_trace_put_texpr0(ap_trace_t* t, ap_texpr0_t* e);
+void ap_trace_put_texpr0_array(ap_trace_t* t, ap_texpr0_t** tab, size_t size);
+void ap_trace_put_tcons0(ap_trace_t* t, ap_tcons0_t* cons);
+void ap_trace_put_tcons0_array(ap_trace_t* t, ap_tcons0_array_t* array);
+void ap_trace_put_generator0_array(ap_trace_t* t, ap_generator0_array_t* array);
+void ap_trace_put_dimchange(ap_trace_t* t, ap_dimchange_t* dimchange);
+void ap_trace_put_dimperm(ap_trace_t* t, ap_dimperm_t* perm);
+  /* Append an argument to the current event */
+
+static inline bool ap_trace_on(ap_manager_t* man)
+{
+  return man->trace!=NULL && !man->trace->busy;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
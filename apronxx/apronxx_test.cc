@@ -13,6 +13,10 @@
 
 #include <iostream>
 #include <stdio.h>
+#if __cplusplus >= 201103L
+#include <type_traits>
+#include <utility>
+#endif
 #include "apronxx.hh"
 
 #include "apxx_box.hh"
@@ -1858,6 +1862,73 @@ void test_tcons1_array()
 }
 
 
+#if __cplusplus >= 201103L
+template<class T> struct nothrow_movable {
+  static const bool value =
+    std::is_nothrow_move_constructible<T>::value &&
+    std::is_nothrow_move_assignable<T>::value;
+};
+
+static_assert(nothrow_movable<scalar>::value, "scalar");
+static_assert(nothrow_movable<interval>::value, "interval");
+static_assert(nothrow_movable<interval_array>::value, "interval_array");
+static_assert(nothrow_movable<coeff>::value, "coeff");
+static_assert(nothrow_movable<dimchange>::value, "dimchange");
+static_assert(nothrow_movable<dimperm>::value, "dimperm");
+static_assert(nothrow_movable<linexpr0>::value, "linexpr0");
+static_assert(nothrow_movable<lincons0>::value, "lincons0");
+static_assert(nothrow_movable<lincons0_array>::value, "lincons0_array");
+static_assert(nothrow_movable<generator0>::value, "generator0");
+static_assert(nothrow_movable<generator0_array>::value, "generator0_array");
+static_assert(nothrow_movable<texpr0>::value, "texpr0");
+static_assert(nothrow_movable<tcons0>::value, "tcons0");
+static_assert(nothrow_movable<tcons0_array>::value, "tcons0_array");
+static_assert(nothrow_movable<linexpr1>::value, "linexpr1");
+static_assert(nothrow_movable<lincons1>::value, "lincons1");
+static_assert(nothrow_movable<lincons1_array>::value, "lincons1_array");
+static_assert(nothrow_movable<generator1>::value, "generator1");
+static_assert(nothrow_movable<generator1_array>::value, "generator1_array");
+static_assert(nothrow_movable<texpr1>::value, "texpr1");
+static_assert(nothrow_movable<tcons1>::value, "tcons1");
+static_assert(nothrow_movable<tcons1_array>::value, "tcons1_array");
+static_assert(nothrow_movable<abstract0>::value, "abstract0");
+static_assert(nothrow_movable<abstract1>::value, "abstract1");
+
+void test_move()
+{
+  cout << endl << "moves" 
+       << endl << "=====" << endl << endl;
+
+  scalar s = frac(1,5);
+  scalar s2(std::move(s));    cout << "move scalar 1/5:      " << s2 << endl;
+  s = 3; s = std::move(s2);   cout << "move assign 1/5:      " << s << endl;
+
+  interval i(1,2);
+  interval i2(std::move(i));  cout << "move interval [1,2]:  " << i2 << endl;
+  i = top(); i = std::move(i2);
+  assert(i==interval(1,2));
+
+  coeff c[3] = { 1,2,3 };
+  linexpr0 l(3,c,4);
+  linexpr0 l2(std::move(l));  cout << "move linexpr0:        " << l2 << endl;
+  l = std::move(l2);          cout << "move assign linexpr0: " << l << endl;
+
+  vector<lincons0> v;
+  for (int k=0;k<4;k++) v.push_back(lincons0(AP_CONS_SUPEQ,linexpr0(3,c,k)));
+  lincons0_array a(v);
+  lincons0_array a2(std::move(a));
+  cout << "move lincons0_array:  " << a2 << endl;
+
+  texpr0 t = dim(1)*dim(2)+3;
+  texpr0 t2(std::move(t));    cout << "move texpr0:          " << t2 << endl;
+
+  var vr[2] = { "x","y" };
+  environment env(NULL,0,vr,2);
+  linexpr1 l1(env,linexpr0(2,c,5));
+  linexpr1 l12(std::move(l1)); cout << "move linexpr1:        " << l12 << endl;
+}
+#endif
+
 void test_abstract0(manager& m, manager& mm)
 {
   cout << "level 0" << endl << endl;
@@ -2061,6 +2132,37 @@ void test_abstract0(manager& m, manager& mm)
   assert(a1==a2);
   cout << "add rays:           " << a1 << endl;
 
+#if __cplusplus >= 201103L
+  // the rvalue versions reuse their argument, with the same results
+
+  a1 = abstract0(m,2,3,ia);
+  a2 = abstract0(m,2,3,ca);
+  meet(m,a3,a1,a2);
+  a4 = a1; meet(m,a5,std::move(a4),a2); assert(a5==a3);
+  a5 = a1; meet(m,a5,std::move(a5),a2); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)*a2==a3);
+  meet(m,a3,a1,ca);
+  a4 = a1; meet(m,a5,std::move(a4),ca); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)*ca==a3);
+  meet(m,a3,a1,ta);
+  a4 = a1; meet(m,a5,std::move(a4),ta); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)*ta==a3);
+  join(m,a3,a1,a2);
+  a4 = a1; join(m,a5,std::move(a4),a2); assert(a5==a3);
+  a5 = a1; join(m,a5,std::move(a5),a2); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)+a2==a3);
+  add_rays(m,a3,a1,ga);
+  a4 = a1; add_rays(m,a5,std::move(a4),ga); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)+ga==a3);
+  try {
+    closure(m,a3,a2);
+    a4 = a2; closure(m,a5,std::move(a4)); assert(a5==a3);
+  }
+  catch (not_implemented& c) {}
+  a4 = a1; a5 = std::move(a4); assert(a5==a1);
+  abstract0 a6(std::move(a5)); assert(a6==a1);
+#endif
+
   // assign
 
   a1 = abstract0(m,2,3,ia);
@@ -2505,6 +2607,37 @@ void test_abstract1(manager& m, manager& mm)
   assert(a1==a2);
   cout << "add rays:           " << a1 << endl;
 
+#if __cplusplus >= 201103L
+  // the rvalue versions reuse their argument, with the same results
+
+  a1 = abstract1(m,env,va,ia);
+  a2 = abstract1(m,ca);
+  meet(m,a3,a1,a2);
+  a4 = a1; meet(m,a5,std::move(a4),a2); assert(a5==a3);
+  a5 = a1; meet(m,a5,std::move(a5),a2); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)*a2==a3);
+  meet(m,a3,a1,ca);
+  a4 = a1; meet(m,a5,std::move(a4),ca); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)*ca==a3);
+  meet(m,a3,a1,ta);
+  a4 = a1; meet(m,a5,std::move(a4),ta); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)*ta==a3);
+  join(m,a3,a1,a2);
+  a4 = a1; join(m,a5,std::move(a4),a2); assert(a5==a3);
+  a5 = a1; join(m,a5,std::move(a5),a2); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)+a2==a3);
+  add_rays(m,a3,a1,ga);
+  a4 = a1; add_rays(m,a5,std::move(a4),ga); assert(a5==a3);
+  a4 = a1; assert(std::move(a4)+ga==a3);
+  try {
+    closure(m,a3,a2);
+    a4 = a2; closure(m,a5,std::move(a4)); assert(a5==a3);
+  }
+  catch (not_implemented& c) {}
+  a4 = a1; a5 = std::move(a4); assert(a5==a1);
+  abstract1 a6(std::move(a5)); assert(a6==a1);
+#endif
+
   // unify
 
   a1 = abstract1(m,env,va,ia);
@@ -2872,6 +3005,9 @@ int main()
   test_texpr1();
   test_tcons1();
   test_tcons1_array();
+#if __cplusplus >= 201103L
+  test_move();
+#endif
   test_box();
   test_polka();
   test_octagon();
@@ -122,6 +122,14 @@ public:
    */
   abstract0(const abstract0& t);
 
+#if __cplusplus >= 201103L
+  /*! \brief Moves the abstract element of t into *this (no copy).
+   *
+   * t is left without abstract element: it can only be destroyed or assigned to.
+   */
+  abstract0(abstract0&& t) noexcept;
+#endif
+
   //@}
 
   
@@ -159,6 +167,14 @@ public:
    */
   abstract0& operator=(const abstract0& t);
 
+#if __cplusplus >= 201103L
+  /*! \brief Swaps the abstract elements of *this and t (no copy).
+   *
+   * The former abstract element of *this is destroyed with t.
+   */
+  abstract0& operator=(abstract0&& t) noexcept;
+#endif
+
   /*! \brief Assigns the full space to *this.
    *
    * Implicitly uses the manager used to create *this.
@@ -470,6 +486,16 @@ public:
    */
   friend abstract0& meet(manager& m, abstract0& dst, const abstract0& x, const abstract0& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with the meet of x and y, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract0& meet(manager& m, abstract0& dst, abstract0&& x, const abstract0& y);
+#endif
+
   /*! \brief Replaces dst with the meet of all abstract elements in x.
    *
    * \return a reference to dst.
@@ -494,6 +520,16 @@ public:
    */
   friend abstract0& meet(manager& m, abstract0& dst, const abstract0& x, const lincons0_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with x with some linear constraints added, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract0& meet(manager& m, abstract0& dst, abstract0&& x, const lincons0_array& y);
+#endif
+
   /*! \brief Adds some arbitrary constraints to *this (modified in-place).
    *
    * \return a reference to *this.
@@ -506,6 +542,16 @@ public:
    */
   friend abstract0& meet(manager& m, abstract0& dst, const abstract0& x, const tcons0_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with x with some arbitrary constraints added, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract0& meet(manager& m, abstract0& dst, abstract0&& x, const tcons0_array& y);
+#endif
+
 
   /*! \brief Replaces *this with the meet of *this and the abstract element y.
    *
@@ -532,6 +578,20 @@ public:
    */
   abstract0& operator*=(const tcons0_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Returns the meet of x and y, computed in-place in x.
+   *
+   * Implicitly uses the manager used to create x.
+   */
+  friend abstract0 operator*(abstract0&& x, const abstract0& y);
+
+  //! Returns x with some linear constraints added, computed in-place in x.
+  friend abstract0 operator*(abstract0&& x, const lincons0_array& y);
+
+  //! Returns x with some arbitrary constraints added, computed in-place in x.
+  friend abstract0 operator*(abstract0&& x, const tcons0_array& y);
+#endif
+
   //@}
 
 
@@ -555,6 +615,16 @@ public:
    */
   friend abstract0& join(manager& m, abstract0& dst, const abstract0& x, const abstract0& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with the join of x and y, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract0& join(manager& m, abstract0& dst, abstract0&& x, const abstract0& y);
+#endif
+
   /*! \brief Replaces dst with the join of all abstract elements in x.
    *
    * \return a reference to dst.
@@ -583,6 +653,16 @@ public:
    */
   friend abstract0& add_rays(manager& m, abstract0& dst, const abstract0& x, const generator0_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with x with some rays added, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract0& add_rays(manager& m, abstract0& dst, abstract0&& x, const generator0_array& y);
+#endif
+
   /*! \brief Replaces *this with the join of *this and the abstract element y.
    *
    * Implicitly uses the manager used to create *this.
@@ -601,6 +681,17 @@ public:
    */
   abstract0& operator+=(const generator0_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Returns the join of x and y, computed in-place in x.
+   *
+   * Implicitly uses the manager used to create x.
+   */
+  friend abstract0 operator+(abstract0&& x, const abstract0& y);
+
+  //! Returns x with some rays added, computed in-place in x.
+  friend abstract0 operator+(abstract0&& x, const generator0_array& y);
+#endif
+
   //@}
 
 
@@ -1103,6 +1194,16 @@ public:
    */
   friend abstract0& closure(manager& m, abstract0& dst, const abstract0& src);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with the topological closure of src, reusing src.
+   *
+   * src is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract0& closure(manager& m, abstract0& dst, abstract0&& src);
+#endif
+
   //@}
 
 
@@ -72,6 +72,14 @@ inline abstract0::abstract0(const abstract0& t)
   manager::raise(a->man, "apron::abstract0::abstract0(abstract0&)",a); 
 }
 
+#if __cplusplus >= 201103L
+inline abstract0::abstract0(abstract0&& t) noexcept
+  : a(t.a)
+{
+  t.a = NULL;
+}
+#endif
+
 
 
 /* destructors */
@@ -96,14 +104,24 @@ inline void abstract0::free(manager& m)
 inline abstract0& abstract0::operator=(const abstract0& t)
 {
   if (&t!=this) {
-    ap_abstract0_t* r = ap_abstract0_copy(a->man, t.a);
-    manager::raise(a->man, "apron::abstract0::operator=(const abstract0&)",r);
-    ap_abstract0_free(a->man, a);
+    // *this may have been moved from
+    ap_manager_t* m = a ? a->man : t.a->man;
+    ap_abstract0_t* r = ap_abstract0_copy(m, t.a);
+    manager::raise(m, "apron::abstract0::operator=(const abstract0&)",r);
+    if (a) ap_abstract0_free(a->man, a);
     a = r;
   }
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& abstract0::operator=(abstract0&& t) noexcept
+{
+  std::swap(a, t.a);
+  return *this;
+}
+#endif
+
 inline abstract0& abstract0::operator=(top t)
 {
   ap_dimension_t d = ap_abstract0_dimension(a->man, a);
@@ -521,6 +539,18 @@ inline abstract0& meet(manager& m, abstract0& dst, const abstract0& x, const abs
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& meet(manager& m, abstract0& dst, abstract0&& x, const abstract0& y)
+{ 
+  ap_abstract0_t* r = ap_abstract0_meet(m.get_ap_manager_t(), true, x.a, y.a);
+  x.a = NULL;
+  m.raise("apron::meet(manager&, abstract0&, abstract0&&, const abstract0&)",r); 
+  if (dst.a) ap_abstract0_free(m.get_ap_manager_t(), dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 inline abstract0& meet(manager& m, abstract0& dst, const std::vector<const abstract0*>& x)
 { 
   ap_abstract0_t* xx[x.size()];
@@ -563,6 +593,18 @@ inline abstract0& join(manager& m, abstract0& dst, const abstract0& x, const abs
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& join(manager& m, abstract0& dst, abstract0&& x, const abstract0& y)
+{ 
+  ap_abstract0_t* r = ap_abstract0_join(m.get_ap_manager_t(), true, x.a, y.a);
+  x.a = NULL;
+  m.raise("apron::join(manager&, abstract0&, abstract0&&, const abstract0&)",r); 
+  if (dst.a) ap_abstract0_free(m.get_ap_manager_t(), dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 inline abstract0& join(manager& m, abstract0& dst, size_t sz, const abstract0 * const x[])
 { 
   ap_abstract0_t* xx[sz];
@@ -608,6 +650,19 @@ inline abstract0& meet(manager& m, abstract0& dst, const abstract0& x, const lin
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& meet(manager& m, abstract0& dst, abstract0&& x, const lincons0_array& y)
+{ 
+  ap_abstract0_t* r = ap_abstract0_meet_lincons_array(m.get_ap_manager_t(), true, x.a, 
+						   const_cast<ap_lincons0_array_t*>(y.get_ap_lincons0_array_t()));
+  x.a = NULL;
+  m.raise("apron::meet(manager&, abstract0&, abstract0&&, const lincons0_array&)",r); 
+  if (dst.a) ap_abstract0_free(m.get_ap_manager_t(), dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 inline abstract0& abstract0::meet(manager& m, const tcons0_array& y)
 { 
@@ -628,6 +683,19 @@ inline abstract0& meet(manager& m, abstract0& dst, const abstract0& x, const tco
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& meet(manager& m, abstract0& dst, abstract0&& x, const tcons0_array& y)
+{ 
+  ap_abstract0_t* r = ap_abstract0_meet_tcons_array(m.get_ap_manager_t(), true, x.a, 
+						   const_cast<ap_tcons0_array_t*>(y.get_ap_tcons0_array_t()));
+  x.a = NULL;
+  m.raise("apron::meet(manager&, abstract0&, abstract0&&, const tcons0_array&)",r); 
+  if (dst.a) ap_abstract0_free(m.get_ap_manager_t(), dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 
 inline abstract0& abstract0::add_rays(manager& m, const generator0_array& y)
@@ -649,6 +717,19 @@ inline abstract0& add_rays(manager& m, abstract0& dst, const abstract0& x, const
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& add_rays(manager& m, abstract0& dst, abstract0&& x, const generator0_array& y)
+{ 
+  ap_abstract0_t* r = ap_abstract0_add_ray_array(m.get_ap_manager_t(), true, x.a, 
+						  const_cast<ap_generator0_array_t*>(y.get_ap_generator0_array_t()));
+  x.a = NULL;
+  m.raise("apron::add_rays(manager&, abstract0&, abstract0&&, const generator0_array&)",r); 
+  if (dst.a) ap_abstract0_free(m.get_ap_manager_t(), dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 
 inline abstract0& abstract0::operator*=(const abstract0& y)
@@ -689,6 +770,38 @@ inline abstract0& abstract0::operator+=(const generator0_array& y)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0 operator*(abstract0&& x, const abstract0& y)
+{
+  x *= y;
+  return std::move(x);
+}
+
+inline abstract0 operator*(abstract0&& x, const lincons0_array& y)
+{
+  x *= y;
+  return std::move(x);
+}
+
+inline abstract0 operator*(abstract0&& x, const tcons0_array& y)
+{
+  x *= y;
+  return std::move(x);
+}
+
+inline abstract0 operator+(abstract0&& x, const abstract0& y)
+{
+  x += y;
+  return std::move(x);
+}
+
+inline abstract0 operator+(abstract0&& x, const generator0_array& y)
+{
+  x += y;
+  return std::move(x);
+}
+#endif
+
 
 /* Assignments */
 /* =========== */
@@ -1161,6 +1274,18 @@ inline abstract0& closure(manager& m, abstract0& dst, const abstract0& src)
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract0& closure(manager& m, abstract0& dst, abstract0&& src)
+{ 
+  ap_abstract0_t* r = ap_abstract0_closure(m.get_ap_manager_t(), true, src.a);
+  src.a = NULL;
+  m.raise("apron::closure(manager&, abstract0&, abstract0&&)",r); 
+  if (dst.a) ap_abstract0_free(m.get_ap_manager_t(), dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 
 /* C-level compatibility */
@@ -97,6 +97,14 @@ public:
    */
   abstract1(const abstract1& t);
 
+#if __cplusplus >= 201103L
+  /*! \brief Moves the abstract element of t into *this (no copy).
+   *
+   * t is left without abstract element: it can only be destroyed or assigned to.
+   */
+  abstract1(abstract1&& t) noexcept;
+#endif
+
   //@}
 
   
@@ -134,6 +142,14 @@ public:
    */
   abstract1& operator=(const abstract1& t);
 
+#if __cplusplus >= 201103L
+  /*! \brief Swaps the abstract elements of *this and t (no copy).
+   *
+   * The former abstract element of *this is destroyed with t.
+   */
+  abstract1& operator=(abstract1&& t) noexcept;
+#endif
+
   /*! \brief Assigns the full space to *this.
    *
    * Implicitly uses the manager used to create *this.
@@ -470,6 +486,16 @@ public:
    */
   friend abstract1& meet(manager& m, abstract1& dst, const abstract1& x, const abstract1& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with the meet of x and y, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract1& meet(manager& m, abstract1& dst, abstract1&& x, const abstract1& y);
+#endif
+
 
   /*! \brief Replaces *this with the meet of *this and the abstract element y.
    *
@@ -514,6 +540,16 @@ public:
    */
   friend abstract1& meet(manager& m, abstract1& dst, const abstract1& x, const lincons1_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with x with some linear constraints added, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract1& meet(manager& m, abstract1& dst, abstract1&& x, const lincons1_array& y);
+#endif
+
   /*! \brief Adds some arbitrary constraints to *this (modified in-place).
    *
    * \return a reference to *this.
@@ -526,6 +562,16 @@ public:
    */
   friend abstract1& meet(manager& m, abstract1& dst, const abstract1& x, const tcons1_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with x with some arbitrary constraints added, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract1& meet(manager& m, abstract1& dst, abstract1&& x, const tcons1_array& y);
+#endif
+
 
   /*! \brief Replaces *this with the meet of *this and the abstract element y.
    *
@@ -552,6 +598,20 @@ public:
    */
   abstract1& operator*=(const tcons1_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Returns the meet of x and y, computed in-place in x.
+   *
+   * Implicitly uses the manager used to create x.
+   */
+  friend abstract1 operator*(abstract1&& x, const abstract1& y);
+
+  //! Returns x with some linear constraints added, computed in-place in x.
+  friend abstract1 operator*(abstract1&& x, const lincons1_array& y);
+
+  //! Returns x with some arbitrary constraints added, computed in-place in x.
+  friend abstract1 operator*(abstract1&& x, const tcons1_array& y);
+#endif
+
   //@}
 
 
@@ -575,6 +635,16 @@ public:
    */
   friend abstract1& join(manager& m, abstract1& dst, const abstract1& x, const abstract1& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with the join of x and y, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract1& join(manager& m, abstract1& dst, abstract1&& x, const abstract1& y);
+#endif
+
   /*! \brief Replaces dst with the join of all abstract elements in x.
    *
    * \return a reference to dst.
@@ -603,6 +673,16 @@ public:
    */
   friend abstract1& add_rays(manager& m, abstract1& dst, const abstract1& x, const generator1_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with x with some rays added, reusing x.
+   *
+   * x is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract1& add_rays(manager& m, abstract1& dst, abstract1&& x, const generator1_array& y);
+#endif
+
   /*! \brief Replaces *this with the join of *this and the abstract element y.
    *
    * Implicitly uses the manager used to create *this.
@@ -621,6 +701,17 @@ public:
    */
   abstract1& operator+=(const generator1_array& y);
 
+#if __cplusplus >= 201103L
+  /*! \brief Returns the join of x and y, computed in-place in x.
+   *
+   * Implicitly uses the manager used to create x.
+   */
+  friend abstract1 operator+(abstract1&& x, const abstract1& y);
+
+  //! Returns x with some rays added, computed in-place in x.
+  friend abstract1 operator+(abstract1&& x, const generator1_array& y);
+#endif
+
   //@}
 
 
@@ -1145,6 +1236,16 @@ public:
    */
   friend abstract1& closure(manager& m, abstract1& dst, const abstract1& src);
 
+#if __cplusplus >= 201103L
+  /*! \brief Replaces dst with the topological closure of src, reusing src.
+   *
+   * src is destroyed (as after a move).
+   *
+   * \return a reference to dst.
+   */
+  friend abstract1& closure(manager& m, abstract1& dst, abstract1&& src);
+#endif
+
   //@}
 
 
@@ -98,6 +98,15 @@ inline abstract1::abstract1(const abstract1& t)
   manager::raise(a.abstract0->man, "apron::abstract1::abstract1(abstract1&)",a); 
 }
 
+#if __cplusplus >= 201103L
+inline abstract1::abstract1(abstract1&& t) noexcept
+  : a(t.a)
+{
+  t.a.abstract0 = NULL;
+  t.a.env = NULL;
+}
+#endif
+
   
 /* destructor */
 /* ========== */
@@ -121,15 +130,24 @@ inline void abstract1::free(manager& m)
 inline abstract1& abstract1::operator=(const abstract1& t)
 {
   if (&t!=this) {
-    ap_abstract1_t r = ap_abstract1_copy(a.abstract0->man, 
-					 const_cast<ap_abstract1_t*>(&t.a));
-    manager::raise(a.abstract0->man, "apron::abstract1::operator=(const abstract1&)",r);
-    ap_abstract1_clear(a.abstract0->man, &a);
+    // *this may have been moved from
+    ap_manager_t* m = a.abstract0 ? a.abstract0->man : t.a.abstract0->man;
+    ap_abstract1_t r = ap_abstract1_copy(m, const_cast<ap_abstract1_t*>(&t.a));
+    manager::raise(m, "apron::abstract1::operator=(const abstract1&)",r);
+    if (a.abstract0) ap_abstract1_clear(a.abstract0->man, &a);
     a = r;
   }
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& abstract1::operator=(abstract1&& t) noexcept
+{
+  std::swap(a, t.a);
+  return *this;
+}
+#endif
+
 inline abstract1& abstract1::operator=(top t)
 {
   ap_abstract1_t r = ap_abstract1_top(a.abstract0->man, a.env);
@@ -663,6 +681,21 @@ inline abstract1& meet(manager& m, abstract1& dst, const abstract1& x, const abs
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& meet(manager& m, abstract1& dst, abstract1&& x, const abstract1& y)
+{ 
+  ap_abstract1_t r = 
+    ap_abstract1_meet(m.get_ap_manager_t(), true, &x.a, 
+		      const_cast<ap_abstract1_t*>(&y.a));
+  x.a.abstract0 = NULL;
+  x.a.env = NULL;
+  m.raise("apron::meet(manager&, abstract1&, abstract1&&, const abstract1&)",r); 
+  if (dst.a.abstract0) ap_abstract1_clear(m.get_ap_manager_t(), &dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 inline abstract1& meet(manager& m, abstract1& dst, const std::vector<const abstract1*>& x)
 { 
   ap_abstract1_t xx[x.size()];
@@ -710,6 +743,21 @@ inline abstract1& join(manager& m, abstract1& dst, const abstract1& x, const abs
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& join(manager& m, abstract1& dst, abstract1&& x, const abstract1& y)
+{ 
+  ap_abstract1_t r = 
+    ap_abstract1_join(m.get_ap_manager_t(), true, &x.a, 
+		      const_cast<ap_abstract1_t*>(&y.a));
+  x.a.abstract0 = NULL;
+  x.a.env = NULL;
+  m.raise("apron::join(manager&, abstract1&, abstract1&&, const abstract1&)",r); 
+  if (dst.a.abstract0) ap_abstract1_clear(m.get_ap_manager_t(), &dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 inline abstract1& join(manager& m, abstract1& dst, size_t sz, const abstract1 * const x[])
 { 
   ap_abstract1_t xx[sz];
@@ -758,6 +806,21 @@ inline abstract1& meet(manager& m, abstract1& dst, const abstract1& x, const lin
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& meet(manager& m, abstract1& dst, abstract1&& x, const lincons1_array& y)
+{ 
+  ap_abstract1_t r = 
+    ap_abstract1_meet_lincons_array(m.get_ap_manager_t(), true, &x.a, 
+				    const_cast<ap_lincons1_array_t*>(y.get_ap_lincons1_array_t()));
+  x.a.abstract0 = NULL;
+  x.a.env = NULL;
+  m.raise("apron::meet(manager&, abstract1&, abstract1&&, const lincons1_array&)",r); 
+  if (dst.a.abstract0) ap_abstract1_clear(m.get_ap_manager_t(), &dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 inline abstract1& abstract1::meet(manager& m, const tcons1_array& y)
 { 
@@ -780,6 +843,21 @@ inline abstract1& meet(manager& m, abstract1& dst, const abstract1& x, const tco
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& meet(manager& m, abstract1& dst, abstract1&& x, const tcons1_array& y)
+{ 
+  ap_abstract1_t r = 
+    ap_abstract1_meet_tcons_array(m.get_ap_manager_t(), true, &x.a, 
+				    const_cast<ap_tcons1_array_t*>(y.get_ap_tcons1_array_t()));
+  x.a.abstract0 = NULL;
+  x.a.env = NULL;
+  m.raise("apron::meet(manager&, abstract1&, abstract1&&, const tcons1_array&)",r); 
+  if (dst.a.abstract0) ap_abstract1_clear(m.get_ap_manager_t(), &dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 
 inline abstract1& abstract1::add_rays(manager& m, const generator1_array& y)
@@ -804,6 +882,21 @@ inline abstract1& add_rays(manager& m, abstract1& dst, const abstract1& x, const
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& add_rays(manager& m, abstract1& dst, abstract1&& x, const generator1_array& y)
+{ 
+  ap_abstract1_t r = 
+    ap_abstract1_add_ray_array(m.get_ap_manager_t(), true, &x.a, 
+			       const_cast<ap_generator1_array_t*>(y.get_ap_generator1_array_t()));
+  x.a.abstract0 = NULL;
+  x.a.env = NULL;
+  m.raise("apron::add_rays(manager&, abstract1&, abstract1&&, const generator1_array&)",r); 
+  if (dst.a.abstract0) ap_abstract1_clear(m.get_ap_manager_t(), &dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 
 inline abstract1& abstract1::operator*=(const abstract1& y)
@@ -856,6 +949,38 @@ inline abstract1& abstract1::operator+=(const generator1_array& y)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1 operator*(abstract1&& x, const abstract1& y)
+{
+  x *= y;
+  return std::move(x);
+}
+
+inline abstract1 operator*(abstract1&& x, const lincons1_array& y)
+{
+  x *= y;
+  return std::move(x);
+}
+
+inline abstract1 operator*(abstract1&& x, const tcons1_array& y)
+{
+  x *= y;
+  return std::move(x);
+}
+
+inline abstract1 operator+(abstract1&& x, const abstract1& y)
+{
+  x += y;
+  return std::move(x);
+}
+
+inline abstract1 operator+(abstract1&& x, const generator1_array& y)
+{
+  x += y;
+  return std::move(x);
+}
+#endif
+
 
 
 /* Assignments */
@@ -1576,6 +1701,20 @@ inline abstract1& closure(manager& m, abstract1& dst, const abstract1& src)
   return dst;
 }
 
+#if __cplusplus >= 201103L
+inline abstract1& closure(manager& m, abstract1& dst, abstract1&& src)
+{ 
+  ap_abstract1_t r = 
+    ap_abstract1_closure(m.get_ap_manager_t(), true, &src.a);
+  src.a.abstract0 = NULL;
+  src.a.env = NULL;
+  m.raise("apron::closure(manager&, abstract1&, abstract1&&)",r); 
+  if (dst.a.abstract0) ap_abstract1_clear(m.get_ap_manager_t(), &dst.a);
+  dst.a = r;  
+  return dst;
+}
+#endif
+
 
 /* C-level compatibility */
 /* ===================== */
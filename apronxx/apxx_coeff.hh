@@ -50,6 +50,10 @@ public:
 
   //! Makes a copy of a coeff.
   coeff(const coeff& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x set to 0.
+  coeff(coeff&& x) noexcept;
+#endif
 
   //! Makes a scalar coeff from a scalar (copied).
   coeff(const scalar& x);
@@ -124,6 +128,10 @@ public:
 
   //! Copies the coeff into *this (setting its type and value).
   coeff& operator= (const coeff& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  coeff& operator= (coeff&& x) noexcept;
+#endif
   
   //! Copies the scalar into *this, setting its type to scalar coeff.
   coeff& operator= (const scalar& x);
@@ -32,6 +32,14 @@ inline coeff::coeff(const coeff& x)
   ap_coeff_set(&c, const_cast<ap_coeff_t*>(x.get_ap_coeff_t())); 
 }
 
+#if __cplusplus >= 201103L
+inline coeff::coeff(coeff&& x) noexcept
+  : coeff()
+{
+  ap_coeff_swap(&c, &x.c);
+}
+#endif
+
 
 /* scalars */
 
@@ -163,6 +171,14 @@ inline coeff& coeff::operator= (const coeff& x)
   ap_coeff_set(&c, const_cast<ap_coeff_t*>(x.get_ap_coeff_t())); 
   return *this; 
 }
+
+#if __cplusplus >= 201103L
+inline coeff& coeff::operator= (coeff&& x) noexcept
+{
+  ap_coeff_swap(&c, &x.c);
+  return *this;
+}
+#endif
   
 inline coeff& coeff::operator= (const scalar& x)
 { 
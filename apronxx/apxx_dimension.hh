@@ -13,6 +13,7 @@
 #ifndef __APXX_DIMENSION_HH
 #define __APXX_DIMENSION_HH
 
+#include <utility>
 #include "ap_dimension.h"
 
 
@@ -130,6 +131,10 @@ public:
    * \arg inv if inv==true, then the constructed dimchange is the inverse of x (see add_invert).
    */
   dimchange(const dimchange& x, bool inv=false);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  dimchange(dimchange&& x) noexcept;
+#endif
 
   //@}
 
@@ -153,6 +158,10 @@ public:
 
   //! (Deep) copy.
   dimchange& operator= (const dimchange& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  dimchange& operator= (dimchange&& x) noexcept;
+#endif
 
   /*! \brief Assignment from an array of indices.
    *
@@ -322,6 +331,10 @@ public:
    * \arg inv if inv==true, then the constructed permutation is the inverse of x.
    */
   dimperm(const dimperm& x, bool inv=false);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  dimperm(dimperm&& x) noexcept;
+#endif
 
   //! Makes a new dimperm that is the composition of two permutations.
   dimperm(const dimperm& x, const dimperm& y);
@@ -348,6 +361,10 @@ public:
 
   //! Copies \c x.
   dimperm& operator= (const dimperm& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  dimperm& operator= (dimperm&& x) noexcept;
+#endif
 
   //! Assigns the identity permutation to *this.
   dimperm& operator= (id t);
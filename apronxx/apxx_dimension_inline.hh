@@ -70,6 +70,14 @@ inline dimchange::dimchange(const dimchange& x, bool inv)
   if (inv) ap_dimchange_add_invert(&c);
 }
 
+#if __cplusplus >= 201103L
+inline dimchange::dimchange(dimchange&& x) noexcept
+  : dimchange()
+{
+  std::swap(c, x.c);
+}
+#endif
+
 inline dimchange::dimchange(size_t intdim, size_t realdim, const std::vector<ap_dim_t>& d)
 {
   if (d.size()<intdim+realdim)
@@ -102,6 +110,14 @@ inline dimchange& dimchange::operator= (const dimchange& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline dimchange& dimchange::operator= (dimchange&& x) noexcept
+{
+  std::swap(c, x.c);
+  return *this;
+}
+#endif
+
 inline dimchange& dimchange::operator= (const ap_dim_t d[])
 { 
   memcpy(c.dim, d, sizeof(ap_dim_t) * (c.intdim + c.realdim));
@@ -241,6 +257,14 @@ inline dimperm::dimperm(const dimperm& x, bool inv)
   else memcpy(c.dim, x.c.dim, sizeof(ap_dim_t) * (x.c.size));
 }
 
+#if __cplusplus >= 201103L
+inline dimperm::dimperm(dimperm&& x) noexcept
+  : dimperm()
+{
+  std::swap(c, x.c);
+}
+#endif
+
 inline dimperm::dimperm(const dimperm& x, const dimperm& y)
 {
   ap_dimperm_init(&c, x.c.size);
@@ -279,6 +303,14 @@ inline dimperm& dimperm::operator= (const dimperm& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline dimperm& dimperm::operator= (dimperm&& x) noexcept
+{
+  std::swap(c, x.c);
+  return *this;
+}
+#endif
+
 inline dimperm& dimperm::operator= (id t)
 { 
   if (t.size!=c.size) {
@@ -69,6 +69,10 @@ public:
 
   //! (Deep) copy of a generator.
   generator0(const generator0& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  generator0(generator0&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of a generator, and applies a dimension change to the underlying linear expression.
   generator0(const generator0& x, const dimchange& d);
@@ -89,6 +93,10 @@ public:
 
   //! (Deep) copy.
   generator0& operator= (const generator0& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  generator0& operator= (generator0&& x) noexcept;
+#endif
 
 
   /* dimension operations */
@@ -236,6 +244,10 @@ public:
 
   //! (Deep) copy.
   generator0_array(const generator0_array& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  generator0_array(generator0_array&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of the array and applies add_dimensions to all generators.
   generator0_array(const generator0_array& x, const dimchange& d);
@@ -272,6 +284,10 @@ public:
 
   //! (Deep) copy.
   generator0_array& operator= (const generator0_array& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  generator0_array& operator= (generator0_array&& x) noexcept;
+#endif
 
   /*! \brief Copies the generators from the array into *this.
    *
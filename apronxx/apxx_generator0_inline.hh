@@ -38,6 +38,14 @@ inline generator0::generator0(const generator0& x)
   l = ap_generator0_copy(const_cast<ap_generator0_t*>(&x.l)); 
 }
 
+#if __cplusplus >= 201103L
+inline generator0::generator0(generator0&& x) noexcept
+  : generator0()
+{
+  std::swap(l, x.l);
+}
+#endif
+
 
 inline generator0::generator0(const generator0& x, const dimchange& d)
 {
@@ -76,6 +84,14 @@ inline generator0& generator0::operator= (const generator0& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline generator0& generator0::operator= (generator0&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 
 /* dimension operations */
 /* ==================== */
@@ -207,6 +223,14 @@ inline generator0_array::generator0_array(const generator0_array& x)
     a.p[i] = ap_generator0_copy(&x.a.p[i]); 
 }
 
+#if __cplusplus >= 201103L
+inline generator0_array::generator0_array(generator0_array&& x) noexcept
+  : generator0_array((size_t)0)
+{
+  std::swap(a, x.a);
+}
+#endif
+
 inline generator0_array::generator0_array(size_t size, const generator0 x[]) 
   : a(ap_generator0_array_make(size))
 {
@@ -256,6 +280,14 @@ inline generator0_array& generator0_array::operator= (const generator0_array& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline generator0_array& generator0_array::operator= (generator0_array&& x) noexcept
+{
+  std::swap(a, x.a);
+  return *this;
+}
+#endif
+
 inline generator0_array& generator0_array::operator= (const generator0 x[])
 {
   size_t size = a.size;
@@ -80,6 +80,10 @@ public:
 
   //! (Deep) copy of a generator.
   generator1(const generator1& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  generator1(generator1&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of x and extends its environment.
    *
@@ -112,6 +116,10 @@ public:
 
   //! Makes a (deep) copy.
   generator1& operator= (const generator1& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  generator1& operator= (generator1&& x) noexcept;
+#endif
 
   /*! \brief Sets the underlying linear expression to c (copied).
    *
@@ -299,6 +307,10 @@ public:
 
   //! (Deep) copy.
   generator1_array(const generator1_array& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  generator1_array(generator1_array&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of x and extends its environment.
    *
@@ -345,6 +357,10 @@ public:
 
   //! (Deep) copy.
   generator1_array& operator= (const generator1_array& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  generator1_array& operator= (generator1_array&& x) noexcept;
+#endif
 
   /*! \brief Copies the generators from the array into *this.
    *
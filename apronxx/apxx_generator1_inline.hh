@@ -49,6 +49,14 @@ inline generator1::generator1(const generator1& x)
   l = ap_generator1_copy(const_cast<ap_generator1_t*>(&x.l));
 }
 
+#if __cplusplus >= 201103L
+inline generator1::generator1(generator1&& x) noexcept
+  : generator1(x.get_environment())
+{
+  std::swap(l, x.l);
+}
+#endif
+
 inline generator1::generator1(const generator1& x, const environment& e)
 {
   if (!x.has_linexpr())
@@ -81,6 +89,14 @@ inline generator1& generator1::operator= (const generator1& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline generator1& generator1::operator= (generator1&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 inline void generator1::set_linexpr(const linexpr1& c)
 {
   get_generator0().set_linexpr(c.get_linexpr0());
@@ -255,6 +271,14 @@ inline generator1_array::generator1_array(const generator1_array& x)
     a.generator0_array.p[i] = ap_generator0_copy(&x.a.generator0_array.p[i]);
 }
 
+#if __cplusplus >= 201103L
+inline generator1_array::generator1_array(generator1_array&& x) noexcept
+  : generator1_array(x.get_environment(), 0)
+{
+  std::swap(a, x.a);
+}
+#endif
+
 inline generator1_array::generator1_array(const generator1_array& x, const environment& e)
 {
   bool r = 
@@ -308,6 +332,14 @@ inline generator1_array& generator1_array::operator= (const generator1_array& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline generator1_array& generator1_array::operator= (generator1_array&& x) noexcept
+{
+  std::swap(a, x.a);
+  return *this;
+}
+#endif
+
 inline generator1_array& generator1_array::operator= (const generator1 x[])
 {
   size_t sz = size();
@@ -80,6 +80,10 @@ public:
   
   //! Makes a copy of an interval (bounds are copied).
   interval(const interval& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x set to [0;0].
+  interval(interval&& x) noexcept;
+#endif
 
   //! Makes a new interval with the specified scalar bounds (copied).
   interval(const scalar& inf, const scalar& sup);
@@ -132,6 +136,10 @@ public:
 
   //! Copies an interval into *this
   interval& operator= (const interval& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  interval& operator= (interval&& x) noexcept;
+#endif
 
   //! Sets *this to top (]-oo;+oo[), no change in scalar types.
   interval& operator= (top t);
@@ -325,6 +333,10 @@ public:
 
   //! Makes a copy of an interval array (copying all elements).
   interval_array(const interval_array &x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  interval_array(interval_array&& x) noexcept;
+#endif
 
   //! Makes a interval array from an interval vector (copying all elements).
   interval_array(const std::vector<interval>& x);
@@ -358,6 +370,10 @@ public:
    * All elements are copied and the array size is updated if necessary.
    */
   interval_array& operator= (const interval_array &x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  interval_array& operator= (interval_array&& x) noexcept;
+#endif
 
   /*! \brief Copies an interval vector into *this.
    *
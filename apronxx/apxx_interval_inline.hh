@@ -45,6 +45,14 @@ inline interval::interval(const interval& x)
   ap_interval_set(&c, const_cast<ap_interval_t*>(&x.c)); 
 }
 
+#if __cplusplus >= 201103L
+inline interval::interval(interval&& x) noexcept
+  : interval()
+{
+  ap_interval_swap(&c, &x.c);
+}
+#endif
+
 inline interval::interval(const scalar& inf, const scalar& sup)
 { 
   init();
@@ -125,6 +133,14 @@ inline interval& interval::operator= (const interval& x)
   return *this; 
 }
 
+#if __cplusplus >= 201103L
+inline interval& interval::operator= (interval&& x) noexcept
+{
+  ap_interval_swap(&c, &x.c);
+  return *this;
+}
+#endif
+
 inline interval& interval::operator= (top t)
 { 
   ap_interval_set_top(&c); 
@@ -368,6 +384,15 @@ inline interval_array::interval_array(const interval_array &x)
     ap_interval_set(c[i], x.c[i]);
 }
 
+#if __cplusplus >= 201103L
+inline interval_array::interval_array(interval_array&& x) noexcept
+  : sz(0), c(NULL)
+{
+  std::swap(sz, x.sz);
+  std::swap(c, x.c);
+}
+#endif
+
 inline interval_array::interval_array(const std::vector<interval>& x)
   : sz(x.size()), c(ap_interval_array_alloc(x.size()))
 {
@@ -410,6 +435,15 @@ inline interval_array& interval_array::operator= (const interval_array &x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline interval_array& interval_array::operator= (interval_array&& x) noexcept
+{
+  std::swap(sz, x.sz);
+  std::swap(c, x.c);
+  return *this;
+}
+#endif
+
 inline interval_array& interval_array::operator= (const std::vector<interval>& x)
 {
   if (sz != x.size()) {
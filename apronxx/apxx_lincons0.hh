@@ -80,6 +80,10 @@ public:
 
   //! (Deep) copy of a constraint.
   lincons0(const lincons0& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  lincons0(lincons0&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of a constraint, and applies a dimension change to the underlying linear expression.
   lincons0(const lincons0& x, const dimchange& d);
@@ -113,6 +117,10 @@ public:
 
   //! (Deep) copy.
   lincons0& operator= (const lincons0& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  lincons0& operator= (lincons0&& x) noexcept;
+#endif
 
   //! Assigns an unsatisfiable constraint to *this (-1>=0).
   lincons0& operator= (unsat x);
@@ -363,6 +371,10 @@ public:
 
   //! (Deep) copy.
   lincons0_array(const lincons0_array& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  lincons0_array(lincons0_array&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of the array and applies add_dimensions to all constraints.
   lincons0_array(const lincons0_array& x, const dimchange& d);
@@ -399,6 +411,10 @@ public:
 
   //! (Deep) copy.
   lincons0_array& operator= (const lincons0_array& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  lincons0_array& operator= (lincons0_array&& x) noexcept;
+#endif
 
   /*! \brief Copies the constraints from the array into *this.
    *
@@ -87,6 +87,10 @@ public:
 
   //! (Deep) copy of a constraint.
   lincons1(const lincons1& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  lincons1(lincons1&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of x and extends its environment.
    *
@@ -119,6 +123,10 @@ public:
 
   //! Makes a (deep) copy.
   lincons1& operator= (const lincons1& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  lincons1& operator= (lincons1&& x) noexcept;
+#endif
 
   //! Assigns an unsatisfiable constraint to *this (-1>=0).
   lincons1& operator= (unsat x);
@@ -358,6 +366,10 @@ public:
 
   //! (Deep) copy.
   lincons1_array(const lincons1_array& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  lincons1_array(lincons1_array&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of x and extends its environment.
    *
@@ -404,6 +416,10 @@ public:
 
   //! (Deep) copy.
   lincons1_array& operator= (const lincons1_array& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  lincons1_array& operator= (lincons1_array&& x) noexcept;
+#endif
 
   /*! \brief Copies the constraints from the array into *this.
    *
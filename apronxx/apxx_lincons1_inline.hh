@@ -60,6 +60,14 @@ inline lincons1::lincons1(const lincons1& x)
   l = ap_lincons1_copy(const_cast<ap_lincons1_t*>(&x.l));
 }
 
+#if __cplusplus >= 201103L
+inline lincons1::lincons1(lincons1&& x) noexcept
+  : lincons1(x.get_environment())
+{
+  std::swap(l, x.l);
+}
+#endif
+
 inline lincons1::lincons1(const lincons1& x, const environment& e)
 {
   if (!x.has_linexpr())
@@ -92,6 +100,14 @@ inline lincons1& lincons1::operator= (const lincons1& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline lincons1& lincons1::operator= (lincons1&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 inline lincons1& lincons1::operator= (unsat x)
 {
   ap_lincons1_t ll = ap_lincons1_make_unsat(ap_lincons1_envref(&l));
@@ -318,6 +334,14 @@ inline lincons1_array::lincons1_array(const lincons1_array& x)
     a.lincons0_array.p[i] = ap_lincons0_copy(&x.a.lincons0_array.p[i]);
 }
 
+#if __cplusplus >= 201103L
+inline lincons1_array::lincons1_array(lincons1_array&& x) noexcept
+  : lincons1_array(x.get_environment(), 0)
+{
+  std::swap(a, x.a);
+}
+#endif
+
 inline lincons1_array::lincons1_array(const lincons1_array& x, const environment& e)
 {
   bool r = 
@@ -371,6 +395,14 @@ inline lincons1_array& lincons1_array::operator= (const lincons1_array& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline lincons1_array& lincons1_array::operator= (lincons1_array&& x) noexcept
+{
+  std::swap(a, x.a);
+  return *this;
+}
+#endif
+
 inline lincons1_array& lincons1_array::operator= (const lincons1 x[])
 {
   size_t sz = size();
@@ -68,6 +68,10 @@ public:
 
   //! Makes a (deep) copy.
   linexpr0(const linexpr0& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  linexpr0(linexpr0&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy, and adds some dimensions (shifting coefficients if needed).
   linexpr0(const linexpr0& x, const dimchange& d);
@@ -123,6 +127,10 @@ public:
 
   //! Makes a (deep) copy.
   linexpr0& operator= (const linexpr0& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  linexpr0& operator= (linexpr0&& x) noexcept;
+#endif
 
   //@}
 
@@ -70,6 +70,14 @@ inline linexpr0::linexpr0(const linexpr0& x)
   apxx_linexpr0_copy(&l, &x.l);
 }
 
+#if __cplusplus >= 201103L
+inline linexpr0::linexpr0(linexpr0&& x) noexcept
+  : linexpr0()
+{
+  std::swap(l, x.l);
+}
+#endif
+
 inline linexpr0::linexpr0(const linexpr0& x, const dimchange& d)
 {
   ap_linexpr0_t* p;
@@ -133,6 +141,14 @@ inline linexpr0& linexpr0::operator= (const linexpr0& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline linexpr0& linexpr0::operator= (linexpr0&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 
 /* dimension operations */
 /* ==================== */
@@ -69,6 +69,10 @@ public:
   
   //! Makes a (deep) copy.
   linexpr1(const linexpr1& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  linexpr1(linexpr1&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of x and extends its environment.
    *
@@ -101,6 +105,10 @@ public:
 
   //! Makes a (deep) copy.
   linexpr1& operator= (const linexpr1& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  linexpr1& operator= (linexpr1&& x) noexcept;
+#endif
 
   //@}
 
@@ -43,6 +43,14 @@ inline linexpr1::linexpr1(const linexpr1& x)
   l = ap_linexpr1_copy(const_cast<ap_linexpr1_t*>(&x.l));
 }
 
+#if __cplusplus >= 201103L
+inline linexpr1::linexpr1(linexpr1&& x) noexcept
+  : linexpr1(x.get_environment())
+{
+  std::swap(l, x.l);
+}
+#endif
+
 inline linexpr1::linexpr1(const linexpr1& x, const environment& e)
 {
   bool r =
@@ -74,6 +82,14 @@ inline linexpr1& linexpr1::operator=(const linexpr1& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline linexpr1& linexpr1::operator= (linexpr1&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 
 /* dimension operations */
 /* ==================== */
@@ -15,6 +15,7 @@
 
 #include <stdlib.h>
 #include <iostream>
+#include <utility>
 
 #include "ap_scalar.h"
 #include "gmpxx.h"
@@ -130,6 +131,10 @@ public:
 
   //! Makes a copy of a scalar.
   scalar(const scalar& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x set to 0.
+  scalar(scalar&& x) noexcept;
+#endif
 
   //@}
 
@@ -174,6 +179,10 @@ public:
 
   //! Sets the type and value of *this to that of x.
   scalar& operator= (const scalar& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  scalar& operator= (scalar&& x) noexcept;
+#endif
 
   //! Swaps the contents (type and value) of two scalars.
   friend void swap(scalar& a, scalar &b);
@@ -103,6 +103,14 @@ inline scalar::scalar(const scalar& x)
   ap_scalar_set(&c, const_cast<ap_scalar_t*>(&x.c)); 
 }
 
+#if __cplusplus >= 201103L
+inline scalar::scalar(scalar&& x) noexcept
+  : scalar()
+{
+  ap_scalar_swap(&c, &x.c);
+}
+#endif
+
 
 /* destructor */
 /* ========== */
@@ -166,6 +174,14 @@ inline scalar& scalar::operator= (const scalar& x)
   return *this; 
 }
 
+#if __cplusplus >= 201103L
+inline scalar& scalar::operator= (scalar&& x) noexcept
+{
+  ap_scalar_swap(&c, &x.c);
+  return *this;
+}
+#endif
+
 
 /* swap */
 
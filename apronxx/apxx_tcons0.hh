@@ -84,6 +84,10 @@ public:
 
   //! (Deep) copy of a constraint.
   tcons0(const tcons0& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  tcons0(tcons0&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of a constraint, and applies a dimension change to the underlying expression.
    *
@@ -151,6 +155,10 @@ public:
 
   //! (Deep) copy.
   tcons0& operator= (const tcons0& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  tcons0& operator= (tcons0&& x) noexcept;
+#endif
 
   //! Assigns an unsatisfiable constraint to *this (-1>=0).
   tcons0& operator= (unsat x);
@@ -372,6 +380,10 @@ public:
 
   //! (Deep) copy.
   tcons0_array(const tcons0_array& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  tcons0_array(tcons0_array&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of the array and applies add_dimensions to all constraints.
   tcons0_array(const tcons0_array& x, const dimchange& d, bool add=true);
@@ -414,6 +426,10 @@ public:
 
   //! (Deep) copy.
   tcons0_array& operator= (const tcons0_array& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  tcons0_array& operator= (tcons0_array&& x) noexcept;
+#endif
 
   /*! \brief Copies the constraints from the array into *this.
    *
@@ -77,6 +77,10 @@ public:
 
   //! (Deep) copy of a constraint.
   tcons1(const tcons1& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  tcons1(tcons1&& x) noexcept;
+#endif
 
 
   /*! \brief Makes a (deep) copy of x and extends its environment.
@@ -142,6 +146,10 @@ public:
 
   //! (Deep) copy.
   tcons1& operator= (const tcons1& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  tcons1& operator= (tcons1&& x) noexcept;
+#endif
 
   //! Assigns an unsatisfiable constraint to *this (-1>=0).
   tcons1& operator= (unsat x);
@@ -364,6 +372,10 @@ public:
 
   //! (Deep) copy.
   tcons1_array(const tcons1_array& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x empty.
+  tcons1_array(tcons1_array&& x) noexcept;
+#endif
 
   /*! \brief Makes a (deep) copy of the array and extends the environment.
    *
@@ -409,6 +421,10 @@ public:
 
   //! (Deep) copy.
   tcons1_array& operator= (const tcons1_array& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  tcons1_array& operator= (tcons1_array&& x) noexcept;
+#endif
 
   /*! \brief Copies the constraints from the array into *this.
    *
@@ -62,6 +62,14 @@ inline tcons1::tcons1(const tcons1& x, const environment& e)
     throw std::invalid_argument("apron::tcons1::tcons1(const tcons1&, const enviroment&) not a super-environment");
 }
 
+#if __cplusplus >= 201103L
+inline tcons1::tcons1(tcons1&& x) noexcept
+  : tcons1(x.get_environment())
+{
+  std::swap(l, x.l);
+}
+#endif
+
 inline tcons1::tcons1(const environment& e, unsat x)
 {
   l.tcons0 = ap_tcons0_make_unsat();
@@ -140,6 +148,14 @@ inline tcons1& tcons1::operator= (const tcons1& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline tcons1& tcons1::operator= (tcons1&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 inline tcons1& tcons1::operator= (unsat x)
 {
   ap_tcons0_clear(&l.tcons0);
@@ -348,6 +364,14 @@ inline tcons1_array::tcons1_array(const tcons1_array& x)
     a.tcons0_array.p[i] = ap_tcons0_copy(&x.a.tcons0_array.p[i]);
 }
 
+#if __cplusplus >= 201103L
+inline tcons1_array::tcons1_array(tcons1_array&& x) noexcept
+  : tcons1_array(x.get_environment(), 0)
+{
+  std::swap(a, x.a);
+}
+#endif
+
 inline tcons1_array::tcons1_array(const tcons1_array& x, const environment& e)
 {
   bool r = 
@@ -401,6 +425,14 @@ inline tcons1_array& tcons1_array::operator= (const tcons1_array& x)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+inline tcons1_array& tcons1_array::operator= (tcons1_array&& x) noexcept
+{
+  std::swap(a, x.a);
+  return *this;
+}
+#endif
+
 inline tcons1_array& tcons1_array::operator= (const tcons1 x[])
 {
   size_t sz = size();
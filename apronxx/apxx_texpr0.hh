@@ -120,6 +120,10 @@ public:
 
   //! Makes a (deep) copy of the expression tree.
   texpr0(const texpr0& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x set to the constant 0.
+  texpr0(texpr0&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of the expression tree.
   texpr0(const const_iterator& x);
@@ -165,6 +169,10 @@ public:
 
   //! Makes a (deep) copy of the expression.
   texpr0& operator=(const texpr0& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  texpr0& operator= (texpr0&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of the expression.
   texpr0& operator=(const const_iterator& x);
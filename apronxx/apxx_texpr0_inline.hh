@@ -78,6 +78,14 @@ inline texpr0::texpr0(const texpr0& x, const dimchange& d, bool add)
 					  const_cast<ap_dimchange_t*>(d.get_ap_dimchange_t())));
 }
 
+#if __cplusplus >= 201103L
+inline texpr0::texpr0(texpr0&& x) noexcept
+{
+  init_from(ap_texpr0_cst_scalar_double(0));
+  std::swap(l, x.l);
+}
+#endif
+
 inline texpr0::texpr0(const texpr0& x, const dimperm& d)
 {
   init_from(ap_texpr0_permute_dimensions(const_cast<ap_texpr0_t*>(&x.l), 
@@ -126,6 +134,14 @@ inline texpr0& texpr0::operator= (const texpr0& x)
   return *this; 
 }
 
+#if __cplusplus >= 201103L
+inline texpr0& texpr0::operator= (texpr0&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 inline texpr0& texpr0::operator= (const const_iterator& x)
 { 
   // copy first, as x.l may alias this!
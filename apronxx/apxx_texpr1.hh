@@ -72,6 +72,10 @@ public:
 
   //! Makes a (deep) copy of the expression tree.
   texpr1(const texpr1& x);
+#if __cplusplus >= 201103L
+  //! Moves the contents of x into *this (no copy), leaving x set to the constant 0.
+  texpr1(texpr1&& x) noexcept;
+#endif
 
   /*! \brief Makes a variable name dimension leaf.
    *
@@ -141,6 +145,10 @@ public:
 
   //! Makes a (deep) copy of the expression.
   texpr1& operator=(const texpr1& x);
+#if __cplusplus >= 201103L
+  //! Swaps the contents of *this and x (no copy).
+  texpr1& operator= (texpr1&& x) noexcept;
+#endif
 
   //! Makes a (deep) copy of the expression.
   texpr1& operator=(const const_iterator& x);
@@ -34,6 +34,14 @@ inline texpr1::texpr1(const texpr1& x)
   init_from(ap_texpr1_copy(const_cast<ap_texpr1_t*>(&x.l)));
 }
 
+#if __cplusplus >= 201103L
+inline texpr1::texpr1(texpr1&& x) noexcept
+{
+  init_from(ap_environment_copy(x.l.env), ap_texpr0_cst_scalar_double(0));
+  std::swap(l, x.l);
+}
+#endif
+
 inline texpr1::texpr1(const builder& x)
 {
   init_from(ap_texpr1_copy(const_cast<ap_texpr1_t*>(x.get_ap_texpr1_t())));
@@ -120,6 +128,14 @@ inline texpr1& texpr1::operator=(const texpr1& x)
   return *this; 
 }
 
+#if __cplusplus >= 201103L
+inline texpr1& texpr1::operator= (texpr1&& x) noexcept
+{
+  std::swap(l, x.l);
+  return *this;
+}
+#endif
+
 inline texpr1& texpr1::operator=(const builder& x)
 {
   ap_texpr1_t* c = ap_texpr1_copy(const_cast<ap_texpr1_t*>(x.get_ap_texpr1_t()));
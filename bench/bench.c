@@ -0,0 +1,468 @@
+/*
+ * bench.c
+ *
+ * Microbenchmarks of the numerical domains on random abstract values.
+ *
+ * Usage: bench [-f csv|json] [-n dims] [-d densities] [-c components]
+ *              [-r reps] [-s seed] [-t timeout] [-o ops] [domain...]
+ *   -f: output format (default csv)
+ *   -n: comma-separated list of dimensions (default 4,8,12)
+ *   -d: comma-separated list of densities, in ]0,1] (default 0.5)
+ *   -c: comma-separated list of numbers of components (default 1)
+ *   -r: number of repetitions of each operation (default 10)
+ *   -s: seed of the generator (default 1)
+ *   -t: timeout in milliseconds set on every function (default 0, none)
+ *   -o: comma-separated list of operations among
+ *       closure,join,meet,widening,assign,meet_lincons,is_leq (default all)
+ *   domain: among box,oct,optoct,polka,pkeq,t1p (default all)
+ *
+ * The variables are split into the given number of components of (almost)
+ * equal size. A random abstract value contains a random point, is bounded by
+ * a random box around it, and is constrained by density*s*(s-1)/2 random
+ * octagonal constraints satisfied by the point in each component of size s
+ * (equalities for pkeq). The two operands of binary operations share their
+ * point, so that their meet is not empty.
+ *
+ * The operations are:
+ * - closure: ap_abstract0_is_bottom on a value built lazily (meet_lincons
+ *   with algorithm -1), which forces the closure of octagons and the
+ *   conversion of polyhedra;
+ * - join, meet: of two values a and b;
+ * - widening: of a and of the join of a and b;
+ * - assign: of x_k := x_i + x_j + 1, with i,j,k in the same component;
+ * - meet_lincons: of a with a new array of constraints;
+ * - is_leq: of a and of the join of a and b.
+ *
+ * Each line of the output gives the minimal, mean and maximal time of one
+ * operation, in microseconds, and the number of repetitions that raised an
+ * exception (a timeout, or a function not implemented by the domain).
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ap_global0.h"
+
+#include "box.h"
+#include "oct.h"
+#include "opt_oct.h"
+#include "pk.h"
+#include "pkeq.h"
+#include "t1p.h"
+
+typedef enum bench_op_t {
+  BENCH_CLOSURE,
+  BENCH_JOIN,
+  BENCH_MEET,
+  BENCH_WIDENING,
+  BENCH_ASSIGN,
+  BENCH_MEET_LINCONS,
+  BENCH_IS_LEQ,
+  BENCH_OP_SIZE
+} bench_op_t;
+
+static const char* bench_name_of_op[BENCH_OP_SIZE] = {
+  "closure","join","meet","widening","assign","meet_lincons","is_leq"
+};
+
+static const char* bench_domains[] = {
+  "box","oct","optoct","polka","pkeq","t1p"
+};
+#define BENCH_NB_DOMAINS (sizeof(bench_domains)/sizeof(bench_domains[0]))
+
+/* Parameters of the generator */
+typedef struct bench_param_t {
+  size_t dim;
+  double density;
+  size_t comp;    /* number of components */
+  long seed;
+  bool eq;        /* equalities instead of inequalities */
+} bench_param_t;
+
+/* Timing of an operation */
+typedef struct bench_stat_t {
+  size_t reps;
+  double min,sum,max;  /* in seconds */
+  size_t nexc;
+} bench_stat_t;
+
+/* ********************************************************************** */
+/* I. Generator */
+/* ********************************************************************** */
+
+static ap_manager_t* manager_of_name(const char* name)
+{
+  if (!strcmp(name,"box")) return box_manager_alloc();
+  if (!strcmp(name,"oct")) return oct_manager_alloc();
+  if (!strcmp(name,"optoct")) return opt_oct_manager_alloc();
+  if (!strcmp(name,"polka")) return pk_manager_alloc(false);
+  if (!strcmp(name,"pkeq")) return pkeq_manager_alloc();
+  if (!strcmp(name,"t1p")) return t1p_manager_alloc();
+  return NULL;
+}
+
+/* Bounds [*start,*end[ of the component of the variable i */
+static void component_of_dim(bench_param_t* p, size_t i,
+			     size_t* start, size_t* end)
+{
+  size_t size = p->dim / p->comp;
+  size_t rem = p->dim % p->comp;
+  /* the rem first components have size+1 variables */
+  size_t c = i < rem*(size+1) ? i/(size+1) : rem + (i-rem*(size+1))/size;
+  *start = c<rem ? c*(size+1) : rem*(size+1) + (c-rem)*size;
+  *end = *start + (c<rem ? size+1 : size);
+}
+
+/* Random point shared by the values generated with the same parameters */
+static double* bench_point(bench_param_t* p)
+{
+  double* pt = malloc(p->dim*sizeof(double));
+  size_t i;
+  srand48(p->seed);
+  for (i=0; i<p->dim; i++) pt[i] = (double)(lrand48()%101 - 50);
+  return pt;
+}
+
+/* Random octagonal constraint si*x_i + sj*x_j <= c satisfied by pt */
+static ap_lincons0_t bench_lincons(bench_param_t* p, double* pt, size_t i)
+{
+  size_t start,end,j;
+  double si,sj,cst;
+  ap_linexpr0_t* e;
+
+  component_of_dim(p,i,&start,&end);
+  do { j = start + (size_t)lrand48()%(end-start); } while (j==i);
+  si = lrand48()%2 ? 1.0 : -1.0;
+  sj = lrand48()%2 ? 1.0 : -1.0;
+  cst = si*pt[i] + sj*pt[j];
+  if (!p->eq) cst += (double)(lrand48()%10);
+  e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_coeff_scalar_double(e,(ap_dim_t)i,-si);
+  ap_linexpr0_set_coeff_scalar_double(e,(ap_dim_t)j,-sj);
+  ap_linexpr0_set_cst_scalar_double(e,cst);
+  return ap_lincons0_make(p->eq ? AP_CONS_EQ : AP_CONS_SUPEQ,e,NULL);
+}
+
+/* density*s*(s-1)/2 random constraints in each component of size s */
+static ap_lincons0_array_t bench_lincons_array(bench_param_t* p, double* pt)
+{
+  ap_lincons0_array_t array;
+  size_t start,end,s,n,k,size;
+
+  size = 0;
+  for (start=0; start<p->dim; start=end){
+    component_of_dim(p,start,&start,&end);
+    s = end-start;
+    if (s>1) size += (size_t)(p->density*(double)(s*(s-1)/2) + 0.5);
+  }
+  array = ap_lincons0_array_make(size);
+  k = 0;
+  for (start=0; start<p->dim; start=end){
+    component_of_dim(p,start,&start,&end);
+    s = end-start;
+    if (s<=1) continue;
+    n = (size_t)(p->density*(double)(s*(s-1)/2) + 0.5);
+    for (; n>0; n--, k++){
+      array.p[k] = bench_lincons(p,pt,start + (size_t)lrand48()%s);
+    }
+  }
+  return array;
+}
+
+/* Random value around pt, built from top by meet_lincons with the given
+   algorithm (lazy if negative); the bounds of the box are given as
+   constraints, as not all domains implement of_box */
+static ap_abstract0_t* bench_value(ap_manager_t* man, bench_param_t* p,
+				   double* pt, long seed, int algorithm)
+{
+  ap_lincons0_array_t array;
+  ap_abstract0_t* a;
+  ap_funopt_t funopt,save;
+  size_t i,size;
+
+  srand48(seed);
+  array = bench_lincons_array(p,pt);
+  size = array.size;
+  ap_lincons0_array_resize(&array,size+2*p->dim);
+  for (i=0; i<p->dim; i++){
+    ap_linexpr0_t* e;
+    /* x_i >= pt_i - w */
+    e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_coeff_scalar_double(e,(ap_dim_t)i,1.0);
+    ap_linexpr0_set_cst_scalar_double(e,(double)(1+lrand48()%50) - pt[i]);
+    array.p[size+2*i] = ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+    /* x_i <= pt_i + w */
+    e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_coeff_scalar_double(e,(ap_dim_t)i,-1.0);
+    ap_linexpr0_set_cst_scalar_double(e,(double)(1+lrand48()%50) + pt[i]);
+    array.p[size+2*i+1] = ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+  }
+  a = ap_abstract0_top(man,0,p->dim);
+  save = funopt = ap_manager_get_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY);
+  funopt.algorithm = algorithm;
+  ap_manager_set_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY,&funopt);
+  a = ap_abstract0_meet_lincons_array(man,true,a,&array);
+  ap_manager_set_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY,&save);
+  ap_lincons0_array_clear(&array);
+  return a;
+}
+
+/* ********************************************************************** */
+/* II. Timing */
+/* ********************************************************************** */
+
+static double bench_clock(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+}
+
+static void bench_stat_add(bench_stat_t* stat, ap_manager_t* man, double time)
+{
+  if (stat->reps==0 || time<stat->min) stat->min = time;
+  if (stat->reps==0 || time>stat->max) stat->max = time;
+  stat->sum += time;
+  stat->reps++;
+  if (man->result.exn!=AP_EXC_NONE) stat->nexc++;
+  ap_manager_clear_exclog(man);
+  man->result.exn = AP_EXC_NONE;
+}
+
+/* Run reps times the operation op on random values */
+static void bench_run(ap_manager_t* man, bench_param_t* p, bench_op_t op,
+		      size_t reps, bench_stat_t* stat)
+{
+  double* pt = bench_point(p);
+  ap_abstract0_t *a,*b,*j,*x;
+  ap_lincons0_array_t array;
+  ap_linexpr0_t* e;
+  ap_dim_t k;
+  size_t r,start,end;
+  double t;
+
+  memset(stat,0,sizeof(bench_stat_t));
+  a = bench_value(man,p,pt,p->seed+1,0);
+  b = bench_value(man,p,pt,p->seed+2,0);
+  j = ap_abstract0_join(man,false,a,b);
+  srand48(p->seed+3);
+  array = bench_lincons_array(p,pt);
+  k = (ap_dim_t)((size_t)lrand48()%p->dim);
+  component_of_dim(p,k,&start,&end);
+  e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_coeff_scalar_double(e,(ap_dim_t)(start+(size_t)lrand48()%(end-start)),1.0);
+  ap_linexpr0_set_coeff_scalar_double(e,(ap_dim_t)(start+(size_t)lrand48()%(end-start)),1.0);
+  ap_linexpr0_set_cst_scalar_double(e,1.0);
+  ap_manager_clear_exclog(man);
+  man->result.exn = AP_EXC_NONE;
+
+  for (r=0; r<reps; r++){
+    x = NULL;
+    switch (op){
+    case BENCH_CLOSURE:
+      x = bench_value(man,p,pt,p->seed+1,-1);
+      ap_manager_clear_exclog(man);
+      man->result.exn = AP_EXC_NONE;
+      t = bench_clock();
+      ap_abstract0_is_bottom(man,x);
+      t = bench_clock() - t;
+      break;
+    case BENCH_JOIN:
+      t = bench_clock();
+      x = ap_abstract0_join(man,false,a,b);
+      t = bench_clock() - t;
+      break;
+    case BENCH_MEET:
+      t = bench_clock();
+      x = ap_abstract0_meet(man,false,a,b);
+      t = bench_clock() - t;
+      break;
+    case BENCH_WIDENING:
+      t = bench_clock();
+      x = ap_abstract0_widening(man,a,j);
+      t = bench_clock() - t;
+      break;
+    case BENCH_ASSIGN:
+      t = bench_clock();
+      x = ap_abstract0_assign_linexpr_array(man,false,a,&k,&e,1,NULL);
+      t = bench_clock() - t;
+      break;
+    case BENCH_MEET_LINCONS:
+      t = bench_clock();
+      x = ap_abstract0_meet_lincons_array(man,false,a,&array);
+      t = bench_clock() - t;
+      break;
+    case BENCH_IS_LEQ:
+      t = bench_clock();
+      ap_abstract0_is_leq(man,a,j);
+      t = bench_clock() - t;
+      break;
+    default:
+      abort();
+    }
+    bench_stat_add(stat,man,t);
+    if (x) ap_abstract0_free(man,x);
+  }
+
+  ap_linexpr0_free(e);
+  ap_lincons0_array_clear(&array);
+  ap_abstract0_free(man,j);
+  ap_abstract0_free(man,b);
+  ap_abstract0_free(man,a);
+  free(pt);
+}
+
+/* ********************************************************************** */
+/* III. Main */
+/* ********************************************************************** */
+
+/* Parse a comma-separated list of numbers into *tab (malloced) */
+static size_t parse_list(const char* str, double** tab)
+{
+  size_t size = 1;
+  const char* s;
+  char* end;
+  for (s=str; *s; s++) if (*s==',') size++;
+  *tab = malloc(size*sizeof(double));
+  size = 0;
+  s = str;
+  for (;;){
+    (*tab)[size++] = strtod(s,&end);
+    if (end==s) { free(*tab); return 0; }
+    if (*end==0) return size;
+    if (*end!=',') { free(*tab); return 0; }
+    s = end+1;
+  }
+}
+
+static void usage(const char* prog)
+{
+  fprintf(stderr,
+	  "usage: %s [-f csv|json] [-n dims] [-d densities] [-c components]\n"
+	  "       [-r reps] [-s seed] [-t timeout] [-o ops] [domain...]\n",
+	  prog);
+  exit(2);
+}
+
+int main(int argc, char** argv)
+{
+  double default_dims[] = {4,8,12};
+  double default_densities[] = {0.5};
+  double default_comps[] = {1};
+  double *dims = default_dims, *densities = default_densities, *comps = default_comps;
+  size_t nbdims = 3, nbdensities = 1, nbcomps = 1;
+  bool json = false;
+  bool ops[BENCH_OP_SIZE];
+  bool first = true;
+  size_t reps = 10, timeout = 0;
+  long seed = 1;
+  const char* const* domains = bench_domains;
+  size_t nbdomains = BENCH_NB_DOMAINS;
+  size_t d,i,n,c,o;
+  int arg;
+
+  for (o=0; o<BENCH_OP_SIZE; o++) ops[o] = true;
+  for (arg=1; arg<argc && argv[arg][0]=='-'; arg+=2){
+    const char* opt = argv[arg];
+    const char* val = argv[arg+1];
+    if (opt[1]==0 || opt[2]!=0 || val==NULL) usage(argv[0]);
+    switch (opt[1]){
+    case 'f':
+      if (!strcmp(val,"json")) json = true;
+      else if (strcmp(val,"csv")) usage(argv[0]);
+      break;
+    case 'n': nbdims = parse_list(val,&dims); break;
+    case 'd': nbdensities = parse_list(val,&densities); break;
+    case 'c': nbcomps = parse_list(val,&comps); break;
+    case 'r': reps = (size_t)atol(val); break;
+    case 's': seed = atol(val); break;
+    case 't': timeout = (size_t)atol(val); break;
+    case 'o':
+      for (o=0; o<BENCH_OP_SIZE; o++){
+	const char* s = strstr(val,bench_name_of_op[o]);
+	size_t len = strlen(bench_name_of_op[o]);
+	ops[o] = s && (s==val || s[-1]==',') && (s[len]==0 || s[len]==',');
+      }
+      break;
+    default:
+      usage(argv[0]);
+    }
+    if (nbdims==0 || nbdensities==0 || nbcomps==0 || reps==0) usage(argv[0]);
+  }
+  if (arg<argc){
+    domains = (const char* const*)(argv+arg);
+    nbdomains = (size_t)(argc-arg);
+  }
+
+  if (json) printf("[\n");
+  else printf("domain,op,dim,density,components,reps,min_us,mean_us,max_us,exceptions\n");
+  for (d=0; d<nbdomains; d++){
+    ap_manager_t* man = manager_of_name(domains[d]);
+    if (man==NULL){
+      fprintf(stderr,"%s: unknown domain %s\n",argv[0],domains[d]);
+      return 2;
+    }
+    for (i=0; i<AP_EXC_SIZE; i++){
+      ap_manager_set_abort_if_exception(man,(ap_exc_t)i,false);
+    }
+    if (timeout){
+      for (i=0; i<AP_FUNID_SIZE; i++){
+	ap_funopt_t funopt = ap_manager_get_funopt(man,(ap_funid_t)i);
+	funopt.timeout = timeout;
+	ap_manager_set_funopt(man,(ap_funid_t)i,&funopt);
+      }
+    }
+    for (n=0; n<nbdims; n++)
+    for (i=0; i<nbdensities; i++)
+    for (c=0; c<nbcomps; c++){
+      bench_param_t p;
+      p.dim = (size_t)dims[n];
+      p.density = densities[i];
+      p.comp = (size_t)comps[c];
+      p.seed = seed;
+      p.eq = !strcmp(domains[d],"pkeq");
+      if (p.dim==0) continue;
+      if (p.comp<1) p.comp = 1;
+      if (p.comp>p.dim) p.comp = p.dim;
+      for (o=0; o<BENCH_OP_SIZE; o++){
+	bench_stat_t stat;
+	if (!ops[o]) continue;
+	bench_run(man,&p,(bench_op_t)o,reps,&stat);
+	if (json){
+	  printf("%s  {\"domain\": \"%s\", \"op\": \"%s\", \"dim\": %lu, "
+		 "\"density\": %g, \"components\": %lu, \"reps\": %lu, "
+		 "\"min_us\": %.3f, \"mean_us\": %.3f, \"max_us\": %.3f, "
+		 "\"exceptions\": %lu}",
+		 first ? "" : ",\n",
+		 domains[d],bench_name_of_op[o],
+		 (unsigned long)p.dim,p.density,(unsigned long)p.comp,
+		 (unsigned long)stat.reps,
+		 1e6*stat.min,1e6*stat.sum/(double)stat.reps,1e6*stat.max,
+		 (unsigned long)stat.nexc);
+	}
+	else {
+	  printf("%s,%s,%lu,%g,%lu,%lu,%.3f,%.3f,%.3f,%lu\n",
+		 domains[d],bench_name_of_op[o],
+		 (unsigned long)p.dim,p.density,(unsigned long)p.comp,
+		 (unsigned long)stat.reps,
+		 1e6*stat.min,1e6*stat.sum/(double)stat.reps,1e6*stat.max,
+		 (unsigned long)stat.nexc);
+	}
+	first = false;
+	fflush(stdout);
+      }
+    }
+    ap_manager_free(man);
+  }
+  if (json) printf("\n]\n");
+  if (dims!=default_dims) free(dims);
+  if (densities!=default_densities) free(densities);
+  if (comps!=default_comps) free(comps);
+  return 0;
+}
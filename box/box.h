@@ -176,6 +176,16 @@ ap_interval_t** box_to_box(ap_manager_t* man, box_t* a);
      The size of the resulting array is box_dimension(man,a).  This
      function can be reimplemented by using box_bound_linexpr */
 
+double* box_to_double_array(ap_manager_t* man, box_t* a);
+  /* Gives direct access to the bounds of a box value, when they are doubles
+     (library boxD): returns an array of 2*box_dimension(man,a) doubles,
+     holding in turn the opposite of the lower bound and the upper bound of
+     each dimension, or NULL if the box is empty.
+
+     The array is not a copy: it belongs to a, and is valid as long as a is
+     neither freed nor modified. With the other libraries, raises
+     AP_EXC_NOT_IMPLEMENTED and returns NULL. */
+
 ap_lincons0_array_t box_to_lincons_array(ap_manager_t* man, box_t* a);
   /* Converts a box value to a polyhedra
      (conjunction of linear constraints).
@@ -218,6 +228,12 @@ box_t* box_meet_lincons_array(ap_manager_t* man,
 			      ap_lincons0_array_t* array);
   /* Meet of an box value with a set of constraints */
 
+box_t* box_meet_linpack0(ap_manager_t* man,
+			 bool destructive,
+			 box_t* a,
+			 ap_linpack0_t* pack);
+  /* Idem, with the constraints given as a pack */
+
 box_t*
 box_meet_tcons_array(ap_manager_t* man,
 		     bool destructive, box_t* a, ap_tcons0_array_t* array);
@@ -253,6 +269,15 @@ box_t* box_assign_linexpr_array(ap_manager_t* man,
 				size_t size,
 				box_t* dest);
 
+box_t* box_assign_linpack0(ap_manager_t* man,
+			   bool destructive,
+			   box_t* a,
+			   ap_dim_t* tdim,
+			   ap_linpack0_t* pack,
+			   box_t* dest);
+  /* Idem, with the expressions given as a pack: the i-th row of the pack is
+     assigned to tdim[i], i<pack->size */
+
 box_t* box_substitute_linexpr_array(ap_manager_t* man,
 				    bool destructive,
 				    box_t* org,
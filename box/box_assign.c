@@ -52,6 +52,40 @@ box_t* box_assign_linexpr_array(ap_manager_t* man,
   return res;
 }
 
+box_t* box_assign_linpack0(ap_manager_t* man,
+			   bool destructive,
+			   box_t* a,
+			   ap_dim_t* tdim,
+			   ap_linpack0_t* pack,
+			   box_t* dest)
+{
+  bool exact;
+  size_t i;
+  box_t* res;
+  itv_linexpr_t expr;
+  box_internal_t* intern = man->internal;
+
+  exact = true;
+  if (a->p==NULL || (dest && dest->p==NULL)){
+    man->result.flag_best = true;
+    man->result.flag_exact = true;
+    return destructive ? a : box_copy(man,a);
+  }
+  res = (pack->size==1 && destructive) ? a : box_copy(man,a);
+  itv_linexpr_init(&expr,0);
+  for (i=0;i<pack->size;i++){
+    exact = itv_linexpr_set_ap_linpack0(intern->itv,&expr,pack,i) && exact;
+    itv_eval_linexpr(intern->itv,res->p[tdim[i]],&expr,a->p);
+  }
+  itv_linexpr_clear(&expr);
+  if (res!=a && destructive) box_free(man,a);
+  if (dest)
+    res = box_meet(man,true,res,dest);
+  man->result.flag_best = pack->size==1 && exact;
+  man->result.flag_exact = false;
+  return res;
+}
+
 box_t* box_substitute_linexpr_array(ap_manager_t* man,
 				    bool destructive,
 				    box_t* a,
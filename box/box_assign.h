@@ -18,6 +18,12 @@ box_t* box_assign_linexpr_array(ap_manager_t* man,
 				ap_linexpr0_t** texpr,
 				size_t size,
 				box_t* dest);
+box_t* box_assign_linpack0(ap_manager_t* man,
+			   bool destructive,
+			   box_t* a,
+			   ap_dim_t* tdim,
+			   ap_linpack0_t* pack,
+			   box_t* dest);
 box_t* box_substitute_linexpr_array(ap_manager_t* man,
 				    bool destructive,
 				    box_t* a,
@@ -522,3 +522,18 @@ ap_interval_t** box_to_box(ap_manager_t* man, box_t* a)
   }
   return interval;
 }
+
+/* Direct access to the bounds, if they are doubles: an itv_t is then a pair
+   of doubles, the first one being the opposite of the lower bound */
+double* box_to_double_array(ap_manager_t* man, box_t* a)
+{
+  man->result.flag_best = true;
+  man->result.flag_exact = true;
+#if defined(NUM_DOUBLE)
+  return (double*)a->p;
+#else
+  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,AP_FUNID_TO_BOX,
+			     "only with double bounds (library boxD)");
+  return NULL;
+#endif
+}
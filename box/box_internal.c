@@ -50,6 +50,11 @@ void box_internal_free(box_internal_t* intern)
   box_internal_clear(intern);
   free(intern);
 }
+/* Fresh working space for a clone of a box manager */
+static void* box_internal_clone(void* intern, ap_manager_t* man)
+{
+  return box_internal_alloc();
+}
 
 ap_manager_t* box_manager_alloc(void)
 {
@@ -65,6 +70,7 @@ ap_manager_t* box_manager_alloc(void)
   itv = box_internal_alloc();
   man = ap_manager_alloc("box", "1.0 with " NUM_NAME,
 			 itv, (void (*)(void*))box_internal_free);
+  ap_manager_set_internal_clone(man, &box_internal_clone);
   funptr = man->funptr;
 
   funptr[AP_FUNID_COPY] = &box_copy;
@@ -168,6 +168,39 @@ box_t* box_add_ray_array(ap_manager_t* man,
 /* Meet_lincons */
 /* ============================================================ */
 
+/* Meet res with the already converted constraints, by at most kmax
+   propagation passes; stops early on the timeout of the current call on
+   man (the box is sound after each pass) */
+static void box_meet_itv_lincons_array(ap_manager_t* man,
+				       ap_funid_t funid,
+				       box_internal_t* intern,
+				       box_t* res,
+				       itv_lincons_array_t* tlincons,
+				       size_t kmax)
+{
+  size_t k;
+  tbool_t tb = itv_lincons_array_reduce_integer(intern->itv,tlincons,res->intdim);
+  if (tb==tbool_false){
+    goto _box_meet_itv_lincons_array_bottom;
+  }
+  for (k=0; k<kmax; k++){
+    if (k>0 && ap_manager_timeout(man)){
+      ap_manager_raise_exception(man,AP_EXC_TIMEOUT,funid,
+				 "propagation interrupted by timeout");
+      break;
+    }
+    if (!itv_boxize_lincons_array(intern->itv,
+				  res->p,NULL,
+				  tlincons,res->p,res->intdim,1,false))
+      break;
+    if (itv_is_bottom(intern->itv,res->p[0])) break;
+  }
+  if (itv_is_bottom(intern->itv,res->p[0])){
+  _box_meet_itv_lincons_array_bottom:
+    box_set_bottom(res);
+  }
+}
+
 box_t* box_meet_lincons_array(ap_manager_t* man,
 			      bool destructive,
 			      box_t* a,
@@ -190,17 +223,37 @@ box_t* box_meet_lincons_array(ap_manager_t* man,
     if (kmax<1) kmax=2;
     itv_lincons_array_init(&tlincons,array->size);
     itv_lincons_array_set_ap_lincons0_array(intern->itv,&tlincons,array);
-    tbool_t tb = itv_lincons_array_reduce_integer(intern->itv,&tlincons,a->intdim);
-    if (tb==tbool_false){
-      goto _box_meet_lincons_array_bottom;
-    }
-    itv_boxize_lincons_array(intern->itv,
-			     res->p,NULL,
-			     &tlincons,res->p,a->intdim,kmax,false);
-    if (itv_is_bottom(intern->itv,res->p[0])){
-    _box_meet_lincons_array_bottom:
-      box_set_bottom(res);
-    }
+    box_meet_itv_lincons_array(man,AP_FUNID_MEET_LINCONS_ARRAY,
+			       intern,res,&tlincons,kmax);
+    itv_lincons_array_clear(&tlincons);
+  }
+  return res;
+}
+
+box_t* box_meet_linpack0(ap_manager_t* man,
+			 bool destructive,
+			 box_t* a,
+			 ap_linpack0_t* pack)
+{
+  box_t* res;
+  size_t kmax;
+  itv_lincons_array_t tlincons;
+  box_internal_t* intern = (box_internal_t*)man->internal;
+
+  res = destructive ? a : box_copy(man,a);
+  if (a->p==NULL){
+    man->result.flag_best = true;
+    man->result.flag_exact = true;
+  }
+  else {
+    man->result.flag_best = pack->size==1;
+    man->result.flag_exact = false;
+    kmax = man->option.funopt[AP_FUNID_MEET_LINCONS_ARRAY].algorithm;
+    if (kmax<1) kmax=2;
+    itv_lincons_array_init(&tlincons,pack->size);
+    itv_lincons_array_set_ap_linpack0(intern->itv,&tlincons,pack);
+    box_meet_itv_lincons_array(man,AP_FUNID_MEET_LINCONS_ARRAY,
+			       intern,res,&tlincons,kmax);
     itv_lincons_array_clear(&tlincons);
   }
   return res;
@@ -234,27 +287,25 @@ box_t* box_meet_tcons_array(ap_manager_t* man,
       itv_lincons_array_init(&tlincons,array->size);
       itv_intlinearize_ap_tcons0_array(intern->itv,&tlincons,
                                        array,res->p,res->intdim);
-      tbool_t tb = itv_lincons_array_reduce_integer(intern->itv,&tlincons,a->intdim);
-      if (tb==tbool_false){
-        goto _box_meet_tcons_array_bottom;
-      }
-      itv_boxize_lincons_array(intern->itv,
-                               res->p,NULL,
-                               &tlincons,res->p,a->intdim,kmax,false);
-      if (itv_is_bottom(intern->itv,res->p[0])){
-      _box_meet_tcons_array_bottom:
-        box_set_bottom(res);
-      }
+      box_meet_itv_lincons_array(man,AP_FUNID_MEET_TCONS_ARRAY,
+                                 intern,res,&tlincons,kmax);
       itv_lincons_array_clear(&tlincons);
     }
     else {
       /* algo in 100 - +oo: experimental implementation based on HC4 */
 
+      bool interrupted;
       kmax -= 100;
       if (kmax < 1) kmax = 2; /* default, for algorithm = 100 */
-      if (itv_meet_ap_tcons0_array(intern->itv,array,res->p,res->intdim,kmax)) {
+      if (itv_meet_ap_tcons0_array_timeout(intern->itv,array,res->p,res->intdim,
+                                           kmax,man,&interrupted)) {
         box_set_bottom(res);
       }
+      else if (interrupted) {
+        ap_manager_raise_exception(man,AP_EXC_TIMEOUT,
+                                   AP_FUNID_MEET_TCONS_ARRAY,
+                                   "propagation interrupted by timeout");
+      }
     }
   }
   return res;
@@ -127,7 +127,7 @@ void ITVFUN(itv_internal_free)(itv_internal_t* intern)
    In any case, return true if the interval is bottom
 */
 bool ITVFUN(itv_canonicalize)(itv_internal_t* intern,
-			      itv_t a, bool integer)
+			      itv_ptr a, bool integer)
 {
   bool exc;
 
@@ -154,7 +154,7 @@ bool ITVFUN(itv_canonicalize)(itv_internal_t* intern,
    - an itv and a num or a bound,
 */
 
-void ITVFUN(itv_mul_num)(itv_t a, itv_t b, num_t c)
+void ITVFUN(itv_mul_num)(itv_ptr a, itv_ptr b, num_t c)
 {
   if (num_sgn(c)>=0){
     bound_mul_num(a->sup,b->sup,c);
@@ -168,7 +168,7 @@ void ITVFUN(itv_mul_num)(itv_t a, itv_t b, num_t c)
   }
 }
 
-void ITVFUN(itv_mul_bound)(itv_t a, itv_t b, bound_t c)
+void ITVFUN(itv_mul_bound)(itv_ptr a, itv_ptr b, bound_t c)
 {
   assert (c!=a->inf && c!=a->sup && c!=b->inf && c!=b->sup);
   if (bound_sgn(c)>=0){
@@ -183,7 +183,7 @@ void ITVFUN(itv_mul_bound)(itv_t a, itv_t b, bound_t c)
   }
 }
 
-void ITVFUN(itv_div_num)(itv_t a, itv_t b, num_t c)
+void ITVFUN(itv_div_num)(itv_ptr a, itv_ptr b, num_t c)
 {
   if (num_sgn(c)>=0){
     bound_div_num(a->sup,b->sup,c);
@@ -196,7 +196,7 @@ void ITVFUN(itv_div_num)(itv_t a, itv_t b, num_t c)
     num_neg(c,c);
   }
 }
-void ITVFUN(itv_div_bound)(itv_t a, itv_t b, bound_t c)
+void ITVFUN(itv_div_bound)(itv_ptr a, itv_ptr b, bound_t c)
 {
   assert (c!=a->inf && c!=a->sup && c!=b->inf && c!=b->sup);
   if (bound_sgn(c)>=0){
@@ -210,20 +210,9 @@ void ITVFUN(itv_div_bound)(itv_t a, itv_t b, bound_t c)
     bound_neg(c,c);
   }
 }
-void ITVFUN(itv_sub)(itv_t a, itv_t b, itv_t c)
-{
-  if (a!=c){
-    bound_add(a->inf,b->inf,c->sup);
-    bound_add(a->sup,b->sup,c->inf);
-  } else if (a!=b) { /* a=c */
-    bound_swap(c->sup,c->inf);
-    itv_add(a,b,c);
-  } else { /* a=b=c */
-    bound_add(a->sup,b->sup,c->inf);
-    bound_set(a->inf,a->sup);
-  }
-}
-void ITVFUN(itv_neg)(itv_t a, itv_t b)
+void ITVFUN(itv_sub)(itv_ptr a, itv_ptr b, itv_ptr c)
+{ itv_sub(a,b,c); }
+void ITVFUN(itv_neg)(itv_ptr a, itv_ptr b)
 {
   if (a!=b){
     bound_set(a->inf,b->sup);
@@ -233,7 +222,7 @@ void ITVFUN(itv_neg)(itv_t a, itv_t b)
   }
 }
 
-bool ITVFUN(itv_sqrt)(itv_internal_t* intern, itv_t a, itv_t b)
+bool ITVFUN(itv_sqrt)(itv_internal_t* intern, itv_ptr a, itv_ptr b)
 {
   bool exact = true;
   if (itv_is_bottom(intern,b) || bound_sgn(b->sup)<0) {
@@ -258,7 +247,7 @@ bool ITVFUN(itv_sqrt)(itv_internal_t* intern, itv_t a, itv_t b)
   return exact;
 }
 
-void ITVFUN(itv_abs)(itv_t a, itv_t b)
+void ITVFUN(itv_abs)(itv_ptr a, itv_ptr b)
 {
   if (bound_sgn(b->inf)<=0)
     /* positive interval */
@@ -272,7 +261,7 @@ void ITVFUN(itv_abs)(itv_t a, itv_t b)
   }
 }
 
-void ITVFUN(itv_mod)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c,
+void ITVFUN(itv_mod)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c,
 		     bool is_int)
 {
   /* b-|c|*trunc(b/|c|) */
@@ -301,260 +290,23 @@ void ITVFUN(itv_mod)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c,
 
 
 /* ====================================================================== */
-/* Multiplication */
+/* Multiplication and division */
 /* ====================================================================== */
 
-/* Assume that both intervals are positive */
-static
-void itv_mulpp(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->inf)<=0);
-  bound_neg(intern->mul_bound,c->inf);
-  bound_mul(a->inf,b->inf,intern->mul_bound);
-  bound_mul(a->sup,b->sup,c->sup);
-}
-/* Assume that both intervals are negative */
-static
-void itv_mulnn(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->sup)<=0 && bound_sgn(c->sup)<=0);
-  bound_neg(intern->mul_bound,c->sup);
-  bound_mul(intern->mul_bound,b->sup,intern->mul_bound);
-  bound_mul(a->sup,b->inf,c->inf);
-  bound_set(a->inf,intern->mul_bound);
-}
-/* Assume that b is positive and c negative */
-static
-void itv_mulpn(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->sup)<=0);
-  bound_neg(intern->mul_bound,b->inf);
-  bound_mul(a->inf,b->sup,c->inf);
-  bound_mul(a->sup,intern->mul_bound,c->sup);
-}
-/* Assume that interval c is positive */
-static
-void itv_mulp(itv_internal_t* intern,
-	      itv_t a,
-	      itv_t b,
-	      itv_t c)
-{
-  assert(bound_sgn(c->inf)<=0);
+/* The kernels are inlined in itv.h; these are the out-of-line entry points. */
 
-  if (bound_sgn(b->inf)<=0){
-    /* b is positive */
-    itv_mulpp(intern,a,b,c);
-  }
-  else if (bound_sgn(b->sup)<=0){
-    /* b is negative */
-    itv_mulpn(intern,a,c,b);
-  }
-  else {
-    /* 0 is in the middle of b: one multiplies b by c->sup */
-    bound_mul(a->inf,b->inf,c->sup);
-    bound_mul(a->sup,b->sup,c->sup);
-  }
-}
-/* Assume that interval c is negative */
-static
-void itv_muln(itv_internal_t* intern,
-	      itv_t a,
-	      itv_t b,
-	      itv_t c)
-{
-  assert(bound_sgn(c->sup)<=0);
-
-  if (bound_sgn(b->inf)<=0){
-    /* b is positive */
-    itv_mulpn(intern,a,b,c);
-  }
-  else if (bound_sgn(b->sup)<=0){
-    /* b is negative */
-    itv_mulnn(intern,a,b,c);
-  }
-  else {
-    /* 0 is in the middle of b: one multiplies b by c->inf */
-    bound_mul(a->sup,b->sup,c->inf);
-    bound_mul(a->inf,b->inf,c->inf);
-    bound_swap(a->inf,a->sup);
-  }
-}
-
-void ITVFUN(itv_mul)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c)
-{
-  if (bound_sgn(c->inf)<=0){
-    /* c is positive, */
-    itv_mulp(intern,a,b,c);
-  }
-  else if (bound_sgn(c->sup)<=0){
-    /* c is negative */
-    itv_muln(intern,a,b,c);
-  }
-  else if (bound_sgn(b->inf)<=0){
-    /* b is positive, */
-    itv_mulp(intern,a,c,b);
-  }
-  else if (bound_sgn(c->sup)<=0){
-    /* b is negative */
-    itv_muln(intern,a,c,b);
-  }
-  else {
-    /* divide c */
-    bound_set(intern->mul_itv->inf,c->inf);
-    bound_set_int(intern->mul_itv->sup,0);
-    itv_muln(intern,intern->mul_itv2,b,intern->mul_itv);
-
-    bound_set_int(intern->mul_itv->inf,0);
-    bound_set(intern->mul_itv->sup,c->sup);
-    itv_mulp(intern,a,b,intern->mul_itv);
-
-    itv_join(a,a,intern->mul_itv2);
-  }
-}
-
-/* ====================================================================== */
-/* Division */
-/* ====================================================================== */
+void ITVFUN(itv_mul)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{ itv_mul(intern,a,b,c); }
 
-/* Assume that both intervals are positive */
-static
-void itv_divpp(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->inf)<0);
-  bound_neg(intern->mul_bound,c->inf);
-  bound_div(a->inf,b->inf,c->sup);
-  bound_div(a->sup,b->sup,intern->mul_bound);
-}
-/* Assume that both intervals are negative */
-static
-void itv_divnn(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->sup)<=0 && bound_sgn(c->sup)<0);
-  bound_neg(intern->mul_bound,b->inf);
-  bound_div(a->inf,b->sup,c->inf);
-  bound_div(a->sup,intern->mul_bound,c->sup);
-}
-/* Assume that b is positive and c negative */
-static
-void itv_divpn(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->sup)<0);
-  bound_neg(intern->mul_bound,b->sup);
-  bound_div(intern->mul_bound,intern->mul_bound,c->sup);
-  bound_div(a->sup,b->inf,c->inf);
-  bound_set(a->inf,intern->mul_bound);
-}
-/* Assume that b is negative and c positive */
-static
-void itv_divnp(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(b->sup)<=0 && bound_sgn(c->inf)<0);
-  bound_neg(intern->mul_bound, b->inf);
-  bound_div(a->inf,intern->mul_bound,c->inf);
-  bound_div(a->sup,b->sup,c->sup);
-}
-
-/* Assume that interval c is positive */
-static
-void itv_divp(itv_internal_t* intern,
-	       itv_t a,
-	       itv_t b,
-	       itv_t c)
-{
-  assert(bound_sgn(c->inf)<0);
-
-  if (bound_sgn(b->inf)<=0){
-    /* b is positive */
-    itv_divpp(intern,a,b,c);
-  }
-  else if (bound_sgn(b->sup)<=0){
-    /* b is negative */
-    itv_divnp(intern,a,b,c);
-  }
-  else {
-    /* 0 is in the middle of b: one divides b by c->inf */
-    bound_neg(intern->mul_bound,c->inf);
-    bound_div(a->inf,b->inf,intern->mul_bound);
-    bound_div(a->sup,b->sup,intern->mul_bound);
-  }
-}
-/* Assume that interval c is negative */
-static
-void itv_divn(itv_internal_t* intern,
-	      itv_t a,
-	      itv_t b,
-	      itv_t c)
-{
-  assert(bound_sgn(c->sup)<0);
-
-  if (bound_sgn(b->inf)<=0){
-    /* b is positive */
-    itv_divpn(intern,a,b,c);
-  }
-  else if (bound_sgn(b->sup)<=0){
-    /* b is negative */
-    itv_divnn(intern,a,b,c);
-  }
-  else {
-    /* 0 is in the middle of b: one cross-divide b by c->sup */
-    if (a!=b) {
-      bound_div(a->inf,b->sup,c->sup);
-      bound_div(a->sup,b->inf,c->sup);
-    }
-    else {
-      bound_div(intern->mul_bound,b->sup,c->sup);
-      bound_div(a->sup,b->inf,c->sup);
-      bound_set(a->inf,intern->mul_bound);
-    }
-  }
-}
-
-void ITVFUN(itv_div)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c)
-{
-  if (bound_sgn(c->inf)<0){
-    /* c is positive */
-    itv_divp(intern,a,b,c);
-  }
-  else if (bound_sgn(c->sup)<0){
-    /* c is negative */
-    itv_divn(intern,a,b,c);
-  }
-  else if (bound_sgn(b->inf)==0 && bound_sgn(b->sup)==0){
-    /* b is [0,0] */
-    itv_set(a,b);
-  }
-  else {
-    itv_set_top(a);
-  }
-}
+void ITVFUN(itv_div)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{ itv_div(intern,a,b,c); }
 
 
 /* ********************************************************************** */
 /* Power */
 /* ********************************************************************** */
 
-void ITVFUN(itv_pow)(itv_internal_t* intern, itv_t a, itv_t b, itv_t n)
+void ITVFUN(itv_pow)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr n)
 {
   long x;
   if (itv_is_bottom(intern, b) || itv_is_bottom(intern, n)) {
@@ -583,7 +335,7 @@ void ITVFUN(itv_pow)(itv_internal_t* intern, itv_t a, itv_t b, itv_t n)
 }
 
 /* inverse of pow, uses the sign of orga to determine the sign of a */
-void ITVFUN(itv_inv_pow)(itv_internal_t* intern, itv_t a, itv_t orga, itv_t b, itv_t n)
+void ITVFUN(itv_inv_pow)(itv_internal_t* intern, itv_ptr a, itv_ptr orga, itv_ptr b, itv_ptr n)
 {
   long x;
   assert(orga != a);
@@ -643,7 +395,7 @@ void ITVFUN(itv_inv_pow)(itv_internal_t* intern, itv_t a, itv_t orga, itv_t b, i
 /* Printing */
 /* ********************************************************************** */
 
-void ITVFUN(itv_fprint)(FILE* stream, itv_t a)
+void ITVFUN(itv_fprint)(FILE* stream, itv_ptr a)
 {
   num_t num;
 
@@ -660,11 +412,11 @@ void ITVFUN(itv_fprint)(FILE* stream, itv_t a)
   bound_fprint(stream,a->sup);
   fprintf(stream,"]");
 }
-void ITVFUN(itv_print)(itv_t a)
+void ITVFUN(itv_print)(itv_ptr a)
 {
   ITVFUN(itv_fprint)(stdout,a);
 }
-int ITVFUN(itv_snprint)(char* s, size_t size, itv_t a)
+int ITVFUN(itv_snprint)(char* s, size_t size, itv_ptr a)
 {
   num_t num;
   int count = 0;
@@ -689,7 +441,7 @@ int ITVFUN(itv_snprint)(char* s, size_t size, itv_t a)
 /* ********************************************************************** */
 
 bool ITVFUN(itv_set_ap_scalar)(itv_internal_t* intern,
-			   itv_t a, ap_scalar_t* b)
+			   itv_ptr a, ap_scalar_t* b)
 {
   assert (ap_scalar_infty(b)==0);
   bool exact = bound_set_ap_scalar(a->sup,b);
@@ -704,7 +456,7 @@ bool ITVFUN(itv_set_ap_scalar)(itv_internal_t* intern,
   }
 }
 bool ITVFUN(itv_set_ap_interval)(itv_internal_t* intern,
-			     itv_t a, ap_interval_t* b)
+			     itv_ptr a, ap_interval_t* b)
 {
   ap_scalar_neg(intern->ap_conversion_scalar, b->inf);
   bool b1 = bound_set_ap_scalar(a->inf,intern->ap_conversion_scalar);
@@ -712,7 +464,7 @@ bool ITVFUN(itv_set_ap_interval)(itv_internal_t* intern,
   return b1 && b2;
 }
 bool ITVFUN(itv_set_ap_coeff)(itv_internal_t* intern,
-			  itv_t itv, ap_coeff_t* coeff)
+			  itv_ptr itv, ap_coeff_t* coeff)
 {
   switch(coeff->discr){
   case AP_COEFF_SCALAR:
@@ -727,7 +479,7 @@ bool ITVFUN(itv_set_ap_coeff)(itv_internal_t* intern,
 }
 
 bool ITVFUN(ap_interval_set_itv)(itv_internal_t* intern,
-				   ap_interval_t* a, itv_t b)
+				   ap_interval_t* a, itv_ptr b)
 {
   bool b1 = ap_scalar_set_bound(a->inf,b->inf);
   ap_scalar_neg(a->inf,a->inf);
@@ -735,7 +487,7 @@ bool ITVFUN(ap_interval_set_itv)(itv_internal_t* intern,
   return b1 && b2;
 }
 bool ITVFUN(ap_coeff_set_itv)(itv_internal_t* intern,
-				ap_coeff_t* a, itv_t b)
+				ap_coeff_t* a, itv_ptr b)
 {
   bool exact;
 
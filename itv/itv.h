@@ -80,132 +80,132 @@ static inline void itv_internal_clear(itv_internal_t* intern);
 /* ********************************************************************** */
 
 /* Initialization and clearing */
-static inline void itv_init(itv_t a);
+static inline void itv_init(itv_ptr a);
 static inline void itv_init_array(itv_t* a, size_t size);
-static inline void itv_init_set(itv_t a, itv_t b);
-static inline void itv_clear(itv_t a);
+static inline void itv_init_set(itv_ptr a, itv_ptr b);
+static inline void itv_clear(itv_ptr a);
 static inline void itv_clear_array(itv_t* a, size_t size);
 static inline itv_t* itv_array_alloc(size_t size);
 static inline void itv_array_free(itv_t* a, size_t size);
 
 /* Assignement */
-static inline void itv_set(itv_t a, itv_t b);
-static inline void itv_set_num(itv_t a, num_t b);
-static inline void itv_set_num2(itv_t a, num_t b, num_t c);
-static inline void itv_set_int(itv_t a, long int b);
-static inline void itv_set_int2(itv_t a, long int b, long int c);
-static inline void itv_set_bottom(itv_t a);
-static inline void itv_set_top(itv_t a);
-static inline void itv_swap(itv_t a, itv_t b);
+static inline void itv_set(itv_ptr a, itv_ptr b);
+static inline void itv_set_num(itv_ptr a, num_t b);
+static inline void itv_set_num2(itv_ptr a, num_t b, num_t c);
+static inline void itv_set_int(itv_ptr a, long int b);
+static inline void itv_set_int2(itv_ptr a, long int b, long int c);
+static inline void itv_set_bottom(itv_ptr a);
+static inline void itv_set_top(itv_ptr a);
+static inline void itv_swap(itv_ptr a, itv_ptr b);
 
 /* a = [-b,b] */
-static inline void itv_set_unit_num(itv_t a, num_t b);
-static inline void itv_set_unit_bound(itv_t a, bound_t b);
+static inline void itv_set_unit_num(itv_ptr a, num_t b);
+static inline void itv_set_unit_bound(itv_ptr a, bound_t b);
 
 /* a = b + [-c,c] */
-static inline void itv_enlarge_bound(itv_t a, itv_t b, bound_t c);
+static inline void itv_enlarge_bound(itv_ptr a, itv_ptr b, bound_t c);
 
 /* Normalization and tests */
-static inline bool itv_canonicalize(itv_internal_t* intern, itv_t a, bool integer);
+static inline bool itv_canonicalize(itv_internal_t* intern, itv_ptr a, bool integer);
   /* Canonicalize an interval:
      - if integer is true, narrows bound to integers
      - return true if the interval is bottom
      - return false otherwise
   */
-static inline bool itv_is_top(itv_t a);
-static inline bool itv_is_bottom(itv_internal_t* intern, itv_t a);
+static inline bool itv_is_top(itv_ptr a);
+static inline bool itv_is_bottom(itv_internal_t* intern, itv_ptr a);
   /* Return true iff the interval is resp. [-oo,+oo] or empty */
-static inline bool itv_is_point(itv_internal_t* intern, itv_t a);
+static inline bool itv_is_point(itv_internal_t* intern, itv_ptr a);
   /* Return true iff the interval is a single point */
-static inline bool itv_is_zero(itv_t a);
+static inline bool itv_is_zero(itv_ptr a);
   /* Return true iff the interval is a single zero point */
-static inline bool itv_is_leq(itv_t a, itv_t b);
+static inline bool itv_is_leq(itv_ptr a, itv_ptr b);
   /* Inclusion test */
-static inline bool itv_is_eq(itv_t a, itv_t b);
+static inline bool itv_is_eq(itv_ptr a, itv_ptr b);
   /* Equality test */
-static inline int itv_hash(itv_t a);
+static inline int itv_hash(itv_ptr a);
   /* Hash code */
-static inline bool itv_is_pos(itv_t a);
-static inline bool itv_is_neg(itv_t a);
+static inline bool itv_is_pos(itv_ptr a);
+static inline bool itv_is_neg(itv_ptr a);
   /* Included in [0;+oo], [-oo;0], or any of those */
 
-static inline bool itv_is_int(itv_internal_t* intern, itv_t a);
+static inline bool itv_is_int(itv_internal_t* intern, itv_ptr a);
   /* has integer bounds */
 
-static inline void itv_range_abs(bound_t a, itv_t b);
+static inline void itv_range_abs(bound_t a, itv_ptr b);
   /* a=(max b - min b) */
-static inline void itv_range_rel(itv_internal_t* intern, bound_t a, itv_t b);
+static inline void itv_range_rel(itv_internal_t* intern, bound_t a, itv_ptr b);
   /* a=(max b - min b) / (|a+b|/2) */
 
 /* Lattice operations */
-static inline bool itv_meet(itv_internal_t* intern, itv_t a, itv_t b, itv_t c);
+static inline bool itv_meet(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c);
   /* Assign a with the intersection of b and c */
-static inline void itv_join(itv_t a, itv_t b, itv_t c);
+static inline void itv_join(itv_ptr a, itv_ptr b, itv_ptr c);
   /* Assign a with the union of b and c */
-static inline void itv_widening(itv_t a, itv_t b, itv_t c);
+static inline void itv_widening(itv_ptr a, itv_ptr b, itv_ptr c);
   /* Assign a with the standard interval widening of b by c */
 
 /* Arithmetic operations */
-static inline void itv_add(itv_t a, itv_t b, itv_t c);
-static inline void itv_sub(itv_t a, itv_t b, itv_t c);
-static inline void itv_neg(itv_t a, itv_t b);
-static inline void itv_mul(itv_internal_t* intern, itv_t a, itv_t b, itv_t c);
-static inline void itv_div(itv_internal_t* intern, itv_t a, itv_t b, itv_t c);
-static inline void itv_add_num(itv_t a, itv_t b, num_t c);
-static inline void itv_sub_num(itv_t a, itv_t b, num_t c);
-static inline void itv_mul_num(itv_t a, itv_t b, num_t c);
-static inline void itv_div_num(itv_t a, itv_t b, num_t c);
-static inline void itv_add_bound(itv_t a, itv_t b, bound_t c);
-static inline void itv_sub_bound(itv_t a, itv_t b, bound_t c);
-static inline void itv_mul_bound(itv_t a, itv_t b, bound_t c);
-static inline void itv_div_bound(itv_t a, itv_t b, bound_t c);
-static inline bool itv_sqrt(itv_internal_t* intern, itv_t a, itv_t b);
-static inline void itv_abs(itv_t a, itv_t b);
-static inline void itv_mul_2exp(itv_t a, itv_t b, int c);
-
-static inline void itv_magnitude(bound_t a, itv_t b);
+static inline void itv_add(itv_ptr a, itv_ptr b, itv_ptr c);
+static inline void itv_sub(itv_ptr a, itv_ptr b, itv_ptr c);
+static inline void itv_neg(itv_ptr a, itv_ptr b);
+static inline void itv_mul(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c);
+static inline void itv_div(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c);
+static inline void itv_add_num(itv_ptr a, itv_ptr b, num_t c);
+static inline void itv_sub_num(itv_ptr a, itv_ptr b, num_t c);
+static inline void itv_mul_num(itv_ptr a, itv_ptr b, num_t c);
+static inline void itv_div_num(itv_ptr a, itv_ptr b, num_t c);
+static inline void itv_add_bound(itv_ptr a, itv_ptr b, bound_t c);
+static inline void itv_sub_bound(itv_ptr a, itv_ptr b, bound_t c);
+static inline void itv_mul_bound(itv_ptr a, itv_ptr b, bound_t c);
+static inline void itv_div_bound(itv_ptr a, itv_ptr b, bound_t c);
+static inline bool itv_sqrt(itv_internal_t* intern, itv_ptr a, itv_ptr b);
+static inline void itv_abs(itv_ptr a, itv_ptr b);
+static inline void itv_mul_2exp(itv_ptr a, itv_ptr b, int c);
+
+static inline void itv_magnitude(bound_t a, itv_ptr b);
   /* get the absolute value of maximal bound */
 
-static inline void itv_mod(itv_internal_t* intern, itv_t a, itv_t b, itv_t c, bool is_int);
+static inline void itv_mod(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c, bool is_int);
   /* x mod y = x - y*trunc(x/y) */
 
 /* Integer casts (rounding towards +oo, -oo, 0, or worst-case) */
-static inline void itv_ceil(itv_t a, itv_t b);
-static inline void itv_floor(itv_t a, itv_t b);
-static inline void itv_trunc(itv_t a, itv_t b);
-static inline void itv_to_int(itv_t a, itv_t b);
+static inline void itv_ceil(itv_ptr a, itv_ptr b);
+static inline void itv_floor(itv_ptr a, itv_ptr b);
+static inline void itv_trunc(itv_ptr a, itv_ptr b);
+static inline void itv_to_int(itv_ptr a, itv_ptr b);
 
 /* Floating-point casts (worst cases) */
-static inline void itv_to_float(itv_t a, itv_t b);
-static inline void itv_to_double(itv_t a, itv_t b);
+static inline void itv_to_float(itv_ptr a, itv_ptr b);
+static inline void itv_to_double(itv_ptr a, itv_ptr b);
 
   /* Inverse of the above functions */
-static inline void itv_unceil(itv_t a, itv_t b);
-static inline void itv_unfloor(itv_t a, itv_t b);
-static inline void itv_untrunc(itv_t a, itv_t b);
-static inline void itv_from_int(itv_t a, itv_t b);
-static inline void itv_from_float(itv_t a, itv_t b);
-static inline void itv_from_double(itv_t a, itv_t b);
+static inline void itv_unceil(itv_ptr a, itv_ptr b);
+static inline void itv_unfloor(itv_ptr a, itv_ptr b);
+static inline void itv_untrunc(itv_ptr a, itv_ptr b);
+static inline void itv_from_int(itv_ptr a, itv_ptr b);
+static inline void itv_from_float(itv_ptr a, itv_ptr b);
+static inline void itv_from_double(itv_ptr a, itv_ptr b);
 
 /* Printing */
-static inline int itv_snprint(char* s, size_t size, itv_t a);
-static inline void itv_fprint(FILE* stream, itv_t a);
-static inline void itv_print(itv_t a);
+static inline int itv_snprint(char* s, size_t size, itv_ptr a);
+static inline void itv_fprint(FILE* stream, itv_ptr a);
+static inline void itv_print(itv_ptr a);
 
 /* All these functions return true if the conversion is exact */
-static inline bool itv_set_ap_scalar(itv_internal_t* intern, itv_t a, ap_scalar_t* b);
+static inline bool itv_set_ap_scalar(itv_internal_t* intern, itv_ptr a, ap_scalar_t* b);
   /* Convert a ap_scalar_t into a itv_t.
      Assumes the scalar is finite.
      If it returns true, the interval is a single point */
-static inline bool itv_set_ap_interval(itv_internal_t* intern, itv_t a, ap_interval_t* b);
+static inline bool itv_set_ap_interval(itv_internal_t* intern, itv_ptr a, ap_interval_t* b);
   /* Convert a ap_interval_t into a itv_t */
-static inline bool itv_set_ap_coeff(itv_internal_t* intern, itv_t a, ap_coeff_t* b);
+static inline bool itv_set_ap_coeff(itv_internal_t* intern, itv_ptr a, ap_coeff_t* b);
   /* Convert a ap_coeff_t into a itv_t. */
 
-static inline bool ap_interval_set_itv(itv_internal_t* intern, ap_interval_t* a, itv_t b);
+static inline bool ap_interval_set_itv(itv_internal_t* intern, ap_interval_t* a, itv_ptr b);
   /* Convert a itv_t into a ap_interval_t */
 
-static inline bool ap_coeff_set_itv(itv_internal_t* intern, ap_coeff_t* a, itv_t b);
+static inline bool ap_coeff_set_itv(itv_internal_t* intern, ap_coeff_t* a, itv_ptr b);
   /* Convert a itv_t into a ap_coeff_t */
 
 static inline bool itv_array_set_ap_interval_array(itv_internal_t* intern, itv_t** ptitv, ap_interval_t** array, size_t size);
@@ -221,36 +221,36 @@ void ITVFUN(itv_internal_init)(itv_internal_t* intern);
 void ITVFUN(itv_internal_clear)(itv_internal_t* intern);
 itv_internal_t* ITVFUN(itv_internal_alloc)(void);
 void ITVFUN(itv_internal_free)(itv_internal_t* intern);
-bool ITVFUN(itv_canonicalize)(itv_internal_t* intern, itv_t a, bool integer);
-void ITVFUN(itv_mul_num)(itv_t a, itv_t b, num_t c);
-void ITVFUN(itv_div_num)(itv_t a, itv_t b, num_t c);
-void ITVFUN(itv_div_num)(itv_t a, itv_t b, num_t c);
-void ITVFUN(itv_mul_bound)(itv_t a, itv_t b, bound_t c);
-void ITVFUN(itv_div_bound)(itv_t a, itv_t b, bound_t c);
-void ITVFUN(itv_sub)(itv_t a, itv_t b, itv_t c);
-void ITVFUN(itv_neg)(itv_t a, itv_t b);
-void ITVFUN(itv_mul)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c);
-void ITVFUN(itv_div)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c);
-bool ITVFUN(itv_sqrt)(itv_internal_t* intern, itv_t a, itv_t b);
-void ITVFUN(itv_abs)(itv_t a, itv_t b);
-void ITVFUN(itv_mod)(itv_internal_t* intern, itv_t a, itv_t b, itv_t c,  bool is_int);
-void ITVFUN(itv_fprint)(FILE* stream, itv_t a);
-void ITVFUN(itv_print)(itv_t a);
-int  ITVFUN(itv_snprint)(char* s, size_t size, itv_t a);
-
-bool ITVFUN(itv_set_ap_scalar)(itv_internal_t* intern, itv_t a, ap_scalar_t* b);
-bool ITVFUN(itv_set_ap_interval)(itv_internal_t* intern, itv_t a, ap_interval_t* b);
-bool ITVFUN(itv_set_ap_coeff)(itv_internal_t* intern, itv_t itv, ap_coeff_t* coeff);
-bool ITVFUN(ap_interval_set_itv)(itv_internal_t* intern,  ap_interval_t* a, itv_t b);
-bool ITVFUN(ap_coeff_set_itv)(itv_internal_t* intern, ap_coeff_t* a, itv_t b);
+bool ITVFUN(itv_canonicalize)(itv_internal_t* intern, itv_ptr a, bool integer);
+void ITVFUN(itv_mul_num)(itv_ptr a, itv_ptr b, num_t c);
+void ITVFUN(itv_div_num)(itv_ptr a, itv_ptr b, num_t c);
+void ITVFUN(itv_div_num)(itv_ptr a, itv_ptr b, num_t c);
+void ITVFUN(itv_mul_bound)(itv_ptr a, itv_ptr b, bound_t c);
+void ITVFUN(itv_div_bound)(itv_ptr a, itv_ptr b, bound_t c);
+void ITVFUN(itv_sub)(itv_ptr a, itv_ptr b, itv_ptr c);
+void ITVFUN(itv_neg)(itv_ptr a, itv_ptr b);
+void ITVFUN(itv_mul)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c);
+void ITVFUN(itv_div)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c);
+bool ITVFUN(itv_sqrt)(itv_internal_t* intern, itv_ptr a, itv_ptr b);
+void ITVFUN(itv_abs)(itv_ptr a, itv_ptr b);
+void ITVFUN(itv_mod)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c,  bool is_int);
+void ITVFUN(itv_fprint)(FILE* stream, itv_ptr a);
+void ITVFUN(itv_print)(itv_ptr a);
+int  ITVFUN(itv_snprint)(char* s, size_t size, itv_ptr a);
+
+bool ITVFUN(itv_set_ap_scalar)(itv_internal_t* intern, itv_ptr a, ap_scalar_t* b);
+bool ITVFUN(itv_set_ap_interval)(itv_internal_t* intern, itv_ptr a, ap_interval_t* b);
+bool ITVFUN(itv_set_ap_coeff)(itv_internal_t* intern, itv_ptr itv, ap_coeff_t* coeff);
+bool ITVFUN(ap_interval_set_itv)(itv_internal_t* intern,  ap_interval_t* a, itv_ptr b);
+bool ITVFUN(ap_coeff_set_itv)(itv_internal_t* intern, ap_coeff_t* a, itv_ptr b);
 bool ITVFUN(itv_array_set_ap_interval_array)(itv_internal_t* intern, itv_t** ptitv, ap_interval_t** array, size_t size);
   
 /** The power operator */
-void ITVFUN(itv_pow)(itv_internal_t* intern, itv_t a, itv_t b, itv_t n);
-static inline void itv_pow(itv_internal_t* intern, itv_t a, itv_t b, itv_t c)
+void ITVFUN(itv_pow)(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr n);
+static inline void itv_pow(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
 { ITVFUN(itv_pow)(intern,a,b,c); }
-void ITVFUN(itv_inv_pow)(itv_internal_t* intern, itv_t a, itv_t orga, itv_t b, itv_t n);
-static inline void itv_inv_pow(itv_internal_t* intern, itv_t a, itv_t orga, itv_t b, itv_t c)
+void ITVFUN(itv_inv_pow)(itv_internal_t* intern, itv_ptr a, itv_ptr orga, itv_ptr b, itv_ptr n);
+static inline void itv_inv_pow(itv_internal_t* intern, itv_ptr a, itv_ptr orga, itv_ptr b, itv_ptr c)
 { ITVFUN(itv_inv_pow)(intern,a,orga,b,c); }
 
 
@@ -267,60 +267,51 @@ static inline void itv_internal_free(itv_internal_t* intern)
 { ITVFUN(itv_internal_free)(intern); }
 
 static inline bool itv_canonicalize(itv_internal_t* intern,
- itv_t a, bool integer)
+ itv_ptr a, bool integer)
 { return ITVFUN(itv_canonicalize)(intern,a,integer); }
 
-static inline void itv_mul_num(itv_t a, itv_t b, num_t c)
+static inline void itv_mul_num(itv_ptr a, itv_ptr b, num_t c)
 { ITVFUN(itv_mul_num)(a,b,c); }
 
-static inline void itv_div_num(itv_t a, itv_t b, num_t c)
+static inline void itv_div_num(itv_ptr a, itv_ptr b, num_t c)
 { ITVFUN(itv_div_num)(a,b,c); }
 
-static inline void itv_mul_bound(itv_t a, itv_t b, bound_t c)
+static inline void itv_mul_bound(itv_ptr a, itv_ptr b, bound_t c)
 { ITVFUN(itv_mul_bound)(a,b,c); }
 
-static inline void itv_div_bound(itv_t a, itv_t b, bound_t c)
+static inline void itv_div_bound(itv_ptr a, itv_ptr b, bound_t c)
 { ITVFUN(itv_div_bound)(a,b,c); }
 
-static inline void itv_sub(itv_t a, itv_t b, itv_t c)
-{ ITVFUN(itv_sub)(a,b,c); }
-
-static inline void itv_neg(itv_t a, itv_t b)
+static inline void itv_neg(itv_ptr a, itv_ptr b)
 { ITVFUN(itv_neg)(a,b); }
 
-static inline void itv_mul(itv_internal_t* intern, itv_t a, itv_t b, itv_t c)
-{ ITVFUN(itv_mul)(intern,a,b,c); }
-
-static inline void itv_div(itv_internal_t* intern, itv_t a, itv_t b, itv_t c)
-{ ITVFUN(itv_div)(intern,a,b,c); }
-
-static inline void itv_fprint(FILE* stream, itv_t a)
+static inline void itv_fprint(FILE* stream, itv_ptr a)
 { ITVFUN(itv_fprint)(stream,a); }
-static inline void itv_print(itv_t itv)
+static inline void itv_print(itv_ptr itv)
 { ITVFUN(itv_print)(itv); }
 
-static inline int itv_snprint(char* s, size_t size, itv_t a)
+static inline int itv_snprint(char* s, size_t size, itv_ptr a)
 { return ITVFUN(itv_snprint)(s,size,a); }
 
-static inline bool itv_set_ap_scalar(itv_internal_t* intern, itv_t a, ap_scalar_t* b)
+static inline bool itv_set_ap_scalar(itv_internal_t* intern, itv_ptr a, ap_scalar_t* b)
 { return ITVFUN(itv_set_ap_scalar)(intern,a,b); }
 
-static inline bool itv_set_ap_interval(itv_internal_t* intern, itv_t a, ap_interval_t* b)
+static inline bool itv_set_ap_interval(itv_internal_t* intern, itv_ptr a, ap_interval_t* b)
 { return ITVFUN(itv_set_ap_interval)(intern,a,b); }
 
-static inline bool itv_set_ap_coeff(itv_internal_t* intern, itv_t itv, ap_coeff_t* coeff)
+static inline bool itv_set_ap_coeff(itv_internal_t* intern, itv_ptr itv, ap_coeff_t* coeff)
 { return ITVFUN(itv_set_ap_coeff)(intern,itv,coeff); }
 
-static inline bool ap_interval_set_itv(itv_internal_t* intern, ap_interval_t* a, itv_t b)
+static inline bool ap_interval_set_itv(itv_internal_t* intern, ap_interval_t* a, itv_ptr b)
 { return ITVFUN(ap_interval_set_itv)(intern,a,b); }
 
-static inline bool ap_coeff_set_itv(itv_internal_t* intern, ap_coeff_t* a, itv_t b)
+static inline bool ap_coeff_set_itv(itv_internal_t* intern, ap_coeff_t* a, itv_ptr b)
 { return ITVFUN(ap_coeff_set_itv)(intern,a,b); }
 
 static inline bool itv_array_set_ap_interval_array(itv_internal_t* intern, itv_t** ptitv, ap_interval_t** array, size_t size)
 { return ITVFUN(itv_array_set_ap_interval_array)(intern,ptitv,array,size); }
 
-static inline void itv_init(itv_t a)
+static inline void itv_init(itv_ptr a)
 {
   bound_init(a->inf);
   bound_init(a->sup);
@@ -330,12 +321,12 @@ static inline void itv_init_array(itv_t* a, size_t size)
   size_t i;
   for (i=0; i<size; i++) itv_init(a[i]);
 }
-static inline void itv_init_set(itv_t a, itv_t b)
+static inline void itv_init_set(itv_ptr a, itv_ptr b)
 {
   bound_init_set(a->inf,b->inf);
   bound_init_set(a->sup,b->sup);
 }
-static inline void itv_clear(itv_t a)
+static inline void itv_clear(itv_ptr a)
 {
   bound_clear(a->inf);
   bound_clear(a->sup);
@@ -359,70 +350,70 @@ static inline void itv_array_free(itv_t* a, size_t size)
   free(a);
 }
 
-static inline void itv_set(itv_t a, itv_t b)
+static inline void itv_set(itv_ptr a, itv_ptr b)
 {
   bound_set(a->inf,b->inf);
   bound_set(a->sup,b->sup);
 }
-static inline void itv_set_num(itv_t a, num_t b)
+static inline void itv_set_num(itv_ptr a, num_t b)
 {
   bound_set_num(a->sup,b);
   bound_neg(a->inf,a->sup);
 }
-static inline void itv_set_num2(itv_t a, num_t b, num_t c)
+static inline void itv_set_num2(itv_ptr a, num_t b, num_t c)
 {
   num_neg(b,b);
   bound_set_num(a->inf,b);
   num_neg(b,b);
   bound_set_num(a->sup,c);
 }
-static inline void itv_set_unit_num(itv_t a, num_t b)
+static inline void itv_set_unit_num(itv_ptr a, num_t b)
 {
   bound_set_num(a->inf,b);
   bound_set_num(a->sup,b);
 }
-static inline void itv_set_unit_bound(itv_t a, bound_t b)
+static inline void itv_set_unit_bound(itv_ptr a, bound_t b)
 {
   bound_set(a->inf,b);
   bound_set(a->sup,b);
 }
-static inline void itv_enlarge_bound(itv_t a, itv_t b, bound_t c)
+static inline void itv_enlarge_bound(itv_ptr a, itv_ptr b, bound_t c)
 {
   bound_add(a->inf,b->inf,c);
   bound_add(a->sup,b->sup,c);
 }
-static inline void itv_set_int(itv_t a, long int b)
+static inline void itv_set_int(itv_ptr a, long int b)
 {
   bound_set_int(a->inf,-b);
   bound_set_int(a->sup,b);
 }
-static inline void itv_set_int2(itv_t a, long int b, long int c)
+static inline void itv_set_int2(itv_ptr a, long int b, long int c)
 {
   bound_set_int(a->inf,-b);
   bound_set_int(a->sup,c);
 }
-static inline void itv_set_bottom(itv_t a)
+static inline void itv_set_bottom(itv_ptr a)
 {
   bound_set_int(a->inf,-1);
   bound_set_int(a->sup,-1);
 }
-static inline void itv_set_top(itv_t a)
+static inline void itv_set_top(itv_ptr a)
 {
   bound_set_infty(a->inf,1);
   bound_set_infty(a->sup,1);
 }
-static inline void itv_swap(itv_t a, itv_t b)
+static inline void itv_swap(itv_ptr a, itv_ptr b)
 { itv_t t; *t=*a;*a=*b;*b=*t; }
 
-static inline bool itv_is_top(itv_t a)
+static inline bool itv_is_top(itv_ptr a)
 {
   return bound_infty(a->inf) && bound_infty(a->sup);
 }
-static inline bool itv_is_bottom(itv_internal_t* intern, itv_t a)
+static inline bool itv_is_bottom(itv_internal_t* intern, itv_ptr a)
 {
   return itv_canonicalize(intern, a, false);
 }
-static inline bool itv_is_point(itv_internal_t* intern, itv_t a)
+static inline bool itv_is_point(itv_internal_t* intern, itv_ptr a)
 {
   if (!bound_infty(a->inf) && !bound_infty(a->sup)){
     num_neg(intern->canonicalize_num,bound_numref(a->inf));
@@ -431,29 +422,29 @@ static inline bool itv_is_point(itv_internal_t* intern, itv_t a)
   else
     return false;
 }
-static inline bool itv_is_zero(itv_t a)
+static inline bool itv_is_zero(itv_ptr a)
 {
   return bound_sgn(a->inf)==0 && bound_sgn(a->sup)==0;
 }
-static inline bool itv_is_leq(itv_t a, itv_t b)
+static inline bool itv_is_leq(itv_ptr a, itv_ptr b)
 {
   return bound_cmp(a->sup,b->sup)<=0 && bound_cmp(a->inf,b->inf)<=0;
 }
-static inline bool itv_is_eq(itv_t a, itv_t b)
+static inline bool itv_is_eq(itv_ptr a, itv_ptr b)
 {
   return bound_equal(a->sup,b->sup) && bound_equal(a->inf,b->inf);
 }
-static inline int itv_hash(itv_t a)
+static inline int itv_hash(itv_ptr a)
 {
   return (5*bound_hash(a->inf) + 7*bound_hash(a->sup));
 }
-static inline bool itv_meet(itv_internal_t* intern, itv_t a, itv_t b, itv_t c)
+static inline bool itv_meet(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
 {
   bound_min(a->sup,b->sup,c->sup);
   bound_min(a->inf,b->inf,c->inf);
   return itv_canonicalize(intern,a,false);
 }
-static inline void itv_join(itv_t a, itv_t b, itv_t c)
+static inline void itv_join(itv_ptr a, itv_ptr b, itv_ptr c)
 {
   bound_max(a->sup,b->sup,c->sup);
   bound_max(a->inf,b->inf,c->inf);
@@ -467,83 +458,348 @@ static inline void bound_widening(bound_t a, bound_t b, bound_t c)
     bound_set(a,b);
   }
 }
-static inline void itv_widening(itv_t a, itv_t b, itv_t c)
+static inline void itv_widening(itv_ptr a, itv_ptr b, itv_ptr c)
 {
   bound_widening(a->sup,b->sup,c->sup);
   bound_widening(a->inf,b->inf,c->inf);
 }
-static inline void itv_add(itv_t a, itv_t b, itv_t c)
+static inline void itv_add(itv_ptr a, itv_ptr b, itv_ptr c)
 {
   bound_add(a->sup,b->sup,c->sup);
   bound_add(a->inf,b->inf,c->inf);
 }
-static inline void itv_add_num(itv_t a, itv_t b, num_t c)
+static inline void itv_add_num(itv_ptr a, itv_ptr b, num_t c)
 {
   bound_add_num(a->sup,b->sup,c);
   bound_sub_num(a->inf,b->inf,c);
 }
-static inline void itv_sub_num(itv_t a, itv_t b, num_t c)
+static inline void itv_sub_num(itv_ptr a, itv_ptr b, num_t c)
 {
   bound_sub_num(a->sup,b->sup,c);
   bound_add_num(a->inf,b->inf,c);
 }
-static inline void itv_add_bound(itv_t a, itv_t b, bound_t c)
+static inline void itv_add_bound(itv_ptr a, itv_ptr b, bound_t c)
 {
   bound_add(a->sup,b->sup,c);
   bound_sub(a->inf,b->inf,c);
 }
-static inline void itv_sub_bound(itv_t a, itv_t b, bound_t c)
+static inline void itv_sub_bound(itv_ptr a, itv_ptr b, bound_t c)
 {
   bound_sub(a->sup,b->sup,c);
   bound_add(a->inf,b->inf,c);
 }
-static inline bool itv_sqrt(itv_internal_t* intern, itv_t a, itv_t b)
+static inline void itv_sub(itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (a!=c){
+    bound_add(a->inf,b->inf,c->sup);
+    bound_add(a->sup,b->sup,c->inf);
+  } else if (a!=b) { /* a=c */
+    bound_add(a->inf,a->inf,b->sup);
+    bound_add(a->sup,a->sup,b->inf);
+    bound_swap(a->inf,a->sup);
+  } else { /* a=b=c */
+    bound_add(a->sup,b->sup,c->inf);
+    bound_set(a->inf,a->sup);
+  }
+}
+
+/* ====================================================================== */
+/* Multiplication */
+/* ====================================================================== */
+
+/* Assume that both intervals are positive */
+static inline
+void itv_mulpp(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->inf)<=0);
+  bound_neg(intern->mul_bound,c->inf);
+  bound_mul(a->inf,b->inf,intern->mul_bound);
+  bound_mul(a->sup,b->sup,c->sup);
+}
+/* Assume that both intervals are negative */
+static inline
+void itv_mulnn(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->sup)<=0 && bound_sgn(c->sup)<=0);
+  bound_neg(intern->mul_bound,c->sup);
+  bound_mul(intern->mul_bound,b->sup,intern->mul_bound);
+  bound_mul(a->sup,b->inf,c->inf);
+  bound_set(a->inf,intern->mul_bound);
+}
+/* Assume that b is positive and c negative */
+static inline
+void itv_mulpn(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->sup)<=0);
+  bound_neg(intern->mul_bound,b->inf);
+  bound_mul(a->inf,b->sup,c->inf);
+  bound_mul(a->sup,intern->mul_bound,c->sup);
+}
+/* Assume that interval c is positive */
+static inline
+void itv_mulp(itv_internal_t* intern,
+	      itv_ptr a,
+	      itv_ptr b,
+	      itv_ptr c)
+{
+  assert(bound_sgn(c->inf)<=0);
+
+  if (bound_sgn(b->inf)<=0){
+    /* b is positive */
+    itv_mulpp(intern,a,b,c);
+  }
+  else if (bound_sgn(b->sup)<=0){
+    /* b is negative */
+    itv_mulpn(intern,a,c,b);
+  }
+  else {
+    /* 0 is in the middle of b: one multiplies b by c->sup */
+    bound_mul(a->inf,b->inf,c->sup);
+    bound_mul(a->sup,b->sup,c->sup);
+  }
+}
+/* Assume that interval c is negative */
+static inline
+void itv_muln(itv_internal_t* intern,
+	      itv_ptr a,
+	      itv_ptr b,
+	      itv_ptr c)
+{
+  assert(bound_sgn(c->sup)<=0);
+
+  if (bound_sgn(b->inf)<=0){
+    /* b is positive */
+    itv_mulpn(intern,a,b,c);
+  }
+  else if (bound_sgn(b->sup)<=0){
+    /* b is negative */
+    itv_mulnn(intern,a,b,c);
+  }
+  else {
+    /* 0 is in the middle of b: one multiplies b by c->inf */
+    bound_mul(a->sup,b->sup,c->inf);
+    bound_mul(a->inf,b->inf,c->inf);
+    bound_swap(a->inf,a->sup);
+  }
+}
+
+static inline void itv_mul(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(c->inf)<=0){
+    /* c is positive, */
+    itv_mulp(intern,a,b,c);
+  }
+  else if (bound_sgn(c->sup)<=0){
+    /* c is negative */
+    itv_muln(intern,a,b,c);
+  }
+  else if (bound_sgn(b->inf)<=0){
+    /* b is positive, */
+    itv_mulp(intern,a,c,b);
+  }
+  else if (bound_sgn(c->sup)<=0){
+    /* b is negative */
+    itv_muln(intern,a,c,b);
+  }
+  else {
+    /* divide c */
+    bound_set(intern->mul_itv->inf,c->inf);
+    bound_set_int(intern->mul_itv->sup,0);
+    itv_muln(intern,intern->mul_itv2,b,intern->mul_itv);
+
+    bound_set_int(intern->mul_itv->inf,0);
+    bound_set(intern->mul_itv->sup,c->sup);
+    itv_mulp(intern,a,b,intern->mul_itv);
+
+    itv_join(a,a,intern->mul_itv2);
+  }
+}
+
+/* ====================================================================== */
+/* Division */
+/* ====================================================================== */
+
+/* Assume that both intervals are positive */
+static inline
+void itv_divpp(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->inf)<0);
+  bound_neg(intern->mul_bound,c->inf);
+  bound_div(a->inf,b->inf,c->sup);
+  bound_div(a->sup,b->sup,intern->mul_bound);
+}
+/* Assume that both intervals are negative */
+static inline
+void itv_divnn(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->sup)<=0 && bound_sgn(c->sup)<0);
+  bound_neg(intern->mul_bound,b->inf);
+  bound_div(a->inf,b->sup,c->inf);
+  bound_div(a->sup,intern->mul_bound,c->sup);
+}
+/* Assume that b is positive and c negative */
+static inline
+void itv_divpn(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->inf)<=0 && bound_sgn(c->sup)<0);
+  bound_neg(intern->mul_bound,b->sup);
+  bound_div(intern->mul_bound,intern->mul_bound,c->sup);
+  bound_div(a->sup,b->inf,c->inf);
+  bound_set(a->inf,intern->mul_bound);
+}
+/* Assume that b is negative and c positive */
+static inline
+void itv_divnp(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(b->sup)<=0 && bound_sgn(c->inf)<0);
+  bound_neg(intern->mul_bound, b->inf);
+  bound_div(a->inf,intern->mul_bound,c->inf);
+  bound_div(a->sup,b->sup,c->sup);
+}
+
+/* Assume that interval c is positive */
+static inline
+void itv_divp(itv_internal_t* intern,
+	       itv_ptr a,
+	       itv_ptr b,
+	       itv_ptr c)
+{
+  assert(bound_sgn(c->inf)<0);
+
+  if (bound_sgn(b->inf)<=0){
+    /* b is positive */
+    itv_divpp(intern,a,b,c);
+  }
+  else if (bound_sgn(b->sup)<=0){
+    /* b is negative */
+    itv_divnp(intern,a,b,c);
+  }
+  else {
+    /* 0 is in the middle of b: one divides b by c->inf */
+    bound_neg(intern->mul_bound,c->inf);
+    bound_div(a->inf,b->inf,intern->mul_bound);
+    bound_div(a->sup,b->sup,intern->mul_bound);
+  }
+}
+/* Assume that interval c is negative */
+static inline
+void itv_divn(itv_internal_t* intern,
+	      itv_ptr a,
+	      itv_ptr b,
+	      itv_ptr c)
+{
+  assert(bound_sgn(c->sup)<0);
+
+  if (bound_sgn(b->inf)<=0){
+    /* b is positive */
+    itv_divpn(intern,a,b,c);
+  }
+  else if (bound_sgn(b->sup)<=0){
+    /* b is negative */
+    itv_divnn(intern,a,b,c);
+  }
+  else {
+    /* 0 is in the middle of b: one cross-divides b by -c->sup */
+    bound_neg(intern->mul_bound,c->sup);
+    if (a!=b) {
+      bound_div(a->inf,b->sup,intern->mul_bound);
+      bound_div(a->sup,b->inf,intern->mul_bound);
+    }
+    else {
+      bound_swap(a->inf,a->sup);
+      bound_div(a->inf,a->inf,intern->mul_bound);
+      bound_div(a->sup,a->sup,intern->mul_bound);
+    }
+  }
+}
+
+static inline void itv_div(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(c->inf)<0){
+    /* c is positive */
+    itv_divp(intern,a,b,c);
+  }
+  else if (bound_sgn(c->sup)<0){
+    /* c is negative */
+    itv_divn(intern,a,b,c);
+  }
+  else if (bound_sgn(b->inf)==0 && bound_sgn(b->sup)==0){
+    /* b is [0,0] */
+    itv_set(a,b);
+  }
+  else {
+    itv_set_top(a);
+  }
+}
+
+static inline bool itv_sqrt(itv_internal_t* intern, itv_ptr a, itv_ptr b)
 { return ITVFUN(itv_sqrt)(intern,a,b); }
 
-static inline void itv_abs(itv_t a, itv_t b)
+static inline void itv_abs(itv_ptr a, itv_ptr b)
 { ITVFUN(itv_abs)(a,b); }
 
-static inline void itv_mod(itv_internal_t* intern, itv_t a, itv_t b, itv_t c, bool is_int)
+static inline void itv_mod(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c, bool is_int)
 { ITVFUN(itv_mod)(intern,a,b,c,is_int); }
 
-static inline void itv_ceil(itv_t a, itv_t b)
+static inline void itv_ceil(itv_ptr a, itv_ptr b)
 { bound_ceil(a->sup,b->sup); bound_floor(a->inf,b->inf); }
 
-static inline void itv_floor(itv_t a, itv_t b)
+static inline void itv_floor(itv_ptr a, itv_ptr b)
 { bound_floor(a->sup,b->sup);  bound_ceil(a->inf,b->inf); }
 
-static inline void itv_trunc(itv_t a, itv_t b)
+static inline void itv_trunc(itv_ptr a, itv_ptr b)
 { bound_trunc(a->sup,b->sup); bound_trunc(a->inf,b->inf); }
 
-static inline void itv_to_int(itv_t a, itv_t b)
+static inline void itv_to_int(itv_ptr a, itv_ptr b)
 { bound_ceil(a->sup,b->sup); bound_ceil(a->inf,b->inf); }
 
-static inline void itv_to_float(itv_t a, itv_t b)
+static inline void itv_to_float(itv_ptr a, itv_ptr b)
 { bound_to_float(a->sup,b->sup); bound_to_float(a->inf,b->inf); }
 
-static inline void itv_to_double(itv_t a, itv_t b)
+static inline void itv_to_double(itv_ptr a, itv_ptr b)
 { bound_to_double(a->sup,b->sup); bound_to_double(a->inf,b->inf); }
 
-static inline void itv_mul_2exp(itv_t a, itv_t b, int c)
+static inline void itv_mul_2exp(itv_ptr a, itv_ptr b, int c)
 { bound_mul_2exp(a->sup,b->sup,c); bound_mul_2exp(a->inf,b->inf,c); }
 
-static inline bool itv_is_pos(itv_t a)
+static inline bool itv_is_pos(itv_ptr a)
 { return (bound_sgn(a->inf)<=0); }
 
-static inline bool itv_is_neg(itv_t a)
+static inline bool itv_is_neg(itv_ptr a)
 { return (bound_sgn(a->sup)<=0); }
 
-static inline void itv_magnitude(bound_t a, itv_t b)
+static inline void itv_magnitude(bound_t a, itv_ptr b)
 {
   if (bound_sgn(b->inf)<=0) bound_set(a,b->sup);
   else if (bound_sgn(b->sup)<=0) bound_set(a,b->inf);
   else bound_max(a,b->inf,b->sup);
 }
 
-static inline void itv_range_abs(bound_t a, itv_t b)
+static inline void itv_range_abs(bound_t a, itv_ptr b)
 { bound_add(a,b->sup,b->inf); }
 
-static inline void itv_range_rel(itv_internal_t* intern, bound_t a, itv_t b)
+static inline void itv_range_rel(itv_internal_t* intern, bound_t a, itv_ptr b)
 {
   bound_add(a,b->sup,b->inf);
   if (!bound_infty(a)) {
@@ -553,7 +809,7 @@ static inline void itv_range_rel(itv_internal_t* intern, bound_t a, itv_t b)
   }
 }
 
-static inline bool itv_is_int(itv_internal_t* intern, itv_t a)
+static inline bool itv_is_int(itv_internal_t* intern, itv_ptr a)
 {
   bound_trunc(intern->muldiv_bound,a->sup);
   if (bound_cmp(intern->muldiv_bound,a->sup)) return false;
@@ -563,7 +819,7 @@ static inline bool itv_is_int(itv_internal_t* intern, itv_t a)
 
 
 
-static inline void itv_unceil(itv_t a, itv_t b)
+static inline void itv_unceil(itv_ptr a, itv_ptr b)
 {
   /* [a,b] ->  [ceil(a)-1,floor(b)] */
   bound_floor(a->sup,b->sup);
@@ -571,7 +827,7 @@ static inline void itv_unceil(itv_t a, itv_t b)
   bound_add_uint(a->inf,a->inf,1);
 }
 
-static inline void itv_unfloor(itv_t a, itv_t b)
+static inline void itv_unfloor(itv_ptr a, itv_ptr b)
 {
   /* [a,b] -> [ceil(a),floor(b)+1] */
   bound_floor(a->inf,b->inf);
@@ -579,7 +835,7 @@ static inline void itv_unfloor(itv_t a, itv_t b)
   bound_add_uint(a->sup,a->sup,1);
 }
 
-static inline void itv_untrunc(itv_t a, itv_t b)
+static inline void itv_untrunc(itv_ptr a, itv_ptr b)
 {
   /* trunc(x) = ceil(x) if x < 0, floor(x) if x > 0 */
   bound_floor(a->inf,b->inf);
@@ -588,14 +844,14 @@ static inline void itv_untrunc(itv_t a, itv_t b)
   if (bound_sgn(a->sup) > 0) bound_add_uint(a->sup,a->sup,1);
 }
 
-static inline void itv_from_int(itv_t a, itv_t b)
+static inline void itv_from_int(itv_ptr a, itv_ptr b)
 {
   /* [a,b] -> [floor(a),ceil(b)] */
   bound_ceil(a->sup,b->sup);
   bound_ceil(a->inf,b->inf);
 }
 
-static inline void itv_from_float(itv_t a, itv_t b)
+static inline void itv_from_float(itv_ptr a, itv_ptr b)
 {
   /* special case to ensure that signs are respected */
   if (bound_sgn(b->sup)==0) bound_set(a->sup,b->sup);
@@ -604,7 +860,7 @@ static inline void itv_from_float(itv_t a, itv_t b)
   else bound_next_float(a->inf,b->inf);
 }
 
-static inline void itv_from_double(itv_t a, itv_t b)
+static inline void itv_from_double(itv_ptr a, itv_ptr b)
 {
   if (bound_sgn(b->sup)==0) bound_set(a->sup,b->sup);
   else bound_next_double(a->sup,b->sup);
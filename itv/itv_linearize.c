@@ -12,7 +12,7 @@
 
 /* Evaluate an ITV interval linear expression */
 void ITVFUN(itv_eval_linexpr)(itv_internal_t* intern,
-			      itv_t itv,
+			      itv_ptr itv,
 			      itv_linexpr_t* expr,
 			      itv_t* env)
 {
@@ -47,7 +47,7 @@ void ITVFUN(itv_eval_linexpr)(itv_internal_t* intern,
 
 /* Evaluate an APRON interval linear expression */
 bool ITVFUN(itv_eval_ap_linexpr0)(itv_internal_t* intern,
-				  itv_t itv,
+				  itv_ptr itv,
 				  ap_linexpr0_t* expr,
 				  itv_t* env)
 {
@@ -460,9 +460,9 @@ bool ITVFUN(itv_boxize_lincons_array)(itv_internal_t* intern,
 
 static void
 itv_quasilinearize_choose_middle(num_t middle, /* the result */
-				 itv_t coeff,    /* the coefficient in which
+				 itv_ptr coeff,    /* the coefficient in which
 						    middle is to be picked */
-				 itv_t var,      /* the variable interval */
+				 itv_ptr var,      /* the variable interval */
 				 bool for_meet_inequality /* is it for the
 							     linearisation of
 							     an inequality ? */
@@ -744,7 +744,7 @@ void ITVFUN(itv_linearize_lincons_array)(itv_internal_t* intern, itv_lincons_arr
 /* ********************************************************************** */
 
 /* General rounding */
-static void itv_round(itv_t res, itv_t arg,
+static void itv_round(itv_ptr res, itv_ptr arg,
 		      ap_texpr_rtype_t t, ap_texpr_rdir_t d)
 {
   switch (t) {
@@ -796,7 +796,7 @@ static void itv_round(itv_t res, itv_t arg,
 static void
 itv_eval_ap_texpr0_node(itv_internal_t* intern,
 			ap_texpr0_node_t* n,
-			itv_t res, itv_t arg1, itv_t arg2)
+			itv_ptr res, itv_ptr arg1, itv_ptr arg2)
 {
   switch (n->op) {
   case AP_TEXPR_NEG:
@@ -835,7 +835,7 @@ itv_eval_ap_texpr0_node(itv_internal_t* intern,
 /* evaluates expr into intervalres,
    assuming env maps dimensions to interval values */
 void ITVFUN(itv_eval_ap_texpr0)(itv_internal_t* intern,
-				itv_t res,
+				itv_ptr res,
 				ap_texpr0_t* expr,
 				itv_t* env)
 {
@@ -1122,7 +1122,7 @@ itv_linexpr_round_float(itv_internal_t* intern,
  */
 static void
 ap_texpr0_to_int(itv_internal_t* intern,
-		 itv_linexpr_t* l /* in/out */, itv_t i /* in */,
+		 itv_linexpr_t* l /* in/out */, itv_ptr i /* in */,
 		 ap_texpr_rdir_t d)
 {
   switch (d) {
@@ -1157,7 +1157,7 @@ ap_texpr0_to_int(itv_internal_t* intern,
 /* adds rounding error to both l and i to go from type org to type dst */
 static ap_texpr_rtype_t
 ap_texpr0_round(itv_internal_t* intern,
-		itv_linexpr_t* l /* in/out */, itv_t i /* in/out */,
+		itv_linexpr_t* l /* in/out */, itv_ptr i /* in/out */,
 		ap_texpr_rtype_t org,
 		ap_texpr_rtype_t dst, ap_texpr_rdir_t d)
 {
@@ -1200,7 +1200,7 @@ ap_texpr0_round(itv_internal_t* intern,
  */
 static void
 ap_texpr0_reduce(itv_internal_t* intern, itv_t* env,
-		 itv_linexpr_t* l /* in/out */, itv_t i /* in/out */)
+		 itv_linexpr_t* l /* in/out */, itv_ptr i /* in/out */)
 {
   itv_t tmp;
   itv_init(tmp);
@@ -1221,8 +1221,8 @@ ap_texpr0_reduce(itv_internal_t* intern, itv_t* env,
 /* multiplication heuristic: choose which interval to keep (0=a, 1=b) */
 static int
 ap_texpr0_cmp_range(itv_internal_t* intern,
-		    itv_linexpr_t* la, itv_t ia,
-		    itv_linexpr_t* lb, itv_t ib)
+		    itv_linexpr_t* la, itv_ptr ia,
+		    itv_linexpr_t* lb, itv_ptr ib)
 {
   int sgn_a,sgn_b;
   /* if one linear form is an interval keep it */
@@ -1259,7 +1259,7 @@ itv_intlinearize_texpr0_rec(itv_internal_t* intern,
 			    ap_texpr0_t* expr,
 			    itv_t* env, size_t intdim,
 			    itv_linexpr_t* lres /* out */,
-			    itv_t ires /* out */);
+			    itv_ptr ires /* out */);
 
 static int debug_indent = 0;
 
@@ -1267,7 +1267,7 @@ static ap_texpr_rtype_t
 ap_texpr0_node_intlinearize(itv_internal_t* intern,
 			    ap_texpr0_node_t* n,
 			    itv_t* env, size_t intdim,
-			    itv_linexpr_t* lres /* out */, itv_t ires /* out */)
+			    itv_linexpr_t* lres /* out */, itv_ptr ires /* out */)
 {
   itv_t i1,i2;
   itv_linexpr_t l1;
@@ -1455,7 +1455,7 @@ static ap_texpr_rtype_t
 itv_intlinearize_texpr0_rec(itv_internal_t* intern,
 			    ap_texpr0_t* expr,
 			    itv_t* env, size_t intdim,
-			    itv_linexpr_t* lres /* out */, itv_t ires /* out */)
+			    itv_linexpr_t* lres /* out */, itv_ptr ires /* out */)
 {
   itv_linexpr_t r;
   ap_texpr_rtype_t t;
@@ -1786,7 +1786,7 @@ itv_expr_bottom_up(itv_internal_t* intern,
    value in arg.
  */
 static void
-itv_unround(itv_internal_t* intern, itv_t res, itv_t arg,
+itv_unround(itv_internal_t* intern, itv_ptr res, itv_ptr arg,
 	    ap_texpr_rtype_t t, ap_texpr_rdir_t d)
 {
   switch (t) {
@@ -1833,8 +1833,8 @@ itv_unround(itv_internal_t* intern, itv_t res, itv_t arg,
 static void
 itv_refine_ap_texpr0_node(itv_internal_t* intern,
 			  ap_texpr0_node_t* n,
-			  itv_t res, itv_t arg1, itv_t arg2,
-			  itv_t arg1r, itv_t arg2r)
+			  itv_ptr res, itv_ptr arg1, itv_ptr arg2,
+			  itv_ptr arg1r, itv_ptr arg2r)
 {
   switch (n->op) {
   case AP_TEXPR_NEG:
@@ -2025,7 +2025,7 @@ itv_refine_cons(itv_internal_t* intern,
 */
 static bool
 itv_refine_expr(itv_internal_t* intern,
-		itv_expr_t* expr, itv_t val,
+		itv_expr_t* expr, itv_ptr val,
 		itv_t* env, size_t intdim)
 {
   itv_meet(intern, intern->eval_itv, expr->val, val);
@@ -2045,6 +2045,21 @@ ITVFUN(itv_meet_ap_tcons0_array)(itv_internal_t* intern,
 				 ap_tcons0_array_t* array,
 				 itv_t* env, size_t intdim,
 				 int max_iter)
+{
+  return ITVFUN(itv_meet_ap_tcons0_array_timeout)(intern,array,env,intdim,
+						  max_iter,NULL,NULL);
+}
+
+/* Same as above, but stops between two refinements once the deadline of the
+   current call on man (if not NULL) has passed, setting *interrupted to
+   true. env is sound after each refinement.
+ */
+bool
+ITVFUN(itv_meet_ap_tcons0_array_timeout)(itv_internal_t* intern,
+					 ap_tcons0_array_t* array,
+					 itv_t* env, size_t intdim,
+					 int max_iter,
+					 ap_manager_t* man, bool* interrupted)
 {
   bool empty = false;
   size_t i;
@@ -2055,14 +2070,20 @@ ITVFUN(itv_meet_ap_tcons0_array)(itv_internal_t* intern,
   for (i=0; i<array->size; i++) {
     tab[i] = itv_expr_build(intern, array->p[i].texpr0, env, intdim);
   }
+  if (interrupted) *interrupted = false;
   /* refine expressions and env with iteration */
   for (n=0; n<max_iter; n++) {
     bool stable = true;
     for (i=0; i<array->size; i++) {
+      if (man && ap_manager_timeout(man)) break;
       if (itv_refine_cons(intern, tab[i], array->p[i].constyp, env, intdim)) {
 	stable = false;
       }
     }
+    if (i<array->size) {
+      if (interrupted) *interrupted = true;
+      break;
+    }
     if (stable) break;
     stable = true;
     for (i=0; i<array->size; i++) {
@@ -8,6 +8,7 @@
 #include "itv.h"
 #include "itv_linexpr.h"
 #include "ap_expr0.h"
+#include "ap_manager.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,14 +19,14 @@ extern "C" {
 /* ********************************************************************** */
 
 static inline void itv_eval_linexpr(itv_internal_t* intern,
-				    itv_t itv,
+				    itv_ptr itv,
 				    itv_linexpr_t* expr,
 				    itv_t* env);
   /* Evaluate the interval linear expression, using the array p[]
      associating intervals to dimensions */
 
 static inline bool itv_eval_ap_linexpr0(itv_internal_t* intern,
-					itv_t itv,
+					itv_ptr itv,
 					ap_linexpr0_t* expr,
 					itv_t* env);
   /* Evaluate the interval linear expression, using the array p[]
@@ -84,7 +85,7 @@ static inline void itv_linearize_lincons_array(itv_internal_t* intern, itv_linco
 /* IV. Evaluation of tree expressions  */
 /* ********************************************************************** */
 
-static inline void itv_eval_ap_texpr0(itv_internal_t* intern, itv_t res, ap_texpr0_t* expr, itv_t* env);
+static inline void itv_eval_ap_texpr0(itv_internal_t* intern, itv_ptr res, ap_texpr0_t* expr, itv_t* env);
 
 /* ********************************************************************** */
 /* V. Linearisation of linear tree expressions. */
@@ -127,6 +128,11 @@ static inline bool itv_intlinearize_ap_tcons0_array(itv_internal_t* intern, itv_
 /* ====================================================================== */
 
 static inline bool itv_meet_ap_tcons0_array(itv_internal_t* intern, ap_tcons0_array_t* array, itv_t* env, size_t intdim, int max_iter);
+static inline bool itv_meet_ap_tcons0_array_timeout(itv_internal_t* intern, ap_tcons0_array_t* array, itv_t* env, size_t intdim, int max_iter, ap_manager_t* man, bool* interrupted);
+  /* Same as itv_meet_ap_tcons0_array, but stops before the next constraint
+     once the deadline of the current call on man (if not NULL) has passed.
+     In that case, *interrupted is set to true, and env is sound but not
+     refined as much as it could be. */
 static inline bool itv_subst_ap_texpr0_array(itv_internal_t* intern, itv_t* res, itv_t* arg, ap_dim_t* dim, ap_texpr0_t** array, size_t size, size_t intdim, size_t realdim, int max_iter);
 
 
@@ -136,8 +142,8 @@ static inline bool itv_subst_ap_texpr0_array(itv_internal_t* intern, itv_t* res,
 /* ********************************************************************** */
 
 /* I. Evaluation of expressions  */
-void ITVFUN(itv_eval_linexpr)(itv_internal_t* intern, itv_t itv, itv_linexpr_t* expr, itv_t* env);
-bool ITVFUN(itv_eval_ap_linexpr0)(itv_internal_t* intern, itv_t itv, ap_linexpr0_t* expr, itv_t* env);
+void ITVFUN(itv_eval_linexpr)(itv_internal_t* intern, itv_ptr itv, itv_linexpr_t* expr, itv_t* env);
+bool ITVFUN(itv_eval_ap_linexpr0)(itv_internal_t* intern, itv_ptr itv, ap_linexpr0_t* expr, itv_t* env);
 
 /* II. Boxization of interval linear expressions */
 bool ITVFUN(itv_boxize_lincons_array)(itv_internal_t* intern, itv_t* res, bool* change, itv_lincons_array_t* array, itv_t* env, size_t intdim, size_t kmax, bool intervalonly);
@@ -149,7 +155,7 @@ bool ITVFUN(itv_quasilinearize_lincons_array)(itv_internal_t* intern, itv_lincon
 void ITVFUN(itv_linearize_lincons_array)(itv_internal_t* intern, itv_lincons_array_t* array, bool meet);
 
 /* IV. Evaluation of tree expressions  */
-void ITVFUN(itv_eval_ap_texpr0)(itv_internal_t* intern, itv_t itv, ap_texpr0_t* expr, itv_t* env);
+void ITVFUN(itv_eval_ap_texpr0)(itv_internal_t* intern, itv_ptr itv, ap_texpr0_t* expr, itv_t* env);
 
 /* V. Linearisation of linear tree expressions. */
 bool ITVFUN(itv_intlinearize_ap_texpr0_intlinear)(itv_internal_t* intern, itv_linexpr_t* res, ap_texpr0_t* expr);
@@ -163,15 +169,16 @@ bool ITVFUN(itv_intlinearize_ap_tcons0_array)(itv_internal_t* intern,itv_lincons
 
 /* VII. Backward evaluation of tree expressions. */
 bool ITVFUN(itv_meet_ap_tcons0_array)(itv_internal_t* intern, ap_tcons0_array_t* array, itv_t* env, size_t intdim, int max_iter);
+bool ITVFUN(itv_meet_ap_tcons0_array_timeout)(itv_internal_t* intern, ap_tcons0_array_t* array, itv_t* env, size_t intdim, int max_iter, ap_manager_t* man, bool* interrupted);
 bool ITVFUN(itv_subst_ap_texpr0_array)(itv_internal_t* intern, itv_t* res, itv_t* arg, ap_dim_t* dim, ap_texpr0_t** array, size_t size, size_t intdim, size_t realdim, int max_iter);
 
 /* ********************************************************************** */
 /* Definition of inline functions */
 /* ********************************************************************** */
 /* I. Evaluation of expressions  */
-static inline void itv_eval_linexpr(itv_internal_t* intern, itv_t itv, itv_linexpr_t* expr, itv_t* env)
+static inline void itv_eval_linexpr(itv_internal_t* intern, itv_ptr itv, itv_linexpr_t* expr, itv_t* env)
 { ITVFUN(itv_eval_linexpr)(intern,itv,expr,env); }
-static inline bool itv_eval_ap_linexpr0(itv_internal_t* intern, itv_t itv, ap_linexpr0_t* expr, itv_t* env)
+static inline bool itv_eval_ap_linexpr0(itv_internal_t* intern, itv_ptr itv, ap_linexpr0_t* expr, itv_t* env)
 { return ITVFUN(itv_eval_ap_linexpr0)(intern,itv,expr,env); }
 
 /* II. Boxization of interval linear expressions */
@@ -189,7 +196,7 @@ static inline void itv_linearize_lincons_array(itv_internal_t* intern, itv_linco
 { ITVFUN(itv_linearize_lincons_array)(intern,array,meet); }
 
 /* IV. Evaluation of tree expressions  */
-static inline void itv_eval_ap_texpr0(itv_internal_t* intern, itv_t itv, ap_texpr0_t* expr, itv_t* env)
+static inline void itv_eval_ap_texpr0(itv_internal_t* intern, itv_ptr itv, ap_texpr0_t* expr, itv_t* env)
 { ITVFUN(itv_eval_ap_texpr0)(intern,itv,expr,env); }
 
 /* V. Linearisation of linear tree expressions. */
@@ -211,6 +218,8 @@ static inline bool itv_intlinearize_ap_tcons0_array(itv_internal_t* intern, itv_
 /* VII. Backward evaluation of tree expressions. */
 static inline bool itv_meet_ap_tcons0_array(itv_internal_t* intern, ap_tcons0_array_t* array, itv_t* env, size_t intdim, int max_iter)
 { return ITVFUN(itv_meet_ap_tcons0_array)(intern,array,env,intdim,max_iter); }
+static inline bool itv_meet_ap_tcons0_array_timeout(itv_internal_t* intern, ap_tcons0_array_t* array, itv_t* env, size_t intdim, int max_iter, ap_manager_t* man, bool* interrupted)
+{ return ITVFUN(itv_meet_ap_tcons0_array_timeout)(intern,array,env,intdim,max_iter,man,interrupted); }
 static inline bool itv_subst_ap_texpr0_array(itv_internal_t* intern, itv_t* res, itv_t* arg, ap_dim_t* dim, ap_texpr0_t** array, size_t size, size_t intdim, size_t realdim, int max_iter)
 { return ITVFUN(itv_subst_ap_texpr0_array)(intern,res,arg,dim,array,size,intdim,realdim,max_iter); }
 
@@ -248,6 +248,105 @@ bool ITVFUN(itv_lincons_array_set_ap_lincons0_array)(itv_internal_t* intern,
   return exact;
 }
 
+/* Convert the value of slot i of a pack into a bound, rounding towards +oo
+   (towards -oo if neg). The pack is not modified: the negation of a rational
+   slot goes through intern->ap_conversion_scalar. */
+static bool bound_set_ap_linpack0_slot(itv_internal_t* intern,
+				       bound_t a, ap_linpack0_t* pack,
+				       ap_linpack0_val_t val, size_t i, bool neg)
+{
+  if (pack->discr==AP_SCALAR_DOUBLE){
+    double k = neg ? -val.dbl[i] : val.dbl[i];
+    if (isinf(k)){
+      bound_set_infty(a, k>0 ? 1 : -1);
+      return true;
+    }
+    _bound_inf(a);
+    return num_set_double(bound_numref(a),k);
+  }
+  else if (neg){
+    ap_scalar_reinit(intern->ap_conversion_scalar,AP_SCALAR_MPQ);
+    mpq_neg(intern->ap_conversion_scalar->val.mpq,&val.mpq[i]);
+    return bound_set_ap_scalar(a,intern->ap_conversion_scalar);
+  }
+  else {
+    mpq_ptr q = &val.mpq[i];
+    if (mpz_sgn(mpq_denref(q))==0){
+      bound_set_infty(a,mpz_sgn(mpq_numref(q)));
+      return true;
+    }
+    _bound_inf(a);
+    return num_set_mpq(bound_numref(a),q);
+  }
+}
+static bool itv_set_ap_linpack0_slots(itv_internal_t* intern,
+				      itv_ptr itv, ap_linpack0_t* pack,
+				      ap_linpack0_val_t val, size_t k)
+{
+  bool b1 = bound_set_ap_linpack0_slot(intern,itv->inf,pack,val,2*k,true);
+  bool b2 = bound_set_ap_linpack0_slot(intern,itv->sup,pack,val,2*k+1,false);
+  return b1 && b2;
+}
+
+bool ITVFUN(itv_linexpr_set_ap_linpack0)(itv_internal_t* intern,
+					 itv_linexpr_t* expr,
+					 ap_linpack0_t* pack, size_t row)
+{
+  size_t i,k,first,last;
+  bool res,exact;
+
+  first = pack->start[row];
+  last = pack->start[row+1];
+  itv_linexpr_reinit(expr,last-first);
+  exact = itv_set_ap_linpack0_slots(intern,expr->cst,pack,pack->cst,row);
+  expr->equality = exact && pack->cstkind[row]==AP_COEFF_SCALAR;
+  res = exact;
+  k = 0;
+  for (i=first; i<last; i++){
+    exact = itv_set_ap_linpack0_slots(intern,expr->linterm[k].itv,pack,pack->coeff,i);
+    if (!itv_is_zero(expr->linterm[k].itv)){
+      res = res && exact;
+      expr->linterm[k].equality = exact && pack->kind[i]==AP_COEFF_SCALAR;
+      expr->linterm[k].dim = pack->dim[i];
+      k++;
+    }
+  }
+  itv_linexpr_reinit(expr,k);
+  return res;
+}
+
+bool ITVFUN(itv_lincons_set_ap_linpack0)(itv_internal_t* intern,
+					 itv_lincons_t* cons,
+					 ap_linpack0_t* pack, size_t row)
+{
+  bool exact1 = itv_linexpr_set_ap_linpack0(intern,&cons->linexpr,pack,row);
+  cons->constyp = pack->constyp[row];
+  if (cons->constyp==AP_CONS_EQMOD){
+    bool exact2 = pack->discr==AP_SCALAR_DOUBLE ?
+      num_set_double(cons->num,pack->modulo.dbl[row]) :
+      num_set_mpq(cons->num,&pack->modulo.mpq[row]);
+    return exact1 && exact2;
+  }
+  else {
+    num_set_int(cons->num,0);
+    return exact1;
+  }
+}
+
+bool ITVFUN(itv_lincons_array_set_ap_linpack0)(itv_internal_t* intern,
+					       itv_lincons_array_t* tcons,
+					       ap_linpack0_t* pack)
+{
+  size_t i;
+  bool exact = true;
+
+  itv_lincons_array_reinit(tcons,pack->size);
+  for (i=0; i<pack->size; i++){
+    exact = itv_lincons_set_ap_linpack0(intern,&tcons->p[i],pack,i) && exact;
+  }
+  return exact;
+}
+
 void ITVFUN(ap_linexpr0_set_itv_linexpr)(itv_internal_t* intern,
 					 ap_linexpr0_t** plinexpr0,
 					 itv_linexpr_t* linexpr)
@@ -315,7 +414,7 @@ void ITVFUN(itv_linexpr_neg)(itv_linexpr_t* expr)
   return;
 }
 void ITVFUN(itv_linexpr_scale)(itv_internal_t* intern,
-			       itv_linexpr_t* expr, itv_t coeff)
+			       itv_linexpr_t* expr, itv_ptr coeff)
 {
   size_t i;
   ap_dim_t dim;
@@ -341,7 +440,7 @@ void ITVFUN(itv_linexpr_scale)(itv_internal_t* intern,
   return;
 }
 void ITVFUN(itv_linexpr_div)(itv_internal_t* intern,
-			     itv_linexpr_t* expr, itv_t coeff)
+			     itv_linexpr_t* expr, itv_ptr coeff)
 {
   size_t i;
   ap_dim_t dim;
@@ -666,6 +765,21 @@ itv_lincons_is_useless_for_meet(itv_internal_t* intern,
   return res;
 }
 
+#if defined(NUM_NUMFLT)
+/* gcd of machine integers, always non-negative */
+static long int itv_lincons_gcd_int(long int a, long int b)
+{
+  if (a<0) a = -a;
+  if (b<0) b = -b;
+  while (b!=0){
+    long int t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+#endif
+
 void ITVFUN(itv_lincons_reduce_integer)(itv_internal_t* intern,
 					itv_lincons_t* cons,
 					size_t intdim)
@@ -723,28 +837,52 @@ void ITVFUN(itv_lincons_reduce_integer)(itv_internal_t* intern,
 		     1);
       bound_neg(pitv->inf,pitv->sup);
     }
+    /* quasi_num is positive */
     numrat_inv(intern->quasi_num,intern->quasi_num);
-    itv_mul_num(expr->cst,expr->cst,intern->quasi_num);
+    bound_mul_num(expr->cst->sup,expr->cst->sup,intern->quasi_num);
+    bound_mul_num(expr->cst->inf,expr->cst->inf,intern->quasi_num);
   }
 #else
 #if defined(NUM_NUMFLT)
   {
     /* Assuming that all coefficients are either integer,
-       compute the pgcd */
-    mpz_set_si(intern->reduce_lincons_gcd,0);
+       compute the pgcd, with machine integers if all the coefficients are
+       smaller than LONG_MAX/2, and with GMP otherwise */
+    bool small = true;
+    long int gcd = 0;
     itv_linexpr_ForeachLinterm(expr,i,dim,pitv,peq) {
       if (!numflt_integer(pitv->sup)) 
 	return;
-      mpz_set_numflt(intern->reduce_lincons_mpz,pitv->sup);
-      mpz_gcd(intern->reduce_lincons_gcd,
-	      intern->reduce_lincons_gcd,
-	      intern->reduce_lincons_mpz);
+      if (small &&
+	  numflt_cmp_int(pitv->sup,LONG_MAX/2)<=0 &&
+	  numflt_cmp_int(pitv->sup,-(LONG_MAX/2))>=0){
+	long int c;
+	int_set_numflt(&c,pitv->sup);
+	gcd = itv_lincons_gcd_int(gcd,c);
+      }
+      else
+	small = false;
+    }
+    if (small){
+      if (gcd<=1)
+	return;
+      numflt_set_int(intern->quasi_num,gcd);
+      if (numflt_cmp_int(intern->quasi_num,gcd)!=0) return;
+    }
+    else {
+      mpz_set_si(intern->reduce_lincons_gcd,0);
+      itv_linexpr_ForeachLinterm(expr,i,dim,pitv,peq) {
+	mpz_set_numflt(intern->reduce_lincons_mpz,pitv->sup);
+	mpz_gcd(intern->reduce_lincons_gcd,
+		intern->reduce_lincons_gcd,
+		intern->reduce_lincons_mpz);
+      }
+      if (mpz_sgn(intern->reduce_lincons_gcd)==0 ||
+	  mpz_cmp_si(intern->reduce_lincons_gcd,1)==0)
+	return;
+      bool exact = numflt_set_mpz(intern->quasi_num,intern->reduce_lincons_gcd);
+      if (!exact) return;
     }
-    if (mpz_sgn(intern->reduce_lincons_gcd)==0 ||
-	mpz_cmp_si(intern->reduce_lincons_gcd,1)==0)
-      return;
-    bool exact = numflt_set_mpz(intern->quasi_num,intern->reduce_lincons_gcd);
-    if (!exact) return;
   }
 #elif defined(NUM_NUMINT)
   {
@@ -126,6 +126,18 @@ static inline bool itv_lincons_array_set_ap_lincons0_array(itv_internal_t* inter
      Return true if the conversion is exact
   */
 
+static inline bool itv_linexpr_set_ap_linpack0(itv_internal_t* intern,
+					       itv_linexpr_t* expr,
+					       ap_linpack0_t* pack, size_t row);
+static inline bool itv_lincons_set_ap_linpack0(itv_internal_t* intern,
+					       itv_lincons_t* cons,
+					       ap_linpack0_t* pack, size_t row);
+static inline bool itv_lincons_array_set_ap_linpack0(itv_internal_t* intern,
+						     itv_lincons_array_t* tcons,
+						     ap_linpack0_t* pack);
+  /* Idem, from the row(s) of a pack, without going through intermediate
+     ap_linexpr0_t objects */
+
 static inline void ap_linexpr0_set_itv_linexpr(itv_internal_t* intern,
 					       ap_linexpr0_t** plinexpr0, itv_linexpr_t* linexpr);
   /* Convert an itv_linexpr_t into an ap_linexpr0_t.
@@ -145,7 +157,7 @@ static inline void ap_lincons0_set_itv_lincons(itv_internal_t* intern,
 static inline void itv_linexpr_neg(itv_linexpr_t* expr);
   /* Negate in-place an expression */
 static inline void itv_linexpr_scale(itv_internal_t* intern,
-				     itv_linexpr_t* expr, itv_t coeff);
+				     itv_linexpr_t* expr, itv_ptr coeff);
   /* Scale in-place an expression by an interval */
 
 static inline void itv_linexpr_add(itv_internal_t* intern,
@@ -246,12 +258,16 @@ bool ITVFUN(itv_linexpr_set_ap_linexpr0)(itv_internal_t* intern, itv_linexpr_t*
 bool ITVFUN(itv_lincons_set_ap_lincons0)(itv_internal_t* intern, itv_lincons_t* cons, ap_lincons0_t* lincons0);
 bool ITVFUN(itv_lincons_array_set_ap_lincons0_array)(itv_internal_t* intern, itv_lincons_array_t* tcons, ap_lincons0_array_t* tlincons0);
 
+bool ITVFUN(itv_linexpr_set_ap_linpack0)(itv_internal_t* intern, itv_linexpr_t* expr, ap_linpack0_t* pack, size_t row);
+bool ITVFUN(itv_lincons_set_ap_linpack0)(itv_internal_t* intern, itv_lincons_t* cons, ap_linpack0_t* pack, size_t row);
+bool ITVFUN(itv_lincons_array_set_ap_linpack0)(itv_internal_t* intern, itv_lincons_array_t* tcons, ap_linpack0_t* pack);
+
 void ITVFUN(ap_linexpr0_set_itv_linexpr)(itv_internal_t* intern, ap_linexpr0_t** linexpr0, itv_linexpr_t* linexpr);
 void ITVFUN(ap_lincons0_set_itv_lincons)(itv_internal_t* intern, ap_lincons0_t* lincons0, itv_lincons_t* lincons);
 
 void ITVFUN(itv_linexpr_neg)(itv_linexpr_t* expr);
-void ITVFUN(itv_linexpr_scale)(itv_internal_t* intern, itv_linexpr_t* expr, itv_t coeff);
-void ITVFUN(itv_linexpr_div)(itv_internal_t* intern, itv_linexpr_t* expr, itv_t coeff);
+void ITVFUN(itv_linexpr_scale)(itv_internal_t* intern, itv_linexpr_t* expr, itv_ptr coeff);
+void ITVFUN(itv_linexpr_div)(itv_internal_t* intern, itv_linexpr_t* expr, itv_ptr coeff);
 void ITVFUN(itv_linexpr_add)(itv_internal_t* intern, itv_linexpr_t* expr, itv_linexpr_t* exprA, itv_linexpr_t* exprB);
 void ITVFUN(itv_linexpr_sub)(itv_internal_t* intern, itv_linexpr_t* expr, itv_linexpr_t* exprA, itv_linexpr_t* exprB);
 
@@ -341,6 +357,15 @@ static inline bool itv_lincons_set_ap_lincons0(itv_internal_t* intern, itv_linco
 static inline bool itv_lincons_array_set_ap_lincons0_array(itv_internal_t* intern, itv_lincons_array_t* tcons, ap_lincons0_array_t* tlincons0)
 { return ITVFUN(itv_lincons_array_set_ap_lincons0_array)(intern,tcons,tlincons0); }
 
+static inline bool itv_linexpr_set_ap_linpack0(itv_internal_t* intern, itv_linexpr_t* expr, ap_linpack0_t* pack, size_t row)
+{ return ITVFUN(itv_linexpr_set_ap_linpack0)(intern,expr,pack,row); }
+
+static inline bool itv_lincons_set_ap_linpack0(itv_internal_t* intern, itv_lincons_t* cons, ap_linpack0_t* pack, size_t row)
+{ return ITVFUN(itv_lincons_set_ap_linpack0)(intern,cons,pack,row); }
+
+static inline bool itv_lincons_array_set_ap_linpack0(itv_internal_t* intern, itv_lincons_array_t* tcons, ap_linpack0_t* pack)
+{ return ITVFUN(itv_lincons_array_set_ap_linpack0)(intern,tcons,pack); }
+
 static inline void ap_linexpr0_set_itv_linexpr(itv_internal_t* intern, ap_linexpr0_t** expr, itv_linexpr_t* linexpr0)
 { ITVFUN(ap_linexpr0_set_itv_linexpr)(intern,expr,linexpr0); }
 
@@ -350,10 +375,10 @@ static inline void ap_lincons0_set_itv_lincons(itv_internal_t* intern, ap_lincon
 static inline void itv_linexpr_neg(itv_linexpr_t* expr)
 { ITVFUN(itv_linexpr_neg)(expr); }
 
-static inline void itv_linexpr_scale(itv_internal_t* intern, itv_linexpr_t* expr, itv_t coeff)
+static inline void itv_linexpr_scale(itv_internal_t* intern, itv_linexpr_t* expr, itv_ptr coeff)
 { ITVFUN(itv_linexpr_scale)(intern,expr,coeff); }
 
-static inline void itv_linexpr_div(itv_internal_t* intern, itv_linexpr_t* expr, itv_t coeff)
+static inline void itv_linexpr_div(itv_internal_t* intern, itv_linexpr_t* expr, itv_ptr coeff)
 { ITVFUN(itv_linexpr_div)(intern,expr,coeff); }
 
 static inline void itv_linexpr_add(itv_internal_t* intern, itv_linexpr_t* expr, itv_linexpr_t* exprA, itv_linexpr_t* exprB)
@@ -6,14 +6,149 @@
 #include "num.h"
 #include "bound.h"
 #include "itv.h"
+#include "itv_linexpr.h"
+
+/* ********************************************************************** */
+/* Reference kernels */
+/* ********************************************************************** */
+
+/* These are the out-of-line itv_sub, itv_mul and itv_div of itv.c before
+   they were inlined in itv.h, with only the fix of the cross-division by a
+   negative c in ref_divn. They always write into a fresh result, so that
+   the checks below also cover the aliased calls. */
+
+static void ref_sub(itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_add(a->inf,b->inf,c->sup);
+  bound_add(a->sup,b->sup,c->inf);
+}
+
+static void ref_mulpp(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound,c->inf);
+  bound_mul(a->inf,b->inf,intern->mul_bound);
+  bound_mul(a->sup,b->sup,c->sup);
+}
+static void ref_mulnn(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound,c->sup);
+  bound_mul(intern->mul_bound,b->sup,intern->mul_bound);
+  bound_mul(a->sup,b->inf,c->inf);
+  bound_set(a->inf,intern->mul_bound);
+}
+static void ref_mulpn(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound,b->inf);
+  bound_mul(a->inf,b->sup,c->inf);
+  bound_mul(a->sup,intern->mul_bound,c->sup);
+}
+static void ref_mulp(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(b->inf)<=0) ref_mulpp(intern,a,b,c);
+  else if (bound_sgn(b->sup)<=0) ref_mulpn(intern,a,c,b);
+  else {
+    bound_mul(a->inf,b->inf,c->sup);
+    bound_mul(a->sup,b->sup,c->sup);
+  }
+}
+static void ref_muln(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(b->inf)<=0) ref_mulpn(intern,a,b,c);
+  else if (bound_sgn(b->sup)<=0) ref_mulnn(intern,a,b,c);
+  else {
+    bound_mul(a->sup,b->sup,c->inf);
+    bound_mul(a->inf,b->inf,c->inf);
+    bound_swap(a->inf,a->sup);
+  }
+}
+static void ref_mul(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(c->inf)<=0) ref_mulp(intern,a,b,c);
+  else if (bound_sgn(c->sup)<=0) ref_muln(intern,a,b,c);
+  else if (bound_sgn(b->inf)<=0) ref_mulp(intern,a,c,b);
+  else if (bound_sgn(c->sup)<=0) ref_muln(intern,a,c,b);
+  else {
+    bound_set(intern->mul_itv->inf,c->inf);
+    bound_set_int(intern->mul_itv->sup,0);
+    ref_muln(intern,intern->mul_itv2,b,intern->mul_itv);
+    bound_set_int(intern->mul_itv->inf,0);
+    bound_set(intern->mul_itv->sup,c->sup);
+    ref_mulp(intern,a,b,intern->mul_itv);
+    itv_join(a,a,intern->mul_itv2);
+  }
+}
+
+static void ref_divpp(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound,c->inf);
+  bound_div(a->inf,b->inf,c->sup);
+  bound_div(a->sup,b->sup,intern->mul_bound);
+}
+static void ref_divnn(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound,b->inf);
+  bound_div(a->inf,b->sup,c->inf);
+  bound_div(a->sup,intern->mul_bound,c->sup);
+}
+static void ref_divpn(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound,b->sup);
+  bound_div(intern->mul_bound,intern->mul_bound,c->sup);
+  bound_div(a->sup,b->inf,c->inf);
+  bound_set(a->inf,intern->mul_bound);
+}
+static void ref_divnp(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  bound_neg(intern->mul_bound, b->inf);
+  bound_div(a->inf,intern->mul_bound,c->inf);
+  bound_div(a->sup,b->sup,c->sup);
+}
+static void ref_divp(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(b->inf)<=0) ref_divpp(intern,a,b,c);
+  else if (bound_sgn(b->sup)<=0) ref_divnp(intern,a,b,c);
+  else {
+    bound_neg(intern->mul_bound,c->inf);
+    bound_div(a->inf,b->inf,intern->mul_bound);
+    bound_div(a->sup,b->sup,intern->mul_bound);
+  }
+}
+static void ref_divn(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(b->inf)<=0) ref_divpn(intern,a,b,c);
+  else if (bound_sgn(b->sup)<=0) ref_divnn(intern,a,b,c);
+  else {
+    bound_neg(intern->mul_bound,c->sup);
+    bound_div(a->inf,b->sup,intern->mul_bound);
+    bound_div(a->sup,b->inf,intern->mul_bound);
+  }
+}
+static void ref_div(itv_internal_t* intern, itv_ptr a, itv_ptr b, itv_ptr c)
+{
+  if (bound_sgn(c->inf)<0) ref_divp(intern,a,b,c);
+  else if (bound_sgn(c->sup)<0) ref_divn(intern,a,b,c);
+  else if (bound_sgn(b->inf)==0 && bound_sgn(b->sup)==0) itv_set(a,b);
+  else itv_set_top(a);
+}
+
+/* Checks the result a of an inlined kernel against the reference r */
+static void check(const char* op, itv_ptr a, itv_ptr r)
+{
+  if (!itv_is_eq(a,r)){
+    printf("%s: got ",op); itv_print(a);
+    printf(", expected "); itv_print(r); printf("\n");
+    abort();
+  }
+}
 
 void arith(itv_internal_t* intern,
 	   itv_t a, itv_t b, itv_t c, bound_t bound)
 {
-  itv_t bb,cc;
+  itv_t bb,cc,r;
   
   itv_init_set(bb,b);
   itv_init_set(cc,c);
+  itv_init(r);
 
   printf("********************\n");
   printf("b="); itv_print(b);
@@ -33,12 +168,22 @@ void arith(itv_internal_t* intern,
   printf("itv_add(b,c)="); itv_print(a); printf("\n");
 
   itv_set(b,bb); itv_set(c,cc);
+  ref_sub(r,bb,cc);
   itv_sub(a,b,c);
   printf("itv_sub(b,c)="); itv_print(a); printf("\n");
+  check("itv_sub",a,r);
 
   itv_set(b,bb); itv_set(c,cc);
+  ref_mul(intern,r,bb,cc);
   itv_mul(intern,a,b,c);
   printf("itv_mul(b,c)="); itv_print(a); printf("\n");
+  check("itv_mul",a,r);
+
+  itv_set(b,bb); itv_set(c,cc);
+  ref_div(intern,r,bb,cc);
+  itv_div(intern,a,b,c);
+  printf("itv_div(b,c)="); itv_print(a); printf("\n");
+  check("itv_div",a,r);
 
   itv_set(b,bb); itv_set(c,cc);
   itv_add_bound(a,b,bound);
@@ -60,9 +205,147 @@ void arith(itv_internal_t* intern,
 
   itv_clear(bb);
   itv_clear(cc);
+  itv_clear(r);
 }
 
+/* Reduces c0.x0+c1.x1+cst>=0, with x0 and x1 integers, and checks that the
+   result is r0.x0+r1.x1+rcst>=0 */
+void reduce_integer(itv_internal_t* intern,
+		    double c0, double c1, double cst,
+		    double r0, double r1, double rcst)
+{
+  ap_linexpr0_t* linexpr0;
+  ap_lincons0_t lincons0;
+  itv_lincons_t cons;
+  num_t num;
+  double r[2];
+  size_t i;
 
+  linexpr0 = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_list(linexpr0,
+		       AP_COEFF_S_DOUBLE,c0,(ap_dim_t)0,
+		       AP_COEFF_S_DOUBLE,c1,(ap_dim_t)1,
+		       AP_CST_S_DOUBLE,cst,
+		       AP_END);
+  lincons0 = ap_lincons0_make(AP_CONS_SUPEQ,linexpr0,NULL);
+  itv_lincons_init(&cons);
+  itv_lincons_set_ap_lincons0(intern,&cons,&lincons0);
+  printf("********************\n");
+  printf("cons="); itv_lincons_print(&cons,NULL); printf("\n");
+  itv_lincons_reduce_integer(intern,&cons,2);
+  printf("itv_lincons_reduce_integer(cons)="); itv_lincons_print(&cons,NULL); printf("\n");
+
+  num_init(num);
+  r[0] = r0; r[1] = r1;
+  if (cons.linexpr.size!=2) abort();
+  for (i=0; i<2; i++){
+    num_set_double(num,r[i]);
+    if (bound_cmp_num(cons.linexpr.linterm[i].itv->sup,num)!=0) abort();
+  }
+  num_set_double(num,rcst);
+  if (bound_cmp_num(cons.linexpr.cst->sup,num)!=0) abort();
+  num_clear(num);
+  itv_lincons_clear(&cons);
+  ap_lincons0_clear(&lincons0);
+}
+
+/* Checks that two slots arrays of packs of the same shape are equal */
+static bool linpack_val_equal(ap_scalar_discr_t discr,
+			      ap_linpack0_val_t a, ap_linpack0_val_t b, size_t n)
+{
+  size_t i;
+  for (i=0; i<n; i++){
+    if (discr==AP_SCALAR_DOUBLE ?
+	a.dbl[i]!=b.dbl[i] :
+	!mpq_equal(&a.mpq[i],&b.mpq[i]))
+      return false;
+  }
+  return true;
+}
+
+/* Converts the constraints
+     3x0 - 2x1 + [-oo,4] >= 0
+     [-5,-1]x0 + [2,+oo]x2 - 7/3 >= 0
+     -x1 + x2 + [-oo,+oo] = 0 mod 3
+   packed with discr, and checks that the result is the one of the
+   conversion of the unpacked constraints, and that the pack is left
+   unchanged */
+void linpack(itv_internal_t* intern, ap_scalar_discr_t discr)
+{
+  ap_lincons0_array_t array,array2;
+  ap_linexpr0_t* e;
+  ap_linpack0_t *pack,*copy;
+  itv_lincons_array_t t1,t2;
+  size_t i,k;
+
+  array = ap_lincons0_array_make(3);
+  e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_list(e,
+		       AP_COEFF_S_INT,3,(ap_dim_t)0,
+		       AP_COEFF_S_INT,-2,(ap_dim_t)1,
+		       AP_CST_I_DOUBLE,-INFINITY,4.0,
+		       AP_END);
+  array.p[0] = ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+  e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_list(e,
+		       AP_COEFF_I_INT,-5,-1,(ap_dim_t)0,
+		       AP_COEFF_I_DOUBLE,2.0,INFINITY,(ap_dim_t)2,
+		       AP_CST_S_FRAC,-7,3,
+		       AP_END);
+  array.p[1] = ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+  e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_list(e,
+		       AP_COEFF_S_INT,-1,(ap_dim_t)1,
+		       AP_COEFF_S_INT,1,(ap_dim_t)2,
+		       AP_CST_I_DOUBLE,-INFINITY,INFINITY,
+		       AP_END);
+  array.p[2] = ap_lincons0_make(AP_CONS_EQMOD,e,ap_scalar_alloc_set_double(3.0));
+
+  pack = ap_linpack0_of_lincons0_array(discr,&array);
+  copy = ap_linpack0_copy(pack);
+  /* a double pack encloses -7/3 in an interval */
+  array2 = ap_lincons0_array_of_linpack0(pack);
+  itv_lincons_array_init(&t1,0);
+  itv_lincons_array_init(&t2,0);
+  itv_lincons_array_set_ap_linpack0(intern,&t1,pack);
+  itv_lincons_array_set_ap_lincons0_array(intern,&t2,&array2);
+
+  printf("********************\n");
+  printf("pack="); ap_linpack0_print(pack,NULL);
+  printf("itv_lincons_array_set_ap_linpack0(pack)="); itv_lincons_array_print(&t1,NULL);
+  if (t1.size!=t2.size) abort();
+  for (i=0; i<t1.size; i++){
+    itv_lincons_t* c1 = &t1.p[i];
+    itv_lincons_t* c2 = &t2.p[i];
+    if (c1->constyp!=c2->constyp || !num_equal(c1->num,c2->num) ||
+	c1->linexpr.size!=c2->linexpr.size ||
+	c1->linexpr.equality!=c2->linexpr.equality ||
+	!itv_is_eq(c1->linexpr.cst,c2->linexpr.cst))
+      abort();
+    for (k=0; k<c1->linexpr.size; k++){
+      if (c1->linexpr.linterm[k].dim!=c2->linexpr.linterm[k].dim ||
+	  c1->linexpr.linterm[k].equality!=c2->linexpr.linterm[k].equality)
+	abort();
+      check("itv_lincons_array_set_ap_linpack0",
+	    c1->linexpr.linterm[k].itv,c2->linexpr.linterm[k].itv);
+    }
+  }
+  if (!itv_is_eq(t1.p[0].linexpr.cst,t2.p[0].linexpr.cst) ||
+      !bound_infty(t1.p[0].linexpr.cst->inf) ||
+      !bound_infty(t1.p[2].linexpr.cst->sup))
+    abort();
+  if (!linpack_val_equal(discr,pack->cst,copy->cst,2*pack->size) ||
+      !linpack_val_equal(discr,pack->coeff,copy->coeff,2*pack->nbterms) ||
+      !linpack_val_equal(discr,pack->modulo,copy->modulo,pack->size))
+    abort();
+
+  itv_lincons_array_clear(&t1);
+  itv_lincons_array_clear(&t2);
+  ap_lincons0_array_clear(&array2);
+  ap_linpack0_free(copy);
+  ap_linpack0_free(pack);
+  ap_lincons0_array_clear(&array);
+}
 
 int main(int argc, char**argv)
 {
@@ -87,6 +370,13 @@ int main(int argc, char**argv)
   arith(intern,a,b,c,bound);
   itv_neg(c,c);
   arith(intern,a,b,c,bound);
+  /* 0 in the middle of b */
+  bound_set_int(b->inf,99); bound_set_int(b->sup,100);
+  bound_set_int(c->inf,1); bound_set_int(c->sup,-1);
+  bound_set_int(bound,-2);
+  arith(intern,a,b,c,bound);
+  itv_neg(c,c);
+  arith(intern,a,b,c,bound);
   /* general intervals */
   bound_set_int(b->inf,3); bound_set_int(b->sup,5);
   bound_set_int(c->inf,7); bound_set_int(c->sup,11);
@@ -103,6 +393,15 @@ int main(int argc, char**argv)
   bound_set_int(bound,-3);
   arith(intern,b,b,b,bound);
 
+  /* integer constraints, with coefficients below and above LONG_MAX/2 */
+  reduce_integer(intern,6.0,10.0,7.0, 3.0,5.0,3.0);
+  reduce_integer(intern,3.0*0x1p61,0x1p62,0x1p61, 3.0,2.0,1.0);
+  reduce_integer(intern,6.0,0x1p62,7.0, 3.0,0x1p61,3.0);
+
+  /* packed constraints */
+  linpack(intern,AP_SCALAR_MPQ);
+  linpack(intern,AP_SCALAR_DOUBLE);
+
   itv_clear(a);
   itv_clear(b);
   itv_clear(c);
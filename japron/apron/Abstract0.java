@@ -44,6 +44,7 @@ public class Abstract0
     private native void init(Manager man, Abstract0 o) throws ApronException;
     private native void init(Manager man, int intdim, int realdim, boolean empty) throws ApronException;
     private native void init(Manager man, int intdim, int realdim, Interval[] box) throws ApronException;
+    private native void init(Manager man, int intdim, int realdim, double[] box) throws ApronException;
 
     /** Deallocates the Apron ap_abstract0_t object. */
     protected native void finalize();
@@ -98,6 +99,20 @@ public class Abstract0
         throws ApronException
     { init(man, intdim, realdim, box); }
 
+    /**
+     * Creates a new abstract element from a box given as an array of doubles.
+     *
+     * <p> The element has intdim integer-valued dimensions, followed by
+     * realdim real-valued dimensions.
+     * <p> box must contain 2*(intdim+realdim) doubles: the lower and upper
+     * bound of each dimension in turn, which can be infinite.
+     * <p> The constructed element is the Cartesian product of the intervals.
+     * <p> This avoids creating one Interval object per dimension.
+     */
+    public Abstract0(Manager man, int intdim, int realdim, double[] box)
+        throws ApronException
+    { init(man, intdim, realdim, box); }
+
 
    /**
      * <p> Creates a new abstract element from a set of constraints.
@@ -248,6 +263,35 @@ public class Abstract0
     public native Interval[] toBox(Manager man)
         throws ApronException;
 
+    /**
+     * Returns a box describing (an over-approximation of) this, as an
+     * array of doubles.
+     *
+     * <p> The array holds the lower and upper bound of each dimension in
+     * turn, rounded outward, with infinite doubles for infinite bounds.
+     * <p> This avoids creating one Interval object per dimension.
+     */
+    public native double[] toBoxDouble(Manager man)
+        throws ApronException;
+
+    /**
+     * Returns a set of linear constraints describing (an over-approximation 
+     * of) this, as an array of doubles.
+     *
+     * <p> Each constraint is a row of n+2 doubles, where n is the number
+     * of dimensions of this: its kind ({@link Lincons0#EQ},
+     * {@link Lincons0#SUPEQ}, {@link Lincons0#SUP} or 
+     * {@link Lincons0#DISEQ}), the coefficients of dimensions 0 to n-1, 
+     * and the constant coefficient.
+     * <p> Constraints that cannot be represented exactly with doubles
+     * (modular constraints, interval or inexact coefficients) are omitted,
+     * except for inequalities whose constant coefficient is only rounded
+     * upward. The result may thus be coarser than {@link #toLincons}.
+     * <p> This avoids creating Lincons0, Linexpr0 and Coeff objects.
+     */
+    public native double[] toLinconsDouble(Manager man)
+        throws ApronException;
+
     /**
      * Returns a set of generators describing (an over-approximation of)
      * this.
@@ -468,6 +512,30 @@ public class Abstract0
     public native void meet(Manager man, Tcons0[] ar)
         throws ApronException;
 
+    /**
+     * Returns a new abstract element that contains (an over-approximation of)
+     * the set-intersection of this with the linear constraints in ar.
+     *
+     * <p> The constraints are given in the format of
+     * {@link #toLinconsDouble}: rows of n+2 doubles, where n is the number
+     * of dimensions of this. The kind of a constraint cannot be 
+     * {@link Lincons0#EQMOD}.
+     * <p> this is not changed.
+     * <p> This avoids creating Lincons0, Linexpr0 and Coeff objects.
+     */
+    public native Abstract0 meetCopy(Manager man, double[] ar)
+        throws ApronException;
+
+    /**
+     * Replaces this with (an over-approximation of) the set-intersection 
+     * of this with the linear constraints in ar.
+     *
+     * <p> The constraints are given in the format of
+     * {@link #toLinconsDouble}.
+     */
+    public native void meet(Manager man, double[] ar)
+        throws ApronException;
+
 
 
     /**
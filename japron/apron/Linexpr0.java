@@ -41,6 +41,7 @@ public class Linexpr0
 
     private native void init(boolean sparse, int size);
     private native void init(Linexpr0 c);
+    private native void init(double[] term, double cst);
 
     /** Deallocates the underlying Apron object. */
     protected native void finalize();
@@ -106,6 +107,18 @@ public class Linexpr0
         setCst(cst);
     }
 
+
+    /**
+     * Creates a new dense Linexpr0 with the specified double dimension
+     * and constant coefficients.
+     *
+     * <p> The Linexpr0 has the same size as the term array.
+     * <p> Dimension i gets coefficient term[i].
+     * <p> Unlike {@link #Linexpr0(Coeff[], Coeff)}, no Coeff object is
+     * involved: the whole array is converted in a single native call.
+     */
+    public Linexpr0(double[] term, double cst)
+    { init(term, cst); }
     
     // Set functions
     ////////////////
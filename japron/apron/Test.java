@@ -158,6 +158,8 @@ public class Test
         a0.isBottom(man2);
         System.out.println("to-lcons: " + Arrays.toString(a0.toLincons(man)));
         System.out.println("to-box: " + Arrays.toString(a0.toBox(man)));
+        System.out.println("to-box double: " + Arrays.toString(a0.toBoxDouble(man)));
+        System.out.println("to-lcons double: " + Arrays.toString(a0.toLinconsDouble(man)));
         System.out.println("to-tcons: " + Arrays.toString(a0.toTcons(man)));
         try { System.out.println("to-gen: " + Arrays.toString(a0.toGenerator(man))); } 
         catch (ApronException e) { System.out.println("got exception: " + e); }
@@ -202,6 +204,9 @@ public class Test
         assert a0.meetCopy(man, lincons).isIncluded(man, a0);
         assert a0.meetCopy(man, lincons2).isIncluded(man, a0);
         assert a0.meetCopy(man, tcons).isIncluded(man, a0);
+        assert a0.isIncluded(man, new Abstract0(man, 2, 1, a0.toBoxDouble(man)));
+        assert a0.meetCopy(man, a0.toLinconsDouble(man)).isIncluded(man, a0);
+        assert a0.isIncluded(man, full.meetCopy(man, a0.toLinconsDouble(man)));
         System.out.println("+ const: " + lincons2 + " -> " + a0.meetCopy(man, lincons2));
         Abstract0 w = full.meetCopy(man, lincons2);
         System.out.println("widen: "+ a0.widening(man, w));
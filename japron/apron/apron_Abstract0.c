@@ -102,6 +102,34 @@ JNIEXPORT void JNICALL Java_apron_Abstract0_init__Lapron_Manager_2II_3Lapron_Int
   set_abstract0(a, r);
 }
 
+/*
+ * Class:     apron_Abstract0
+ * Method:    init
+ * Signature: (Lapron/Manager;II[D)V
+ */
+JNIEXPORT void JNICALL Java_apron_Abstract0_init__Lapron_Manager_2II_3D
+  (JNIEnv *env, jobject a, jobject m, jint i, jint j, jdoubleArray ar)
+{
+  check_nonnull(a,);
+  check_nonnull(m,);
+  check_positive(i,);
+  check_positive(j,);
+  check_nonnull(ar,);
+  ap_manager_t* man = as_manager(m);
+  size_t nb;
+  ap_interval_t** t = japron_interval_array_alloc_set_double(env, &nb, ar);
+  if (!t) return;
+  if (nb!=(size_t)i+j) {
+    ap_interval_array_free(t, nb);
+    illegal_argument("invalid array size");
+    return;
+  }
+  ap_abstract0_t* r = ap_abstract0_of_box(man, i, j, t);
+  ap_interval_array_free(t, nb);
+  check_exc( { if (r) ap_abstract0_free(man, r); return; } );
+  set_abstract0(a, r);
+}
+
 /*
  * Class:     apron_Abstract0
  * Method:    getSize
@@ -280,6 +308,46 @@ JNIEXPORT jobjectArray JNICALL Java_apron_Abstract0_toBox
   return rr;
 }
 
+/*
+ * Class:     apron_Abstract0
+ * Method:    toLinconsDouble
+ * Signature: (Lapron/Manager;)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_apron_Abstract0_toLinconsDouble
+  (JNIEnv *env, jobject a, jobject m)
+{
+  check_nonnull(a,NULL);
+  check_nonnull(m,NULL);
+  ap_manager_t* man = as_manager(m);
+  ap_dimension_t d = ap_abstract0_dimension(man, as_abstract0(a));
+  ap_lincons0_array_t t = ap_abstract0_to_lincons_array(man, as_abstract0(a));
+  check_exc( { ap_lincons0_array_clear(&t); return NULL; } );
+  jdoubleArray rr = 
+    japron_lincons0_array_get_double(env, &t, d.intdim + d.realdim);
+  ap_lincons0_array_clear(&t);
+  return rr;
+}
+
+/*
+ * Class:     apron_Abstract0
+ * Method:    toBoxDouble
+ * Signature: (Lapron/Manager;)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_apron_Abstract0_toBoxDouble
+  (JNIEnv *env, jobject a, jobject m)
+{
+  check_nonnull(a,NULL);
+  check_nonnull(m,NULL);
+  ap_manager_t* man = as_manager(m);
+  ap_dimension_t d = ap_abstract0_dimension(man, as_abstract0(a));
+  size_t nb = d.intdim + d.realdim;
+  ap_interval_t** t = ap_abstract0_to_box(man, as_abstract0(a));
+  check_exc( { if (t) ap_interval_array_free(t, nb); return NULL; } );
+  jdoubleArray rr = japron_interval_array_get_double(env, t, nb);
+  ap_interval_array_free(t, nb); 
+  return rr;
+}
+
 /*
  * Class:     apron_Abstract0
  * Method:    toGenerator
@@ -681,6 +749,54 @@ JNIEXPORT void JNICALL Java_apron_Abstract0_meet__Lapron_Manager_2_3Lapron_Tcons
   check_exc( { } );
 }
 
+/*
+ * Class:     apron_Abstract0
+ * Method:    meetCopy
+ * Signature: (Lapron/Manager;[D)Lapron/Abstract0;
+ */
+JNIEXPORT jobject JNICALL Java_apron_Abstract0_meetCopy__Lapron_Manager_2_3D
+  (JNIEnv *env, jobject a, jobject m, jdoubleArray ar)
+{
+  check_nonnull(a,NULL);
+  check_nonnull(m,NULL);
+  check_nonnull(ar,NULL);
+  ap_manager_t* man = as_manager(m);
+  ap_dimension_t d = ap_abstract0_dimension(man, as_abstract0(a));
+  ap_lincons0_array_t t;
+  if (!japron_lincons0_array_init_set_double(env, &t, ar, 
+                                             d.intdim + d.realdim))
+    return NULL;
+  ap_abstract0_t* r = 
+    ap_abstract0_meet_lincons_array(man, false, as_abstract0(a), &t);
+  ap_lincons0_array_clear(&t);
+  check_exc( { if (r) ap_abstract0_free(man, r); return NULL; } );
+  return japron_abstract0_get(env, man, r);
+}
+
+/*
+ * Class:     apron_Abstract0
+ * Method:    meet
+ * Signature: (Lapron/Manager;[D)V
+ */
+JNIEXPORT void JNICALL Java_apron_Abstract0_meet__Lapron_Manager_2_3D
+  (JNIEnv *env, jobject a, jobject m, jdoubleArray ar)
+{
+  check_nonnull(a,);
+  check_nonnull(m,);
+  check_nonnull(ar,);
+  ap_manager_t* man = as_manager(m);
+  ap_dimension_t d = ap_abstract0_dimension(man, as_abstract0(a));
+  ap_lincons0_array_t t;
+  if (!japron_lincons0_array_init_set_double(env, &t, ar, 
+                                             d.intdim + d.realdim))
+    return;
+  ap_abstract0_t* r = 
+    ap_abstract0_meet_lincons_array(man, true, as_abstract0(a), &t);
+  ap_lincons0_array_clear(&t);
+  set_abstract0(a, r);
+  check_exc( { } );
+}
+
 /*
  * Class:     apron_Abstract0
  * Method:    addRayCopy
@@ -1337,6 +1453,6 @@ JNIEXPORT jobject JNICALL Java_apron_Abstract0_deserialize
   jbyte* buf = (*env)->GetByteArrayElements(env, ar, 0);
   ap_abstract0_t* r = ap_abstract0_deserialize_raw(man, buf, &nb);  
   (*env)->ReleaseByteArrayElements(env, ar, buf, 0);
-  check_exc( { if (r) ap_abstract0_free(man, r); } );
+  check_exc( { if (r) ap_abstract0_free(man, r); return NULL; } );
   return japron_abstract0_get(env, man, r);
 }
@@ -41,6 +41,27 @@ JNIEXPORT void JNICALL Java_apron_Linexpr0_init__Lapron_Linexpr0_2
   set_linexpr0(o, ap_linexpr0_copy(as_linexpr0(oo)));
 }
 
+/*
+ * Class:     apron_Linexpr0
+ * Method:    init
+ * Signature: ([DD)V
+ */
+JNIEXPORT void JNICALL Java_apron_Linexpr0_init___3DD
+  (JNIEnv *env, jobject o, jdoubleArray ar, jdouble cst)
+{
+  check_nonnull(o,);
+  check_nonnull(ar,);
+  size_t i, nb = (*env)->GetArrayLength(env, ar);
+  jdouble* buf = (*env)->GetDoubleArrayElements(env, ar, 0);
+  if (!buf) return;
+  ap_linexpr0_t* e = ap_linexpr0_alloc(AP_LINEXPR_DENSE, nb);
+  for (i=0; i<nb; i++)
+    ap_coeff_set_scalar_double(&e->p.coeff[i], buf[i]);
+  ap_coeff_set_scalar_double(&e->cst, cst);
+  (*env)->ReleaseDoubleArrayElements(env, ar, buf, JNI_ABORT);
+  set_linexpr0(o, e);
+}
+
 /*
  * Class:     apron_Linexpr0
  * Method:    finalize
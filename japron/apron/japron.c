@@ -9,6 +9,7 @@
  */
 
 #include "japron.h"
+#include <math.h>
 
 
 /* Method, field & class cache */
@@ -752,6 +753,144 @@ ap_texpr0_t** japron_texpr0_array_alloc_set(JNIEnv *env, jobjectArray ar, size_t
 }
 
 
+/* Bulk arrays */
+/* ----------- */
+
+/*
+  Boxes and dense linear constraints can also be exchanged as flat arrays of
+  doubles, without one Java object per element:
+  - a box of nb intervals is an array of 2*nb doubles, holding in turn the
+  lower and upper bound of each interval (infinite bounds are infinite
+  doubles);
+  - a constraint over dim dimensions is a row of dim+2 doubles: its kind,
+  the coefficients of dimensions 0 to dim-1, and the constant coefficient.
+ */
+
+/* ap_scalar_t -> double, with rounding; returns 0 if exact */
+static int japron_double_set_scalar(double* d, ap_scalar_t* s, mp_rnd_t round)
+{
+  int inf = ap_scalar_infty(s);
+  if (inf) { *d = inf>0 ? INFINITY : -INFINITY; return 0; }
+  return ap_double_set_scalar(d, s, round);
+}
+
+/* double[] -> ap_interval_t** */
+ap_interval_t** japron_interval_array_alloc_set_double(JNIEnv *env, size_t* pnb, jdoubleArray o)
+{
+  check_nonnull(o,NULL);
+  size_t i, nb = (*env)->GetArrayLength(env, o);
+  if (nb%2) { illegal_argument("invalid array size"); return NULL; }
+  nb /= 2;
+  jdouble* buf = (*env)->GetDoubleArrayElements(env, o, 0);
+  if (!buf) return NULL;
+  ap_interval_t** t = ap_interval_array_alloc(nb);
+  *pnb = nb;
+  for (i=0; i<nb; i++) {
+    if (isnan(buf[2*i]) || isnan(buf[2*i+1])) {
+      (*env)->ReleaseDoubleArrayElements(env, o, buf, JNI_ABORT);
+      ap_interval_array_free(t, nb);
+      illegal_argument("NaN bound");
+      return NULL;
+    }
+    ap_interval_set_double(t[i], buf[2*i], buf[2*i+1]);
+  }
+  (*env)->ReleaseDoubleArrayElements(env, o, buf, JNI_ABORT);
+  return t;
+}
+
+/* ap_interval_t** -> double[], bounds rounded outward */
+jdoubleArray japron_interval_array_get_double(JNIEnv *env, ap_interval_t **t, size_t nb)
+{
+  check_nonnull(t,NULL);
+  jdoubleArray o = (*env)->NewDoubleArray(env, 2*nb);
+  if (!o) return NULL;
+  jdouble* buf = (*env)->GetDoubleArrayElements(env, o, 0);
+  if (!buf) return NULL;
+  size_t i;
+  for (i=0; i<nb; i++) {
+    japron_double_set_scalar(&buf[2*i], t[i]->inf, GMP_RNDD);
+    japron_double_set_scalar(&buf[2*i+1], t[i]->sup, GMP_RNDU);
+  }
+  (*env)->ReleaseDoubleArrayElements(env, o, buf, 0);
+  return o;
+}
+
+/* double[] -> ap_lincons0_array_t, with dense expressions of size dim
+   (to be freed with ap_lincons0_array_clear, as the expressions are owned) */
+int japron_lincons0_array_init_set_double(JNIEnv *env, ap_lincons0_array_t* t, jdoubleArray o, size_t dim)
+{
+  t->size = 0;
+  t->p = NULL;
+  check_nonnull(o,0);
+  size_t i, j, nb = (*env)->GetArrayLength(env, o);
+  if (nb%(dim+2)) { illegal_argument("invalid array size"); return 0; }
+  jdouble* buf = (*env)->GetDoubleArrayElements(env, o, 0);
+  if (!buf) return 0;
+  *t = ap_lincons0_array_make(nb/(dim+2));
+  for (i=0; i<t->size; i++) {
+    jdouble* row = buf + i*(dim+2);
+    /* check the kind as a double: converting it first is undefined if it
+       is out of range */
+    int ok = row[0]==AP_CONS_EQ || row[0]==AP_CONS_SUPEQ ||
+      row[0]==AP_CONS_SUP || row[0]==AP_CONS_DISEQ;
+    for (j=1; ok && j<dim+2; j++) ok = !isnan(row[j]);
+    if (!ok) {
+      (*env)->ReleaseDoubleArrayElements(env, o, buf, JNI_ABORT);
+      ap_lincons0_array_clear(t);
+      illegal_argument("invalid constraint");
+      return 0;
+    }
+    ap_linexpr0_t* e = ap_linexpr0_alloc(AP_LINEXPR_DENSE, dim);
+    for (j=0; j<dim; j++)
+      ap_coeff_set_scalar_double(&e->p.coeff[j], row[1+j]);
+    ap_coeff_set_scalar_double(&e->cst, row[1+dim]);
+    t->p[i] = ap_lincons0_make((ap_constyp_t)row[0], e, NULL);
+  }
+  (*env)->ReleaseDoubleArrayElements(env, o, buf, JNI_ABORT);
+  return 1;
+}
+
+/* ap_lincons0_t -> row of dim+2 doubles; returns 0 if the constraint cannot
+   be represented: modular, with interval or inexact coefficients (except the
+   constant of an inequality, rounded upward so that the row is implied) */
+static int japron_lincons0_set_double(double* row, ap_lincons0_t* c, size_t dim)
+{
+  ap_linexpr0_t* e = c->linexpr0;
+  ap_coeff_t* coeff;
+  ap_dim_t d;
+  size_t i;
+  if (c->constyp==AP_CONS_EQMOD) return 0;
+  row[0] = c->constyp;
+  for (i=0; i<dim; i++) row[1+i] = 0;
+  ap_linexpr0_ForeachLinterm(e, i, d, coeff) {
+    if (d>=dim || coeff->discr!=AP_COEFF_SCALAR ||
+        ap_scalar_infty(coeff->val.scalar) ||
+        ap_double_set_scalar(&row[1+d], coeff->val.scalar, GMP_RNDN))
+      return 0;
+  }
+  if (e->cst.discr!=AP_COEFF_SCALAR || ap_scalar_infty(e->cst.val.scalar))
+    return 0;
+  if (ap_double_set_scalar(&row[1+dim], e->cst.val.scalar, GMP_RNDU))
+    return c->constyp==AP_CONS_SUPEQ || c->constyp==AP_CONS_SUP;
+  return 1;
+}
+
+/* ap_lincons0_array_t -> double[], omitting the constraints that cannot be
+   represented (the result is still an over-approximation) */
+jdoubleArray japron_lincons0_array_get_double(JNIEnv *env, ap_lincons0_array_t* t, size_t dim)
+{
+  check_nonnull(t,NULL);
+  double* buf = (double*) malloc((t->size*(dim+2)+1)*sizeof(double));
+  size_t i, nb = 0;
+  for (i=0; i<t->size; i++)
+    if (japron_lincons0_set_double(buf + nb*(dim+2), &t->p[i], dim)) nb++;
+  jdoubleArray o = (*env)->NewDoubleArray(env, nb*(dim+2));
+  if (o) (*env)->SetDoubleArrayRegion(env, o, 0, nb*(dim+2), buf);
+  free(buf);
+  return o;
+}
+
+
 /* Manager */
 /* ------- */
 
@@ -169,6 +169,12 @@ void         japron_tcons0_array_clear    (ap_tcons0_array_t* t);
 int          japron_tcons0_array_init_set(JNIEnv *env, ap_tcons0_array_t* t, jobjectArray o);
 jobjectArray japron_tcons0_array_get     (JNIEnv *env, ap_tcons0_array_t* t);
 
+ap_interval_t** japron_interval_array_alloc_set_double(JNIEnv *env, size_t* pnb, jdoubleArray o);
+jdoubleArray    japron_interval_array_get_double      (JNIEnv *env, ap_interval_t **t, size_t nb);
+
+int          japron_lincons0_array_init_set_double(JNIEnv *env, ap_lincons0_array_t* t, jdoubleArray o, size_t dim);
+jdoubleArray japron_lincons0_array_get_double     (JNIEnv *env, ap_lincons0_array_t* t, size_t dim);
+
 ap_texpr0_t* japron_texpr0_alloc_set(JNIEnv *env, jobject o);
 jobject      japron_texpr0_get      (JNIEnv *env, ap_texpr0_t* t);
 
@@ -5,6 +5,7 @@
 /* This file is part of the APRON Library, released under LGPL license.
    Please read the COPYING file packaged in the distribution  */
 
+#include <math.h>
 #include "apron_caml.h"
 
 /* ********************************************************************** */
@@ -315,14 +316,17 @@ static
 unsigned long camlidl_apron_abstract0_deserialize(void * dst)
 {
   if (deserialize_man) {
-    size_t size = deserialize_uint_8(), realsize;
+    size_t size = deserialize_uint_8(), realsize = size;
     void* data;
+    ap_abstract0_ptr a;
     data = malloc(size);
     assert(data);
     deserialize_block_1(data,size);
-    *((ap_abstract0_ptr*)dst) =
-      ap_abstract0_deserialize_raw(deserialize_man,data,&realsize);
+    a = ap_abstract0_deserialize_raw(deserialize_man,data,&realsize);
     free(data);
+    if (a==NULL)
+      caml_failwith("invalid serialized abstract element.");
+    *((ap_abstract0_ptr*)dst) = a;
   }
   else caml_failwith("you must call Apron.Manager.set_deserialize before deserializing abstract elements.");
   return sizeof(ap_abstract0_ptr);
@@ -337,6 +341,135 @@ struct custom_operations camlidl_apron_custom_abstract0_ptr = {
   camlidl_apron_abstract0_deserialize
 };
 
+/* ********************************************************************** */
+/* abstract0: bigarray conversions */
+/* ********************************************************************** */
+
+/* Boxes and dense linear constraints are exchanged as float64 bigarrays,
+   filled or read in one call, without allocating one OCaml value per
+   bound or coefficient. */
+
+static
+double camlidl_apron_double_of_scalar(ap_scalar_t* scalar, mp_rnd_t round)
+{
+  double d;
+  int inf = ap_scalar_infty(scalar);
+  if (inf) return inf>0 ? INFINITY : -INFINITY;
+  ap_double_set_scalar(&d,scalar,round);
+  return d;
+}
+
+/* Bounds of a, as a (n,2) bigarray, rounded outward */
+value camlidl_apron_abstract0_to_box_bigarray(value vman, value va)
+{
+  CAMLparam2(vman,va);
+  CAMLlocal1(vres);
+  ap_manager_ptr man;
+  ap_abstract0_ptr a;
+  ap_dimension_t dim;
+  ap_interval_t** tinterval;
+  intnat dims[2];
+  double* p;
+  size_t i,nbdims;
+
+  camlidl_apron_manager_ptr_ml2c(vman,&man);
+  camlidl_apron_abstract0_ptr_ml2c(va,&a);
+  dim = ap_abstract0_dimension(man,a);
+  nbdims = dim.intdim+dim.realdim;
+  dims[0] = nbdims;
+  dims[1] = 2;
+  vres = caml_ba_alloc(CAML_BA_FLOAT64 | CAML_BA_C_LAYOUT, 2, NULL, dims);
+  p = (double*)Caml_ba_data_val(vres);
+  tinterval = ap_abstract0_to_box(man,a);
+  if (man->result.exn!=AP_EXC_NONE){
+    if (tinterval) ap_interval_array_free(tinterval,nbdims);
+    camlidl_apron_manager_check_exception(man,NULL);
+  }
+  for (i=0; i<nbdims; i++){
+    p[2*i] = camlidl_apron_double_of_scalar(tinterval[i]->inf,GMP_RNDD);
+    p[2*i+1] = camlidl_apron_double_of_scalar(tinterval[i]->sup,GMP_RNDU);
+  }
+  if (tinterval) ap_interval_array_free(tinterval,nbdims);
+  CAMLreturn(vres);
+}
+
+/* Meet of a with the constraints of types vtyp and of coefficients the rows
+   of the (m,n+1) bigarray vmat (the last column holds the constants) */
+static
+value camlidl_apron_abstract0_meet_lincons_bigarray_aux(value vman, value va,
+							value vtyp, value vmat,
+							bool destructive)
+{
+  CAMLparam4(vman,va,vtyp,vmat);
+  CAMLlocal1(vres);
+  ap_manager_ptr man;
+  ap_abstract0_ptr a,res;
+  ap_dimension_t dim;
+  ap_lincons0_array_t array;
+  ap_scalar_t scalar;
+  struct caml_ba_array* ba;
+  double* p;
+  size_t i,j,nbdims,nbcons;
+
+  camlidl_apron_manager_ptr_ml2c(vman,&man);
+  camlidl_apron_abstract0_ptr_ml2c(va,&a);
+  dim = ap_abstract0_dimension(man,a);
+  nbdims = dim.intdim+dim.realdim;
+  nbcons = Wosize_val(vtyp);
+  ba = Caml_ba_array_val(vmat);
+  if (ba->num_dims!=2 ||
+      (size_t)ba->dim[0]!=nbcons || (size_t)ba->dim[1]!=nbdims+1)
+    caml_invalid_argument("Abstract0.meet_lincons_bigarray: the matrix must have one row per constraint type and one column per dimension, plus one");
+  p = (double*)ba->data;
+  for (i=0; i<nbcons*(nbdims+1); i++){
+    if (isnan(p[i]))
+      caml_invalid_argument("Abstract0.meet_lincons_bigarray: NaN coefficient");
+  }
+  array = ap_lincons0_array_make(nbcons);
+  for (i=0; i<nbcons; i++){
+    ap_linexpr0_t* e = ap_linexpr0_alloc(AP_LINEXPR_DENSE,nbdims);
+    value vt = Field(vtyp,i);
+    for (j=0; j<nbdims; j++)
+      ap_coeff_set_scalar_double(&e->p.coeff[j],p[i*(nbdims+1)+j]);
+    ap_coeff_set_scalar_double(&e->cst,p[i*(nbdims+1)+nbdims]);
+    array.p[i].linexpr0 = e;
+    if (Is_long(vt)){
+      /* EQ, SUPEQ, SUP, DISEQ */
+      array.p[i].constyp = Int_val(vt)==3 ? AP_CONS_DISEQ : Int_val(vt);
+    }
+    else {
+      /* EQMOD of Scalar.t: the scalar refers to OCaml data, copy it */
+      array.p[i].constyp = AP_CONS_EQMOD;
+      camlidl_apron_scalar_ml2c(Field(vt,0),&scalar);
+      array.p[i].scalar = ap_scalar_alloc_set(&scalar);
+    }
+  }
+  res = ap_abstract0_meet_lincons_array(man,destructive,a,&array);
+  ap_lincons0_array_clear(&array);
+  if (destructive){
+    *((ap_abstract0_ptr *) Data_custom_val(va)) = res;
+    vres = Val_unit;
+  }
+  else {
+    vres = camlidl_apron_abstract0_ptr_c2ml(&res);
+  }
+  if (man->result.exn!=AP_EXC_NONE)
+    camlidl_apron_manager_check_exception(man,NULL);
+  CAMLreturn(vres);
+}
+value camlidl_apron_abstract0_meet_lincons_bigarray(value vman, value va,
+						    value vtyp, value vmat)
+{
+  return camlidl_apron_abstract0_meet_lincons_bigarray_aux(vman,va,vtyp,vmat,
+							   false);
+}
+value camlidl_apron_abstract0_meet_lincons_bigarray_with(value vman, value va,
+							 value vtyp, value vmat)
+{
+  return camlidl_apron_abstract0_meet_lincons_bigarray_aux(vman,va,vtyp,vmat,
+							   true);
+}
+
 /* ********************************************************************** */
 /* variable */
 /* ********************************************************************** */
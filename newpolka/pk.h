@@ -80,6 +80,26 @@ void pk_set_max_coeff_size(pk_internal_t* pk, size_t size);
 void pk_set_approximate_max_coeff_size(pk_internal_t* pk, size_t size);
 size_t pk_get_max_coeff_size(pk_internal_t* pk);
 size_t pk_get_approximate_max_coeff_size(pk_internal_t* pk);
+void pk_set_constraint_only(pk_internal_t* pk, bool flag);
+bool pk_get_constraint_only(pk_internal_t* pk);
+  /* In constraint-only mode, meets are lazy, and a polyhedron represented
+     only by its constraints is not converted to generators for emptiness,
+     inclusion, equality and satisfaction tests, for bounding linear
+     expressions with scalar coefficients and dimensions, and for
+     minimization (pk_minimize then removes redundant constraints). These
+     operations are answered by an exact rational simplex instead, which
+     avoids the exponential size of generators in high dimension with few
+     constraints. The other operations compute generators when needed. */
+void pk_set_cache_size(pk_internal_t* pk, size_t size);
+size_t pk_get_cache_size(pk_internal_t* pk);
+  /* Number of entries of the cache of the results of pk_is_leq and
+     pk_is_eq, which are indexed by the fingerprints of the arguments (see
+     pk_hash). 0, the default, disables the cache; setting the size clears
+     the cache. When the cache is enabled, the arguments of these tests are
+     put in canonical form, and an entry is reused only if the canonical
+     constraints of the arguments are equal to the recorded ones. This is
+     intended for fixpoint computations that repeatedly compare the same
+     polyhedra. */
 void pk_print(ap_manager_t* man, pk_t* po, char** name_of_dim);
 
 /* ============================================================ */
@@ -144,6 +164,9 @@ int pk_hash(ap_manager_t* man, pk_t* a);
      canonical from (according to @code{ap_abstract1_canonicalize}) and
      considered as equal by the function ap_abstract0_is_eq are given the
      same hash value (this implies more or less a canonical form).
+
+     The value is put in canonical form, and all its constraints are hashed
+     independently of their order.
   */
 
 void pk_approximate(ap_manager_t* man, pk_t* a, int algorithm);
@@ -203,12 +226,18 @@ ap_membuf_t pk_serialize_raw(ap_manager_t* man, pk_t* a);
    binary format to it and return a pointer on the memory buffer and the size
    of bytes written.  It is the user responsability to free the memory
    afterwards (with free).
-   Not implemented */
+   The current representation is stored as is, including saturation
+   matrices, so that a minimized polyhedron needs no conversion after being
+   read back. The format does not depend on the underlying numbers. */
 
 pk_t* pk_deserialize_raw(ap_manager_t* man, void* ptr, size_t* size);
-/* Return the abstract value read in raw binary format from the input stream
-   and store in size the number of bytes read
-   Not implemented */
+/* Return the abstract value read in raw binary format from the buffer ptr,
+   whose size in bytes is given in *size, and store in *size the number of
+   bytes read.
+   Return NULL and raise AP_EXC_INVALID_ARGUMENT if the buffer is truncated
+   or malformed, or if the polyhedron was serialized with a manager of
+   another mode (strict/loose), and AP_EXC_OVERFLOW if a coefficient does not
+   fit in the underlying numbers. */
 
 /* ********************************************************************** */
 /* II. Constructor, accessors, tests and property extraction */
@@ -360,7 +389,16 @@ pk_t* pk_join(ap_manager_t* man, bool destructive, pk_t* a1, pk_t* a2);
 
 pk_t* pk_meet_array(ap_manager_t* man, pk_t** tab, size_t size);
 pk_t* pk_join_array(ap_manager_t* man, pk_t** tab, size_t size);
-  /* Meet and Join of a non empty array of abstract values. */
+  /* Meet and Join of a non empty array of abstract values.
+
+     For pk_join_array:
+     algorithm > 1: the array is split into at most algorithm parts (bounded
+		    by the number of processors), which are joined
+		    concurrently, each one with a clone of the manager (see
+		    ap_manager_clone_for_thread), and the results are joined
+		    pairwise along a balanced tree
+     algorithm = 0 or 1: a single conversion of all the generators
+     algorithm < 0: in addition, lazy behaviour */
 
 pk_t* pk_meet_lincons_array(ap_manager_t* man,
 			    bool destructive, pk_t* a,
@@ -369,6 +407,10 @@ pk_t* pk_meet_tcons_array(ap_manager_t* man,
 			  bool destructive, pk_t* a,
 			  ap_tcons0_array_t* array);
   /* Meet of an abstract value with a set of constraints. */
+pk_t* pk_meet_linpack0(ap_manager_t* man,
+		       bool destructive, pk_t* a,
+		       ap_linpack0_t* pack);
+  /* Same as pk_meet_lincons_array, with constraints given as a pack */
 
 pk_t* pk_add_ray_array(ap_manager_t* man,
 		       bool destructive, pk_t* a,
@@ -385,6 +427,13 @@ pk_t* pk_assign_linexpr_array(ap_manager_t* man,
 			      ap_linexpr0_t** texpr,
 			      size_t size,
 			      pk_t* dest);
+pk_t* pk_assign_linpack0(ap_manager_t* man,
+			 bool destructive, pk_t* a,
+			 ap_dim_t* tdim,
+			 ap_linpack0_t* pack,
+			 pk_t* dest);
+  /* Same as pk_assign_linexpr_array, with the pack->size expressions given
+     as a pack */
 pk_t* pk_substitute_linexpr_array(ap_manager_t* man,
 				  bool destructive, pk_t* a,
 				  ap_dim_t* tdim,
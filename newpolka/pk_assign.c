@@ -443,12 +443,16 @@ void vector_invert_expr(pk_internal_t* pk,
 /* Assignement/Substitution by several *deterministic* linear expressions */
 /* ====================================================================== */
 
-pk_t* poly_asssub_linexpr_array_det(bool assign,
-				    ap_manager_t* man,
-				    bool destructive,
-				    pk_t* pa,
-				    ap_dim_t* tdim, ap_linexpr0_t** texpr,
-				    size_t size)
+/* The expressions are taken either from texpr, or if texpr==NULL, from the
+   rows of pack */
+static
+pk_t* poly_asssub_rows_det(bool assign,
+			   ap_manager_t* man,
+			   bool destructive,
+			   pk_t* pa,
+			   ap_dim_t* tdim,
+			   ap_linexpr0_t** texpr, ap_linpack0_t* pack,
+			   size_t size)
 {
   size_t i;
   ap_dim_t* tdim2;
@@ -468,7 +472,7 @@ pk_t* poly_asssub_linexpr_array_det(bool assign,
     pk->exn = AP_EXC_NONE;
     man->result.flag_best = man->result.flag_exact = false;
     poly_set_top(pk,po);
-    goto _poly_asssub_linexpr_array_det_exit;
+    goto _poly_asssub_rows_det_exit;
   }
   /* Return empty if empty */
   if (!pa->C && !pa->F){
@@ -481,9 +485,14 @@ pk_t* poly_asssub_linexpr_array_det(bool assign,
   tvec = (numint_t**)malloc(size*sizeof(numint_t*));
   for (i=0; i<size; i++){
     tvec[i] = vector_alloc(nbcols);
-    itv_linexpr_set_ap_linexpr0(pk->itv,
-				&pk->poly_itv_linexpr,
-				texpr[i]);
+    if (texpr)
+      itv_linexpr_set_ap_linexpr0(pk->itv,
+				  &pk->poly_itv_linexpr,
+				  texpr[i]);
+    else
+      itv_linexpr_set_ap_linpack0(pk->itv,
+				  &pk->poly_itv_linexpr,
+				  pack,i);
     vector_set_itv_linexpr(pk,
 			   tvec[i],
 			   &pk->poly_itv_linexpr,
@@ -511,7 +520,7 @@ pk_t* poly_asssub_linexpr_array_det(bool assign,
   }
   po->F = mat;
   po->status = 0;
- _poly_asssub_linexpr_array_det_exit:
+ _poly_asssub_rows_det_exit:
   if (!assign){
     poly_dual(pa);
     if (!destructive) poly_dual(po);
@@ -520,16 +529,39 @@ pk_t* poly_asssub_linexpr_array_det(bool assign,
   return po;
 }
 
+pk_t* poly_asssub_linexpr_array_det(bool assign,
+				    ap_manager_t* man,
+				    bool destructive,
+				    pk_t* pa,
+				    ap_dim_t* tdim, ap_linexpr0_t** texpr,
+				    size_t size)
+{
+  return poly_asssub_rows_det(assign,man,destructive,pa,tdim,texpr,NULL,size);
+}
+
 /* ====================================================================== */
 /* Assignement/Substitution by an array of linear expressions */
 /* ====================================================================== */
+
+/* Does the row involve only real dimensions ? (terms are sorted) */
+static inline
+bool ap_linpack0_row_is_real(ap_linpack0_t* pack, size_t row, size_t intdim)
+{
+  return
+    pack->start[row]==pack->start[row+1] ||
+    pack->dim[pack->start[row]] >= intdim;
+}
+
+/* The expressions are taken either from texpr, or if texpr==NULL, from the
+   rows of pack, which should then be linear */
 static
 pk_t* poly_asssub_linexpr_array(bool assign,
 				bool lazy,
 				ap_manager_t* man,
 				bool destructive,
 				pk_t* pa,
-				ap_dim_t* tdim, ap_linexpr0_t** texpr, size_t size,
+				ap_dim_t* tdim, ap_linexpr0_t** texpr,
+				ap_linpack0_t* pack, size_t size,
 				pk_t* pb)
 {
   pk_t* po;
@@ -555,8 +587,8 @@ pk_t* poly_asssub_linexpr_array(bool assign,
     return destructive ? pa : pk_bottom(man,pa->intdim,pa->realdim);
   }
   /* Choose the right technique */
-  if (ap_linexpr0_array_is_linear(texpr,size)){
-    po = poly_asssub_linexpr_array_det(assign,man,destructive,pa,tdim,texpr,size);
+  if (texpr==NULL || ap_linexpr0_array_is_linear(texpr,size)){
+    po = poly_asssub_rows_det(assign,man,destructive,pa,tdim,texpr,pack,size);
     if (pb){
       poly_meet(true,lazy,man,po,po,pb);
     }
@@ -579,7 +611,10 @@ pk_t* poly_asssub_linexpr_array(bool assign,
     size_t i;
     man->result.flag_best = true;
     for (i=0;i<size;i++){
-      if (tdim[i] < pa->intdim || !ap_linexpr0_is_real(texpr[i], pa->intdim)){
+      if (tdim[i] < pa->intdim ||
+	  !(texpr ?
+	    ap_linexpr0_is_real(texpr[i], pa->intdim) :
+	    ap_linpack0_row_is_real(pack, i, pa->intdim))){
 	man->result.flag_best = false;
 	break;
       }
@@ -850,7 +885,7 @@ pk_t* pk_assign_linexpr_array(ap_manager_t* man,
     :
     poly_asssub_linexpr_array(true,
 			      pk->funopt->algorithm<=0,
-			      man,destructive,pa,tdim,texpr,size,pb);
+			      man,destructive,pa,tdim,texpr,NULL,size,pb);
   assert(poly_check(pk,po));
   return po;
 }
@@ -871,7 +906,29 @@ pk_t* pk_substitute_linexpr_array(ap_manager_t* man,
     :
     poly_asssub_linexpr_array(false,
 			      pk->funopt->algorithm<=0,
-			      man,destructive,pa,tdim,texpr,size,pb);
+			      man,destructive,pa,tdim,texpr,NULL,size,pb);
+  assert(poly_check(pk,po));
+  return po;
+}
+
+pk_t* pk_assign_linpack0(ap_manager_t* man,
+			 bool destructive, pk_t* pa,
+			 ap_dim_t* tdim, ap_linpack0_t* pack,
+			 pk_t* pb)
+{
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_ASSIGN_LINEXPR_ARRAY);
+  pk_t* po;
+  if (ap_linpack0_is_linear(pack)){
+    po = poly_asssub_linexpr_array(true,
+				   pk->funopt->algorithm<=0,
+				   man,destructive,pa,tdim,NULL,pack,pack->size,pb);
+  }
+  else {
+    /* go through the generic (interval) version */
+    ap_linexpr0_t** texpr = ap_linexpr0_array_of_linpack0(pack);
+    po = pk_assign_linexpr_array(man,destructive,pa,tdim,texpr,pack->size,pb);
+    ap_linexpr0_array_free(texpr,pack->size);
+  }
   assert(poly_check(pk,po));
   return po;
 }
@@ -79,6 +79,11 @@ bool cherni_checksat(pk_internal_t* pk,
       }
     }
     rank = cherni_gauss(pk,mat,nb);
+    if (pk->exn){
+      /* overflow: the ray cannot be checked */
+      pk->exn = AP_EXC_NONE;
+      continue;
+    }
     if (!( (numint_sgn(F->p[i][0])==0 && nb == C->nbrows)
 	   || (rank==nbcols-2-nblines && nb >= rank))){
       printf("cherni_checksat con_to_ray=%d: wrong ray %lu; expected = %lu, effective = (%lu<=%lu)\n",
@@ -102,6 +107,11 @@ bool cherni_checksat(pk_internal_t* pk,
       }
     }
     rank = cherni_gauss(pk,mat,nb);
+    if (pk->exn){
+      /* overflow: the constraint cannot be checked */
+      pk->exn = AP_EXC_NONE;
+      continue;
+    }
     if (!( (numint_sgn(C->p[j.index][0])==0 && nb == F->nbrows)
 	   || (rank==nbcols-2-nbequations && nb >= rank))){
       printf("cherni_checksat con_to_ray=%d: wrong con %lu; expected = %lu, effective = (%lu<=%lu)\n",
@@ -185,6 +195,10 @@ size_t cherni_conversion(pk_internal_t* pk,
   k = bitindex_init(start);
   while (k.index < con->nbrows){
     /* Iteration sur les contraintes */
+    if (pk->man && ap_manager_timeout(pk->man)){
+      pk->exn = AP_EXC_TIMEOUT;
+      goto cherni_conversion_exit0;
+    }
     is_inequality = numint_sgn(con->p[k.index][0]);
 
     /* Scalar product and index: */
@@ -537,6 +551,16 @@ int cherni_simplify(pk_internal_t* pk,
   }
   /* remove redundant equalities and update nbeq */
   rank = cherni_gauss(pk,con, nbeq); /* gauss pivot to simplify equalities */
+#if defined(PK_NUMINT_CHECKED)
+  if (pk->exn){
+    /* A combination does not fit: rows are unchanged or exact combinations,
+       so we just restore the status coefficients */
+    for (i=nbeq; i<nbcons; i++){
+      numint_set_int(con->p[i][0],1);
+    }
+    return nbeq;
+  }
+#endif
   pk->exn = AP_EXC_NONE;
 
   /* remove redundants equations, located between rank and nbeq */
@@ -621,7 +645,9 @@ int cherni_simplify(pk_internal_t* pk,
 
   /* back substitution of remaining constraints */
   cherni_backsubstitute(pk, con, nbeq);
+#if !defined(PK_NUMINT_CHECKED)
   pk->exn = AP_EXC_NONE;
+#endif
 
   return nbeq;
 }
@@ -717,6 +743,15 @@ void cherni_minimize(pk_internal_t* pk,
     po->satF = satmat_transpose(satC,C->nbrows);
     satmat_free(satC);      
     po->nbeq = cherni_simplify(pk,C,F,po->satF,po->nbline);
+    if (pk->exn){
+      /* overflow during simplification, C is still valid */
+      matrix_free(F);
+      satmat_free(po->satF);
+      po->F = NULL;
+      po->satF = NULL;
+      po->nbeq = po->nbline = 0;
+      return;
+    }
     if (F->_maxrows > 3*F->nbrows/2){
       matrix_resize_rows(F,F->nbrows);
       satmat_resize_cols(po->satF,bitindex_size(F->nbrows));
@@ -804,6 +839,15 @@ void cherni_add_and_minimize(pk_internal_t* pk,
     satmat_free(satC);
     po->satC = NULL;
     po->nbeq = cherni_simplify(pk,C,F,po->satF,po->nbline);
+    if (pk->exn){
+      /* overflow during simplification, C is still valid */
+      matrix_free(F);
+      satmat_free(po->satF);
+      po->F = NULL;
+      po->satF = NULL;
+      po->nbeq = po->nbline = 0;
+      return;
+    }
     if (F->_maxrows > 3*F->nbrows/2){
       matrix_resize_rows(F,F->nbrows);
       satmat_resize_cols(po->satF,bitindex_size(F->nbrows));
@@ -824,6 +868,7 @@ void cherni_buildsatline(pk_internal_t* pk,
 			 bitstring_t* satline)
 {
   bitindex_t jx = bitindex_init(0);
+  ap_exc_t exn = pk->exn;
   while (jx.index<con->nbrows){
     vector_product(pk,pk->cherni_prod,
 		   con->p[jx.index],
@@ -831,6 +876,9 @@ void cherni_buildsatline(pk_internal_t* pk,
     if (numint_sgn(pk->cherni_prod)) bitstring_set(satline,jx);
     bitindex_inc(&jx);
   }
+  /* only the sign of the products is used, which is right even if they
+     overflow */
+  pk->exn = exn;
 }
 
 /* ********************************************************************** */
@@ -34,6 +34,19 @@ static const bool false = 0;
 static const bool true  = 1;
 #endif
 
+/* PK_NUMINT_CHECKED selects, for native integers, the overflow-checked
+   versions of the vector kernels (see pk_vector.c). It is the
+   checked-overflow build libpolkaRllChecked: coefficients stay native, and
+   results that do not fit raise AP_EXC_OVERFLOW (see README). */
+#if defined(PK_NUMINT_CHECKED)
+#if !defined(NUMINT_NATIVE)
+#error "PK_NUMINT_CHECKED requires native integers"
+#endif
+#if !defined(__GNUC__)
+#error "PK_NUMINT_CHECKED requires __builtin_mul_overflow and __builtin_add_overflow"
+#endif
+#endif
+
 /* Extension to the num package */
 /* size in words */
 static inline size_t numint_size(numint_t a)
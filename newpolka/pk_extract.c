@@ -12,7 +12,9 @@
 #include "pk.h"
 #include "pk_user.h"
 #include "pk_representation.h"
+#include "pk_constructor.h"
 #include "pk_extract.h"
+#include "pk_lp.h"
 #include "ap_generic.h"
 #include "itv_linearize.h"
 
@@ -266,25 +268,24 @@ ap_interval_t* pk_bound_dimension(ap_manager_t* man,
 
   interval = ap_interval_alloc();
   ap_interval_reinit(interval,AP_SCALAR_MPQ);
-  if (pk->funopt->algorithm>0)
-    poly_chernikova(man,po,NULL);
-  else
-    poly_obtain_F(man,po,NULL);
-
+  poly_obtain_F_or_lp(man,po,NULL);
   if (pk->exn){
     pk->exn = AP_EXC_NONE;
     ap_interval_set_top(interval);
     return interval;
   }
 
-  if (!po->F){ /* po is empty */
+  if (!po->C && !po->F){ /* po is empty */
     ap_interval_set_bottom(interval);
     man->result.flag_exact = man->result.flag_best = true;
     return interval;
   }
 
   itv_init(itv);
-  matrix_bound_dimension(pk,itv,dim,po->F);
+  if (po->F)
+    matrix_bound_dimension(pk,itv,dim,po->F);
+  else
+    lp_bound_dimension(pk,itv,dim,po->C);
   ap_interval_set_itv(pk->itv,interval, itv);
   itv_clear(itv);
   man->result.flag_exact = man->result.flag_best = 
@@ -308,7 +309,14 @@ ap_interval_t* pk_bound_linexpr(ap_manager_t* man,
 
   interval = ap_interval_alloc();
   ap_interval_reinit(interval,AP_SCALAR_MPQ);
-  if (pk->funopt->algorithm>0)
+  /* we fill the vector with the expression, taking lower bound of the interval
+     constant */
+  exact = itv_linexpr_set_ap_linexpr0(pk->itv,
+				      &pk->poly_itv_linexpr,
+				      expr);
+  if (itv_linexpr_is_scalar(&pk->poly_itv_linexpr))
+    poly_obtain_F_or_lp(man,po,NULL);
+  else if (pk->funopt->algorithm>0)
     poly_chernikova(man,po,NULL);
   else
     poly_obtain_F(man,po,NULL);
@@ -319,19 +327,17 @@ ap_interval_t* pk_bound_linexpr(ap_manager_t* man,
     return interval;
   }
 
-  if (!po->F){ /* po is empty */
+  if (!po->C && !po->F){ /* po is empty */
     ap_interval_set_bottom(interval);
     man->result.flag_exact = man->result.flag_best = true;
     return interval;
   }
-  
-  /* we fill the vector with the expression, taking lower bound of the interval
-     constant */
-  exact = itv_linexpr_set_ap_linexpr0(pk->itv,
-				      &pk->poly_itv_linexpr,
-				      expr);
+
   itv_init(itv);
-  matrix_bound_itv_linexpr(pk,itv,&pk->poly_itv_linexpr,po->F);
+  if (po->F)
+    matrix_bound_itv_linexpr(pk,itv,&pk->poly_itv_linexpr,po->F);
+  else
+    lp_bound_itv_linexpr(pk,itv,&pk->poly_itv_linexpr,po->C);
   ap_interval_set_itv(pk->itv,interval,itv);
   itv_clear(itv);
   
@@ -400,7 +406,15 @@ ap_lincons0_array_t pk_to_lincons_array(ap_manager_t* man,
 
   man->result.flag_exact = man->result.flag_best = true;
 
-  poly_chernikova3(man,po,NULL);
+  if (poly_is_constraint_only(pk,po)){
+    /* remove redundant constraints by linear programming */
+    if (lp_is_empty(pk,po->C))
+      poly_set_bottom(pk,po);
+    else if (lp_remove_redundant(pk,po->C))
+      po->status &= ~pk_status_minimaleps;
+  }
+  else
+    poly_chernikova3(man,po,NULL);
   if (pk->exn){
     pk->exn = AP_EXC_NONE;
     man->result.flag_exact = man->result.flag_best = false;
@@ -412,7 +426,7 @@ ap_lincons0_array_t pk_to_lincons_array(ap_manager_t* man,
     array.p[0] = ap_lincons0_make_unsat();
     return array;
   }
-  poly_obtain_sorted_C(pk,po);
+  if (po->F) poly_obtain_sorted_C(pk,po);
   C = po->C;
   array = ap_lincons0_array_make(C->nbrows);
   for (i=0,k=0; i<C->nbrows; i++){
@@ -445,7 +459,11 @@ ap_interval_t** pk_to_box(ap_manager_t* man,
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_TO_BOX);
 
   dim = po->intdim + po->realdim;
-  if (pk->funopt->algorithm>=0)
+  if (poly_is_constraint_only(pk,po)){
+    if (lp_is_empty(pk,po->C))
+      poly_set_bottom(pk,po);
+  }
+  else if (pk->funopt->algorithm>=0)
     poly_chernikova(man,po,NULL);
   else
     poly_obtain_F(man,po,NULL);
@@ -460,13 +478,13 @@ ap_interval_t** pk_to_box(ap_manager_t* man,
     return interval;
   }
   interval = ap_interval_array_alloc(dim);
-  if (!po->F){
+  if (!po->C && !po->F){
     for (i=0; i<dim; i++){
       ap_interval_set_bottom(interval[i]);
     }
   }
   else {
-    titv = matrix_to_box(pk,po->F);
+    titv = po->F ? matrix_to_box(pk,po->F) : lp_to_box(pk,po->C);
     for (i=0; i<dim; i++){
       ap_interval_set_itv(pk->itv,interval[i],titv[i]);
     }
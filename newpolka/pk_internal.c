@@ -30,6 +30,11 @@ void pk_internal_init(pk_internal_t* pk, size_t maxdims)
   pk->vector_mpqp = malloc( (maxdims+3)*sizeof(mpq_t));
   for (i=0; i<maxdims+3; i++)
     mpq_init(pk->vector_mpqp[i]);
+#if defined(PK_NUMINT_CHECKED)
+  pk->vector_mpzp = malloc(pk->maxcols*sizeof(mpz_t));
+  for (i=0; i<pk->maxcols; i++)
+    mpz_init(pk->vector_mpzp[i]);
+#endif
 
   pk->vector_tmp = vector_alloc(5);
 
@@ -66,6 +71,10 @@ pk_internal_t* pk_internal_alloc(bool strict)
   pk->dec = strict ? 3 : 2;
   pk->max_coeff_size = 0;
   pk->approximate_max_coeff_size = 2;
+  pk->constraint_only = false;
+  pk->cache = NULL;
+  pk->cache_size = 0;
+  pk->man = NULL;
 
   pk_internal_init(pk,10);
 
@@ -89,6 +98,14 @@ void pk_internal_clear(pk_internal_t* pk)
     free(pk->vector_mpqp);
   }
   pk->vector_mpqp = 0;
+#if defined(PK_NUMINT_CHECKED)
+  if (pk->vector_mpzp){
+    for (i=0; i<pk->maxcols; i++)
+      mpz_clear(pk->vector_mpzp[i]);
+    free(pk->vector_mpzp);
+  }
+  pk->vector_mpzp = 0;
+#endif
 
   if (pk->matrix_dimp) free(pk->matrix_dimp);
   pk->matrix_dimp = 0;
@@ -140,6 +157,7 @@ void pk_internal_clear(pk_internal_t* pk)
 /* Clear and free pk */
 void pk_internal_free(pk_internal_t* pk)
 {
+  pk_set_cache_size(pk,0);
   pk_internal_clear(pk);
   free(pk);
 }
@@ -162,6 +180,22 @@ void pk_internal_realloc_lazy(pk_internal_t* pk, size_t maxdims)
   }
 }
 
+/* Allocates a fresh pk with the same options and size as pk,
+   for a clone of the manager */
+static void* pk_internal_clone(void* internal, ap_manager_t* man)
+{
+  pk_internal_t* pk = (pk_internal_t*)internal;
+  pk_internal_t* res = pk_internal_alloc(pk->strict);
+
+  res->max_coeff_size = pk->max_coeff_size;
+  res->approximate_max_coeff_size = pk->approximate_max_coeff_size;
+  res->constraint_only = pk->constraint_only;
+  pk_set_cache_size(res,pk->cache_size);
+  pk_internal_realloc_lazy(res,pk->maxdims);
+  res->man = man;
+  return res;
+}
+
 /* ********************************************************************** */
 /* II. Options */
 /* ********************************************************************** */
@@ -182,6 +216,32 @@ size_t pk_get_max_coeff_size(pk_internal_t* pk){
 size_t pk_get_approximate_max_coeff_size(pk_internal_t* pk){
   return pk->approximate_max_coeff_size;
 }
+void pk_set_constraint_only(pk_internal_t* pk, bool flag){
+  pk->constraint_only = flag;
+}
+bool pk_get_constraint_only(pk_internal_t* pk){
+  return pk->constraint_only;
+}
+void pk_set_cache_size(pk_internal_t* pk, size_t size){
+  size_t i;
+  for (i=0; i<pk->cache_size; i++){
+    if (pk->cache[i].Ca) matrix_free(pk->cache[i].Ca);
+    if (pk->cache[i].Cb) matrix_free(pk->cache[i].Cb);
+  }
+  free(pk->cache);
+  pk->cache = NULL;
+  pk->cache_size = size;
+  if (size>0){
+    pk->cache = (pk_cache_entry_t*)malloc(size*sizeof(pk_cache_entry_t));
+    for (i=0; i<size; i++){
+      pk->cache[i].funid = AP_FUNID_UNKNOWN;
+      pk->cache[i].Ca = pk->cache[i].Cb = NULL;
+    }
+  }
+}
+size_t pk_get_cache_size(pk_internal_t* pk){
+  return pk->cache_size;
+}
 
 /* ********************************************************************** */
 /* III. Initialization from manager */
@@ -207,6 +267,8 @@ ap_manager_t* pk_manager_alloc(bool strict)
 #error "here"
 #endif
 		      pk, (void (*)(void*))pk_internal_free);
+  pk->man = man;
+  ap_manager_set_internal_clone(man, &pk_internal_clone);
   funptr = man->funptr;
   
   funptr[AP_FUNID_COPY] = &pk_copy;
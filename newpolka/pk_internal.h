@@ -20,6 +20,21 @@ extern "C" {
 /* I. Types */
 /* ********************************************************************** */
 
+/* Entry of the cache of inclusion and equality tests (see
+   pk_set_cache_size). The arguments are identified by their canonical
+   constraints, which determine the polyhedra. */
+typedef struct pk_cache_entry_t {
+  ap_funid_t funid;    /* AP_FUNID_IS_LEQ or AP_FUNID_IS_EQ,
+			  AP_FUNID_UNKNOWN if the entry is unused */
+  size_t intdim;
+  size_t realdim;
+  struct matrix_t* Ca; /* canonical constraints of the arguments, */
+  struct matrix_t* Cb; /* NULL for an empty polyhedron */
+  bool res;
+  bool flag_exact;
+  bool flag_best;
+} pk_cache_entry_t;
+
 /* These variables are used by various functions.  The prefix XXX_
    indicates that the variable is used by the module XXX. */
 
@@ -35,13 +50,22 @@ struct pk_internal_t {
 
   ap_funid_t funid;
   ap_funopt_t* funopt;
+  ap_manager_t* man;     /* Owning manager, for ap_manager_timeout */
 
   size_t max_coeff_size; /* Used for overflow exception in vector_combine */
   size_t approximate_max_coeff_size;
+  bool constraint_only; /* Answer queries by linear programming on
+			   constraints, see pk_set_constraint_only */
+
+  pk_cache_entry_t* cache; /* of size cache_size, indexed by fingerprints */
+  size_t cache_size;
 
   numint_t* vector_numintp; /* of size maxcols */
 
   mpq_t* vector_mpqp; /* of size maxdims+3 */
+#if defined(PK_NUMINT_CHECKED)
+  mpz_t* vector_mpzp; /* of size maxcols, used when a kernel overflows */
+#endif
 
   numint_t* vector_tmp;    /* of size 5 */
   
@@ -0,0 +1,590 @@
+/* ********************************************************************** */
+/* pk_lp.c: linear programming on matrices of constraints */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <string.h>
+
+#include "pk_config.h"
+#include "pk_vector.h"
+#include "pk_matrix.h"
+#include "pk_representation.h"
+#include "pk_constructor.h"
+#include "pk_lp.h"
+
+/* ********************************************************************** */
+/* I. Simplex */
+/* ********************************************************************** */
+
+/* The simplex follows the general form of Dutertre and de Moura, "A fast
+   linear-arithmetic solver for DPLL(T)": each row i of the constraints
+   introduces a slack variable s_i equal to the scalar product of the row and
+   of the variables, bounded by the opposite of the constant of the row
+   (below for an inequality, below and above for an equality). The
+   variables themselves are unbounded.
+
+   The tableau has one row per basic variable x_b, and one column per
+   variable: the row r represents the equation
+     0 = sum_k T[r][k] x_k, with T[r][basis[r]] = -1
+   and T[r][k] = 0 for the other basic variables k. Nonbasic variables need
+   not be at one of their bounds, which allows to start from the null
+   assignment with the slack variables basic.
+
+   The objective is kept as a combination of nonbasic variables, and updated
+   at each pivot. */
+
+typedef struct lp_t {
+  size_t nbvars;  /* number of variables, including slack variables */
+  size_t nbrows;  /* number of rows (and of basic variables) */
+  mpq_t** T;      /* tableau, of size nbrows*nbvars */
+  mpq_t* obj;     /* objective, of size nbvars */
+  mpq_t* val;     /* current assignment, of size nbvars */
+  mpq_t* lb;      /* lower bounds, of size nbvars */
+  mpq_t* ub;      /* upper bounds, of size nbvars */
+  bool* haslb;
+  bool* hasub;
+  size_t* basis;  /* basic variable of each row */
+  long* row;      /* row of each variable if it is basic, -1 otherwise */
+  mpq_t tmp, tmp2;
+} lp_t;
+
+static mpq_t* lp_mpq_array_alloc(size_t size)
+{
+  size_t i;
+  mpq_t* res = (mpq_t*)malloc(size*sizeof(mpq_t));
+  for (i=0; i<size; i++) mpq_init(res[i]);
+  return res;
+}
+static void lp_mpq_array_free(mpq_t* tab, size_t size)
+{
+  size_t i;
+  for (i=0; i<size; i++) mpq_clear(tab[i]);
+  free(tab);
+}
+
+/* Build the tableau from an array of rows of size nbcols */
+static void lp_init(lp_t* lp, numint_t** p, size_t nbrows, size_t nbcols,
+		    mpq_t* obj)
+{
+  size_t i,j,nbdims;
+
+  nbdims = nbcols - polka_cst - 1;
+  lp->nbrows = nbrows;
+  lp->nbvars = nbdims + nbrows;
+  lp->T = (mpq_t**)malloc(nbrows*sizeof(mpq_t*));
+  for (i=0; i<nbrows; i++){
+    lp->T[i] = lp_mpq_array_alloc(lp->nbvars);
+  }
+  lp->obj = lp_mpq_array_alloc(lp->nbvars);
+  lp->val = lp_mpq_array_alloc(lp->nbvars);
+  lp->lb = lp_mpq_array_alloc(lp->nbvars);
+  lp->ub = lp_mpq_array_alloc(lp->nbvars);
+  lp->haslb = (bool*)malloc(lp->nbvars*sizeof(bool));
+  lp->hasub = (bool*)malloc(lp->nbvars*sizeof(bool));
+  lp->basis = (size_t*)malloc(nbrows*sizeof(size_t));
+  lp->row = (long*)malloc(lp->nbvars*sizeof(long));
+  mpq_init(lp->tmp);
+  mpq_init(lp->tmp2);
+
+  for (j=0; j<nbdims; j++){
+    lp->haslb[j] = lp->hasub[j] = false;
+    lp->row[j] = -1;
+    if (obj) mpq_set(lp->obj[j],obj[polka_cst+1+j]);
+  }
+  for (i=0; i<nbrows; i++){
+    size_t s = nbdims+i;
+    for (j=0; j<nbdims; j++){
+      mpq_set_numint(lp->T[i][j],p[i][polka_cst+1+j]);
+    }
+    mpq_set_si(lp->T[i][s],-1,1);
+    lp->basis[i] = s;
+    lp->row[s] = (long)i;
+    mpq_set_numint(lp->lb[s],p[i][polka_cst]);
+    mpq_neg(lp->lb[s],lp->lb[s]);
+    lp->haslb[s] = true;
+    lp->hasub[s] = numint_sgn(p[i][0])==0;
+    if (lp->hasub[s]) mpq_set(lp->ub[s],lp->lb[s]);
+  }
+}
+
+static void lp_clear(lp_t* lp)
+{
+  size_t i;
+  for (i=0; i<lp->nbrows; i++){
+    lp_mpq_array_free(lp->T[i],lp->nbvars);
+  }
+  free(lp->T);
+  lp_mpq_array_free(lp->obj,lp->nbvars);
+  lp_mpq_array_free(lp->val,lp->nbvars);
+  lp_mpq_array_free(lp->lb,lp->nbvars);
+  lp_mpq_array_free(lp->ub,lp->nbvars);
+  free(lp->haslb);
+  free(lp->hasub);
+  free(lp->basis);
+  free(lp->row);
+  mpq_clear(lp->tmp);
+  mpq_clear(lp->tmp2);
+}
+
+/* Makes the nonbasic variable k basic in place of the basic variable of row
+   r, and update the other rows and the objective */
+static void lp_pivot(lp_t* lp, size_t r, size_t k)
+{
+  size_t i,j,b;
+  mpq_t* Tr = lp->T[r];
+
+  b = lp->basis[r];
+  /* Normalize the row r so that T[r][k] = -1 */
+  mpq_inv(lp->tmp,Tr[k]);
+  mpq_neg(lp->tmp,lp->tmp);
+  for (j=0; j<lp->nbvars; j++){
+    if (mpq_sgn(Tr[j])) mpq_mul(Tr[j],Tr[j],lp->tmp);
+  }
+  /* Eliminate x_k from the other rows and from the objective */
+  for (i=0; i<=lp->nbrows; i++){
+    mpq_t* Ti = i<lp->nbrows ? lp->T[i] : lp->obj;
+    if (i==r || mpq_sgn(Ti[k])==0) continue;
+    mpq_set(lp->tmp,Ti[k]);
+    for (j=0; j<lp->nbvars; j++){
+      if (mpq_sgn(Tr[j])){
+	mpq_mul(lp->tmp2,lp->tmp,Tr[j]);
+	mpq_add(Ti[j],Ti[j],lp->tmp2);
+      }
+    }
+  }
+  lp->basis[r] = k;
+  lp->row[k] = (long)r;
+  lp->row[b] = -1;
+}
+
+/* Move the nonbasic variable k by delta, and update the basic variables */
+static void lp_update(lp_t* lp, size_t k, mpq_t delta)
+{
+  size_t i;
+  mpq_add(lp->val[k],lp->val[k],delta);
+  for (i=0; i<lp->nbrows; i++){
+    if (mpq_sgn(lp->T[i][k])){
+      mpq_mul(lp->tmp,lp->T[i][k],delta);
+      mpq_add(lp->val[lp->basis[i]],lp->val[lp->basis[i]],lp->tmp);
+    }
+  }
+}
+
+/* Set the basic variable of row r to v by moving the nonbasic variable k,
+   and then exchange them */
+static void lp_pivot_and_update(lp_t* lp, size_t r, size_t k, mpq_t v)
+{
+  mpq_t theta;
+  mpq_init(theta);
+  mpq_sub(theta,v,lp->val[lp->basis[r]]);
+  mpq_div(theta,theta,lp->T[r][k]);
+  lp_update(lp,k,theta);
+  mpq_clear(theta);
+  lp_pivot(lp,r,k);
+}
+
+/* Can the variable k increase (sgn>0) or decrease (sgn<0) ? */
+static inline bool lp_can_move(lp_t* lp, size_t k, int sgn)
+{
+  return sgn>0 ?
+    (!lp->hasub[k] || mpq_cmp(lp->val[k],lp->ub[k])<0) :
+    (!lp->haslb[k] || mpq_cmp(lp->val[k],lp->lb[k])>0);
+}
+
+/* Look for an assignment satisfying the bounds */
+static bool lp_check(lp_t* lp)
+{
+  size_t b,k,r;
+  int sgn;
+
+  for (;;){
+    /* Select the violated basic variable of smallest index */
+    for (b=0; b<lp->nbvars; b++){
+      if (lp->row[b]<0) continue;
+      if (lp->haslb[b] && mpq_cmp(lp->val[b],lp->lb[b])<0){
+	sgn = 1; break;
+      }
+      if (lp->hasub[b] && mpq_cmp(lp->val[b],lp->ub[b])>0){
+	sgn = -1; break;
+      }
+    }
+    if (b==lp->nbvars) return true;
+    r = (size_t)lp->row[b];
+    /* Select the nonbasic variable of smallest index allowing to move b in
+       the direction sgn */
+    for (k=0; k<lp->nbvars; k++){
+      int s;
+      if (lp->row[k]>=0) continue;
+      s = mpq_sgn(lp->T[r][k]);
+      if (s && lp_can_move(lp,k,s*sgn)) break;
+    }
+    if (k==lp->nbvars) return false;
+    lp_pivot_and_update(lp,r,k, sgn>0 ? lp->lb[b] : lp->ub[b]);
+  }
+}
+
+/* Maximize the objective from a feasible assignment */
+static lp_status_t lp_optimize(lp_t* lp)
+{
+  size_t i,k,b;
+  long r;
+  int sgn,s;
+  mpq_t t,best;
+
+  mpq_init(t);
+  mpq_init(best);
+  for (;;){
+    /* Select the entering variable of smallest index */
+    for (k=0; k<lp->nbvars; k++){
+      if (lp->row[k]>=0) continue;
+      sgn = mpq_sgn(lp->obj[k]);
+      if (sgn && lp_can_move(lp,k,sgn)) break;
+    }
+    if (k==lp->nbvars) break;
+    /* Ratio test: r==-1 indicates the bound of k itself, r==-2 no bound */
+    r = -2;
+    if (sgn>0 && lp->hasub[k]){
+      mpq_sub(best,lp->ub[k],lp->val[k]);
+      r = -1;
+    }
+    else if (sgn<0 && lp->haslb[k]){
+      mpq_sub(best,lp->val[k],lp->lb[k]);
+      r = -1;
+    }
+    for (i=0; i<lp->nbrows; i++){
+      s = mpq_sgn(lp->T[i][k])*sgn;
+      b = lp->basis[i];
+      if (s>0 && lp->hasub[b])
+	mpq_sub(t,lp->ub[b],lp->val[b]);
+      else if (s<0 && lp->haslb[b])
+	mpq_sub(t,lp->val[b],lp->lb[b]);
+      else
+	continue;
+      mpq_div(t,t,lp->T[i][k]);
+      if (mpq_sgn(t)<0) mpq_neg(t,t);
+      if (r==-2 || mpq_cmp(t,best)<0 ||
+	  (r>=0 && mpq_cmp(t,best)==0 && b<lp->basis[r])){
+	mpq_set(best,t);
+	r = (long)i;
+      }
+    }
+    if (r==-2){
+      mpq_clear(t);
+      mpq_clear(best);
+      return lp_unbounded;
+    }
+    if (r==-1){
+      if (sgn<0) mpq_neg(best,best);
+      lp_update(lp,k,best);
+    }
+    else {
+      b = lp->basis[r];
+      s = mpq_sgn(lp->T[r][k])*sgn;
+      lp_pivot_and_update(lp,(size_t)r,k, s>0 ? lp->ub[b] : lp->lb[b]);
+    }
+  }
+  mpq_clear(t);
+  mpq_clear(best);
+  return lp_optimal;
+}
+
+static lp_status_t lp_maximize_rows(mpq_t res,
+				    numint_t** p, size_t nbrows,
+				    size_t nbcols, mpq_t* obj)
+{
+  lp_t lp;
+  lp_status_t status;
+  size_t k;
+
+  lp_init(&lp,p,nbrows,nbcols,obj);
+  if (!lp_check(&lp)){
+    status = lp_infeasible;
+  }
+  else if (obj==NULL){
+    status = lp_optimal;
+  }
+  else {
+    status = lp_optimize(&lp);
+    if (status==lp_optimal){
+      mpq_set(res,obj[polka_cst]);
+      for (k=0; k<lp.nbvars; k++){
+	if (mpq_sgn(lp.obj[k])){
+	  mpq_mul(lp.tmp,lp.obj[k],lp.val[k]);
+	  mpq_add(res,res,lp.tmp);
+	}
+      }
+    }
+  }
+  lp_clear(&lp);
+  return status;
+}
+
+lp_status_t lp_maximize(pk_internal_t* pk,
+			mpq_t res,
+			matrix_t* C, numint_t* row,
+			mpq_t* obj)
+{
+  numint_t** p;
+  size_t nbrows;
+  lp_status_t status;
+
+  nbrows = C->nbrows;
+  if (row){
+    p = (numint_t**)malloc((nbrows+1)*sizeof(numint_t*));
+    memcpy(p,C->p,nbrows*sizeof(numint_t*));
+    p[nbrows++] = row;
+  }
+  else {
+    p = C->p;
+  }
+  status = lp_maximize_rows(res,p,nbrows,C->nbcolumns,obj);
+  if (row) free(p);
+  return status;
+}
+
+/* ********************************************************************** */
+/* II. Constraint-only mode */
+/* ********************************************************************** */
+
+void poly_obtain_F_or_lp(ap_manager_t* man, pk_t* po, char* msg)
+{
+  pk_internal_t* pk = (pk_internal_t*)man->internal;
+
+  if (poly_is_constraint_only(pk,po)){
+    if (lp_is_empty(pk,po->C))
+      poly_set_bottom(pk,po);
+  }
+  else if (pk->funopt->algorithm>0)
+    poly_chernikova(man,po,msg);
+  else
+    poly_obtain_F(man,po,msg);
+}
+
+/* ********************************************************************** */
+/* III. Queries */
+/* ********************************************************************** */
+
+/* Emptiness given additional row */
+static bool lp_is_empty_row(pk_internal_t* pk, matrix_t* C, numint_t* row)
+{
+  bool res;
+
+  if (pk->strict){
+    mpq_t* obj;
+    mpq_t max;
+
+    obj = lp_mpq_array_alloc(C->nbcolumns);
+    mpq_set_si(obj[polka_eps],1,1);
+    mpq_init(max);
+    switch (lp_maximize(pk,max,C,row,obj)){
+    case lp_infeasible:
+      res = true;
+      break;
+    case lp_unbounded:
+      res = false;
+      break;
+    default:
+      res = mpq_sgn(max)<=0;
+      break;
+    }
+    mpq_clear(max);
+    lp_mpq_array_free(obj,C->nbcolumns);
+  }
+  else {
+    res = lp_maximize(pk,NULL,C,row,NULL) == lp_infeasible;
+  }
+  return res;
+}
+
+bool lp_is_empty(pk_internal_t* pk, matrix_t* C)
+{
+  return lp_is_empty_row(pk,C,NULL);
+}
+
+/* Fill obj with sgn times vec, without the epsilon component */
+static void lp_obj_set_vector(pk_internal_t* pk, mpq_t* obj,
+			      numint_t* vec, size_t size, int sgn)
+{
+  size_t j;
+  for (j=polka_cst; j<size; j++){
+    mpq_set_numint(obj[j],vec[j]);
+    if (sgn<0) mpq_neg(obj[j],obj[j]);
+  }
+  if (pk->strict) mpq_set_si(obj[polka_eps],0,1);
+}
+
+bool lp_sat_vector(pk_internal_t* pk, matrix_t* C,
+		   numint_t* vec, bool is_strict)
+{
+  bool res;
+  mpq_t* obj;
+  mpq_t max;
+  size_t size = C->nbcolumns;
+
+  obj = lp_mpq_array_alloc(size);
+  mpq_init(max);
+  /* minimum of the expression */
+  lp_obj_set_vector(pk,obj,vec,size,-1);
+  res =
+    lp_maximize(pk,max,C,NULL,obj)==lp_optimal &&
+    mpq_sgn(max)<=0;
+  if (res){
+    if (numint_sgn(vec[0])==0){
+      /* equality: the maximum should be zero as well */
+      lp_obj_set_vector(pk,obj,vec,size,1);
+      res =
+	mpq_sgn(max)==0 &&
+	lp_maximize(pk,max,C,NULL,obj)==lp_optimal &&
+	mpq_sgn(max)==0;
+    }
+    else if (is_strict && mpq_sgn(max)==0){
+      /* the minimum zero is reached in the topological closure, we check
+	 whether it is reached in the polyhedron itself */
+      if (pk->strict){
+	numint_t* row = vector_alloc(size);
+	vector_copy(row,vec,size);
+	numint_set_int(row[0],0);
+	numint_set_int(row[polka_eps],0);
+	res = lp_is_empty_row(pk,C,row);
+	vector_free(row,size);
+      }
+      else {
+	res = false;
+      }
+    }
+  }
+  mpq_clear(max);
+  lp_mpq_array_free(obj,size);
+  return res;
+}
+
+/* Set a bound from a rational number, or to infinity if it does not fit
+   into the number type */
+static void lp_bound_set_mpq(pk_internal_t* pk, bound_t bound, mpq_t q)
+{
+  if (mpq_fits_numrat(q)){
+    numrat_set_mpq(pk->poly_numrat,q);
+    bound_set_num(bound,pk->poly_numrat);
+  }
+  else {
+    bound_set_infty(bound,1);
+  }
+}
+
+/* Bounds of the objective, without its constant */
+static void lp_bound_obj(pk_internal_t* pk,
+			 itv_t itv, mpq_t* obj, matrix_t* C)
+{
+  size_t j;
+  mpq_t max;
+
+  mpq_init(max);
+  mpq_set_si(obj[polka_cst],0,1);
+  if (lp_maximize(pk,max,C,NULL,obj)==lp_optimal)
+    lp_bound_set_mpq(pk,itv->sup,max);
+  else
+    bound_set_infty(itv->sup,1);
+  for (j=polka_cst+1; j<C->nbcolumns; j++){
+    mpq_neg(obj[j],obj[j]);
+  }
+  /* inf bounds are stored negated */
+  if (lp_maximize(pk,max,C,NULL,obj)==lp_optimal)
+    lp_bound_set_mpq(pk,itv->inf,max);
+  else
+    bound_set_infty(itv->inf,1);
+  mpq_clear(max);
+}
+
+void lp_bound_dimension(pk_internal_t* pk,
+			itv_t itv, ap_dim_t dim, matrix_t* C)
+{
+  mpq_t* obj;
+
+  assert(pk->dec+dim<C->nbcolumns);
+  obj = lp_mpq_array_alloc(C->nbcolumns);
+  mpq_set_si(obj[pk->dec+dim],1,1);
+  lp_bound_obj(pk,itv,obj,C);
+  lp_mpq_array_free(obj,C->nbcolumns);
+}
+
+void lp_bound_itv_linexpr(pk_internal_t* pk,
+			  itv_t itv, itv_linexpr_t* expr, matrix_t* C)
+{
+  size_t i,dim;
+  bool* peq;
+  itv_ptr pitv;
+  mpq_t* obj;
+
+  assert(itv_linexpr_is_scalar(expr));
+  obj = lp_mpq_array_alloc(C->nbcolumns);
+  itv_linexpr_ForeachLinterm(expr,i,dim,pitv,peq){
+    mpq_set_numrat(obj[pk->dec+dim],bound_numref(pitv->sup));
+  }
+  lp_bound_obj(pk,itv,obj,C);
+  itv_add(itv,itv,expr->cst);
+  lp_mpq_array_free(obj,C->nbcolumns);
+}
+
+itv_t* lp_to_box(pk_internal_t* pk, matrix_t* C)
+{
+  size_t i,dim;
+  itv_t* res;
+
+  assert(C->nbcolumns>=pk->dec);
+  dim = C->nbcolumns - pk->dec;
+  res = itv_array_alloc(dim);
+  for (i=0;i<dim;i++){
+    lp_bound_dimension(pk,res[i],i,C);
+  }
+  return res;
+}
+
+bool lp_remove_redundant(pk_internal_t* pk, matrix_t* C)
+{
+  size_t i,j,k,nbrows;
+  numint_t** p;
+  mpq_t* obj;
+  mpq_t max;
+  bool redundant,change;
+
+  obj = lp_mpq_array_alloc(C->nbcolumns);
+  p = (numint_t**)malloc(C->nbrows*sizeof(numint_t*));
+  mpq_init(max);
+  change = false;
+  /* The rows 0..k-1 are kept, the rows i+1..nbrows-1 remain to be tested */
+  k = 0;
+  nbrows = C->nbrows;
+  for (i=0; i<nbrows; i++){
+    numint_t* q = C->p[i];
+    redundant = false;
+    /* inequality with a non-null linear part (vector_is_null ignores the
+       first coefficient of its argument) */
+    if (numint_sgn(q[0]) &&
+	!vector_is_null(pk,&q[pk->dec-1],C->nbcolumns-pk->dec+1)){
+      /* minimum of the row over the other kept rows */
+      for (j=0; j<k; j++) p[j] = C->p[j];
+      for (j=i+1; j<nbrows; j++) p[k+j-i-1] = C->p[j];
+      for (j=polka_cst; j<C->nbcolumns; j++){
+	mpq_set_numint(obj[j],q[j]);
+	mpq_neg(obj[j],obj[j]);
+      }
+      redundant =
+	lp_maximize_rows(max,p,nbrows-i-1+k,C->nbcolumns,obj)==lp_optimal &&
+	mpq_sgn(max)<=0;
+    }
+    if (redundant){
+      change = true;
+    }
+    else {
+      if (k!=i) matrix_exch_rows(C,k,i);
+      k++;
+    }
+  }
+  C->nbrows = k;
+  mpq_clear(max);
+  free(p);
+  lp_mpq_array_free(obj,C->nbcolumns);
+  return change;
+}
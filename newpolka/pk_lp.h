@@ -0,0 +1,118 @@
+/* ********************************************************************** */
+/* pk_lp.h: linear programming on matrices of constraints */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* This header file defines an exact rational simplex working directly on a
+   matrix of constraints, and the queries on polyhedra that it allows to
+   answer without computing generators. */
+
+#ifndef __PK_LP_H__
+#define __PK_LP_H__
+
+#include "pk_config.h"
+#include "pk_vector.h"
+#include "pk_matrix.h"
+#include "pk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Functions meant to be internal */
+
+typedef enum lp_status_t {
+  lp_infeasible,
+  lp_unbounded,
+  lp_optimal
+} lp_status_t;
+
+/* ********************************************************************** */
+/* I. Simplex */
+/* ********************************************************************** */
+
+lp_status_t lp_maximize(pk_internal_t* pk,
+			mpq_t res,
+			matrix_t* C, numint_t* row,
+			mpq_t* obj);
+/* Maximize the objective obj over the points of the matrix of constraints
+   C, to which the constraint row is added if it is not NULL.
+
+   - The variables are the columns following polka_cst, including the
+     epsilon column in strict mode; the coefficient polka_cst of a row is
+     its constant and its coefficient 0 indicates an equality (0) or an
+     inequality (1).
+   - obj is an array of size C->nbcolumns, with the same convention (the
+     coefficient 0 is ignored). If it is NULL, only the feasibility is
+     tested.
+   - In case of lp_optimal, res is set to the maximum of obj.
+
+   The simplex uses the Bland rule and exact arithmetic on mpq_t, so that
+   it always terminates with an exact answer. */
+
+/* ********************************************************************** */
+/* II. Constraint-only mode */
+/* ********************************************************************** */
+
+static inline bool poly_is_constraint_only(pk_internal_t* pk, pk_t* po);
+/* Should the queries on po be answered by linear programming ? This is the
+   case in constraint-only mode (see pk_set_constraint_only) when po has
+   constraints but no generators. */
+
+void poly_obtain_F_or_lp(ap_manager_t* man, pk_t* po, char* msg);
+/* If poly_is_constraint_only(pk,po), decide the emptiness of po by linear
+   programming (po is set to bottom if it is empty). Otherwise, obtain the
+   generators of po, with poly_chernikova if the algorithm of the current
+   function is strictly positive, with poly_obtain_F otherwise. */
+
+static inline bool poly_is_constraint_only(pk_internal_t* pk, pk_t* po)
+{
+  return pk->constraint_only && po->C && !po->F;
+}
+
+/* ********************************************************************** */
+/* III. Queries */
+/* ********************************************************************** */
+
+/* In the following functions, C is supposed to be a non-empty matrix of
+   constraints of a polyhedron. Except for lp_is_empty and
+   lp_remove_redundant, the polyhedron is supposed to be non-empty. */
+
+bool lp_is_empty(pk_internal_t* pk, matrix_t* C);
+/* Is the polyhedron empty ? In strict mode, this means that there is no
+   point with a strictly positive epsilon. */
+
+bool lp_sat_vector(pk_internal_t* pk, matrix_t* C,
+		   numint_t* vec, bool is_strict);
+/* Does the polyhedron satisfy the constraint vec ? As for
+   do_generators_sat_vector, the epsilon component of vec is not taken into
+   account, and the constraint is considered as strict only if is_strict
+   tells so. */
+
+void lp_bound_dimension(pk_internal_t* pk,
+			itv_t itv, ap_dim_t dim, matrix_t* C);
+/* Bounding the value of a dimension in the topological closure of the
+   polyhedron */
+
+void lp_bound_itv_linexpr(pk_internal_t* pk,
+			  itv_t itv, itv_linexpr_t* expr, matrix_t* C);
+/* Bounding the value of a linear expression with scalar coefficients (and
+   possibly an interval constant) in the topological closure of the
+   polyhedron */
+
+itv_t* lp_to_box(pk_internal_t* pk, matrix_t* C);
+/* Bounding by a itv box the polyhedron */
+
+bool lp_remove_redundant(pk_internal_t* pk, matrix_t* C);
+/* Remove from C the inequalities implied by the other rows. Equalities
+   and rows involving only the constant and epsilon columns are kept.
+   The order of the remaining rows is unchanged. Return true if some row
+   has been removed. */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -296,8 +296,8 @@ typedef struct qsort_man_t {
 static int qsort_rows_compar(void* qsort_man, const void* pq1, const void* pq2)
 {
   qsort_man_t* qm = (qsort_man_t*)qsort_man;
-  numint_t* q1 = *((numint_t**)pq1);
-  numint_t* q2 = *((numint_t**)pq2);
+  numint_t* q1 = *((numint_t* const*)pq1);
+  numint_t* q2 = *((numint_t* const*)pq2);
   return vector_compare(qm->pk,q1,q2,qm->size);
 }
 
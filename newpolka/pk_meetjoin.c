@@ -5,6 +5,8 @@
 /* This file is part of the APRON Library, released under LGPL license.  Please
    read the COPYING file packaged in the distribution */
 
+#include <pthread.h>
+#include <unistd.h>
 #include "pk_config.h"
 #include "pk_vector.h"
 #include "pk_satmat.h"
@@ -16,6 +18,7 @@
 #include "pk_test.h"
 #include "pk_extract.h"
 #include "pk_cherni.h"
+#include "pk_lp.h"
 #include "pk_meetjoin.h"
 #include "ap_generic.h"
 #include "itv_linearize.h"
@@ -239,9 +242,10 @@ void poly_meet(bool meet,
   /* lazy behaviour */
   if (lazy){
   _poly_meet_entry0:
+    /* also reached when the minimization of the arguments failed */
     poly_obtain_sorted_C(pk,pa);
     poly_obtain_sorted_C(pk,pb);
-    poly_meet_matrix(meet,lazy,man,po,pa,pb->C);
+    poly_meet_matrix(meet,true,man,po,pa,pb->C);
   }
   /* strict behaviour */
   else {
@@ -304,6 +308,10 @@ void poly_meet(bool meet,
     poly_obtain_satC(pa);
     poly_obtain_sorted_C(pk,pb);
     poly_meet_matrix(meet,lazy,man,po,pa,pb->C);
+    if (pk->exn){
+      pk->exn = AP_EXC_NONE;
+      man->result.flag_best = man->result.flag_exact = false;
+    }
   }
   assert(poly_check_dual(pk,po,meet));
 }
@@ -494,7 +502,7 @@ pk_t* pk_meet(ap_manager_t* man,
 {
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_MEET);
   pk_t* po = destructive ? pa : poly_alloc(pa->intdim,pa->realdim);
-  poly_meet(true, pk->funopt->algorithm < 0,
+  poly_meet(true, pk->funopt->algorithm < 0 || pk->constraint_only,
 	    man,po,pa,pb);
   assert(poly_check(pk,po));
   return po;
@@ -504,7 +512,8 @@ pk_t* pk_meet_array(ap_manager_t* man,
 		    pk_t** po, size_t size)
 {
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_MEET_ARRAY);
-  pk_t* res = poly_meet_array(true, pk->funopt->algorithm < 0,
+  pk_t* res = poly_meet_array(true,
+			      pk->funopt->algorithm < 0 || pk->constraint_only,
 			      man,po,size);
   assert(poly_check(pk,res));
   return res;
@@ -528,7 +537,7 @@ void poly_meet_itv_lincons_array(bool lazy,
   quasilinear = itv_lincons_array_is_quasilinear(array);
 
   /* Get the constraint systems */
-  if (lazy && quasilinear){
+  if (lazy && (quasilinear || pk->constraint_only)){
     poly_obtain_C(man,pa,"of the argument");
   } else {
     poly_chernikova(man,pa,"of the argument");
@@ -540,6 +549,8 @@ void poly_meet_itv_lincons_array(bool lazy,
       poly_set_top(pk,po);
       return;
     }
+    /* pa is not minimized: fall back to the lazy meet */
+    lazy = true;
   }
   /* if pa is bottom, return bottom */
   if ( !pa->C && !pa->F){
@@ -550,7 +561,16 @@ void poly_meet_itv_lincons_array(bool lazy,
 
   /* quasilinearize if needed */
   if (!quasilinear){
-    itv_t* env = matrix_to_box(pk,pa->F);
+    itv_t* env;
+    if (pa->F)
+      env = matrix_to_box(pk,pa->F);
+    else if (lp_is_empty(pk,pa->C)){
+      man->result.flag_best = man->result.flag_exact = true;
+      poly_set_bottom(pk,po);
+      return;
+    }
+    else
+      env = lp_to_box(pk,pa->C);
     itv_quasilinearize_lincons_array(pk->itv,array,env,true);
     itv_array_free(env,pa->intdim+pa->realdim);
   }
@@ -578,7 +598,22 @@ pk_t* pk_meet_lincons_array(ap_manager_t* man, bool destructive, pk_t* pa, ap_li
 
   itv_lincons_array_init(&tcons,array->size);
   itv_lincons_array_set_ap_lincons0_array(pk->itv,&tcons,array);
-  poly_meet_itv_lincons_array(pk->funopt->algorithm<0,
+  poly_meet_itv_lincons_array(pk->funopt->algorithm<0 || pk->constraint_only,
+			      man,po,pa,&tcons);
+  itv_lincons_array_clear(&tcons);
+  assert(poly_check(pk,po));
+  return po;
+}
+
+pk_t* pk_meet_linpack0(ap_manager_t* man, bool destructive, pk_t* pa, ap_linpack0_t* pack)
+{
+  itv_lincons_array_t tcons;
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_MEET_LINCONS_ARRAY);
+  pk_t* po = destructive ? pa : poly_alloc(pa->intdim,pa->realdim);
+
+  itv_lincons_array_init(&tcons,pack->size);
+  itv_lincons_array_set_ap_linpack0(pk->itv,&tcons,pack);
+  poly_meet_itv_lincons_array(pk->funopt->algorithm<0 || pk->constraint_only,
 			      man,po,pa,&tcons);
   itv_lincons_array_clear(&tcons);
   assert(poly_check(pk,po));
@@ -589,7 +624,7 @@ pk_t* pk_meet_tcons_array(ap_manager_t* man, bool destructive, pk_t* pa, ap_tcon
 {
   return ap_generic_meet_intlinearize_tcons_array(man,destructive,pa,array,
 						  AP_SCALAR_MPQ, AP_LINEXPR_LINEAR,
-						  &pk_meet_lincons_array);
+						  (void* (*)(ap_manager_t*,bool,void*,ap_lincons0_array_t*))&pk_meet_lincons_array);
 }
 
 /* ********************************************************************** */
@@ -617,11 +652,90 @@ pk_t* pk_join(ap_manager_t* man, bool destructive, pk_t* pa, pk_t* pb)
 
 static int poly_cmp(const void* a, const void* b)
 {
-  pk_t* pa = *((pk_t**)a);
-  pk_t* pb = *((pk_t**)b);
+  pk_t* pa = *((pk_t* const*)a);
+  pk_t* pb = *((pk_t* const*)b);
   return (pa>pb ? 1 : (pa==pb ? 0 : -1));
 }
 
+/* Join of an array of distinct polyhedra, with a single conversion */
+static
+pk_t* poly_join_array(bool lazy, ap_manager_t* man, pk_t** tpoly, size_t size)
+{
+  pk_t* poly;
+  size_t i;
+
+  for (i=0;i<size;i++)
+    poly_dual(tpoly[i]);
+  poly = poly_meet_array(false,lazy,man,tpoly,size);
+  for(i=0;i<size;i++){
+    poly_dual(tpoly[i]);
+  }
+  poly_dual(poly);
+  return poly;
+}
+
+/* Join of an array of distinct polyhedra by a balanced reduction tree: the
+   second half of the array is joined in another thread, with a clone of
+   the manager, as long as there are threads left, and each thread joins
+   its part with poly_join_array. */
+typedef struct pk_join_tree_t {
+  ap_manager_t* man;
+  pk_t** tab;
+  size_t size;
+  size_t nbthreads; /* number of threads allowed, including the current one */
+  pk_t* res;
+  bool best;        /* are all the joins best ? */
+} pk_join_tree_t;
+
+static
+void* pk_join_tree(void* arg)
+{
+  pk_join_tree_t* t = (pk_join_tree_t*)arg;
+  ap_manager_t* man = t->man;
+  pk_join_tree_t left,right;
+  pthread_t thread;
+  bool started;
+
+  if (t->nbthreads<=1 || t->size<=2){
+    pk_init_from_manager(man,AP_FUNID_JOIN_ARRAY);
+    t->res = poly_join_array(false,man,t->tab,t->size);
+    t->best = man->result.flag_best;
+    return NULL;
+  }
+  left.man = man;
+  left.tab = t->tab;
+  left.size = t->size/2;
+  left.nbthreads = t->nbthreads - t->nbthreads/2;
+  right.man = ap_manager_clone_for_thread(man);
+  right.tab = t->tab + left.size;
+  right.size = t->size - left.size;
+  right.nbthreads = t->nbthreads/2;
+  started = false;
+  if (right.man){
+    started = pthread_create(&thread,NULL,&pk_join_tree,&right)==0;
+    if (!started){
+      ap_manager_free(right.man);
+    }
+  }
+  pk_join_tree(&left);
+  if (started){
+    pthread_join(thread,NULL);
+    if (right.man->result.exn!=AP_EXC_NONE){
+      ap_manager_raise_exception(man,right.man->result.exn,AP_FUNID_JOIN_ARRAY,
+				 "in a concurrent join");
+    }
+    ap_manager_free(right.man);
+  }
+  else {
+    right.man = man;
+    pk_join_tree(&right);
+  }
+  t->res = pk_join(man,true,left.res,right.res);
+  t->best = left.best && right.best && man->result.flag_best;
+  pk_free(man,right.res);
+  return NULL;
+}
+
 pk_t* pk_join_array(ap_manager_t* man, pk_t** po, size_t size)
 {
   pk_t** tpoly;
@@ -647,26 +761,39 @@ pk_t* pk_join_array(ap_manager_t* man, pk_t** po, size_t size)
   memcpy(tpoly, po, size*sizeof(pk_t*));
   qsort(tpoly,size,sizeof(pk_t*),poly_cmp);
 
-  /* remove doublons */
-  for(i=0;i<size-1;i++){
+  /* remove doublons (poly_join_array dualizes each polyhedron in place):
+     i stays on a polyhedron as long as it is followed by an alias */
+  i = 0;
+  while (i<size-1){
     if (tpoly[i]==tpoly[i+1]){
       if (i<size-2){
 	memmove(&tpoly[i+1],&tpoly[i+2],(size-i-2)*sizeof(pk_t*));
       }
       size--;
     }
+    else
+      i++;
   }
-  /* dual */
-  for (i=0;i<size;i++)
-    poly_dual(tpoly[i]);
-
-  poly = poly_meet_array(false,pk->funopt->algorithm<0,
-			 man,(pk_t**)tpoly,size);
-  for(i=0;i<size;i++){
-    poly_dual(tpoly[i]);
+  if (pk->funopt->algorithm>1 && size>2){
+    pk_join_tree_t t;
+    long nbprocs = sysconf(_SC_NPROCESSORS_ONLN);
+
+    t.man = man;
+    t.tab = tpoly;
+    t.size = size;
+    t.nbthreads = (size_t)pk->funopt->algorithm;
+    if (nbprocs>0 && t.nbthreads>(size_t)nbprocs)
+      t.nbthreads = (size_t)nbprocs;
+    pk_join_tree(&t);
+    poly = t.res;
+    pk_init_from_manager(man,AP_FUNID_JOIN_ARRAY);
+    man->result.flag_best = t.best;
+    man->result.flag_exact = false;
+  }
+  else {
+    poly = poly_join_array(pk->funopt->algorithm<0,man,tpoly,size);
   }
   free(tpoly);
-  poly_dual(poly);
   assert(poly_check(pk,poly));
   return poly;
 }
@@ -702,6 +829,8 @@ void poly_add_ray_array(bool lazy,
       poly_set_top(pk,po);
       return;
     }
+    /* pa is not minimized: fall back to the lazy join */
+    lazy = true;
   }
   /* if pa is bottom, return bottom */
   if ( !pa->C && !pa->F){
@@ -718,7 +847,12 @@ void poly_add_ray_array(bool lazy,
   poly_dual(po);
   if (po!=pa) poly_dual(pa);
   matrix_free(mat);
-  man->result.flag_exact = exact;
+  if (pk->exn){
+    pk->exn = AP_EXC_NONE;
+    man->result.flag_best = man->result.flag_exact = false;
+  }
+  else
+    man->result.flag_exact = exact;
 }
 
 pk_t* pk_add_ray_array(ap_manager_t* man, bool destructive, pk_t* pa, ap_generator0_array_t* array)
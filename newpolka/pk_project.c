@@ -50,6 +50,8 @@ void poly_projectforget_array(bool project,
       poly_set_top(pk,po);
       return;
     }
+    /* pa is not minimized: fall back to the lazy behaviour */
+    lazy = true;
   }
   /* if empty, return empty */
   if (!pa->F){
@@ -15,6 +15,7 @@
 #include "pk_representation.h"
 #include "pk_extract.h"
 #include "pk_constructor.h"
+#include "pk_lp.h"
 
 /* ********************************************************************** */
 /* Conversions */
@@ -263,16 +264,26 @@ void poly_chernikova3(ap_manager_t* man,
     size_t rank;
     if (! (po->status & pk_status_consgauss)){
       rank = cherni_gauss(pk,po->C,po->nbeq);
-      assert(rank==po->nbeq);
+      assert(pk->exn || rank==po->nbeq);
       cherni_backsubstitute(pk,po->C,rank);
       po->C->_sorted = false;
     }
     if (! (po->status & pk_status_gengauss)){
       rank = cherni_gauss(pk,po->F,po->nbline);
-      assert(rank==po->nbline);
+      assert(pk->exn || rank==po->nbline);
       cherni_backsubstitute(pk,po->F,rank);
       po->F->_sorted = false;
     }
+#if defined(PK_NUMINT_CHECKED)
+    if (pk->exn){
+      /* Some combinations do not fit: the matrices are still valid, but not
+	 in Gauss normal form */
+      po->status &= ~(pk_status_consgauss | pk_status_gengauss);
+      ap_manager_raise_exception(man,pk->exn,pk->funid,
+				 "Gauss normalization of the polyhedron");
+      return;
+    }
+#endif
     poly_obtain_sorted_C(pk,po);
     poly_obtain_sorted_F(pk,po);
     po->status |=
@@ -355,26 +366,47 @@ void pk_canonicalize(ap_manager_t* man, pk_t* po)
     po->intdim>0 && (po->C || po->F) ? false : true;
 }
 
-int pk_hash(ap_manager_t* man, pk_t* po)
+/* Fingerprint of a polyhedron, computed from its constraints. The hash values
+   of the rows are combined by a sum, so that the result does not depend on
+   the order of the rows. */
+int poly_fingerprint(pk_internal_t* pk, pk_t* po)
 {
-  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_HASH);
-  int res,t;
-  size_t i;
-  ap_funopt_t opt = ap_manager_get_funopt(man,AP_FUNID_CANONICALIZE);
+  unsigned int res,h;
+  long t;
+  size_t i,j;
 
-  poly_chernikova3(man,po,NULL);
-  assert(poly_check(pk,po));
   res = 5*po->intdim + 7*po->realdim;
   if (po->C!=NULL){
-    res += po->C->nbrows*11 +  po->F->nbrows*13;
-    for (i=0; i<po->C->nbrows; i += (po->C->nbrows+3)/4){
-      res = res*3 + vector_hash(pk,po->C->p[i],po->C->nbcolumns);
-    }
-    for (i=0; i<po->F->nbrows; i += (po->F->nbrows+3)/4){
-      res = res*3 + vector_hash(pk,po->F->p[i],po->F->nbcolumns);
+    res += po->nbeq*11 + po->nbline*13;
+    for (i=0; i<po->C->nbrows; i++){
+      h = 0;
+      for (j=0; j<po->C->nbcolumns; j++){
+	int_set_numint(&t,po->C->p[i][j]);
+	h = h*31 + (unsigned int)t;
+      }
+      /* mix the bits, so that the sum is not degenerate */
+      h ^= h>>16;
+      h *= 0x45d9f3bU;
+      h ^= h>>16;
+      res += h;
     }
   }
-  return res;
+  return (int)res;
+}
+
+int pk_hash(ap_manager_t* man, pk_t* po)
+{
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_HASH);
+
+  poly_chernikova3(man,po,NULL);
+  if (pk->exn){
+    pk->exn = AP_EXC_NONE;
+    man->result.flag_exact = man->result.flag_best = false;
+    return 5*po->intdim + 7*po->realdim;
+  }
+  assert(poly_check(pk,po));
+  man->result.flag_exact = man->result.flag_best = true;
+  return poly_fingerprint(pk,po);
 }
 
 /* Minimize the size of the representation of the polyhedron */
@@ -382,7 +414,17 @@ void pk_minimize(ap_manager_t* man, pk_t* po)
 {
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_MINIMIZE);
 
-  if (po->C || po->F){
+  if (poly_is_constraint_only(pk,po)){
+    /* remove redundant constraints by linear programming */
+    if (lp_is_empty(pk,po->C))
+      poly_set_bottom(pk,po);
+    else {
+      if (lp_remove_redundant(pk,po->C))
+	po->status &= ~pk_status_minimaleps;
+      matrix_minimize(po->C);
+    }
+  }
+  else if (po->C || po->F){
     poly_chernikova2(man,po,NULL);
     if (pk->exn){
       pk->exn = AP_EXC_NONE;
@@ -526,19 +568,397 @@ void pk_fdump(FILE* stream, ap_manager_t* man, pk_t* po)
 /* IV. Serialization */
 /* ********************************************************************** */
 
+/* raw format:
+   0: uchar:  format version (1)
+   1: uchar:  status
+   2: uchar:  presence flags (C, F, satC, satF, C sorted, F sorted)
+   3: uint32: intdim
+   7: uint32: realdim
+  11: uint32: nbeq
+  15: uint32: nbline
+  19:   -   : matrices C and F, if present, as
+	      uint32 nbrows, uint32 nbcolumns and coefficients row by row
+	    : saturation matrices satC and satF, if present, as
+	      uint32 nbrows, uint32 nbcolumns and words row by row
+
+   A coefficient is an unsigned varint (7 bits per byte, low bits first).
+   If its lowest bit is 0, the remaining bits are the zigzag encoding of a
+   coefficient in [-2^62,2^62[; otherwise, bit 1 is the sign and the
+   remaining bits the number of bytes of the absolute value, which follow
+   in big-endian order. The format does not depend on the underlying
+   numeric type. */
+
+#define PK_SERIALIZE_VERSION 1
+
+enum {
+  pk_serialize_C = 0x1,
+  pk_serialize_F = 0x2,
+  pk_serialize_satC = 0x4,
+  pk_serialize_satF = 0x8,
+  pk_serialize_Csorted = 0x10,
+  pk_serialize_Fsorted = 0x20
+};
+
+static size_t varint_size(unsigned long long u)
+{
+  size_t n = 1;
+  while (u >= 0x80){ u >>= 7; n++; }
+  return n;
+}
+static size_t varint_dump(unsigned char* dst, unsigned long long u)
+{
+  size_t n = 0;
+  while (u >= 0x80){
+    dst[n++] = (unsigned char)(u & 0x7f) | 0x80;
+    u >>= 7;
+  }
+  dst[n++] = (unsigned char)u;
+  return n;
+}
+/* Return 0 if the varint does not end within the length bytes of src, or
+   does not fit in 64 bits */
+static size_t varint_undump(unsigned long long* u, const unsigned char* src,
+			    size_t length)
+{
+  size_t n = 0;
+  unsigned shift = 0;
+  *u = 0;
+  do {
+    if (n==length || shift>=64) return 0;
+    *u |= (unsigned long long)(src[n] & 0x7f) << shift;
+    shift += 7;
+  } while (src[n++] & 0x80);
+  return n;
+}
+
+/* Return true and the zigzag encoding of a small coefficient */
+static bool numint_zigzag(unsigned long long* u, numint_t a)
+{
+  long int l;
+  if (!numint_fits_int(a)) return false;
+  int_set_numint(&l,a);
+  if (l < -(1LL<<62) || l >= (1LL<<62)) return false;
+  *u = l<0 ? ((unsigned long long)(-(l+1))<<1)|1 : (unsigned long long)l<<1;
+  return true;
+}
+
+static size_t numint_serialized_size_raw(mpz_t tmp, numint_t a)
+{
+  unsigned long long u;
+  if (numint_zigzag(&u,a))
+    return varint_size(u<<1);
+  else {
+    size_t nbytes;
+    mpz_set_numint(tmp,a);
+    nbytes = (mpz_sizeinbase(tmp,2)+7)/8;
+    return varint_size(((unsigned long long)nbytes<<2)|3) + nbytes;
+  }
+}
+static size_t numint_serialize_raw(unsigned char* dst, mpz_t tmp, numint_t a)
+{
+  unsigned long long u;
+  if (numint_zigzag(&u,a))
+    return varint_dump(dst,u<<1);
+  else {
+    size_t n,nbytes;
+    mpz_set_numint(tmp,a);
+    nbytes = (mpz_sizeinbase(tmp,2)+7)/8;
+    n = varint_dump(dst,((unsigned long long)nbytes<<2)|
+		    (mpz_sgn(tmp)<0 ? 2 : 0)|1);
+    mpz_export(dst+n,NULL,1,1,1,0,tmp);
+    return n+nbytes;
+  }
+}
+/* Read a coefficient from the length bytes of src. Return false and set
+   pk->exn if it is truncated or does not fit in numint_t */
+static bool numint_deserialize_raw(pk_internal_t* pk, numint_t a, mpz_t tmp,
+				   const unsigned char* src, size_t length,
+				   size_t* size)
+{
+  unsigned long long u;
+  size_t n = varint_undump(&u,src,length);
+  if (n==0){
+    pk->exn = AP_EXC_INVALID_ARGUMENT;
+    return false;
+  }
+  if ((u & 1)==0){
+    u >>= 1;
+    *size = n;
+    if (u & 1){
+      long int l = -(long int)(u>>1)-1;
+      numint_set_int(a,l);
+    } else {
+      numint_set_int(a,(long int)(u>>1));
+    }
+    return true;
+  }
+  else {
+    unsigned long long nbytes = u>>2;
+    if (nbytes > length-n){
+      pk->exn = AP_EXC_INVALID_ARGUMENT;
+      return false;
+    }
+    mpz_import(tmp,(size_t)nbytes,1,1,1,0,src+n);
+    if (u & 2) mpz_neg(tmp,tmp);
+    *size = n+(size_t)nbytes;
+    if (!mpz_fits_numint(tmp)){
+      pk->exn = AP_EXC_OVERFLOW;
+      return false;
+    }
+    numint_set_mpz(a,tmp);
+    return true;
+  }
+}
+
+static size_t matrix_serialized_size_raw(mpz_t tmp, matrix_t* mat)
+{
+  size_t i,j,n;
+  n = 8;
+  for (i=0; i<mat->nbrows; i++)
+    for (j=0; j<mat->nbcolumns; j++)
+      n += numint_serialized_size_raw(tmp,mat->p[i][j]);
+  return n;
+}
+static size_t matrix_serialize_raw(unsigned char* dst, mpz_t tmp,
+				   matrix_t* mat)
+{
+  size_t i,j,n;
+  num_dump_word32(dst,mat->nbrows);
+  num_dump_word32(dst+4,mat->nbcolumns);
+  n = 8;
+  for (i=0; i<mat->nbrows; i++)
+    for (j=0; j<mat->nbcolumns; j++)
+      n += numint_serialize_raw(dst+n,tmp,mat->p[i][j]);
+  return n;
+}
+/* Read a matrix from the length bytes of src. Return NULL and set pk->exn
+   if the number of columns is not nbcols, if the rows do not fit in length
+   (a coefficient takes at least one byte), or if a coefficient is
+   truncated or does not fit */
+static matrix_t* matrix_deserialize_raw(pk_internal_t* pk, mpz_t tmp,
+					const unsigned char* src, size_t length,
+					size_t* size,
+					size_t nbcols, bool sorted)
+{
+  size_t i,j,n,s;
+  size_t nbrows;
+  matrix_t* mat;
+
+  if (length<8 || num_undump_word32(src+4)!=nbcols){
+    pk->exn = AP_EXC_INVALID_ARGUMENT;
+    return NULL;
+  }
+  nbrows = num_undump_word32(src);
+  if (nbrows>0 && nbcols>(length-8)/nbrows){
+    pk->exn = AP_EXC_INVALID_ARGUMENT;
+    return NULL;
+  }
+  mat = matrix_alloc(nbrows,nbcols,sorted);
+  n = 8;
+  for (i=0; i<nbrows; i++){
+    for (j=0; j<nbcols; j++){
+      if (!numint_deserialize_raw(pk,mat->p[i][j],tmp,src+n,length-n,&s)){
+	matrix_free(mat);
+	return NULL;
+      }
+      n += s;
+    }
+  }
+  *size = n;
+  return mat;
+}
+
+/* Only the first nbrows rows and nbcols columns of sat are stored, which
+   are the meaningful ones */
+static size_t satmat_serialized_size_raw(size_t nbrows, size_t nbcols)
+{
+  return 8 + 4*nbrows*nbcols;
+}
+static size_t satmat_serialize_raw(unsigned char* dst, satmat_t* sat,
+				   size_t nbrows, size_t nbcols)
+{
+  size_t i,j,n;
+  assert(nbrows<=sat->nbrows && nbcols<=sat->nbcolumns);
+  num_dump_word32(dst,nbrows);
+  num_dump_word32(dst+4,nbcols);
+  n = 8;
+  for (i=0; i<nbrows; i++)
+    for (j=0; j<nbcols; j++){
+      num_dump_word32(dst+n,sat->p[i][j]);
+      n += 4;
+    }
+  return n;
+}
+/* Return NULL and set pk->exn if the sizes are not nbrows and nbcols or
+   if the words do not fit in the length bytes of src */
+static satmat_t* satmat_deserialize_raw(pk_internal_t* pk,
+					const unsigned char* src, size_t length,
+					size_t* size,
+					size_t nbrows, size_t nbcols)
+{
+  size_t i,j,n;
+  satmat_t* sat;
+
+  if (length<8 ||
+      num_undump_word32(src)!=nbrows || num_undump_word32(src+4)!=nbcols ||
+      (nbrows>0 && nbcols>(length-8)/4/nbrows)){
+    pk->exn = AP_EXC_INVALID_ARGUMENT;
+    return NULL;
+  }
+  sat = satmat_alloc(nbrows,nbcols);
+  n = 8;
+  for (i=0; i<nbrows; i++)
+    for (j=0; j<nbcols; j++){
+      sat->p[i][j] = (bitstring_t)num_undump_word32(src+n);
+      n += 4;
+    }
+  *size = n;
+  return sat;
+}
+
 ap_membuf_t pk_serialize_raw(ap_manager_t* man, pk_t* a)
 {
   ap_membuf_t membuf;
+  unsigned char* buf;
+  unsigned char flags;
+  size_t n,satCcols,satFcols;
+  bool withsat;
+  mpz_t tmp;
   pk_init_from_manager(man,AP_FUNID_SERIALIZE_RAW);
-  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,AP_FUNID_SERIALIZE_RAW,NULL);
-  membuf.ptr = NULL;
-  membuf.size = 0;
+  man->result.flag_exact = man->result.flag_best = true;
+
+  withsat = a->C && a->F;
+  satCcols = withsat ? bitindex_size(a->C->nbrows) : 0;
+  satFcols = withsat ? bitindex_size(a->F->nbrows) : 0;
+  mpz_init(tmp);
+  n = 19;
+  if (a->C) n += matrix_serialized_size_raw(tmp,a->C);
+  if (a->F) n += matrix_serialized_size_raw(tmp,a->F);
+  if (withsat && a->satC)
+    n += satmat_serialized_size_raw(a->F->nbrows,satCcols);
+  if (withsat && a->satF)
+    n += satmat_serialized_size_raw(a->C->nbrows,satFcols);
+  buf = (unsigned char*)malloc(n);
+  if (buf==NULL){
+    mpz_clear(tmp);
+    ap_manager_raise_exception(man,AP_EXC_OUT_OF_SPACE,AP_FUNID_SERIALIZE_RAW,NULL);
+    membuf.ptr = NULL;
+    membuf.size = 0;
+    return membuf;
+  }
+  flags =
+    (a->C ? pk_serialize_C : 0) |
+    (a->F ? pk_serialize_F : 0) |
+    (withsat && a->satC ? pk_serialize_satC : 0) |
+    (withsat && a->satF ? pk_serialize_satF : 0) |
+    (a->C && a->C->_sorted ? pk_serialize_Csorted : 0) |
+    (a->F && a->F->_sorted ? pk_serialize_Fsorted : 0);
+  buf[0] = PK_SERIALIZE_VERSION;
+  buf[1] = (unsigned char)a->status;
+  buf[2] = flags;
+  num_dump_word32(buf+3,a->intdim);
+  num_dump_word32(buf+7,a->realdim);
+  num_dump_word32(buf+11,a->nbeq);
+  num_dump_word32(buf+15,a->nbline);
+  n = 19;
+  if (a->C) n += matrix_serialize_raw(buf+n,tmp,a->C);
+  if (a->F) n += matrix_serialize_raw(buf+n,tmp,a->F);
+  if (flags & pk_serialize_satC)
+    n += satmat_serialize_raw(buf+n,a->satC,a->F->nbrows,satCcols);
+  if (flags & pk_serialize_satF)
+    n += satmat_serialize_raw(buf+n,a->satF,a->C->nbrows,satFcols);
+  mpz_clear(tmp);
+  membuf.ptr = buf;
+  membuf.size = n;
   return membuf;
 }
+
 pk_t* pk_deserialize_raw(ap_manager_t* man, void* ptr, size_t* size)
 {
-  pk_init_from_manager(man,AP_FUNID_DESERIALIZE_RAW);
-  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,AP_FUNID_DESERIALIZE_RAW,NULL);
+  const unsigned char* buf = (const unsigned char*)ptr;
+  unsigned char flags;
+  size_t intdim,realdim,nbcols,length,n,s;
+  pk_t* po;
+  mpz_t tmp;
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_DESERIALIZE_RAW);
+  man->result.flag_exact = man->result.flag_best = true;
+
+  if (size==NULL){
+    ap_manager_raise_exception(man,AP_EXC_INVALID_ARGUMENT,AP_FUNID_DESERIALIZE_RAW,
+			       "size of the buffer not given");
+    return NULL;
+  }
+  length = *size;
+  *size = 0;
+  if (length<19 || buf[0]!=PK_SERIALIZE_VERSION){
+    ap_manager_raise_exception(man,AP_EXC_INVALID_ARGUMENT,AP_FUNID_DESERIALIZE_RAW,
+			       "unknown format");
+    return NULL;
+  }
+  flags = buf[2];
+  intdim = num_undump_word32(buf+3);
+  realdim = num_undump_word32(buf+7);
+  nbcols = pk->dec + intdim + realdim;
+
+  po = poly_alloc(intdim,realdim);
+  po->nbeq = num_undump_word32(buf+11);
+  po->nbline = num_undump_word32(buf+15);
+  n = 19;
+  mpz_init(tmp);
+  if (flags & pk_serialize_C){
+    po->C = matrix_deserialize_raw(pk,tmp,buf+n,length-n,&s,nbcols,
+				   flags & pk_serialize_Csorted);
+    if (!po->C) goto pk_deserialize_raw_exit;
+    n += s;
+  }
+  if (flags & pk_serialize_F){
+    po->F = matrix_deserialize_raw(pk,tmp,buf+n,length-n,&s,nbcols,
+				   flags & pk_serialize_Fsorted);
+    if (!po->F) goto pk_deserialize_raw_exit;
+    n += s;
+  }
+  if (flags & pk_serialize_satC){
+    if (!po->C || !po->F){
+      pk->exn = AP_EXC_INVALID_ARGUMENT;
+      goto pk_deserialize_raw_exit;
+    }
+    po->satC = satmat_deserialize_raw(pk,buf+n,length-n,&s,po->F->nbrows,
+				      bitindex_size(po->C->nbrows));
+    if (!po->satC) goto pk_deserialize_raw_exit;
+    n += s;
+  }
+  if (flags & pk_serialize_satF){
+    if (!po->C || !po->F){
+      pk->exn = AP_EXC_INVALID_ARGUMENT;
+      goto pk_deserialize_raw_exit;
+    }
+    po->satF = satmat_deserialize_raw(pk,buf+n,length-n,&s,po->C->nbrows,
+				      bitindex_size(po->F->nbrows));
+    if (!po->satF) goto pk_deserialize_raw_exit;
+    n += s;
+  }
+  if ((po->C && po->nbeq>po->C->nbrows) ||
+      (po->F && po->nbline>po->F->nbrows)){
+    pk->exn = AP_EXC_INVALID_ARGUMENT;
+    goto pk_deserialize_raw_exit;
+  }
+  mpz_clear(tmp);
+  if (po->C || po->F)
+    pk_internal_realloc_lazy(pk,intdim+realdim);
+  po->status = (pk_status_t)buf[1];
+  *size = n;
+  assert(poly_check(pk,po));
+  return po;
+
+ pk_deserialize_raw_exit:
+  mpz_clear(tmp);
+  ap_manager_raise_exception(man,pk->exn,AP_FUNID_DESERIALIZE_RAW,
+			     pk->exn==AP_EXC_OVERFLOW ?
+			     "coefficient too large for the underlying numbers" :
+			     "truncated buffer or dimensions do not match the manager");
+  pk->exn = AP_EXC_NONE;
+  man->result.flag_exact = man->result.flag_best = false;
+  pk_free(man,po);
   return NULL;
 }
 
@@ -641,7 +1061,7 @@ bool matrix_check_gauss(matrix_t* mat, size_t nbeq)
 }
 
 
-bool poly_check(pk_internal_t* pk, pk_t* po)
+static bool poly_check_aux(pk_internal_t* pk, pk_t* po)
 {
   bool res;
   size_t nbdim,nbcols;
@@ -804,6 +1224,16 @@ bool poly_check(pk_internal_t* pk, pk_t* po)
   return true;
 }
 
+/* The scalar products computed by the checks may overflow; the exception
+   state of the caller is left untouched. */
+bool poly_check(pk_internal_t* pk, pk_t* po)
+{
+  ap_exc_t exn = pk->exn;
+  bool res = poly_check_aux(pk,po);
+  pk->exn = exn;
+  return res;
+}
+
 bool poly_check_dual(pk_internal_t* pk, pk_t* po, bool usual)
 {
   bool res;
@@ -57,6 +57,13 @@ static inline bool poly_is_conseps(pk_internal_t* pk, pk_t* po);
 /* Is the polyhedron under (strong) normal form ? */
 bool pk_is_canonical(ap_manager_t* man, pk_t* po);
 
+/* Fingerprint of the constraints of the polyhedron, independent of the order
+   of the rows. Two polyhedra in canonical form (poly_chernikova3) are equal
+   iff their constraints are equal, and then they have the same fingerprint.
+   In the absence of equalities, the minimized constraints are unique up to
+   their order, so that poly_chernikova2 is enough. */
+int poly_fingerprint(pk_internal_t* pk, pk_t* po);
+
 /* Make available the matrix of constraints (resp. frames). The matrix will
    remain unavailable iff the polyhedron appears to be empty */
 static inline void poly_obtain_C(ap_manager_t* man, pk_t* po, char* msg);
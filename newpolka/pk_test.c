@@ -15,6 +15,7 @@
 #include "pk_constructor.h"
 #include "pk_extract.h"
 #include "pk_test.h"
+#include "pk_lp.h"
 #include "itv_linearize.h"
 
 /* ====================================================================== */
@@ -34,7 +35,14 @@ bool pk_is_bottom(ap_manager_t* man, pk_t* po)
       return false;
   }
   else {
-    if (pk->funopt->algorithm<0){
+    if (poly_is_constraint_only(pk,po)){
+      bool res = lp_is_empty(pk,po->C);
+      if (res) poly_set_bottom(pk,po);
+      man->result.flag_exact = man->result.flag_best =
+	po->intdim>0 && !res ? false : true;
+      return res;
+    }
+    else if (pk->funopt->algorithm<0){
       man->result.flag_exact = man->result.flag_best = false;
       return (po->C ? false : true);
     }
@@ -135,27 +143,115 @@ bool do_generators_sat_vector(pk_internal_t* pk, matrix_t* F, numint_t* tab, boo
   }
 }
 
+/* ---------------------------------------------------------------------- */
+/* Cache of inclusion and equality tests */
+/* ---------------------------------------------------------------------- */
+
+/* Are C the canonical constraints of po ? */
+static bool poly_cache_match(pk_t* po, matrix_t* C)
+{
+  return
+    (po->C==NULL && C==NULL) ||
+    (po->C!=NULL && C!=NULL && matrix_equal(po->C,C));
+}
+
+/* Put pa and pb in canonical form, and return the entry of the cache
+   associated to the test funid on pa and pb, or NULL if the cache is
+   disabled or if an exception occured. *found tells whether the entry
+   records the result of the test.
+
+   Constraint-only polyhedra are not cached: the canonical form would
+   require their generators, which the test itself avoids. */
+static pk_cache_entry_t* poly_cache_lookup(ap_manager_t* man,
+					   ap_funid_t funid,
+					   pk_t* pa, pk_t* pb,
+					   bool* found)
+{
+  unsigned int hash;
+  pk_cache_entry_t* entry;
+  pk_internal_t* pk = (pk_internal_t*)man->internal;
+
+  *found = false;
+  if (pk->cache_size==0 ||
+      poly_is_constraint_only(pk,pa) || poly_is_constraint_only(pk,pb))
+    return NULL;
+  poly_chernikova3(man,pa,"of the first argument");
+  if (!pk->exn)
+    poly_chernikova3(man,pb,"of the second argument");
+  if (pk->exn){
+    pk->exn = AP_EXC_NONE;
+    return NULL;
+  }
+  hash =
+    (unsigned int)poly_fingerprint(pk,pa)*31 +
+    (unsigned int)poly_fingerprint(pk,pb) + funid;
+  entry = &pk->cache[hash % pk->cache_size];
+  *found =
+    entry->funid==funid &&
+    entry->intdim==pa->intdim && entry->realdim==pa->realdim &&
+    poly_cache_match(pa,entry->Ca) && poly_cache_match(pb,entry->Cb);
+  return entry;
+}
+
+/* Record in the entry the result of the test funid on pa and pb */
+static void poly_cache_store(ap_manager_t* man,
+			     pk_cache_entry_t* entry, ap_funid_t funid,
+			     pk_t* pa, pk_t* pb, bool res)
+{
+  if (entry->Ca) matrix_free(entry->Ca);
+  if (entry->Cb) matrix_free(entry->Cb);
+  entry->funid = funid;
+  entry->intdim = pa->intdim;
+  entry->realdim = pa->realdim;
+  entry->Ca = pa->C ? matrix_copy(pa->C) : NULL;
+  entry->Cb = pb->C ? matrix_copy(pb->C) : NULL;
+  entry->res = res;
+  entry->flag_exact = man->result.flag_exact;
+  entry->flag_best = man->result.flag_best;
+}
+
+/* Look for the result of the test funid on pa and pb in the cache, and
+   otherwise compute it with the function test and record it. */
+static bool poly_cache_test(ap_manager_t* man, ap_funid_t funid,
+			    bool (*test)(ap_manager_t*, pk_t*, pk_t*),
+			    pk_t* pa, pk_t* pb)
+{
+  bool found,res;
+  pk_cache_entry_t* entry;
+
+  entry = poly_cache_lookup(man,funid,pa,pb,&found);
+  if (found){
+    man->result.flag_exact = entry->flag_exact;
+    man->result.flag_best = entry->flag_best;
+    return entry->res;
+  }
+  res = test(man,pa,pb);
+  if (entry)
+    poly_cache_store(man,entry,funid,pa,pb,res);
+  return res;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Inclusion test */
+/* ---------------------------------------------------------------------- */
+
 /* This test requires frames of pa and constraints of pb. The
    result is true if and only if all frames of pa verify the
    constraints of pb. We do not require minimality. */
 
-bool pk_is_leq(ap_manager_t* man, pk_t* pa, pk_t* pb)
+static bool poly_is_leq(ap_manager_t* man, pk_t* pa, pk_t* pb)
 {
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_IS_LEQ);
 
   assert(poly_check(pk,pa));
   assert(poly_check(pk,pb));
   man->result.flag_exact = man->result.flag_best = false;
-  if (pk->funopt->algorithm>0)
-    poly_chernikova(man,pa,"of the first argument");
-  else
-    poly_obtain_F(man,pa,"of the first argument");
-
+  poly_obtain_F_or_lp(man,pa,"of the first argument");
   if (pk->exn){
     pk->exn = AP_EXC_NONE;
     return false;
   }
-  if (!pa->F){ /* pa is empty */
+  if (!pa->C && !pa->F){ /* pa is empty */
     man->result.flag_exact = man->result.flag_best = true;
     return true;
   }
@@ -186,21 +282,28 @@ bool pk_is_leq(ap_manager_t* man, pk_t* pa, pk_t* pb)
     /* does the frames of pa satisfy constraints of pb ? */
     size_t i;
     for (i=0; i<pb->C->nbrows; i++){
-      bool sat = do_generators_sat_vector(pk,
-					  pa->F,
-					  pb->C->p[i],
-					  pk->strict &&
-					  numint_sgn(pb->C->p[i][polka_eps])<0);
+      bool is_strict = pk->strict && numint_sgn(pb->C->p[i][polka_eps])<0;
+      bool sat = pa->F ?
+	do_generators_sat_vector(pk,pa->F,pb->C->p[i],is_strict) :
+	lp_sat_vector(pk,pa->C,pb->C->p[i],is_strict);
       if (sat==false) return false;
     }
     return true;
   }
 }
 
+bool pk_is_leq(ap_manager_t* man, pk_t* pa, pk_t* pb)
+{
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_IS_LEQ);
+  return pk->cache_size>0 ?
+    poly_cache_test(man,AP_FUNID_IS_LEQ,&poly_is_leq,pa,pb) :
+    poly_is_leq(man,pa,pb);
+}
+
 /* ====================================================================== */
 /* Equality test */
 /* ====================================================================== */
-bool pk_is_eq(ap_manager_t* man, pk_t* pa, pk_t* pb)
+static bool poly_is_eq(ap_manager_t* man, pk_t* pa, pk_t* pb)
 {
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_IS_EQ);
 
@@ -210,6 +313,9 @@ bool pk_is_eq(ap_manager_t* man, pk_t* pa, pk_t* pb)
       (pa->nbeq != pb->nbeq || pa->nbline != pb->nbline) ){
     return false;
   }
+  if (poly_is_constraint_only(pk,pa) || poly_is_constraint_only(pk,pb)){
+    return pk_is_leq(man,pa,pb) && pk_is_leq(man,pb,pa);
+  }
   if (pk->funopt->algorithm>0){
     poly_chernikova3(man,pa,"of the first argument");
     if (pk->exn){
@@ -238,6 +344,14 @@ bool pk_is_eq(ap_manager_t* man, pk_t* pa, pk_t* pb)
   }
 }
 
+bool pk_is_eq(ap_manager_t* man, pk_t* pa, pk_t* pb)
+{
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_IS_EQ);
+  return pk->cache_size>0 ?
+    poly_cache_test(man,AP_FUNID_IS_EQ,&poly_is_eq,pa,pb) :
+    poly_is_eq(man,pa,pb);
+}
+
 /* ====================================================================== */
 /* Satisfiability of a linear constraint */
 /* ====================================================================== */
@@ -249,16 +363,12 @@ bool pk_sat_lincons(ap_manager_t* man, pk_t* po, ap_lincons0_t* lincons0)
   size_t dim;
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_SAT_LINCONS);
 
-  if (pk->funopt->algorithm>0)
-    poly_chernikova(man,po,NULL);
-  else
-    poly_obtain_F(man,po,NULL);
-
+  poly_obtain_F_or_lp(man,po,NULL);
   if (pk->exn){
     pk->exn = AP_EXC_NONE;
     return false;
   }
-  if (!po->F){ /* po is empty */
+  if (!po->C && !po->F){ /* po is empty */
     man->result.flag_exact = man->result.flag_best = true;
     return true;
   }
@@ -274,7 +384,7 @@ bool pk_sat_lincons(ap_manager_t* man, pk_t* po, ap_lincons0_t* lincons0)
   dim = po->intdim + po->realdim;
 
   if (!ap_linexpr0_is_quasilinear(lincons0->linexpr0)){
-    itv_t* env = matrix_to_box(pk,po->F);
+    itv_t* env = po->F ? matrix_to_box(pk,po->F) : lp_to_box(pk,po->C);
     exact = itv_lincons_set_ap_lincons0(pk->itv,
 					&pk->poly_itv_lincons,
 					lincons0);
@@ -295,9 +405,13 @@ bool pk_sat_lincons(ap_manager_t* man, pk_t* po, ap_lincons0_t* lincons0)
 				   &pk->poly_itv_lincons,
 				   po->intdim, po->realdim, true);
   if (sat){
-    sat = do_generators_sat_vector(pk,po->F,
-				   pk->poly_numintp,
-				   lincons0->constyp==AP_CONS_SUP);
+    sat = po->F ?
+      do_generators_sat_vector(pk,po->F,
+			       pk->poly_numintp,
+			       lincons0->constyp==AP_CONS_SUP) :
+      lp_sat_vector(pk,po->C,
+		    pk->poly_numintp,
+		    lincons0->constyp==AP_CONS_SUP);
   }
   man->result.flag_exact = man->result.flag_best =
     sat ?
@@ -316,16 +430,12 @@ bool pk_sat_tcons(ap_manager_t* man, pk_t* po, ap_tcons0_t* cons)
   size_t dim;
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_SAT_LINCONS);
 
-  if (pk->funopt->algorithm>0)
-    poly_chernikova(man,po,NULL);
-  else
-    poly_obtain_F(man,po,NULL);
-
+  poly_obtain_F_or_lp(man,po,NULL);
   if (pk->exn){
     pk->exn = AP_EXC_NONE;
     return false;
   }
-  if (!po->F){ /* po is empty */
+  if (!po->C && !po->F){ /* po is empty */
     man->result.flag_exact = man->result.flag_best = true;
     return true;
   }
@@ -340,7 +450,7 @@ bool pk_sat_tcons(ap_manager_t* man, pk_t* po, ap_tcons0_t* cons)
   }
   dim = po->intdim + po->realdim;
 
-  itv_t* env = matrix_to_box(pk,po->F);
+  itv_t* env = po->F ? matrix_to_box(pk,po->F) : lp_to_box(pk,po->C);
   itv_intlinearize_ap_tcons0(pk->itv,&pk->poly_itv_lincons,
 			     cons,env,po->intdim);
   itv_quasilinearize_lincons(pk->itv,&pk->poly_itv_lincons,env,false);
@@ -350,9 +460,13 @@ bool pk_sat_tcons(ap_manager_t* man, pk_t* po, ap_tcons0_t* cons)
 					&pk->poly_itv_lincons,
 					po->intdim, po->realdim, true);
   if (sat){
-    sat = do_generators_sat_vector(pk,po->F,
-				   pk->poly_numintp,
-				   cons->constyp==AP_CONS_SUP);
+    sat = po->F ?
+      do_generators_sat_vector(pk,po->F,
+			       pk->poly_numintp,
+			       cons->constyp==AP_CONS_SUP) :
+      lp_sat_vector(pk,po->C,
+		    pk->poly_numintp,
+		    cons->constyp==AP_CONS_SUP);
   }
   man->result.flag_exact = man->result.flag_best = sat;
   return sat;
@@ -422,22 +536,26 @@ bool pk_sat_interval(ap_manager_t* man, pk_t* po,
   bool sat;
   pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_SAT_INTERVAL);
 
-  if (pk->funopt->algorithm>0)
-    poly_chernikova(man,po,NULL);
-  else
-    poly_obtain_F(man,po,NULL);
-
+  poly_obtain_F_or_lp(man,po,NULL);
   if (pk->exn){
     pk->exn = AP_EXC_NONE;
     return false;
   }
-  if (!po->F){ /* po is empty */
+  if (!po->C && !po->F){ /* po is empty */
     man->result.flag_exact = man->result.flag_best = true;
     return true;
   }
   itv_set_ap_interval(pk->itv,
 		      pk->poly_itv, interval);
-  if (itv_is_point(pk->itv, pk->poly_itv)){
+  if (!po->F){
+    /* bound the dimension by linear programming */
+    itv_t itv;
+    itv_init(itv);
+    lp_bound_dimension(pk,itv,dim,po->C);
+    sat = itv_is_leq(itv,pk->poly_itv);
+    itv_clear(itv);
+  }
+  else if (itv_is_point(pk->itv, pk->poly_itv)){
     /* interval is a point */
     sat = do_generators_sat_bound(pk,po->F,dim,pk->poly_itv->sup,0);
   }
@@ -83,6 +83,81 @@ void vector_print(numint_t* q, size_t size)
   printf("\n");
 }
 
+#if defined(NUMINT_NATIVE)
+/* ====================================================================== */
+/* Native integer kernels */
+/* ====================================================================== */
+
+/* With native integers, a row of numint_t is a contiguous array of
+   numint_native. The following kernels are plain loops over such arrays,
+   with local accumulators and no test inside the loop, so that the compiler
+   vectorizes them.
+
+   With PK_NUMINT_CHECKED, overflows are excluded beforehand by bounding the
+   magnitude of the operands: the or-reduction vector_native_or, which
+   vectorizes as well, returns m such that |q[j]| <= 2^vector_native_bits(m)
+   for all j. A sum of size products of such numbers fits if the numbers of
+   bits add up to at most NUMINT_BITS-2. */
+
+#define NUMINT_BITS ((int)sizeof(numint_native)*8)
+
+static inline numint_native vector_native_or(numint_t* q, size_t size)
+{
+  size_t j;
+  numint_native* v = (numint_native*)q;
+  numint_native m = 0;
+  for (j=0; j<size; j++){
+    /* |v[j]|, or |v[j]|-1 for a negative number */
+    m |= v[j] ^ (v[j] >> (NUMINT_BITS-1));
+  }
+  return m;
+}
+static inline int vector_native_bits(numint_native m)
+{
+  return m ?
+    (int)sizeof(unsigned long long)*8 - __builtin_clzll((unsigned long long)m) :
+    0;
+}
+/* Can a sum of n products of numbers bounded by m1 and m2 overflow ? */
+static inline bool vector_native_fits(numint_native m1, numint_native m2,
+				      size_t n)
+{
+#if defined(PK_NUMINT_CHECKED)
+  return
+    vector_native_bits(m1) + vector_native_bits(m2) +
+    vector_native_bits((numint_native)n) <= NUMINT_BITS-2;
+#else
+  return true;
+#endif
+}
+static inline numint_native vector_native_product(numint_t* q1, numint_t* q2,
+						  size_t size)
+{
+  size_t j;
+  numint_native* v1 = (numint_native*)q1;
+  numint_native* v2 = (numint_native*)q2;
+  numint_native acc = 0;
+  for (j=0; j<size; j++){
+    acc += v1[j]*v2[j];
+  }
+  return acc;
+}
+/* q3 may be equal to q1 or q2 */
+static inline void vector_native_combine(numint_t* q3,
+					 numint_t* q1, numint_t* q2,
+					 numint_native a2, numint_native a1,
+					 size_t size)
+{
+  size_t j;
+  numint_native* v1 = (numint_native*)q1;
+  numint_native* v2 = (numint_native*)q2;
+  numint_native* v3 = (numint_native*)q3;
+  for (j=0; j<size; j++){
+    v3[j] = a2*v1[j] - a1*v2[j];
+  }
+}
+#endif
+
 /* ********************************************************************** */
 /* II. Normalization */
 /* ********************************************************************** */
@@ -147,6 +222,14 @@ void vector_gcd(pk_internal_t* pk,
 		numint_t* q, size_t size, numint_t gcd)
 {
   size_t i;
+#if defined(NUMINT_NATIVE)
+  /* Accumulate the gcd of the coefficients: most rows have a gcd of 1,
+     which is often detected after the first nonzero coefficients. */
+  numint_set_int(gcd,0);
+  for (i=0; i<size && numint_cmp_int(gcd,1)!=0; i++){
+    if (numint_sgn(q[i])) numint_gcd(gcd,gcd,q[i]);
+  }
+#else
   bool not_all_zero;
   numint_t* v = pk->vector_numintp; 
 
@@ -164,6 +247,7 @@ void vector_gcd(pk_internal_t* pk,
 	not_all_zero = not_all_zero || numint_sgn(v[i]);
       }
   } while (not_all_zero);
+#endif
 }
 
 
@@ -362,6 +446,106 @@ int vector_compare(pk_internal_t* pk,
 /* IV. Combine function */
 /* ********************************************************************** */
 
+#if defined(PK_NUMINT_CHECKED)
+/* With PK_NUMINT_CHECKED, vector_combine and vector_product first compute
+   with native integers and overflow checks. If an intermediate result
+   overflows, the row is computed again with GMP integers in
+   pk->vector_mpzp, and copied back if it fits in native integers after
+   normalization; otherwise pk->exn is set to AP_EXC_OVERFLOW and the
+   row q3 is left unchanged. */
+
+/* Test if |z| < 2^(bits of numint_t - 1), so that negating the result
+   does not overflow either */
+static inline bool vector_mpz_fits(mpz_t z)
+{
+  return mpz_sizeinbase(z,2) < sizeof(numint_t)*8;
+}
+
+/* Normalize z[1..size-1] (z[0] is not considered) and copy it into q.
+   Return false if some coefficient does not fit. */
+static bool vector_set_mpz(pk_internal_t* pk,
+			   numint_t* q, mpz_t* z, size_t size)
+{
+  size_t j;
+  mpz_ptr gcd = z[0];
+
+  mpz_set_ui(gcd,0);
+  for (j=1; j<size; j++){
+    mpz_gcd(gcd,gcd,z[j]);
+  }
+  if (mpz_cmp_ui(gcd,1)>0){
+    for (j=1; j<size; j++){
+      mpz_divexact(z[j],z[j],gcd);
+    }
+  }
+  for (j=1; j<size; j++){
+    if (!vector_mpz_fits(z[j])) return false;
+  }
+  for (j=1; j<size; j++){
+    numint_set_mpz(q[j],z[j]);
+  }
+  return true;
+}
+
+/* Slow path of vector_combine. The multipliers are pk->vector_tmp[1] and
+   pk->vector_tmp[2]. q3 is modified only if the result fits. */
+static bool vector_combine_mpz(pk_internal_t* pk,
+			       numint_t* q1, numint_t* q2,
+			       numint_t* q3, size_t k, size_t size)
+{
+  size_t j;
+  mpz_t* z = pk->vector_mpzp;
+  mpz_t a1,a2,tmp;
+  bool res;
+
+  assert(size<=pk->maxcols);
+  mpz_init(a1); mpz_init(a2); mpz_init(tmp);
+  mpz_set_numint(a1,pk->vector_tmp[1]);
+  mpz_set_numint(a2,pk->vector_tmp[2]);
+  for (j=1; j<size; j++){
+    if (j!=k){
+      mpz_set_numint(tmp,q1[j]);
+      mpz_mul(z[j],a2,tmp);
+      mpz_set_numint(tmp,q2[j]);
+      mpz_submul(z[j],a1,tmp);
+    }
+    else {
+      mpz_set_ui(z[j],0);
+    }
+  }
+  res = vector_set_mpz(pk,q3,z,size);
+  mpz_clear(a1); mpz_clear(a2); mpz_clear(tmp);
+  return res;
+}
+
+/* Slow path of vector_product: computes the sum of the products of
+   columns polka_cst and jstart..size-1 */
+static void vector_product_mpz(pk_internal_t* pk,
+			       numint_t prod,
+			       numint_t* q1, numint_t* q2,
+			       size_t jstart, size_t size)
+{
+  size_t j;
+  mpz_t* z = pk->vector_mpzp;
+
+  assert(pk->maxcols>=3);
+  mpz_set_ui(z[0],0);
+  for (j=polka_cst; j<size; j = (j==polka_cst) ? jstart : j+1){
+    mpz_set_numint(z[1],q1[j]);
+    mpz_set_numint(z[2],q2[j]);
+    mpz_addmul(z[0],z[1],z[2]);
+  }
+  if (vector_mpz_fits(z[0])){
+    numint_set_mpz(prod,z[0]);
+  }
+  else {
+    /* The sign is still right, which is enough for saturation tests */
+    *prod = mpz_sgn(z[0])>0 ? NUMINT_MAX : -NUMINT_MAX;
+    pk->exn = AP_EXC_OVERFLOW;
+  }
+}
+#endif
+
 /* vector_combine computes a combination q3 of q1 and
    q2 such that q3[k]=0.  The first coefficient is never
    considered for computations, except when k==0.
@@ -376,6 +560,39 @@ void vector_combine(pk_internal_t* pk,
   numint_gcd(pk->vector_tmp[0],q1[k],q2[k]);
   numint_divexact(pk->vector_tmp[1],q1[k],pk->vector_tmp[0]);
   numint_divexact(pk->vector_tmp[2],q2[k],pk->vector_tmp[0]);
+#if defined(NUMINT_NATIVE)
+  if (vector_native_fits(vector_native_or(&pk->vector_tmp[1],2),
+			 vector_native_or(&q1[1],size-1) |
+			 vector_native_or(&q2[1],size-1),
+			 2)){
+    /* q3[k] is computed as 0 */
+    vector_native_combine(&q3[1],&q1[1],&q2[1],
+			  *pk->vector_tmp[2],*pk->vector_tmp[1],size-1);
+    goto vector_combine_end;
+  }
+#endif
+#if defined(PK_NUMINT_CHECKED)
+  /* The row is computed in pk->vector_numintp, as q3 may be q1 or q2 */
+  for (j=1;j<size;j++){
+    if (j!=k){
+      if (__builtin_mul_overflow(*pk->vector_tmp[2],*q1[j],pk->vector_tmp[3]) ||
+	  __builtin_mul_overflow(*pk->vector_tmp[1],*q2[j],pk->vector_tmp[4]) ||
+	  __builtin_sub_overflow(*pk->vector_tmp[3],*pk->vector_tmp[4],pk->vector_numintp[j]))
+	break;
+    }
+  }
+  if (j<size){
+    if (!vector_combine_mpz(pk,q1,q2,q3,k,size)){
+      pk->exn = AP_EXC_OVERFLOW;
+      return;
+    }
+  }
+  else {
+    for (j=1;j<size;j++){
+      if (j!=k) numint_set(q3[j],pk->vector_numintp[j]);
+    }
+  }
+#else
   for (j=1;j<size;j++){
     if (j!=k){
       numint_mul(pk->vector_tmp[3],pk->vector_tmp[2],q1[j]);
@@ -383,6 +600,10 @@ void vector_combine(pk_internal_t* pk,
       numint_sub(q3[j],pk->vector_tmp[3],pk->vector_tmp[4]);
     }
   }
+#endif
+#if defined(NUMINT_NATIVE)
+ vector_combine_end:
+#endif
   numint_set_int(q3[k],0);
   vector_normalize(pk,q3,size);
 
@@ -411,10 +632,27 @@ void vector_product(pk_internal_t* pk,
 		    numint_t* q1, numint_t* q2, size_t size)
 {
   size_t j;
+#if defined(NUMINT_NATIVE)
+  if (size>1 &&
+      vector_native_fits(vector_native_or(&q1[1],size-1),
+			 vector_native_or(&q2[1],size-1),
+			 size-1)){
+    *prod = vector_native_product(&q1[1],&q2[1],size-1);
+    return;
+  }
+#endif
   numint_set_int(prod,0);
   for (j=1; j<size; j++){
+#if defined(PK_NUMINT_CHECKED)
+    if (__builtin_mul_overflow(*q1[j],*q2[j],pk->vector_tmp[0]) ||
+	__builtin_add_overflow(*prod,*pk->vector_tmp[0],prod)){
+      vector_product_mpz(pk,prod,q1,q2,polka_cst+1,size);
+      return;
+    }
+#else
     numint_mul(pk->vector_tmp[0],q1[j],q2[j]);
     numint_add(prod,prod,pk->vector_tmp[0]);
+#endif
   }
 }
 
@@ -426,16 +664,42 @@ void vector_product_strict(pk_internal_t* pk,
 			   numint_t* q1, numint_t* q2, size_t size)
 {
   size_t j;
-  if (polka_cst<size){
-    numint_mul(prod,q1[polka_cst],q2[polka_cst]);
-  }
-  else {
+  if (polka_cst>=size){
     numint_set_int(prod,0);
     return;
   }
+#if defined(NUMINT_NATIVE)
+  if (vector_native_fits(vector_native_or(&q1[polka_cst],1) |
+			 vector_native_or(&q1[pk->dec],size-pk->dec),
+			 vector_native_or(&q2[polka_cst],1) |
+			 vector_native_or(&q2[pk->dec],size-pk->dec),
+			 size-pk->dec+1)){
+    *prod = *q1[polka_cst] * *q2[polka_cst] +
+      vector_native_product(&q1[pk->dec],&q2[pk->dec],size-pk->dec);
+    return;
+  }
+#endif
+  /* the constant coefficients are multiplied only here, once the bound
+     above has failed, so that their product is checked first */
+#if defined(PK_NUMINT_CHECKED)
+  if (__builtin_mul_overflow(*q1[polka_cst],*q2[polka_cst],prod)){
+    vector_product_mpz(pk,prod,q1,q2,pk->dec,size);
+    return;
+  }
+#else
+  numint_mul(prod,q1[polka_cst],q2[polka_cst]);
+#endif
   for (j=pk->dec; j<size; j++){
+#if defined(PK_NUMINT_CHECKED)
+    if (__builtin_mul_overflow(*q1[j],*q2[j],pk->vector_tmp[0]) ||
+	__builtin_add_overflow(*prod,*pk->vector_tmp[0],prod)){
+      vector_product_mpz(pk,prod,q1,q2,pk->dec,size);
+      return;
+    }
+#else
     numint_mul(pk->vector_tmp[0],q1[j],q2[j]);
     numint_add(prod,prod,pk->vector_tmp[0]);
+#endif
   }
 }
 
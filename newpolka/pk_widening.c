@@ -68,8 +68,8 @@ typedef struct qsort_man_t {
 static int qsort_rows_compar(void* qsort_man, const void* p1, const void* p2)
 {
   qsort_man_t* qm = (qsort_man_t*)qsort_man;
-  return (bitstring_cmp( ((satmat_row_t*)p1)->p,
-			 ((satmat_row_t*)p2)->p,
+  return (bitstring_cmp( ((const satmat_row_t*)p1)->p,
+			 ((const satmat_row_t*)p2)->p,
 			 qm->size));
 }
 
@@ -0,0 +1,1603 @@
+/* ********************************************************************** */
+/* pkd.c: decomposed polyhedra on top of NewPolka polyhedra */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "pk.h"
+#include "pkd.h"
+
+#include "ap_generic.h"
+
+/* ********************************************************************** */
+/* 0. Datatypes and internal functions */
+/* ********************************************************************** */
+
+typedef struct pkd_internal_t {
+  ap_manager_t* man;  /* NewPolka manager working on blocks */
+  ap_funid_t funid;   /* current function */
+} pkd_internal_t;
+
+typedef struct pkd_block_t {
+  size_t size;    /* number of dimensions of the block */
+  size_t intdim;  /* number of integer dimensions among them */
+  ap_dim_t* dim;  /* sorted global dimensions, of size size */
+  pk_t* poly;     /* polyhedron on the local dimensions 0..size-1 */
+} pkd_block_t;
+
+struct pkd_t {
+  size_t intdim;
+  size_t realdim;
+  bool bottom;
+  size_t nbblocks;
+  pkd_block_t* block; /* blocks with pairwise disjoint dimensions,
+			 never empty unless bottom is true */
+};
+
+#define PKD_NOBLOCK ((size_t)(-1))
+
+static pkd_internal_t* pkd_init_from_manager(ap_manager_t* man, ap_funid_t funid)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  pr->funid = funid;
+  pr->man->option.funopt[funid] = man->option.funopt[funid];
+  man->result.flag_exact = man->result.flag_best = true;
+  return pr;
+}
+
+/* Collect the flags and exceptions of the last operation on a block */
+static void pkd_update(ap_manager_t* man)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  ap_manager_t* pman = pr->man;
+
+  man->result.flag_exact = man->result.flag_exact && pman->result.flag_exact;
+  man->result.flag_best = man->result.flag_best && pman->result.flag_best;
+  if (pman->result.exn != AP_EXC_NONE){
+    ap_exc_t exn = pman->result.exn;
+    pman->result.exn = AP_EXC_NONE;
+    ap_manager_clear_exclog(pman);
+    ap_manager_raise_exception(man,exn,pr->funid,"raised on a block");
+  }
+}
+
+static inline size_t pkd_dims(pkd_t* a)
+{ return a->intdim+a->realdim; }
+
+static pkd_t* pkd_alloc(size_t intdim, size_t realdim)
+{
+  pkd_t* a = (pkd_t*)malloc(sizeof(pkd_t));
+  a->intdim = intdim;
+  a->realdim = realdim;
+  a->bottom = false;
+  a->nbblocks = 0;
+  a->block = NULL;
+  return a;
+}
+
+static void pkd_block_clear(ap_manager_t* pman, pkd_block_t* b)
+{
+  if (b->poly) pk_free(pman,b->poly);
+  free(b->dim);
+  b->poly = NULL;
+  b->dim = NULL;
+  b->size = 0;
+}
+
+/* Add an uninitialized block at the end */
+static pkd_block_t* pkd_block_add(pkd_t* a)
+{
+  a->block = (pkd_block_t*)realloc(a->block,(a->nbblocks+1)*sizeof(pkd_block_t));
+  a->nbblocks++;
+  return &a->block[a->nbblocks-1];
+}
+
+static void pkd_block_set(pkd_t* a, pkd_block_t* b,
+			  ap_dim_t* dim, size_t size, pk_t* poly)
+{
+  size_t j;
+  b->dim = dim;
+  b->size = size;
+  b->intdim = 0;
+  for (j=0; j<size; j++){
+    if (dim[j] < a->intdim) b->intdim++;
+  }
+  b->poly = poly;
+}
+
+/* Remove the blocks with a NULL polyhedron */
+static void pkd_compact(ap_manager_t* pman, pkd_t* a)
+{
+  size_t i,j;
+  j = 0;
+  for (i=0; i<a->nbblocks; i++){
+    if (a->block[i].poly){
+      a->block[j++] = a->block[i];
+    }
+    else {
+      pkd_block_clear(pman,&a->block[i]);
+    }
+  }
+  a->nbblocks = j;
+}
+
+static void pkd_set_bottom(ap_manager_t* pman, pkd_t* a)
+{
+  size_t i;
+  for (i=0; i<a->nbblocks; i++){
+    pkd_block_clear(pman,&a->block[i]);
+  }
+  free(a->block);
+  a->block = NULL;
+  a->nbblocks = 0;
+  a->bottom = true;
+}
+
+static pkd_t* pkd_copy_internal(ap_manager_t* pman, pkd_t* a)
+{
+  size_t i;
+  pkd_t* res = pkd_alloc(a->intdim,a->realdim);
+  res->bottom = a->bottom;
+  res->nbblocks = a->nbblocks;
+  res->block = a->nbblocks ? (pkd_block_t*)malloc(a->nbblocks*sizeof(pkd_block_t)) : NULL;
+  for (i=0; i<a->nbblocks; i++){
+    pkd_block_t* b = &a->block[i];
+    res->block[i] = *b;
+    res->block[i].dim = (ap_dim_t*)malloc(b->size*sizeof(ap_dim_t));
+    memcpy(res->block[i].dim,b->dim,b->size*sizeof(ap_dim_t));
+    res->block[i].poly = pk_copy(pman,b->poly);
+  }
+  return res;
+}
+
+static void pkd_free_internal(ap_manager_t* pman, pkd_t* a)
+{
+  pkd_set_bottom(pman,a);
+  free(a);
+}
+
+/* Fill owner[d] with the index of the block of dimension d (or PKD_NOBLOCK),
+   and local[d] with its rank in the block; arrays of size pkd_dims(a) */
+static void pkd_owner(pkd_t* a, size_t* owner, ap_dim_t* local)
+{
+  size_t i,j;
+  for (i=0; i<pkd_dims(a); i++){
+    owner[i] = PKD_NOBLOCK;
+    local[i] = AP_DIM_MAX;
+  }
+  for (i=0; i<a->nbblocks; i++){
+    for (j=0; j<a->block[i].size; j++){
+      owner[a->block[i].dim[j]] = i;
+      local[a->block[i].dim[j]] = j;
+    }
+  }
+}
+
+/* Mark the dimensions with a non-zero coefficient in expr */
+static void pkd_linexpr_mark(ap_linexpr0_t* expr, char* mark)
+{
+  size_t i;
+  ap_dim_t d;
+  ap_coeff_t* coeff;
+  ap_linexpr0_ForeachLinterm(expr,i,d,coeff){
+    if (!ap_coeff_zero(coeff)) mark[d] = 1;
+  }
+}
+
+/* Sorted list of the marked dimensions, in tdim; returns its size */
+static size_t pkd_marked(char* mark, size_t dims, ap_dim_t* tdim)
+{
+  size_t d,n;
+  n = 0;
+  for (d=0; d<dims; d++){
+    if (mark[d]) tdim[n++] = d;
+  }
+  return n;
+}
+
+/* Copy of expr where dimension d is renamed into map[d]; zero terms are
+   dropped. map should be increasing on the support of expr, so that the
+   result is a well-formed sparse expression. */
+static ap_linexpr0_t* pkd_linexpr_remap(ap_linexpr0_t* expr, const ap_dim_t* map)
+{
+  size_t i,n;
+  ap_dim_t d;
+  ap_coeff_t* coeff;
+  ap_linexpr0_t* res;
+
+  n = 0;
+  ap_linexpr0_ForeachLinterm(expr,i,d,coeff){
+    if (!ap_coeff_zero(coeff)) n++;
+  }
+  res = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,n);
+  ap_coeff_set(&res->cst,&expr->cst);
+  n = 0;
+  ap_linexpr0_ForeachLinterm(expr,i,d,coeff){
+    if (!ap_coeff_zero(coeff)){
+      assert(map[d]!=AP_DIM_MAX);
+      res->p.linterm[n].dim = map[d];
+      ap_coeff_set(&res->p.linterm[n].coeff,coeff);
+      n++;
+    }
+  }
+  return res;
+}
+
+static ap_lincons0_t pkd_lincons_remap(ap_lincons0_t* cons, const ap_dim_t* map)
+{
+  return ap_lincons0_make(cons->constyp,
+			  pkd_linexpr_remap(cons->linexpr0,map),
+			  cons->scalar ? ap_scalar_alloc_set(cons->scalar) : NULL);
+}
+
+/* Copy of the polyhedron of block b, extended with unconstrained dimensions
+   to the sorted dimensions dim[0..size-1], which include those of b */
+static pk_t* pkd_poly_extend(ap_manager_t* pman, pkd_t* a, pkd_block_t* b,
+			     ap_dim_t* dim, size_t size)
+{
+  ap_dimchange_t dimchange;
+  size_t i,j,k,nbint;
+  pk_t* res;
+
+  if (size==b->size) return pk_copy(pman,b->poly);
+  nbint = 0;
+  for (i=0; i<size; i++){
+    if (dim[i] < a->intdim) nbint++;
+  }
+  ap_dimchange_init(&dimchange,nbint-b->intdim,(size-nbint)-(b->size-b->intdim));
+  j = k = 0;
+  for (i=0; i<size; i++){
+    if (j<b->size && b->dim[j]==dim[i])
+      j++;
+    else
+      dimchange.dim[k++] = j;
+  }
+  assert(j==b->size && k==size-b->size);
+  res = pk_add_dimensions(pman,false,b->poly,&dimchange,false);
+  ap_dimchange_clear(&dimchange);
+  return res;
+}
+
+/* Product of the blocks of a flagged in touched, as a polyhedron on the
+   sorted dimensions dim[0..size-1], which include those of the blocks. The
+   product of polyhedra on disjoint dimensions is exact. */
+static pk_t* pkd_product(ap_manager_t* pman, pkd_t* a, char* touched,
+			 ap_dim_t* dim, size_t size)
+{
+  size_t i,j,k,base,nbcons,nbint;
+  ap_dim_t* pos;
+  ap_lincons0_array_t array;
+  pk_t* res;
+
+  base = PKD_NOBLOCK;
+  for (i=0; i<a->nbblocks; i++){
+    if (touched[i] && (base==PKD_NOBLOCK || a->block[i].size > a->block[base].size))
+      base = i;
+  }
+  if (base==PKD_NOBLOCK){
+    nbint = 0;
+    for (i=0; i<size; i++){
+      if (dim[i] < a->intdim) nbint++;
+    }
+    return pk_top(pman,nbint,size-nbint);
+  }
+  res = pkd_poly_extend(pman,a,&a->block[base],dim,size);
+
+  /* Constraints of the other blocks, renamed into the product */
+  pos = (ap_dim_t*)malloc(pkd_dims(a)*sizeof(ap_dim_t));
+  for (i=0; i<size; i++) pos[dim[i]] = i;
+  nbcons = 0;
+  array = ap_lincons0_array_make(0);
+  for (i=0; i<a->nbblocks; i++){
+    if (touched[i] && i!=base){
+      pkd_block_t* b = &a->block[i];
+      ap_dim_t* map = (ap_dim_t*)malloc(b->size*sizeof(ap_dim_t));
+      ap_lincons0_array_t cons = pk_to_lincons_array(pman,b->poly);
+      for (j=0; j<b->size; j++) map[j] = pos[b->dim[j]];
+      ap_lincons0_array_resize(&array,nbcons+cons.size);
+      for (k=0; k<cons.size; k++){
+	array.p[nbcons++] = pkd_lincons_remap(&cons.p[k],map);
+      }
+      ap_lincons0_array_clear(&cons);
+      free(map);
+    }
+  }
+  if (nbcons>0){
+    res = pk_meet_lincons_array(pman,true,res,&array);
+  }
+  ap_lincons0_array_clear(&array);
+  free(pos);
+  return res;
+}
+
+/* Make the dimensions tdim[0..size-1] belong to a single block, by merging
+   the blocks they belong to; unconstrained dimensions are added to the
+   block. Returns the index of the block, as the other blocks may be
+   reordered. */
+static size_t pkd_merge(ap_manager_t* pman, pkd_t* a, ap_dim_t* tdim, size_t size)
+{
+  size_t dims = pkd_dims(a);
+  size_t i,j,n,nbtouched,last;
+  size_t* owner;
+  ap_dim_t* local;
+  char* touched;
+  char* mark;
+  ap_dim_t* dim;
+  pk_t* poly;
+  bool fresh;
+
+  assert(!a->bottom);
+  owner = (size_t*)malloc(dims*sizeof(size_t));
+  local = (ap_dim_t*)malloc(dims*sizeof(ap_dim_t));
+  touched = (char*)calloc(a->nbblocks+1,1);
+  mark = (char*)calloc(dims+1,1);
+  pkd_owner(a,owner,local);
+
+  fresh = false;
+  nbtouched = 0;
+  last = PKD_NOBLOCK;
+  for (i=0; i<size; i++){
+    ap_dim_t d = tdim[i];
+    mark[d] = 1;
+    if (owner[d]==PKD_NOBLOCK)
+      fresh = true;
+    else if (!touched[owner[d]]){
+      touched[owner[d]] = 1;
+      nbtouched++;
+      last = owner[d];
+    }
+  }
+  if (nbtouched==1 && !fresh){
+    free(owner); free(local); free(touched); free(mark);
+    return last;
+  }
+  for (i=0; i<a->nbblocks; i++){
+    if (touched[i]){
+      for (j=0; j<a->block[i].size; j++) mark[a->block[i].dim[j]] = 1;
+    }
+  }
+  dim = (ap_dim_t*)malloc(dims*sizeof(ap_dim_t));
+  n = pkd_marked(mark,dims,dim);
+  dim = (ap_dim_t*)realloc(dim,n*sizeof(ap_dim_t));
+  poly = pkd_product(pman,a,touched,dim,n);
+
+  for (i=0; i<a->nbblocks; i++){
+    if (touched[i]){
+      pk_free(pman,a->block[i].poly);
+      a->block[i].poly = NULL;
+    }
+  }
+  pkd_compact(pman,a);
+  pkd_block_set(a,pkd_block_add(a),dim,n,poly);
+  free(owner); free(local); free(touched); free(mark);
+  return a->nbblocks-1;
+}
+
+/* Exact projection of a on the sorted dimensions dim[0..size-1] */
+static pk_t* pkd_project(ap_manager_t* pman, pkd_t* a, ap_dim_t* dim, size_t size)
+{
+  size_t dims = pkd_dims(a);
+  size_t i,j,k,n,nbint;
+  size_t* owner;
+  ap_dim_t* local;
+  char* touched;
+  char* mark;
+  ap_dim_t* udim;
+  pk_t* res;
+
+  owner = (size_t*)malloc(dims*sizeof(size_t));
+  local = (ap_dim_t*)malloc(dims*sizeof(ap_dim_t));
+  touched = (char*)calloc(a->nbblocks+1,1);
+  mark = (char*)calloc(dims+1,1);
+  pkd_owner(a,owner,local);
+  for (i=0; i<size; i++){
+    mark[dim[i]] = 1;
+    if (owner[dim[i]]!=PKD_NOBLOCK) touched[owner[dim[i]]] = 1;
+  }
+  for (i=0; i<a->nbblocks; i++){
+    if (touched[i]){
+      for (j=0; j<a->block[i].size; j++) mark[a->block[i].dim[j]] = 1;
+    }
+  }
+  udim = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  n = pkd_marked(mark,dims,udim);
+  res = pkd_product(pman,a,touched,udim,n);
+  if (n>size){
+    ap_dimchange_t dimchange;
+    nbint = 0;
+    j = 0;
+    for (i=0; i<n; i++){
+      if (j<size && dim[j]==udim[i]) j++;
+      else if (udim[i] < a->intdim) nbint++;
+    }
+    ap_dimchange_init(&dimchange,nbint,(n-size)-nbint);
+    j = k = 0;
+    for (i=0; i<n; i++){
+      if (j<size && dim[j]==udim[i]) j++;
+      else dimchange.dim[k++] = i;
+    }
+    res = pk_remove_dimensions(pman,true,res,&dimchange);
+    ap_dimchange_clear(&dimchange);
+  }
+  free(owner); free(local); free(touched); free(mark); free(udim);
+  return res;
+}
+
+/* Product of all the blocks */
+static pk_t* pkd_to_poly_internal(ap_manager_t* pman, pkd_t* a)
+{
+  size_t i;
+  ap_dim_t* dim;
+  pk_t* res;
+
+  if (a->bottom) return pk_bottom(pman,a->intdim,a->realdim);
+  dim = (ap_dim_t*)malloc((pkd_dims(a)+1)*sizeof(ap_dim_t));
+  for (i=0; i<pkd_dims(a); i++) dim[i] = i;
+  res = pkd_project(pman,a,dim,pkd_dims(a));
+  free(dim);
+  return res;
+}
+
+/* ********************************************************************** */
+/* I. General management */
+/* ********************************************************************** */
+
+static pkd_t* pkd_meet_lincons_internal(ap_manager_t* man, pkd_t* a,
+					ap_lincons0_array_t* array);
+
+static pkd_t* pkd_of_poly_internal(ap_manager_t* man, pk_t* po)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  ap_dimension_t dim = pk_dimension(pr->man,po);
+  pkd_t* res = pkd_alloc(dim.intdim,dim.realdim);
+
+  if (pk_is_bottom(pr->man,po)){
+    res->bottom = true;
+  }
+  else {
+    ap_lincons0_array_t array = pk_to_lincons_array(pr->man,po);
+    pkd_meet_lincons_internal(man,res,&array);
+    ap_lincons0_array_clear(&array);
+  }
+  return res;
+}
+
+static pkd_t* pkd_copy(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_COPY);
+  return pkd_copy_internal(pr->man,a);
+}
+
+static void pkd_free(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_FREE);
+  pkd_free_internal(pr->man,a);
+}
+
+static size_t pkd_size(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_ASIZE);
+  size_t i,res;
+  res = 0;
+  for (i=0; i<a->nbblocks; i++){
+    res += pk_size(pr->man,a->block[i].poly);
+  }
+  return res;
+}
+
+static void pkd_minimize(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_MINIMIZE);
+  size_t i;
+  for (i=0; i<a->nbblocks; i++){
+    pk_minimize(pr->man,a->block[i].poly);
+    pkd_update(man);
+  }
+}
+
+static void pkd_canonicalize(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_CANONICALIZE);
+  size_t i;
+  for (i=0; i<a->nbblocks; i++){
+    pk_canonicalize(pr->man,a->block[i].poly);
+    pkd_update(man);
+  }
+}
+
+/* Equal decomposed polyhedra may have different partitions into blocks (a
+   block may be split, or contain unconstrained dimensions), so that the
+   hash value is the one of the product of the blocks, which only depends
+   on the represented set */
+static int pkd_hash(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_HASH);
+  pk_t* po = pkd_to_poly_internal(pr->man,a);
+  int res = pk_hash(pr->man,po);
+  pkd_update(man);
+  pk_free(pr->man,po);
+  return res;
+}
+
+static void pkd_approximate(ap_manager_t* man, pkd_t* a, int algorithm)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_APPROXIMATE);
+  size_t i;
+  for (i=0; i<a->nbblocks; i++){
+    pk_approximate(pr->man,a->block[i].poly,algorithm);
+    pkd_update(man);
+  }
+}
+
+static ap_lincons0_array_t pkd_to_lincons_array(ap_manager_t* man, pkd_t* a);
+
+static void pkd_fprint(FILE* stream, ap_manager_t* man, pkd_t* a,
+		       char** name_of_dim)
+{
+  pkd_init_from_manager(man,AP_FUNID_FPRINT);
+  if (a->bottom){
+    fprintf(stream,"empty polyhedron of dim (%lu,%lu)\n",
+	    (unsigned long)a->intdim,(unsigned long)a->realdim);
+  }
+  else {
+    ap_lincons0_array_t cons = pkd_to_lincons_array(man,a);
+    fprintf(stream,"polyhedron of dim (%lu,%lu) in %lu blocks\n",
+	    (unsigned long)a->intdim,(unsigned long)a->realdim,
+	    (unsigned long)a->nbblocks);
+    ap_lincons0_array_fprint(stream,&cons,name_of_dim);
+    ap_lincons0_array_clear(&cons);
+  }
+}
+
+static void pkd_fprintdiff(FILE* stream, ap_manager_t* man,
+			   pkd_t* a1, pkd_t* a2,
+			   char** name_of_dim)
+{
+  pkd_init_from_manager(man,AP_FUNID_FPRINTDIFF);
+  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,AP_FUNID_FPRINTDIFF,NULL);
+}
+
+static void pkd_fdump(FILE* stream, ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_FDUMP);
+  size_t i,j;
+  fprintf(stream,"decomposed polyhedron of dim (%lu,%lu), %s, %lu blocks\n",
+	  (unsigned long)a->intdim,(unsigned long)a->realdim,
+	  a->bottom ? "empty" : "non empty",
+	  (unsigned long)a->nbblocks);
+  for (i=0; i<a->nbblocks; i++){
+    fprintf(stream,"block %lu: dimensions",(unsigned long)i);
+    for (j=0; j<a->block[i].size; j++){
+      fprintf(stream," %lu",(unsigned long)a->block[i].dim[j]);
+    }
+    fprintf(stream,"\n");
+    pk_fdump(stream,pr->man,a->block[i].poly);
+  }
+}
+
+static ap_membuf_t pkd_serialize_raw(ap_manager_t* man, pkd_t* a)
+{
+  ap_membuf_t membuf;
+  pkd_init_from_manager(man,AP_FUNID_SERIALIZE_RAW);
+  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,AP_FUNID_SERIALIZE_RAW,NULL);
+  membuf.ptr = NULL;
+  membuf.size = 0;
+  return membuf;
+}
+
+static pkd_t* pkd_deserialize_raw(ap_manager_t* man, void* ptr, size_t* size)
+{
+  pkd_init_from_manager(man,AP_FUNID_DESERIALIZE_RAW);
+  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,AP_FUNID_DESERIALIZE_RAW,NULL);
+  return NULL;
+}
+
+/* ********************************************************************** */
+/* II. Constructor, accessors, tests and property extraction */
+/* ********************************************************************** */
+
+static pkd_t* pkd_bottom(ap_manager_t* man, size_t intdim, size_t realdim)
+{
+  pkd_t* res;
+  pkd_init_from_manager(man,AP_FUNID_BOTTOM);
+  res = pkd_alloc(intdim,realdim);
+  res->bottom = true;
+  return res;
+}
+
+static pkd_t* pkd_top(ap_manager_t* man, size_t intdim, size_t realdim)
+{
+  pkd_init_from_manager(man,AP_FUNID_TOP);
+  return pkd_alloc(intdim,realdim);
+}
+
+static pkd_t* pkd_of_box(ap_manager_t* man,
+			 size_t intdim, size_t realdim,
+			 ap_interval_t** tinterval)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_OF_BOX);
+  pkd_t* res = pkd_alloc(intdim,realdim);
+  size_t i;
+
+  for (i=0; i<intdim+realdim; i++){
+    if (ap_interval_is_top(tinterval[i])) continue;
+    if (ap_interval_is_bottom(tinterval[i])){
+      pkd_set_bottom(pr->man,res);
+      break;
+    }
+    else {
+      ap_dim_t* dim = (ap_dim_t*)malloc(sizeof(ap_dim_t));
+      pk_t* poly;
+      dim[0] = i;
+      poly = pk_of_box(pr->man, i<intdim ? 1 : 0, i<intdim ? 0 : 1, &tinterval[i]);
+      pkd_update(man);
+      pkd_block_set(res,pkd_block_add(res),dim,1,poly);
+      if (pk_is_bottom(pr->man,poly)){
+	pkd_set_bottom(pr->man,res);
+	break;
+      }
+    }
+  }
+  return res;
+}
+
+static ap_dimension_t pkd_dimension(ap_manager_t* man, pkd_t* a)
+{
+  ap_dimension_t res;
+  res.intdim = a->intdim;
+  res.realdim = a->realdim;
+  return res;
+}
+
+static bool pkd_is_bottom(ap_manager_t* man, pkd_t* a)
+{
+  pkd_init_from_manager(man,AP_FUNID_IS_BOTTOM);
+  return a->bottom;
+}
+
+static bool pkd_is_top(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_IS_TOP);
+  size_t i;
+  if (a->bottom) return false;
+  for (i=0; i<a->nbblocks; i++){
+    bool top = pk_is_top(pr->man,a->block[i].poly);
+    pkd_update(man);
+    if (!top) return false;
+  }
+  return true;
+}
+
+/* Inclusion is checked block by block of a2, on the projections of a1 */
+static bool pkd_is_leq(ap_manager_t* man, pkd_t* a1, pkd_t* a2)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_IS_LEQ);
+  size_t i;
+
+  if (a1->bottom) return true;
+  if (a2->bottom) return false;
+  for (i=0; i<a2->nbblocks; i++){
+    pkd_block_t* b = &a2->block[i];
+    pk_t* proj = pkd_project(pr->man,a1,b->dim,b->size);
+    bool leq = pk_is_leq(pr->man,proj,b->poly);
+    pkd_update(man);
+    pk_free(pr->man,proj);
+    if (!leq) return false;
+  }
+  return true;
+}
+
+static bool pkd_is_eq(ap_manager_t* man, pkd_t* a1, pkd_t* a2)
+{
+  bool res;
+  res = pkd_is_leq(man,a1,a2) && pkd_is_leq(man,a2,a1);
+  ((pkd_internal_t*)man->internal)->funid = AP_FUNID_IS_EQ;
+  return res;
+}
+
+static bool pkd_is_dimension_unconstrained(ap_manager_t* man, pkd_t* a,
+					   ap_dim_t dim)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_IS_DIMENSION_UNCONSTRAINED);
+  size_t i,j;
+  bool res;
+
+  if (a->bottom) return false;
+  for (i=0; i<a->nbblocks; i++){
+    for (j=0; j<a->block[i].size; j++){
+      if (a->block[i].dim[j]==dim){
+	res = pk_is_dimension_unconstrained(pr->man,a->block[i].poly,j);
+	pkd_update(man);
+	return res;
+      }
+    }
+  }
+  return true;
+}
+
+static ap_interval_t* pkd_bound_dimension(ap_manager_t* man, pkd_t* a, ap_dim_t dim)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_BOUND_DIMENSION);
+  ap_interval_t* res;
+  size_t i,j;
+
+  for (i=0; i<a->nbblocks; i++){
+    for (j=0; j<a->block[i].size; j++){
+      if (a->block[i].dim[j]==dim){
+	res = pk_bound_dimension(pr->man,a->block[i].poly,j);
+	pkd_update(man);
+	return res;
+      }
+    }
+  }
+  res = ap_interval_alloc();
+  if (a->bottom)
+    ap_interval_set_bottom(res);
+  else
+    ap_interval_set_top(res);
+  return res;
+}
+
+/* Projection of a on the support of expr, and expr renamed accordingly */
+static pk_t* pkd_project_linexpr(ap_manager_t* pman, pkd_t* a,
+				 ap_linexpr0_t* expr, ap_linexpr0_t** pexpr)
+{
+  size_t dims = pkd_dims(a);
+  size_t i,n;
+  char* mark = (char*)calloc(dims+1,1);
+  ap_dim_t* tdim = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  ap_dim_t* map = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  pk_t* res;
+
+  pkd_linexpr_mark(expr,mark);
+  n = pkd_marked(mark,dims,tdim);
+  for (i=0; i<n; i++) map[tdim[i]] = i;
+  res = pkd_project(pman,a,tdim,n);
+  *pexpr = pkd_linexpr_remap(expr,map);
+  free(mark); free(tdim); free(map);
+  return res;
+}
+
+static ap_interval_t* pkd_bound_linexpr(ap_manager_t* man, pkd_t* a,
+					ap_linexpr0_t* expr)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_BOUND_LINEXPR);
+  ap_interval_t* res;
+  ap_linexpr0_t* lexpr;
+  pk_t* proj;
+
+  if (a->bottom){
+    res = ap_interval_alloc();
+    ap_interval_set_bottom(res);
+    return res;
+  }
+  proj = pkd_project_linexpr(pr->man,a,expr,&lexpr);
+  res = pk_bound_linexpr(pr->man,proj,lexpr);
+  pkd_update(man);
+  ap_linexpr0_free(lexpr);
+  pk_free(pr->man,proj);
+  return res;
+}
+
+static bool pkd_sat_lincons(ap_manager_t* man, pkd_t* a, ap_lincons0_t* cons)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_SAT_LINCONS);
+  ap_lincons0_t lcons;
+  pk_t* proj;
+  bool res;
+
+  if (a->bottom) return true;
+  proj = pkd_project_linexpr(pr->man,a,cons->linexpr0,&lcons.linexpr0);
+  lcons.constyp = cons->constyp;
+  lcons.scalar = cons->scalar;
+  res = pk_sat_lincons(pr->man,proj,&lcons);
+  pkd_update(man);
+  ap_linexpr0_free(lcons.linexpr0);
+  pk_free(pr->man,proj);
+  return res;
+}
+
+static bool pkd_sat_interval(ap_manager_t* man, pkd_t* a,
+			     ap_dim_t dim, ap_interval_t* interval)
+{
+  ap_interval_t* itv;
+  bool res;
+
+  if (a->bottom){
+    pkd_init_from_manager(man,AP_FUNID_SAT_INTERVAL);
+    return true;
+  }
+  itv = pkd_bound_dimension(man,a,dim);
+  ((pkd_internal_t*)man->internal)->funid = AP_FUNID_SAT_INTERVAL;
+  res = ap_interval_is_leq(itv,interval);
+  ap_interval_free(itv);
+  return res;
+}
+
+static bool pkd_sat_tcons(ap_manager_t* man, pkd_t* a, ap_tcons0_t* cons)
+{
+  return ap_generic_sat_tcons(man,a,cons,AP_SCALAR_MPQ,false);
+}
+
+static ap_interval_t* pkd_bound_texpr(ap_manager_t* man, pkd_t* a, ap_texpr0_t* expr)
+{
+  return ap_generic_bound_texpr(man,a,expr,AP_SCALAR_MPQ,false);
+}
+
+static ap_interval_t** pkd_to_box(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_TO_BOX);
+  size_t dims = pkd_dims(a);
+  ap_interval_t** res = ap_interval_array_alloc(dims);
+  size_t i,j;
+
+  for (i=0; i<dims; i++){
+    if (a->bottom)
+      ap_interval_set_bottom(res[i]);
+    else
+      ap_interval_set_top(res[i]);
+  }
+  for (i=0; i<a->nbblocks; i++){
+    pkd_block_t* b = &a->block[i];
+    ap_interval_t** box = pk_to_box(pr->man,b->poly);
+    pkd_update(man);
+    for (j=0; j<b->size; j++){
+      ap_interval_set(res[b->dim[j]],box[j]);
+    }
+    ap_interval_array_free(box,b->size);
+  }
+  return res;
+}
+
+static ap_lincons0_array_t pkd_to_lincons_array(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_TO_LINCONS_ARRAY);
+  ap_lincons0_array_t res;
+  size_t i,k,nbcons;
+
+  if (a->bottom){
+    res = ap_lincons0_array_make(1);
+    res.p[0] = ap_lincons0_make_unsat();
+    return res;
+  }
+  res = ap_lincons0_array_make(0);
+  nbcons = 0;
+  for (i=0; i<a->nbblocks; i++){
+    pkd_block_t* b = &a->block[i];
+    ap_lincons0_array_t cons = pk_to_lincons_array(pr->man,b->poly);
+    pkd_update(man);
+    ap_lincons0_array_resize(&res,nbcons+cons.size);
+    for (k=0; k<cons.size; k++){
+      res.p[nbcons++] = pkd_lincons_remap(&cons.p[k],b->dim);
+    }
+    ap_lincons0_array_clear(&cons);
+  }
+  return res;
+}
+
+static ap_tcons0_array_t pkd_to_tcons_array(ap_manager_t* man, pkd_t* a)
+{
+  return ap_generic_to_tcons_array(man,a);
+}
+
+static ap_generator0_array_t pkd_to_generator_array(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_TO_GENERATOR_ARRAY);
+  pk_t* poly = pkd_to_poly_internal(pr->man,a);
+  ap_generator0_array_t res = pk_to_generator_array(pr->man,poly);
+  pkd_update(man);
+  pk_free(pr->man,poly);
+  return res;
+}
+
+/* ********************************************************************** */
+/* III. Operations */
+/* ********************************************************************** */
+
+/* ============================================================ */
+/* III.1 Meet and Join */
+/* ============================================================ */
+
+/* Merge the blocks linked by each constraint, then meet each block with its
+   own constraints */
+static pkd_t* pkd_meet_lincons_internal(ap_manager_t* man, pkd_t* a,
+					ap_lincons0_array_t* array)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  size_t dims = pkd_dims(a);
+  size_t i,j,k,n;
+  char* mark;
+  ap_dim_t* tdim;
+  size_t* owner;
+  ap_dim_t* local;
+  size_t* first;
+  size_t* count;
+  ap_lincons0_array_t* tcons;
+
+  if (a->bottom) return a;
+  mark = (char*)malloc(dims+1);
+  tdim = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  first = (size_t*)malloc((array->size+1)*sizeof(size_t));
+  for (i=0; i<array->size; i++){
+    memset(mark,0,dims+1);
+    pkd_linexpr_mark(array->p[i].linexpr0,mark);
+    n = pkd_marked(mark,dims,tdim);
+    if (n==0){
+      first[i] = AP_DIM_MAX;
+      if (ap_lincons0_is_unsat(&array->p[i])){
+	pkd_set_bottom(pr->man,a);
+	free(mark); free(tdim); free(first);
+	return a;
+      }
+    }
+    else {
+      first[i] = tdim[0];
+      pkd_merge(pr->man,a,tdim,n);
+    }
+  }
+  owner = (size_t*)malloc(dims*sizeof(size_t));
+  local = (ap_dim_t*)malloc(dims*sizeof(ap_dim_t));
+  pkd_owner(a,owner,local);
+  count = (size_t*)calloc(a->nbblocks+1,sizeof(size_t));
+  for (i=0; i<array->size; i++){
+    if (first[i]!=AP_DIM_MAX) count[owner[first[i]]]++;
+  }
+  tcons = (ap_lincons0_array_t*)malloc((a->nbblocks+1)*sizeof(ap_lincons0_array_t));
+  for (k=0; k<a->nbblocks; k++){
+    tcons[k] = ap_lincons0_array_make(count[k]);
+    count[k] = 0;
+  }
+  for (i=0; i<array->size; i++){
+    if (first[i]!=AP_DIM_MAX){
+      k = owner[first[i]];
+      tcons[k].p[count[k]++] = pkd_lincons_remap(&array->p[i],local);
+    }
+  }
+  for (k=0; k<a->nbblocks; k++){
+    if (tcons[k].size>0 && !a->bottom){
+      a->block[k].poly = pk_meet_lincons_array(pr->man,true,a->block[k].poly,&tcons[k]);
+      pkd_update(man);
+      if (pk_is_bottom(pr->man,a->block[k].poly)){
+	for (j=k; j<a->nbblocks; j++) ap_lincons0_array_clear(&tcons[j]);
+	pkd_set_bottom(pr->man,a);
+	break;
+      }
+    }
+    ap_lincons0_array_clear(&tcons[k]);
+  }
+  free(mark); free(tdim); free(first);
+  free(owner); free(local); free(count); free(tcons);
+  return a;
+}
+
+static pkd_t* pkd_meet_lincons_array(ap_manager_t* man, bool destructive,
+				     pkd_t* a, ap_lincons0_array_t* array)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_MEET_LINCONS_ARRAY);
+  pkd_t* res = destructive ? a : pkd_copy_internal(pr->man,a);
+  return pkd_meet_lincons_internal(man,res,array);
+}
+
+static pkd_t* pkd_meet_tcons_array(ap_manager_t* man, bool destructive,
+				   pkd_t* a, ap_tcons0_array_t* array)
+{
+  return ap_generic_meet_intlinearize_tcons_array(man,destructive,a,array,
+						  AP_SCALAR_MPQ, AP_LINEXPR_LINEAR,
+						  (void* (*)(ap_manager_t*,bool,void*,ap_lincons0_array_t*))&pkd_meet_lincons_array);
+}
+
+static pkd_t* pkd_meet(ap_manager_t* man, bool destructive, pkd_t* a1, pkd_t* a2)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_MEET);
+  pkd_t* res = destructive ? a1 : pkd_copy_internal(pr->man,a1);
+  size_t i,k;
+
+  if (res->bottom) return res;
+  if (a2->bottom){
+    pkd_set_bottom(pr->man,res);
+    return res;
+  }
+  for (i=0; i<a2->nbblocks; i++){
+    pkd_block_t* b = &a2->block[i];
+    pk_t* ext;
+    k = pkd_merge(pr->man,res,b->dim,b->size);
+    ext = pkd_poly_extend(pr->man,res,b,res->block[k].dim,res->block[k].size);
+    res->block[k].poly = pk_meet(pr->man,true,res->block[k].poly,ext);
+    pkd_update(man);
+    pk_free(pr->man,ext);
+    if (pk_is_bottom(pr->man,res->block[k].poly)){
+      pkd_set_bottom(pr->man,res);
+      break;
+    }
+  }
+  return res;
+}
+
+/* Make the partitions of a1 and a2 equal, by merging blocks */
+static void pkd_unify(ap_manager_t* pman, pkd_t* a1, pkd_t* a2)
+{
+  size_t i;
+  for (i=0; i<a2->nbblocks; i++){
+    pkd_merge(pman,a1,a2->block[i].dim,a2->block[i].size);
+  }
+  for (i=0; i<a1->nbblocks; i++){
+    pkd_merge(pman,a2,a1->block[i].dim,a1->block[i].size);
+  }
+  assert(a1->nbblocks==a2->nbblocks);
+}
+
+/* Join (or widening) of two non-empty values. Blocks on which a1 and a2 are
+   equal are kept; the other ones are merged into a single block before
+   applying the operation, so that no relation is lost. */
+static pkd_t* pkd_joinwiden(ap_manager_t* man, bool join,
+			    pkd_t* a1, pkd_t* a2)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  size_t dims = pkd_dims(a1);
+  size_t i,j,n,k1,k2;
+  size_t* owner;
+  ap_dim_t* local;
+  ap_dim_t* tdim;
+  pkd_t* tmp;
+
+  assert(!a1->bottom && !a2->bottom);
+  tmp = pkd_copy_internal(pr->man,a2);
+  pkd_unify(pr->man,a1,tmp);
+  owner = (size_t*)malloc((dims+1)*sizeof(size_t));
+  local = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  tdim = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  pkd_owner(tmp,owner,local);
+  n = 0;
+  for (i=0; i<a1->nbblocks; i++){
+    pkd_block_t* b1 = &a1->block[i];
+    pkd_block_t* b2 = &tmp->block[owner[b1->dim[0]]];
+    assert(b1->size==b2->size);
+    if (!pk_is_eq(pr->man,b1->poly,b2->poly)){
+      for (j=0; j<b1->size; j++) tdim[n++] = b1->dim[j];
+    }
+  }
+  if (n>0){
+    k1 = pkd_merge(pr->man,a1,tdim,n);
+    k2 = pkd_merge(pr->man,tmp,tdim,n);
+    if (join){
+      a1->block[k1].poly = pk_join(pr->man,true,a1->block[k1].poly,tmp->block[k2].poly);
+    }
+    else {
+      pk_t* poly = pk_widening(pr->man,a1->block[k1].poly,tmp->block[k2].poly);
+      pk_free(pr->man,a1->block[k1].poly);
+      a1->block[k1].poly = poly;
+    }
+    pkd_update(man);
+  }
+  pkd_free_internal(pr->man,tmp);
+  free(owner); free(local); free(tdim);
+  return a1;
+}
+
+static pkd_t* pkd_join(ap_manager_t* man, bool destructive, pkd_t* a1, pkd_t* a2)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_JOIN);
+  pkd_t* res;
+
+  if (a2->bottom)
+    return destructive ? a1 : pkd_copy_internal(pr->man,a1);
+  if (a1->bottom){
+    if (destructive) pkd_free_internal(pr->man,a1);
+    return pkd_copy_internal(pr->man,a2);
+  }
+  res = destructive ? a1 : pkd_copy_internal(pr->man,a1);
+  return pkd_joinwiden(man,true,res,a2);
+}
+
+static pkd_t* pkd_meet_array(ap_manager_t* man, pkd_t** tab, size_t size)
+{
+  return ap_generic_meet_array(man,(void**)tab,size);
+}
+
+static pkd_t* pkd_join_array(ap_manager_t* man, pkd_t** tab, size_t size)
+{
+  return ap_generic_join_array(man,(void**)tab,size);
+}
+
+static pkd_t* pkd_widening(ap_manager_t* man, pkd_t* a1, pkd_t* a2)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_WIDENING);
+  if (a1->bottom) return pkd_copy_internal(pr->man,a2);
+  if (a2->bottom) return pkd_copy_internal(pr->man,a1);
+  return pkd_joinwiden(man,false,pkd_copy_internal(pr->man,a1),a2);
+}
+
+/* Generalized time elapse is computed on the undecomposed polyhedron */
+static pkd_t* pkd_add_ray_array(ap_manager_t* man, bool destructive, pkd_t* a,
+				ap_generator0_array_t* array)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_ADD_RAY_ARRAY);
+  pk_t* poly;
+  pkd_t* res;
+
+  if (a->bottom) return destructive ? a : pkd_copy_internal(pr->man,a);
+  poly = pkd_to_poly_internal(pr->man,a);
+  poly = pk_add_ray_array(pr->man,true,poly,array);
+  pkd_update(man);
+  res = pkd_of_poly_internal(man,poly);
+  pk_free(pr->man,poly);
+  if (destructive) pkd_free_internal(pr->man,a);
+  return res;
+}
+
+/* ============================================================ */
+/* III.2 Assignement and Substitutions */
+/* ============================================================ */
+
+static pkd_t* pkd_forget_internal(ap_manager_t* man, pkd_t* a,
+				  ap_dim_t* tdim, size_t size);
+
+static pkd_t* pkd_asssub_linexpr_array(bool assign,
+				       ap_manager_t* man,
+				       bool destructive, pkd_t* a,
+				       ap_dim_t* tdim, ap_linexpr0_t** texpr,
+				       size_t size,
+				       pkd_t* dest)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  size_t dims = pkd_dims(a);
+  size_t i,k,n;
+  char* mark;
+  ap_dim_t* sdim;
+  ap_dim_t* ltdim;
+  ap_linexpr0_t** ltexpr;
+  size_t* owner;
+  ap_dim_t* local;
+  pkd_t* res;
+
+  res = destructive ? a : pkd_copy_internal(pr->man,a);
+  if (res->bottom) return res;
+
+  mark = (char*)calloc(dims+1,1);
+  sdim = (ap_dim_t*)malloc((dims+1)*sizeof(ap_dim_t));
+  for (i=0; i<size; i++){
+    pkd_linexpr_mark(texpr[i],mark);
+  }
+  if (assign && size==1 && !mark[tdim[0]]){
+    /* x := e with x not in e: the previous relations of x are lost, so x
+       leaves its block instead of linking it with the ones of e */
+    pkd_forget_internal(man,res,tdim,1);
+  }
+  for (i=0; i<size; i++){
+    mark[tdim[i]] = 1;
+  }
+  n = pkd_marked(mark,dims,sdim);
+  k = pkd_merge(pr->man,res,sdim,n);
+
+  owner = (size_t*)malloc(dims*sizeof(size_t));
+  local = (ap_dim_t*)malloc(dims*sizeof(ap_dim_t));
+  pkd_owner(res,owner,local);
+  ltdim = (ap_dim_t*)malloc(size*sizeof(ap_dim_t));
+  ltexpr = (ap_linexpr0_t**)malloc(size*sizeof(ap_linexpr0_t*));
+  for (i=0; i<size; i++){
+    ltdim[i] = local[tdim[i]];
+    ltexpr[i] = pkd_linexpr_remap(texpr[i],local);
+  }
+  res->block[k].poly =
+    assign ?
+    pk_assign_linexpr_array(pr->man,true,res->block[k].poly,ltdim,ltexpr,size,NULL) :
+    pk_substitute_linexpr_array(pr->man,true,res->block[k].poly,ltdim,ltexpr,size,NULL);
+  pkd_update(man);
+  if (!assign && pk_is_bottom(pr->man,res->block[k].poly)){
+    pkd_set_bottom(pr->man,res);
+  }
+  for (i=0; i<size; i++){
+    ap_linexpr0_free(ltexpr[i]);
+  }
+  free(ltexpr); free(ltdim);
+  free(owner); free(local);
+  free(mark); free(sdim);
+  if (dest){
+    res = pkd_meet(man,true,res,dest);
+  }
+  return res;
+}
+
+static pkd_t* pkd_assign_linexpr_array(ap_manager_t* man,
+				       bool destructive, pkd_t* a,
+				       ap_dim_t* tdim, ap_linexpr0_t** texpr,
+				       size_t size,
+				       pkd_t* dest)
+{
+  pkd_init_from_manager(man,AP_FUNID_ASSIGN_LINEXPR_ARRAY);
+  return pkd_asssub_linexpr_array(true,man,destructive,a,tdim,texpr,size,dest);
+}
+
+static pkd_t* pkd_substitute_linexpr_array(ap_manager_t* man,
+					   bool destructive, pkd_t* a,
+					   ap_dim_t* tdim, ap_linexpr0_t** texpr,
+					   size_t size,
+					   pkd_t* dest)
+{
+  pkd_init_from_manager(man,AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY);
+  return pkd_asssub_linexpr_array(false,man,destructive,a,tdim,texpr,size,dest);
+}
+
+static pkd_t* pkd_assign_texpr_array(ap_manager_t* man,
+				     bool destructive, pkd_t* a,
+				     ap_dim_t* tdim, ap_texpr0_t** texpr,
+				     size_t size,
+				     pkd_t* dest)
+{
+  return ap_generic_assign_texpr_array(man,destructive,a,tdim,texpr,size,dest);
+}
+
+static pkd_t* pkd_substitute_texpr_array(ap_manager_t* man,
+					 bool destructive, pkd_t* a,
+					 ap_dim_t* tdim, ap_texpr0_t** texpr,
+					 size_t size,
+					 pkd_t* dest)
+{
+  return ap_generic_substitute_texpr_array(man,destructive,a,tdim,texpr,size,dest);
+}
+
+/* ============================================================ */
+/* III.3 Projections */
+/* ============================================================ */
+
+/* Existential quantification of the dimensions, which leave their blocks */
+static pkd_t* pkd_forget_internal(ap_manager_t* man, pkd_t* a,
+				  ap_dim_t* tdim, size_t size)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)man->internal;
+  size_t dims = pkd_dims(a);
+  size_t i,j,k,n,nbint;
+  char* mark;
+
+  if (a->bottom) return a;
+  mark = (char*)calloc(dims+1,1);
+  for (i=0; i<size; i++) mark[tdim[i]] = 1;
+  for (i=0; i<a->nbblocks; i++){
+    pkd_block_t* b = &a->block[i];
+    n = nbint = 0;
+    for (j=0; j<b->size; j++){
+      if (mark[b->dim[j]]){
+	n++;
+	if (j<b->intdim) nbint++;
+      }
+    }
+    if (n==0) continue;
+    if (n==b->size){
+      pk_free(pr->man,b->poly);
+      b->poly = NULL;
+    }
+    else {
+      ap_dimchange_t dimchange;
+      ap_dimchange_init(&dimchange,nbint,n-nbint);
+      k = 0;
+      for (j=0; j<b->size; j++){
+	if (mark[b->dim[j]]) dimchange.dim[k++] = j;
+      }
+      b->poly = pk_remove_dimensions(pr->man,true,b->poly,&dimchange);
+      pkd_update(man);
+      ap_dimchange_clear(&dimchange);
+      k = 0;
+      for (j=0; j<b->size; j++){
+	if (!mark[b->dim[j]]) b->dim[k++] = b->dim[j];
+      }
+      b->size -= n;
+      b->intdim -= nbint;
+    }
+  }
+  pkd_compact(pr->man,a);
+  free(mark);
+  return a;
+}
+
+/* Meet with the constraints tdim[i]=0 */
+static pkd_t* pkd_set_zero(ap_manager_t* man, pkd_t* a, ap_dim_t* tdim, size_t size)
+{
+  ap_lincons0_array_t array = ap_lincons0_array_make(size);
+  size_t i;
+  for (i=0; i<size; i++){
+    ap_linexpr0_t* expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    expr->p.linterm[0].dim = tdim[i];
+    ap_coeff_set_scalar_int(&expr->p.linterm[0].coeff,1);
+    array.p[i] = ap_lincons0_make(AP_CONS_EQ,expr,NULL);
+  }
+  pkd_meet_lincons_internal(man,a,&array);
+  ap_lincons0_array_clear(&array);
+  return a;
+}
+
+static pkd_t* pkd_forget_array(ap_manager_t* man,
+			       bool destructive, pkd_t* a,
+			       ap_dim_t* tdim, size_t size,
+			       bool project)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_FORGET_ARRAY);
+  pkd_t* res = destructive ? a : pkd_copy_internal(pr->man,a);
+  pkd_forget_internal(man,res,tdim,size);
+  if (project) pkd_set_zero(man,res,tdim,size);
+  return res;
+}
+
+/* ============================================================ */
+/* III.4 Change and permutation of dimensions */
+/* ============================================================ */
+
+static pkd_t* pkd_add_dimensions(ap_manager_t* man,
+				 bool destructive, pkd_t* a,
+				 ap_dimchange_t* dimchange,
+				 bool project)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_ADD_DIMENSIONS);
+  pkd_t* res = destructive ? a : pkd_copy_internal(pr->man,a);
+  size_t size = dimchange->intdim+dimchange->realdim;
+  size_t i,j,k;
+
+  for (i=0; i<res->nbblocks; i++){
+    pkd_block_t* b = &res->block[i];
+    k = 0;
+    for (j=0; j<b->size; j++){
+      while (k<size && dimchange->dim[k]<=b->dim[j]) k++;
+      b->dim[j] += k;
+    }
+  }
+  res->intdim += dimchange->intdim;
+  res->realdim += dimchange->realdim;
+  if (project && !res->bottom){
+    ap_dim_t* tdim = (ap_dim_t*)malloc((size+1)*sizeof(ap_dim_t));
+    for (k=0; k<size; k++) tdim[k] = dimchange->dim[k]+k;
+    pkd_set_zero(man,res,tdim,size);
+    free(tdim);
+  }
+  return res;
+}
+
+static pkd_t* pkd_remove_dimensions(ap_manager_t* man,
+				    bool destructive, pkd_t* a,
+				    ap_dimchange_t* dimchange)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_REMOVE_DIMENSIONS);
+  pkd_t* res = destructive ? a : pkd_copy_internal(pr->man,a);
+  size_t size = dimchange->intdim+dimchange->realdim;
+  size_t i,j,k;
+
+  pkd_forget_internal(man,res,dimchange->dim,size);
+  for (i=0; i<res->nbblocks; i++){
+    pkd_block_t* b = &res->block[i];
+    k = 0;
+    for (j=0; j<b->size; j++){
+      while (k<size && dimchange->dim[k]<b->dim[j]) k++;
+      b->dim[j] -= k;
+    }
+  }
+  res->intdim -= dimchange->intdim;
+  res->realdim -= dimchange->realdim;
+  return res;
+}
+
+static pkd_t* pkd_permute_dimensions(ap_manager_t* man,
+				     bool destructive,
+				     pkd_t* a,
+				     ap_dimperm_t* permutation)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_PERMUTE_DIMENSIONS);
+  pkd_t* res = destructive ? a : pkd_copy_internal(pr->man,a);
+  size_t i,j,k;
+
+  for (i=0; i<res->nbblocks; i++){
+    pkd_block_t* b = &res->block[i];
+    ap_dimperm_t perm;
+    ap_dim_t* dim = (ap_dim_t*)malloc(b->size*sizeof(ap_dim_t));
+    bool identity = true;
+    ap_dimperm_init(&perm,b->size);
+    /* rank of each new dimension among the new dimensions of the block */
+    for (j=0; j<b->size; j++){
+      ap_dim_t d = permutation->dim[b->dim[j]];
+      perm.dim[j] = 0;
+      for (k=0; k<b->size; k++){
+	if (permutation->dim[b->dim[k]] < d) perm.dim[j]++;
+      }
+      dim[perm.dim[j]] = d;
+      if (perm.dim[j]!=j) identity = false;
+    }
+    if (!identity){
+      b->poly = pk_permute_dimensions(pr->man,true,b->poly,&perm);
+      pkd_update(man);
+    }
+    ap_dimperm_clear(&perm);
+    free(b->dim);
+    b->dim = dim;
+  }
+  return res;
+}
+
+/* ============================================================ */
+/* III.5 Expansion and folding of dimensions */
+/* ============================================================ */
+
+/* Computed on the undecomposed polyhedron */
+static pkd_t* pkd_expand(ap_manager_t* man,
+			 bool destructive, pkd_t* a,
+			 ap_dim_t dim,
+			 size_t n)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_EXPAND);
+  pk_t* poly = pkd_to_poly_internal(pr->man,a);
+  pkd_t* res;
+
+  poly = pk_expand(pr->man,true,poly,dim,n);
+  pkd_update(man);
+  res = pkd_of_poly_internal(man,poly);
+  pk_free(pr->man,poly);
+  if (destructive) pkd_free_internal(pr->man,a);
+  return res;
+}
+
+static pkd_t* pkd_fold(ap_manager_t* man,
+		       bool destructive, pkd_t* a,
+		       ap_dim_t* tdim,
+		       size_t size)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_FOLD);
+  pk_t* poly = pkd_to_poly_internal(pr->man,a);
+  pkd_t* res;
+
+  poly = pk_fold(pr->man,true,poly,tdim,size);
+  pkd_update(man);
+  res = pkd_of_poly_internal(man,poly);
+  pk_free(pr->man,poly);
+  if (destructive) pkd_free_internal(pr->man,a);
+  return res;
+}
+
+/* ============================================================ */
+/* III.7 Closure operation */
+/* ============================================================ */
+
+static pkd_t* pkd_closure(ap_manager_t* man, bool destructive, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_CLOSURE);
+  pkd_t* res = destructive ? a : pkd_copy_internal(pr->man,a);
+  size_t i;
+  for (i=0; i<res->nbblocks; i++){
+    res->block[i].poly = pk_closure(pr->man,true,res->block[i].poly);
+    pkd_update(man);
+  }
+  return res;
+}
+
+/* ********************************************************************** */
+/* IV. Manager */
+/* ********************************************************************** */
+
+static void pkd_internal_free(pkd_internal_t* pr)
+{
+  ap_manager_free(pr->man);
+  free(pr);
+}
+
+static void* pkd_internal_clone(void* internal, ap_manager_t* man)
+{
+  pkd_internal_t* pr = (pkd_internal_t*)internal;
+  pkd_internal_t* res;
+  ap_manager_t* pman = ap_manager_clone_for_thread(pr->man);
+
+  if (pman==NULL) return NULL;
+  res = (pkd_internal_t*)malloc(sizeof(pkd_internal_t));
+  res->man = pman;
+  res->funid = AP_FUNID_UNKNOWN;
+  return res;
+}
+
+ap_manager_t* pkd_manager_alloc(bool strict)
+{
+  pkd_internal_t* pr;
+  ap_manager_t* man;
+  void** funptr;
+
+  pr = (pkd_internal_t*)malloc(sizeof(pkd_internal_t));
+  pr->man = pk_manager_alloc(strict);
+  pr->funid = AP_FUNID_UNKNOWN;
+  man = ap_manager_alloc(strict ?
+			 "polka, decomposed strict mode" :
+			 "polka, decomposed loose mode",
+			 pr->man->version,
+			 pr, (void (*)(void*))pkd_internal_free);
+  ap_manager_set_internal_clone(man, &pkd_internal_clone);
+  funptr = man->funptr;
+
+  funptr[AP_FUNID_COPY] = &pkd_copy;
+  funptr[AP_FUNID_FREE] = &pkd_free;
+  funptr[AP_FUNID_ASIZE] = &pkd_size;
+  funptr[AP_FUNID_MINIMIZE] = &pkd_minimize;
+  funptr[AP_FUNID_CANONICALIZE] = &pkd_canonicalize;
+  funptr[AP_FUNID_HASH] = &pkd_hash;
+  funptr[AP_FUNID_APPROXIMATE] = &pkd_approximate;
+  funptr[AP_FUNID_FPRINT] = &pkd_fprint;
+  funptr[AP_FUNID_FPRINTDIFF] = &pkd_fprintdiff;
+  funptr[AP_FUNID_FDUMP] = &pkd_fdump;
+  funptr[AP_FUNID_SERIALIZE_RAW] = &pkd_serialize_raw;
+  funptr[AP_FUNID_DESERIALIZE_RAW] = &pkd_deserialize_raw;
+  funptr[AP_FUNID_BOTTOM] = &pkd_bottom;
+  funptr[AP_FUNID_TOP] = &pkd_top;
+  funptr[AP_FUNID_OF_BOX] = &pkd_of_box;
+  funptr[AP_FUNID_DIMENSION] = &pkd_dimension;
+  funptr[AP_FUNID_IS_BOTTOM] = &pkd_is_bottom;
+  funptr[AP_FUNID_IS_TOP] = &pkd_is_top;
+  funptr[AP_FUNID_IS_LEQ] = &pkd_is_leq;
+  funptr[AP_FUNID_IS_EQ] = &pkd_is_eq;
+  funptr[AP_FUNID_IS_DIMENSION_UNCONSTRAINED] = &pkd_is_dimension_unconstrained;
+  funptr[AP_FUNID_SAT_INTERVAL] = &pkd_sat_interval;
+  funptr[AP_FUNID_SAT_LINCONS] = &pkd_sat_lincons;
+  funptr[AP_FUNID_SAT_TCONS] = &pkd_sat_tcons;
+  funptr[AP_FUNID_BOUND_DIMENSION] = &pkd_bound_dimension;
+  funptr[AP_FUNID_BOUND_LINEXPR] = &pkd_bound_linexpr;
+  funptr[AP_FUNID_BOUND_TEXPR] = &pkd_bound_texpr;
+  funptr[AP_FUNID_TO_BOX] = &pkd_to_box;
+  funptr[AP_FUNID_TO_LINCONS_ARRAY] = &pkd_to_lincons_array;
+  funptr[AP_FUNID_TO_TCONS_ARRAY] = &pkd_to_tcons_array;
+  funptr[AP_FUNID_TO_GENERATOR_ARRAY] = &pkd_to_generator_array;
+  funptr[AP_FUNID_MEET] = &pkd_meet;
+  funptr[AP_FUNID_MEET_ARRAY] = &pkd_meet_array;
+  funptr[AP_FUNID_MEET_LINCONS_ARRAY] = &pkd_meet_lincons_array;
+  funptr[AP_FUNID_MEET_TCONS_ARRAY] = &pkd_meet_tcons_array;
+  funptr[AP_FUNID_JOIN] = &pkd_join;
+  funptr[AP_FUNID_JOIN_ARRAY] = &pkd_join_array;
+  funptr[AP_FUNID_ADD_RAY_ARRAY] = &pkd_add_ray_array;
+  funptr[AP_FUNID_ASSIGN_LINEXPR_ARRAY] = &pkd_assign_linexpr_array;
+  funptr[AP_FUNID_SUBSTITUTE_LINEXPR_ARRAY] = &pkd_substitute_linexpr_array;
+  funptr[AP_FUNID_ASSIGN_TEXPR_ARRAY] = &pkd_assign_texpr_array;
+  funptr[AP_FUNID_SUBSTITUTE_TEXPR_ARRAY] = &pkd_substitute_texpr_array;
+  funptr[AP_FUNID_ADD_DIMENSIONS] = &pkd_add_dimensions;
+  funptr[AP_FUNID_REMOVE_DIMENSIONS] = &pkd_remove_dimensions;
+  funptr[AP_FUNID_PERMUTE_DIMENSIONS] = &pkd_permute_dimensions;
+  funptr[AP_FUNID_FORGET_ARRAY] = &pkd_forget_array;
+  funptr[AP_FUNID_EXPAND] = &pkd_expand;
+  funptr[AP_FUNID_FOLD] = &pkd_fold;
+  funptr[AP_FUNID_WIDENING] = &pkd_widening;
+  funptr[AP_FUNID_CLOSURE] = &pkd_closure;
+
+  ap_manager_set_abort_if_exception(man, AP_EXC_TIMEOUT, false);
+  ap_manager_set_abort_if_exception(man, AP_EXC_OUT_OF_SPACE, false);
+  ap_manager_set_abort_if_exception(man, AP_EXC_OVERFLOW, false);
+
+  return man;
+}
+
+ap_manager_t* pkd_manager_get_polka(ap_manager_t* man)
+{
+  return ((pkd_internal_t*)man->internal)->man;
+}
+
+/* ********************************************************************** */
+/* V. Conversions */
+/* ********************************************************************** */
+
+pkd_t* pkd_of_abstract0(ap_abstract0_t* abstract)
+{
+  return (pkd_t*)abstract->value;
+}
+
+ap_abstract0_t* pkd_to_abstract0(ap_manager_t* man, pkd_t* a)
+{
+  ap_abstract0_t* res = malloc(sizeof(ap_abstract0_t));
+  assert(man->library && strncmp(man->library,"polka, decomposed",17)==0);
+  res->value = a;
+  res->man = ap_manager_copy(man);
+  return res;
+}
+
+pk_t* pkd_to_poly(ap_manager_t* man, pkd_t* a)
+{
+  pkd_internal_t* pr = pkd_init_from_manager(man,AP_FUNID_UNKNOWN);
+  return pkd_to_poly_internal(pr->man,a);
+}
+
+pkd_t* pkd_of_poly(ap_manager_t* man, pk_t* po)
+{
+  pkd_init_from_manager(man,AP_FUNID_UNKNOWN);
+  return pkd_of_poly_internal(man,po);
+}
@@ -0,0 +1,76 @@
+/* ********************************************************************** */
+/* pkd.h: Interface of decomposed NewPolka polyhedra */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#ifndef __PKD_H__
+#define __PKD_H__
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ap_global0.h"
+#include "pk.h"
+
+typedef struct pkd_t pkd_t;
+
+/*
+
+  A decomposed polyhedron maintains a partition of the dimensions into
+  blocks, and one NewPolka polyhedron per block; dimensions that do not
+  belong to any block are unconstrained. The represented set is the product
+  of the blocks, so that the size of the generator systems only depends on
+  the size of the blocks.
+
+  Blocks are merged when a constraint, an assignment or a join links their
+  dimensions. Joins and widenings are computed block-wise, except for the
+  blocks on which the two arguments differ, which are merged into a single
+  block first: the join is as precise as the join of the undecomposed
+  polyhedra.
+
+  The library is intended to be accessed through the APRON interface; it
+  uses a NewPolka manager to work on blocks.
+
+*/
+
+/* ============================================================ */
+/* A. Constructor for APRON manager (to be freed with ap_manager_free). */
+/* ============================================================ */
+
+ap_manager_t* pkd_manager_alloc(bool strict);
+  /* Allocate a manager for decomposed polyhedra, in strict or loose mode
+     (see pk_manager_alloc) */
+
+ap_manager_t* pkd_manager_get_polka(ap_manager_t* man);
+  /* Return the NewPolka manager working on blocks, so as to set its
+     options (the result is not a copy and should not be freed) */
+
+/* ============================================================ */
+/* D. Conversions */
+/* ============================================================ */
+
+pkd_t* pkd_of_abstract0(ap_abstract0_t* abstract);
+  /* Extract from an abstract value the underlying decomposed polyhedron.
+     There is no copy, so only one of the two objects should be freed. */
+
+ap_abstract0_t* pkd_to_abstract0(ap_manager_t* man, pkd_t* a);
+  /* Create an abstract value from the manager and the underlying decomposed
+     polyhedron. There is no copy, and only the result should be freed */
+
+pk_t* pkd_to_poly(ap_manager_t* man, pkd_t* a);
+  /* Product of the blocks, as a polyhedron of the NewPolka manager
+     pkd_manager_get_polka(man) */
+
+pkd_t* pkd_of_poly(ap_manager_t* man, pk_t* po);
+  /* Decomposition of a polyhedron of the NewPolka manager
+     pkd_manager_get_polka(man) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
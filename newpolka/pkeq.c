@@ -108,6 +108,16 @@ void pkeq_canonicalize(ap_manager_t* man, pkeq_t* po)
   return pk_canonicalize(man,po);
 }
 
+/* Hash code computed on the canonical form used by pkeq_is_eq, so that equal
+   values have the same code */
+int pkeq_hash(ap_manager_t* man, pkeq_t* po)
+{
+  pk_internal_t* pk = pk_init_from_manager(man,AP_FUNID_HASH);
+  pkeq_canonicalize(man,po);
+  man->result.flag_exact = man->result.flag_best = true;
+  return poly_fingerprint(pk,po);
+}
+
 void pkeq_approximate(ap_manager_t* man, pkeq_t* po, int algorithm)
 {
   return;
@@ -611,7 +621,7 @@ ap_manager_t* pkeq_manager_alloc(void)
   funptr[AP_FUNID_ASIZE] = &pkeq_size;
   // funptr[AP_FUNID_MINIMIZE] = &poly_minimize;
   // funptr[AP_FUNID_CANONICALIZE] = &poly_canonicalize;
-  // funptr[AP_FUNID_HASH] = &poly_hash;
+  funptr[AP_FUNID_HASH] = &pkeq_hash;
   funptr[AP_FUNID_APPROXIMATE] = &pkeq_approximate;
   // funptr[AP_FUNID_FPRINT] = &poly_fprint;
   // funptr[AP_FUNID_FPRINTDIFF] = &poly_fprintdiff;
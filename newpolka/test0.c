@@ -163,7 +163,7 @@ void poly1(ap_manager_t* man, char** name_of_dim, pk_t** ppo1, pk_t** ppo2)
      1/2x+2/3y=1, [1,2]<=z+2w<=4, -2<=1/3z-w<=3,
      u non contraint */
   mpq_t mpq;
-  ap_lincons0_t cons;
+  ap_lincons0_t cons = { NULL, AP_CONS_SUPEQ, NULL };
   ap_lincons0_array_t array;
   ap_generator0_array_t garray;
   pk_t* poly;
@@ -455,7 +455,7 @@ void poly2(ap_manager_t* man, char** name_of_dim, pk_t* po1, pk_t* po2)
   bool b;
   pk_t* po;
   ap_linexpr0_t* expr[2];
-  ap_lincons0_t cons;
+  ap_lincons0_t cons = { NULL, AP_CONS_SUPEQ, NULL };
   ap_lincons0_array_t array = { &cons, 1 };
   ap_generator0_t gen;
   ap_generator0_array_t garray, garray2;
@@ -899,18 +899,17 @@ ap_linexpr0_t* expr_random(size_t intdim, size_t realdim,
   return expr;
 }
 
-pk_t* pk_random(ap_manager_t* man, size_t intdim, size_t realdim, 
-		    size_t nbcons, /* Number of constraints */
-		    size_t maxeq, /* Maximum number of equations */
-		    size_t maxcoeff, /* Maximum size of non-null coefficients */
-		    unsigned int mag /* magnitude of coefficients */
-		    )
+ap_lincons0_array_t lincons_array_random(size_t intdim, size_t realdim, 
+					 size_t nbcons, /* Number of constraints */
+					 size_t maxeq, /* Maximum number of equations */
+					 size_t maxcoeff, /* Maximum size of non-null coefficients */
+					 unsigned int mag /* magnitude of coefficients */
+					 )
 {
   ap_lincons0_array_t array;
   long int r;
-  ap_lincons0_t cons;
+  ap_lincons0_t cons = { NULL, AP_CONS_SUPEQ, NULL };
   ap_linexpr0_t* expr;
-  pk_t* poly;
   size_t i;
 
   array = ap_lincons0_array_make(nbcons);
@@ -928,6 +927,20 @@ pk_t* pk_random(ap_manager_t* man, size_t intdim, size_t realdim,
     cons.linexpr0 = expr;
     array.p[i] = cons;
   }
+  return array;
+}
+
+pk_t* pk_random(ap_manager_t* man, size_t intdim, size_t realdim, 
+		    size_t nbcons, /* Number of constraints */
+		    size_t maxeq, /* Maximum number of equations */
+		    size_t maxcoeff, /* Maximum size of non-null coefficients */
+		    unsigned int mag /* magnitude of coefficients */
+		    )
+{
+  ap_lincons0_array_t array;
+  pk_t* poly;
+
+  array = lincons_array_random(intdim,realdim,nbcons,maxeq,maxcoeff,mag);
   poly = pk_top(man,intdim,realdim);
   poly = pk_meet_lincons_array(man,true,poly,&array);
   ap_lincons0_array_clear(&array);
@@ -942,7 +955,7 @@ pk_t* pk_random(ap_manager_t* man, size_t intdim, size_t realdim,
 void test_approximate(void)
 {
   ap_linexpr0_t* expr;
-  ap_lincons0_t cons;
+  ap_lincons0_t cons = { NULL, AP_CONS_SUPEQ, NULL };
   ap_lincons0_array_t array = { &cons, 1 };
   pk_t* po, *pa;
   pk_internal_t* pk;
@@ -1097,7 +1110,7 @@ void pk_test_check(ap_manager_t* man, size_t intdim, size_t realdim,
   mpq_t mpq, mpqone;
   ap_coeff_t* pcoeff;
   ap_interval_t* interval;
-  ap_lincons0_t cons;
+  ap_lincons0_t cons = { NULL, AP_CONS_SUPEQ, NULL };
   ap_lincons0_array_t consarray = { &cons, 1 };
   ap_lincons0_array_t array;
   ap_generator0_array_t garray;
@@ -1612,6 +1625,171 @@ void pk_test(size_t intdim, size_t realdim,
   ap_manager_free(man);
 }
 
+/* ********************************************************************** */
+/* Constraint-only mode */
+/* ********************************************************************** */
+
+/* Compares the answers of the linear programming of the constraint-only mode
+   with the ones of the double description, on the same random constraints */
+void pk_test_lp(size_t intdim, size_t realdim,
+		size_t nbcons, /* Number of constraints */
+		size_t maxeq, /* Maximum number of equations */
+		size_t maxcoeff, /* Maximum size of non-null coefficients */
+		unsigned int mag, /* magnitude of coefficients */
+		size_t nbtests
+		)
+{
+  ap_manager_t* man;
+  ap_manager_t* manlp;
+  ap_lincons0_array_t array[2];
+  ap_lincons0_array_t tcons;
+  pk_t* tpoly[2];
+  pk_t* tpolylp[2];
+  pk_t* poly;
+  size_t i,k,n,nblp,nbeq;
+  bool b,blp;
+
+  man = pk_manager_alloc(false);
+  manlp = pk_manager_alloc(false);
+  pk_set_constraint_only((pk_internal_t*)manlp->internal,true);
+
+  for (n=0; n<nbtests; n++){
+    for (k=0; k<2; k++){
+      array[k] = lincons_array_random(intdim,realdim,nbcons,maxeq,maxcoeff,mag);
+      tpoly[k] = pk_top(man,intdim,realdim);
+      tpoly[k] = pk_meet_lincons_array(man,true,tpoly[k],&array[k]);
+      tpolylp[k] = pk_top(manlp,intdim,realdim);
+      tpolylp[k] = pk_meet_lincons_array(manlp,true,tpolylp[k],&array[k]);
+      assert(tpolylp[k]->F==NULL);
+      ap_lincons0_array_clear(&array[k]);
+    }
+    /* emptiness and inclusion */
+    for (k=0; k<2; k++){
+      b = pk_is_bottom(man,tpoly[k]);
+      blp = pk_is_bottom(manlp,tpolylp[k]);
+      assert(b==blp);
+      b = pk_is_leq(man,tpoly[k],tpoly[1-k]);
+      blp = pk_is_leq(manlp,tpolylp[k],tpolylp[1-k]);
+      assert(b==blp);
+    }
+    b = pk_is_eq(man,tpoly[0],tpoly[1]);
+    blp = pk_is_eq(manlp,tpolylp[0],tpolylp[1]);
+    assert(b==blp);
+    /* satisfaction of constraints: for strict constraints, generators
+       reaching the boundary only along a ray make the first test fail,
+       whereas the linear programming one is exact */
+    tcons = lincons_array_random(intdim,realdim,nbcons,maxeq,maxcoeff,mag);
+    for (i=0; i<tcons.size; i++){
+      b = pk_sat_lincons(man,tpoly[0],&tcons.p[i]);
+      blp = pk_sat_lincons(manlp,tpolylp[0],&tcons.p[i]);
+      assert(tcons.p[i].constyp==AP_CONS_SUP ? !b || blp : b==blp);
+    }
+    ap_lincons0_array_clear(&tcons);
+    /* removal of redundant constraints: the minimized constraints define the
+       same polyhedron, with as many constraints as its minimal form, except
+       that implicit equalities remain pairs of inequalities */
+    pk_minimize(manlp,tpolylp[0]);
+    assert(tpolylp[0]->F==NULL);
+    if (!pk_is_bottom(man,tpoly[0])){
+      tcons = pk_to_lincons_array(manlp,tpolylp[0]);
+      poly = pk_top(man,intdim,realdim);
+      poly = pk_meet_lincons_array(man,true,poly,&tcons);
+      assert(pk_is_eq(man,poly,tpoly[0]));
+      pk_free(man,poly);
+      nblp = tcons.size;
+      ap_lincons0_array_clear(&tcons);
+      tcons = pk_to_lincons_array(man,tpoly[0]);
+      nbeq = 0;
+      for (i=0; i<tcons.size; i++){
+	if (tcons.p[i].constyp==AP_CONS_EQ) nbeq++;
+      }
+      assert(tcons.size<=nblp && nblp<=tcons.size+nbeq);
+      ap_lincons0_array_clear(&tcons);
+    }
+    for (k=0; k<2; k++){
+      pk_free(man,tpoly[k]);
+      pk_free(manlp,tpolylp[k]);
+    }
+  }
+  ap_manager_free(manlp);
+  ap_manager_free(man);
+}
+
+/* ********************************************************************** */
+/* Serialization */
+/* ********************************************************************** */
+
+/* Reads back the serialized polyhedron po, checks that it is equal to po,
+   and that every truncated prefix of the buffer is rejected */
+void pk_test_serialize_aux(ap_manager_t* man, pk_t* po)
+{
+  ap_membuf_t buf;
+  pk_t* po2;
+  size_t size,len;
+
+  ap_manager_clear_exclog(man);
+  buf = pk_serialize_raw(man,po);
+  assert(buf.ptr!=NULL && man->result.exclog==NULL);
+  size = buf.size;
+  po2 = pk_deserialize_raw(man,buf.ptr,&size);
+  assert(po2!=NULL && man->result.exclog==NULL);
+  assert(size==buf.size);
+  assert(pk_is_eq(man,po,po2));
+  pk_free(man,po2);
+  for (len=0; len<buf.size; len++){
+    size = len;
+    po2 = pk_deserialize_raw(man,buf.ptr,&size);
+    assert(po2==NULL && man->result.exclog!=NULL && size==0);
+    ap_manager_clear_exclog(man);
+  }
+  /* unknown version */
+  ((unsigned char*)buf.ptr)[0] = 0xff;
+  size = buf.size;
+  po2 = pk_deserialize_raw(man,buf.ptr,&size);
+  assert(po2==NULL && man->result.exclog!=NULL);
+  ap_manager_clear_exclog(man);
+  free(buf.ptr);
+}
+
+/* Round trip of the serialization of empty, universe and random
+   polyhedra, in all the representations they go through */
+void pk_test_serialize(size_t intdim, size_t realdim,
+		       size_t nbcons, /* Number of constraints */
+		       size_t maxeq, /* Maximum number of equations */
+		       size_t maxcoeff, /* Maximum size of non-null coefficients */
+		       unsigned int mag, /* magnitude of coefficients */
+		       size_t nbtests
+		       )
+{
+  ap_manager_t* man;
+  pk_t* po;
+  size_t n;
+  int strict;
+
+  for (strict=0; strict<2; strict++){
+    man = pk_manager_alloc(strict);
+    ap_manager_set_abort_if_exception(man,AP_EXC_INVALID_ARGUMENT,false);
+    po = pk_bottom(man,intdim,realdim);
+    pk_test_serialize_aux(man,po);
+    pk_free(man,po);
+    po = pk_top(man,intdim,realdim);
+    pk_test_serialize_aux(man,po);
+    pk_minimize(man,po);
+    pk_test_serialize_aux(man,po);
+    pk_free(man,po);
+    for (n=0; n<nbtests; n++){
+      po = pk_random(man,intdim,realdim,nbcons,maxeq,maxcoeff,mag);
+      pk_test_serialize_aux(man,po);
+      pk_minimize(man,po);
+      pk_test_serialize_aux(man,po);
+      pk_canonicalize(man,po);
+      pk_test_serialize_aux(man,po);
+      pk_free(man,po);
+    }
+    ap_manager_free(man);
+  }
+}
+
 void mine2(void)
 {
   ap_manager_t* man;
@@ -1815,6 +1993,12 @@ int main(int argc, char**argv)
 
   srand(31);
 
+  pk_test_lp(0,6,6,1,3,20,100);
+  pk_test_lp(3,5,8,2,4,20,100);
+
+  pk_test_serialize(0,6,6,1,3,20,20);
+  pk_test_serialize(3,5,8,2,4,20,20);
+
   pk_test(0,6,6,1,3,20);
   pk_test(6,0,6,1,3,20);
   pk_test(6,10,6,1,3,20);
@@ -0,0 +1,184 @@
+/* ********************************************************************** */
+/* test2.c: testing decomposed polyhedra against NewPolka */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "ap_global0.h"
+#include "pk.h"
+#include "pkd.h"
+
+/* Random constraints on dim dimensions, each one on at most maxvars
+   dimensions, so that the decomposition has several blocks */
+ap_lincons0_array_t lincons_array_random(bool strict, size_t dim,
+					 size_t nbcons, size_t maxvars)
+{
+  ap_lincons0_array_t array;
+  ap_linexpr0_t* expr;
+  size_t i,j,nbvars;
+  int r;
+
+  array = ap_lincons0_array_make(nbcons);
+  for (i=0; i<nbcons; i++){
+    nbvars = 1 + rand()%maxvars;
+    expr = ap_linexpr0_alloc(AP_LINEXPR_DENSE,dim);
+    for (j=0; j<nbvars; j++){
+      r = rand()%7 - 3;
+      ap_coeff_set_scalar_int(&expr->p.coeff[rand()%dim],r==0 ? 1 : r);
+    }
+    ap_coeff_set_scalar_int(&expr->cst,rand()%21 - 5);
+    r = rand()%10;
+    array.p[i] = ap_lincons0_make(r==0 ? AP_CONS_EQ :
+				  (strict && r<3) ? AP_CONS_SUP : AP_CONS_SUPEQ,
+				  expr,NULL);
+  }
+  return array;
+}
+
+/* Product of the blocks of a, as a polyhedron */
+pk_t* poly_of_pkd(ap_manager_t* manpkd, ap_abstract0_t* a)
+{
+  return pkd_to_poly(manpkd,pkd_of_abstract0(a));
+}
+
+/* Compares meet, join and widening on decomposed polyhedra with the ones of
+   NewPolka, on the same random constraints: the meet and the join must be
+   equal (the join of decomposed polyhedra is as precise as the one of
+   polyhedra), and the widening must contain its arguments */
+void test_pkd(bool strict, size_t dim, size_t nbcons, size_t maxvars,
+	      size_t nbtests)
+{
+  ap_manager_t* manpkd;
+  ap_manager_t* manpk;
+  ap_lincons0_array_t array;
+  ap_abstract0_t* ta[2];
+  ap_abstract0_t* am;
+  ap_abstract0_t* aj;
+  ap_abstract0_t* aw;
+  pk_t* tp[2];
+  pk_t* pm;
+  pk_t* pj;
+  pk_t* po;
+  size_t n,k,nbbottom;
+
+  manpkd = pkd_manager_alloc(strict);
+  manpk = pk_manager_alloc(strict);
+  nbbottom = 0;
+  for (n=0; n<nbtests; n++){
+    for (k=0; k<2; k++){
+      array = lincons_array_random(strict,dim,nbcons,maxvars);
+      ta[k] = ap_abstract0_top(manpkd,0,dim);
+      ta[k] = ap_abstract0_meet_lincons_array(manpkd,true,ta[k],&array);
+      tp[k] = pk_top(manpk,0,dim);
+      tp[k] = pk_meet_lincons_array(manpk,true,tp[k],&array);
+      ap_lincons0_array_clear(&array);
+      po = poly_of_pkd(manpkd,ta[k]);
+      assert(pk_is_eq(manpk,po,tp[k]));
+      pk_free(manpk,po);
+      assert(ap_abstract0_is_bottom(manpkd,ta[k])==pk_is_bottom(manpk,tp[k]));
+      if (pk_is_bottom(manpk,tp[k])) nbbottom++;
+    }
+    /* inclusion */
+    assert(ap_abstract0_is_leq(manpkd,ta[0],ta[1])==
+	   pk_is_leq(manpk,tp[0],tp[1]));
+    assert(ap_abstract0_is_eq(manpkd,ta[0],ta[1])==
+	   pk_is_eq(manpk,tp[0],tp[1]));
+    /* hash, which only depends on the represented set */
+    assert(ap_abstract0_hash(manpkd,ta[0])==pk_hash(manpk,tp[0]));
+    if (pk_is_eq(manpk,tp[0],tp[1]))
+      assert(ap_abstract0_hash(manpkd,ta[0])==ap_abstract0_hash(manpkd,ta[1]));
+    /* meet */
+    am = ap_abstract0_meet(manpkd,false,ta[0],ta[1]);
+    pm = pk_meet(manpk,false,tp[0],tp[1]);
+    po = poly_of_pkd(manpkd,am);
+    assert(pk_is_eq(manpk,po,pm));
+    pk_free(manpk,po);
+    /* join */
+    aj = ap_abstract0_join(manpkd,false,ta[0],ta[1]);
+    pj = pk_join(manpk,false,tp[0],tp[1]);
+    po = poly_of_pkd(manpkd,aj);
+    assert(pk_is_leq(manpk,pj,po));
+    assert(pk_is_eq(manpk,po,pj));
+    pk_free(manpk,po);
+    assert(ap_abstract0_hash(manpkd,aj)==pk_hash(manpk,pj));
+    assert(ap_abstract0_is_leq(manpkd,ta[0],aj) &&
+	   ap_abstract0_is_leq(manpkd,ta[1],aj));
+    /* widening */
+    aw = ap_abstract0_widening(manpkd,ta[0],aj);
+    po = poly_of_pkd(manpkd,aw);
+    assert(pk_is_leq(manpk,tp[0],po) && pk_is_leq(manpk,pj,po));
+    pk_free(manpk,po);
+
+    for (k=0; k<2; k++){
+      ap_abstract0_free(manpkd,ta[k]);
+      pk_free(manpk,tp[k]);
+    }
+    ap_abstract0_free(manpkd,am);
+    ap_abstract0_free(manpkd,aj);
+    ap_abstract0_free(manpkd,aw);
+    pk_free(manpk,pm);
+    pk_free(manpk,pj);
+  }
+  printf("pkd %s, %lu dimensions: %lu tests, %lu empty arguments\n",
+	 strict ? "strict" : "loose",
+	 (unsigned long)dim,(unsigned long)nbtests,(unsigned long)nbbottom);
+  ap_manager_free(manpk);
+  ap_manager_free(manpkd);
+}
+
+/* x0>=0, x1>=0, x2=1 in three blocks, and the same set in a single block
+   obtained with the redundant constraint x0+x1+x2>=1 */
+void test_pkd_hash(void)
+{
+  ap_manager_t* manpkd = pkd_manager_alloc(false);
+  ap_lincons0_array_t array;
+  ap_abstract0_t* a1;
+  ap_abstract0_t* a2;
+  ap_linexpr0_t* expr;
+  size_t i;
+
+  array = ap_lincons0_array_make(4);
+  for (i=0; i<3; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_list(expr,AP_COEFF_S_INT,1,(ap_dim_t)i,
+			 AP_CST_S_INT,i==2 ? -1 : 0,AP_END);
+    array.p[i] = ap_lincons0_make(i==2 ? AP_CONS_EQ : AP_CONS_SUPEQ,expr,NULL);
+  }
+  array.size = 3;
+  a1 = ap_abstract0_top(manpkd,0,4);
+  a1 = ap_abstract0_meet_lincons_array(manpkd,true,a1,&array);
+  expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,3);
+  ap_linexpr0_set_list(expr,
+		       AP_COEFF_S_INT,1,(ap_dim_t)0,
+		       AP_COEFF_S_INT,1,(ap_dim_t)1,
+		       AP_COEFF_S_INT,1,(ap_dim_t)2,
+		       AP_CST_S_INT,-1,AP_END);
+  array.p[3] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  array.size = 4;
+  a2 = ap_abstract0_top(manpkd,0,4);
+  a2 = ap_abstract0_meet_lincons_array(manpkd,true,a2,&array);
+
+  assert(ap_abstract0_is_eq(manpkd,a1,a2));
+  assert(ap_abstract0_hash(manpkd,a1)==ap_abstract0_hash(manpkd,a2));
+  printf("pkd hash: ok\n");
+  ap_abstract0_free(manpkd,a1);
+  ap_abstract0_free(manpkd,a2);
+  ap_lincons0_array_clear(&array);
+  ap_manager_free(manpkd);
+}
+
+int main(int argc, char**argv)
+{
+  srand(31);
+  test_pkd(false,6,4,2,200);
+  test_pkd(true,6,4,2,200);
+  test_pkd(false,10,6,3,200);
+  test_pkd(true,10,6,3,200);
+  test_pkd(false,12,8,1,100);
+  test_pkd_hash();
+  return 0;
+}
@@ -0,0 +1,182 @@
+/* ********************************************************************** */
+/* test3.c: overflow of native coefficients */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* Built with libpolkaRllChecked, combinations and scalar products whose
+   intermediate results overflow are computed again with gmp integers, the
+   results that do not fit raise AP_EXC_OVERFLOW, and the operations
+   that raised it return sound approximations. Built with libpolkaMPQ, the
+   same computations are exact. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "ap_global0.h"
+#include "pk_config.h"
+#include "pk_vector.h"
+#include "pk.h"
+#include "pk_internal.h"
+
+/* Vector of size pk->dec+2 [0 cst [0] x0 x1] */
+static numint_t* vector3(pk_internal_t* pk, long cst, long x0, long x1)
+{
+  numint_t* q = vector_alloc(pk->dec+2);
+  numint_set_int(q[polka_cst],cst);
+  numint_set_int(q[pk->dec],x0);
+  numint_set_int(q[pk->dec+1],x1);
+  return q;
+}
+
+static bool vector3_equal(pk_internal_t* pk, numint_t* q,
+			  long cst, long x0, long x1)
+{
+  return
+    numint_cmp_int(q[polka_cst],cst)==0 &&
+    numint_cmp_int(q[pk->dec],x0)==0 &&
+    numint_cmp_int(q[pk->dec+1],x1)==0;
+}
+
+void test_vector(void)
+{
+  ap_manager_t* man = pk_manager_alloc(false);
+  pk_internal_t* pk = pk_manager_get_internal(man);
+  size_t size;
+  numint_t *q1,*q2,*q3;
+  numint_t prod;
+
+  pk_internal_realloc_lazy(pk,2);
+  size = pk->dec+2;
+  numint_init(prod);
+
+  /* the multipliers are 2^40-1 and 2^40+1, and the products of
+     vector_combine are close to 2^70, but the normalized result
+     [-2^31 -3.2^31]/2^31 fits */
+  q1 = vector3(pk,(1L<<40)+1,1L<<30,3L<<30);
+  q2 = vector3(pk,(1L<<40)-1,1L<<30,3L<<30);
+  q3 = vector_alloc(size);
+  pk->exn = AP_EXC_NONE;
+  vector_combine(pk,q1,q2,q3,polka_cst,size);
+  assert(pk->exn==AP_EXC_NONE);
+  assert(vector3_equal(pk,q3,0,-1,-3));
+
+  /* the normalized result [(2^40-1).2^29 -1] does not fit: q3 is left
+     unchanged */
+  vector_free(q1,size);
+  vector_free(q2,size);
+  q1 = vector3(pk,(1L<<40)+1,1L<<30,1);
+  q2 = vector3(pk,(1L<<40)-1,0,1);
+  vector_combine(pk,q1,q2,q3,polka_cst,size);
+#if defined(PK_NUMINT_CHECKED)
+  assert(pk->exn==AP_EXC_OVERFLOW);
+  assert(vector3_equal(pk,q3,0,-1,-3));
+#else
+  assert(pk->exn==AP_EXC_NONE);
+  assert(numint_sgn(q3[pk->dec])>0 && numint_cmp_int(q3[pk->dec+1],-1)==0);
+#endif
+
+  /* 2^63 - 2^63: the partial sum overflows, not the result */
+  vector_free(q1,size);
+  vector_free(q2,size);
+  q1 = vector3(pk,0,1L<<32,1L<<32);
+  q2 = vector3(pk,0,1L<<31,-(1L<<31));
+  pk->exn = AP_EXC_NONE;
+  vector_product(pk,prod,q1,q2,size);
+  assert(pk->exn==AP_EXC_NONE);
+  assert(numint_sgn(prod)==0);
+  vector_product_strict(pk,prod,q1,q2,size);
+  assert(pk->exn==AP_EXC_NONE);
+  assert(numint_sgn(prod)==0);
+
+  /* 2^63 + 2^63: the result does not fit, but keeps its sign */
+  numint_set_int(q2[pk->dec+1],1L<<31);
+  vector_product(pk,prod,q1,q2,size);
+#if defined(PK_NUMINT_CHECKED)
+  assert(pk->exn==AP_EXC_OVERFLOW);
+#else
+  assert(pk->exn==AP_EXC_NONE);
+#endif
+  assert(numint_sgn(prod)>0);
+  pk->exn = AP_EXC_NONE;
+
+  vector_free(q1,size);
+  vector_free(q2,size);
+  vector_free(q3,size);
+  numint_clear(prod);
+  ap_manager_free(man);
+  printf("vector: ok\n");
+}
+
+/* Constraints around the origin, with coefficients close to 2^22 on 3
+   dimensions, so that the coefficients of the vertices, 3x3
+   determinants, do not fit in 64 bits */
+static ap_lincons0_array_t lincons_array_large(void)
+{
+  static const int coeff[4][3] = {
+    { 4194301, -4194287, 4194277},
+    {-4194271, 4194247, 4194217},
+    { 4194199, 4194191, -4194187},
+    {-4194181, -4194173, -4194167}
+  };
+  ap_lincons0_array_t array = ap_lincons0_array_make(4);
+  ap_linexpr0_t* expr;
+  size_t i;
+
+  for (i=0; i<4; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,3);
+    ap_linexpr0_set_list(expr,
+			 AP_COEFF_S_INT,coeff[i][0],(ap_dim_t)0,
+			 AP_COEFF_S_INT,coeff[i][1],(ap_dim_t)1,
+			 AP_COEFF_S_INT,coeff[i][2],(ap_dim_t)2,
+			 AP_CST_S_INT,4194143+(int)i,
+			 AP_END);
+    array.p[i] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  }
+  return array;
+}
+
+void test_poly(void)
+{
+  ap_manager_t* man = pk_manager_alloc(false);
+  ap_lincons0_array_t array = lincons_array_large();
+  ap_interval_t** origin = ap_interval_array_alloc(3);
+  ap_interval_t** box;
+  ap_abstract0_t *a,*o;
+  size_t i;
+
+  for (i=0; i<3; i++) ap_interval_set_int(origin[i],0,0);
+  o = ap_abstract0_of_box(man,0,3,origin);
+  a = ap_abstract0_of_lincons_array(man,0,3,&array);
+
+  ap_manager_clear_exclog(man);
+  man->result.exn = AP_EXC_NONE;
+  box = ap_abstract0_to_box(man,a);
+#if defined(PK_NUMINT_CHECKED)
+  assert(man->result.exn==AP_EXC_OVERFLOW);
+  assert(!ap_manager_get_flag_exact(man));
+#else
+  assert(man->result.exn==AP_EXC_NONE);
+#endif
+  /* sound in both cases */
+  for (i=0; i<3; i++){
+    assert(ap_interval_is_leq(origin[i],box[i]));
+  }
+  assert(ap_abstract0_is_leq(man,o,a));
+
+  ap_interval_array_free(box,3);
+  ap_interval_array_free(origin,3);
+  ap_abstract0_free(man,a);
+  ap_abstract0_free(man,o);
+  ap_lincons0_array_clear(&array);
+  ap_manager_free(man);
+  printf("poly: ok\n");
+}
+
+int main(int argc, char**argv)
+{
+  test_vector();
+  test_poly();
+  return 0;
+}
@@ -0,0 +1,149 @@
+/* ********************************************************************** */
+/* test4.c: testing the concurrent join of arrays of polyhedra */
+/* ********************************************************************** */
+
+/* This file is part of the APRON Library, released under LGPL license.  Please
+   read the COPYING file packaged in the distribution */
+
+/* With algorithm>1, pk_join_array joins the parts of the array in
+   several threads (see pk.h); the result must be equal to the one of the
+   sequential join, on arrays with empty polyhedra and aliases, and the
+   arguments must be left unchanged. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "ap_global0.h"
+#include "pk.h"
+
+#define MAXSIZE 12
+
+/* Random polyhedron on dim dimensions, empty one time out of 6 */
+pk_t* poly_random(ap_manager_t* man, size_t dim, size_t nbcons)
+{
+  ap_lincons0_array_t array;
+  ap_linexpr0_t* expr;
+  pk_t* po;
+  size_t i,j;
+
+  if (rand()%6==0) return pk_bottom(man,0,dim);
+  array = ap_lincons0_array_make(nbcons);
+  for (i=0; i<nbcons; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_DENSE,dim);
+    for (j=0; j<dim; j++){
+      ap_coeff_set_scalar_int(&expr->p.coeff[j],rand()%7 - 3);
+    }
+    ap_coeff_set_scalar_int(&expr->cst,rand()%21);
+    array.p[i] = ap_lincons0_make(rand()%10==0 ? AP_CONS_EQ : AP_CONS_SUPEQ,
+				  expr,NULL);
+  }
+  po = pk_top(man,0,dim);
+  po = pk_meet_lincons_array(man,true,po,&array);
+  ap_lincons0_array_clear(&array);
+  return po;
+}
+
+void set_algorithm(ap_manager_t* man, int algorithm)
+{
+  ap_funopt_t funopt = ap_manager_get_funopt(man,AP_FUNID_JOIN_ARRAY);
+  funopt.algorithm = algorithm;
+  ap_manager_set_funopt(man,AP_FUNID_JOIN_ARRAY,&funopt);
+}
+
+/* Compares pk_join_array with algorithm 2, 3, 4 and 8 with the sequential
+   one on nbtests random arrays of 1 to MAXSIZE polyhedra, some of them
+   aliased */
+void test_join_array(bool strict, size_t dim, size_t nbcons, size_t nbtests)
+{
+  static const int algorithms[] = { 2, 3, 4, 8 };
+  ap_manager_t* man = pk_manager_alloc(strict);
+  pk_t* tab[MAXSIZE];
+  pk_t* copy[MAXSIZE];
+  pk_t* seq;
+  pk_t* con;
+  size_t n,i,size,k,nbbottom,nbalias;
+
+  nbbottom = nbalias = 0;
+  for (n=0; n<nbtests; n++){
+    size = 1 + rand()%MAXSIZE;
+    for (i=0; i<size; i++){
+      if (i>0 && rand()%5==0){
+	tab[i] = tab[rand()%i];
+	copy[i] = NULL;
+	nbalias++;
+      }
+      else {
+	tab[i] = poly_random(man,dim,nbcons);
+	copy[i] = pk_copy(man,tab[i]);
+	if (pk_is_bottom(man,tab[i])) nbbottom++;
+      }
+    }
+    set_algorithm(man,0);
+    seq = pk_join_array(man,tab,size);
+    for (k=0; k<sizeof(algorithms)/sizeof(int); k++){
+      set_algorithm(man,algorithms[k]);
+      con = pk_join_array(man,tab,size);
+      assert(pk_is_eq(man,con,seq));
+      pk_free(man,con);
+    }
+    for (i=0; i<size; i++){
+      assert(pk_is_leq(man,tab[i],seq));
+      if (copy[i]) assert(pk_is_eq(man,tab[i],copy[i]));
+    }
+    for (i=0; i<size; i++){
+      if (copy[i]){
+	pk_free(man,copy[i]);
+	pk_free(man,tab[i]);
+      }
+    }
+    pk_free(man,seq);
+  }
+  set_algorithm(man,0);
+  printf("join_array %s, %lu dimensions: %lu tests, %lu empty arguments, %lu aliases\n",
+	 strict ? "strict" : "loose",(unsigned long)dim,
+	 (unsigned long)nbtests,(unsigned long)nbbottom,(unsigned long)nbalias);
+  ap_manager_free(man);
+}
+
+/* Arrays of empty polyhedra only, and of the same polyhedron only */
+void test_join_array_degenerate(void)
+{
+  ap_manager_t* man = pk_manager_alloc(false);
+  pk_t* tab[MAXSIZE];
+  pk_t* po;
+  pk_t* seq;
+  pk_t* con;
+  size_t i;
+
+  for (i=0; i<MAXSIZE; i++) tab[i] = pk_bottom(man,0,3);
+  set_algorithm(man,4);
+  con = pk_join_array(man,tab,MAXSIZE);
+  assert(pk_is_bottom(man,con));
+  pk_free(man,con);
+  for (i=0; i<MAXSIZE; i++) pk_free(man,tab[i]);
+
+  do {
+    po = poly_random(man,3,3);
+  } while (pk_is_bottom(man,po));
+  for (i=0; i<MAXSIZE; i++) tab[i] = po;
+  set_algorithm(man,0);
+  seq = pk_join_array(man,tab,MAXSIZE);
+  set_algorithm(man,4);
+  con = pk_join_array(man,tab,MAXSIZE);
+  assert(pk_is_eq(man,con,seq) && pk_is_eq(man,con,po));
+  pk_free(man,con);
+  pk_free(man,seq);
+  pk_free(man,po);
+  ap_manager_free(man);
+  printf("join_array degenerate: ok\n");
+}
+
+int main(int argc, char**argv)
+{
+  srand(34);
+  test_join_array(false,4,4,200);
+  test_join_array(true,4,4,100);
+  test_join_array(false,6,5,100);
+  test_join_array_degenerate();
+  return 0;
+}
@@ -93,6 +93,18 @@ ap_abstract0_oct_add_epsilon_bin(ap_manager_t* man,
   /* Enlarge each bound from a1 by epsilon times the maximum finite bound in 
      a2. Only those bounds in a1 that are not stable in a2 are enlared. */
 
+double*
+ap_abstract0_oct_to_double_matrix(ap_manager_t* man, ap_abstract0_t* a);
+  /* Gives direct access to the closed half-matrix of an octagon, when its
+     bounds are doubles (library octD), or NULL if the octagon is empty.
+     The array has 2n(n+1) elements for n dimensions; the element (i,j),
+     j/2 <= i/2, is at position j+(i+1)*(i+1)/2 and bounds v_j-v_i, where
+     v_2k = x_k and v_2k+1 = -x_k (so that the bounds of x_k are doubled).
+
+     The array is not a copy: it belongs to a, and is valid as long as a is
+     neither freed nor modified. With the other libraries, raises
+     AP_EXC_NOT_IMPLEMENTED and returns NULL. */
+
 #ifdef __cplusplus
 }
 #endif
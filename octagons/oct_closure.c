@@ -67,15 +67,32 @@ bool hmat_s_step(bound_t* m, size_t dim)
  */
 
 bool hmat_close(bound_t* m, size_t dim)
+{
+  return hmat_close_timeout(m,dim,NULL,NULL);
+}
+
+/* Same as hmat_close, but stops before the next pivot once the deadline of
+   the current call on man (if not NULL) has passed. In that case,
+   *interrupted is set to true and m is only partially closed: it is still
+   a sound (tightened) version of the original matrix, but not a closed one.
+ */
+
+bool hmat_close_timeout(bound_t* m, size_t dim, ap_manager_t* man,
+			bool* interrupted)
 {
   size_t i,j,k;
   bound_t *c,ik,ik2,ij;
 
+  if (interrupted) *interrupted = false;
   bound_init(ik); bound_init(ik2); bound_init(ij);
 
   /* Floyd-Warshall */
   for (k=0;k<2*dim;k++) {
     size_t k2 = k^1;
+    if (man && ap_manager_timeout(man)) {
+      if (interrupted) *interrupted = true;
+      break;
+    }
     c = m;
     for (i=0;i<2*dim;i++) {
       size_t i2 = i|1;
@@ -93,6 +93,12 @@ oct_init_from_manager(ap_manager_t* man, ap_funid_t id, size_t size)
 
 #define flag_conv flag_incomplete
 
+  /* closure interrupted by the timeout of the current call
+     (see hmat_close_timeout) */
+#define flag_timeout							\
+  ap_manager_raise_exception(pr->man,AP_EXC_TIMEOUT,pr->funid,		\
+			     "closure interrupted by timeout")
+
 
   /* invalid argument exception */
 #define arg_assert(cond,action)						\
@@ -173,6 +179,8 @@ static inline size_t matpos2(size_t i, size_t j)
 
 bool hmat_s_step(bound_t* m, size_t dim);
 bool hmat_close(bound_t* m, size_t dim);
+bool hmat_close_timeout(bound_t* m, size_t dim, ap_manager_t* man,
+			bool* interrupted);
 bool hmat_close_incremental(bound_t* m, size_t dim, size_t v);
 bool hmat_check_closed(bound_t* m, size_t dim);
 
@@ -223,14 +223,21 @@ ap_dimension_t oct_dimension(ap_manager_t* man, oct_t* a)
  */
 void oct_cache_closure(oct_internal_t* pr, oct_t* a)
 {
+  bool interrupted;
   if (a->closed || !a->m) return;
   a->closed = hmat_copy(pr,a->m,a->dim);
-  if (hmat_close(a->closed,a->dim)) {
+  if (hmat_close_timeout(a->closed,a->dim,pr->man,&interrupted)) {
     /* empty! */
     hmat_free(pr,a->m,a->dim);
     hmat_free(pr,a->closed,a->dim);
     a->m = a->closed = NULL;
   }
+  else if (interrupted) {
+    /* timeout: keep a->m alone, as if closure was disabled */
+    hmat_free(pr,a->closed,a->dim);
+    a->closed = NULL;
+    flag_timeout;
+  }
 }
 
 /* Unlike oct_cache_closure, this frees the a->m representation, forcing
@@ -240,6 +247,7 @@ void oct_cache_closure(oct_internal_t* pr, oct_t* a)
 */
 void oct_close(oct_internal_t* pr, oct_t* a)
 {
+  bool interrupted;
   if (!a->m) return;
   if (a->closed) {
     hmat_free(pr,a->m,a->dim);
@@ -248,10 +256,36 @@ void oct_close(oct_internal_t* pr, oct_t* a)
   }
   a->closed = a->m;
   a->m = NULL;
-  if (hmat_close(a->closed,a->dim)) {
+  if (hmat_close_timeout(a->closed,a->dim,pr->man,&interrupted)) {
     hmat_free(pr,a->closed,a->dim);
     a->closed = NULL;
   }
+  else if (interrupted) {
+    /* timeout: the partially closed matrix is still sound */
+    a->m = a->closed;
+    a->closed = NULL;
+    flag_timeout;
+  }
+}
+
+/* Direct access to the closed matrix, for the double bounds only (bound_t is
+   then a double). The matrix is closed in place, as in oct_cache_closure. */
+double* ap_abstract0_oct_to_double_matrix(ap_manager_t* man, ap_abstract0_t* a0)
+{
+  oct_internal_t* pr = oct_init_from_manager(man,AP_FUNID_CLOSURE,0);
+  oct_t* a = (oct_t*) (a0->value);
+  arg_assert(man->library==a0->man->library,return NULL;);
+#if defined(NUM_DOUBLE)
+  oct_cache_closure(pr,a);
+  if (a->closed) return (double*)a->closed;
+  /* closure interrupted: the matrix is sound, but not the best one */
+  if (a->m) flag_algo;
+  return (double*)a->m;
+#else
+  ap_manager_raise_exception(man,AP_EXC_NOT_IMPLEMENTED,pr->funid,
+			     "only with double bounds (library octD)");
+  return NULL;
+#endif
 }
 
 
@@ -326,6 +360,22 @@ void oct_internal_free(oct_internal_t* pr)
   free(pr);
 }
 
+/* Fresh working space for a clone of an octagon manager */
+static void* oct_internal_clone(void* internal, ap_manager_t* man)
+{
+  oct_internal_t* pr = (oct_internal_t*)internal;
+  oct_internal_t* res = (oct_internal_t*)malloc(sizeof(oct_internal_t));
+  assert(res);
+  res->tmp_size = pr->tmp_size;
+  res->tmp = malloc(sizeof(bound_t)*res->tmp_size);
+  assert(res->tmp);
+  bound_init_array(res->tmp,res->tmp_size);
+  res->tmp2 = malloc(sizeof(long)*res->tmp_size);
+  assert(res->tmp2);
+  res->man = man;
+  return res;
+}
+
 ap_manager_t* oct_manager_alloc(void)
 {
   size_t i;
@@ -349,6 +399,7 @@ ap_manager_t* oct_manager_alloc(void)
 			 (void (*)(void*))oct_internal_free);
 
   pr->man = man;
+  ap_manager_set_internal_clone(man, &oct_internal_clone);
 
   man->funptr[AP_FUNID_COPY] = &oct_copy;
   man->funptr[AP_FUNID_FREE] = &oct_free;
@@ -697,6 +697,7 @@ void test_serialize(void)
     ap_membuf_t b;
     o  = random_oct(10,.1);
     b  = oct_serialize_raw(mo,o); FLAG(mo);
+    sz = b.size;
     o2 = oct_deserialize_raw(mo,b.ptr,&sz); FLAG(mo);
     RESULT(check(o)); check(o2);
     if (oct_is_nleq(mo,o,o2)) {
@@ -984,6 +984,7 @@ oct_t* oct_assign_linexpr_array(ap_manager_t* man,
   ap_dim_t p = a->dim;
   int inexact = 0;
   bool respect_closure = false; /* TODO */
+  bool interrupted;
 
   /* checks */
   arg_assert(size>0,return NULL;);
@@ -1026,11 +1027,12 @@ oct_t* oct_assign_linexpr_array(ap_manager_t* man,
 
   /* now close & remove temporary variables */
   if (pr->funopt->algorithm>=0) {
-    if (hmat_close(mm,a->dim+size)) {
+    if (hmat_close_timeout(mm,a->dim+size,pr->man,&interrupted)) {
       /* empty */
       hmat_free(pr,mm,a->dim+size);
       return oct_set_mat(pr,a,NULL,NULL,destructive);
     }
+    if (interrupted) flag_timeout;
   }
   else flag_algo;
   if (!destructive) m = hmat_alloc(pr,a->dim);
@@ -1076,6 +1078,7 @@ oct_t* oct_substitute_linexpr_array(ap_manager_t* man,
   ap_dim_t p = a->dim;
   int inexact = 0;
   bool respect_closure = false; /* TODO */
+  bool interrupted;
 
   /* checks */
   arg_assert(size>0,return NULL;);
@@ -1139,11 +1142,12 @@ oct_t* oct_substitute_linexpr_array(ap_manager_t* man,
 
   /* now close */
   if (pr->funopt->algorithm>=0) {
-    if (hmat_close(mm,a->dim+size)) {
+    if (hmat_close_timeout(mm,a->dim+size,pr->man,&interrupted)) {
       /* empty */
       hmat_free(pr,mm,a->dim+size);
       return oct_set_mat(pr,a,NULL,NULL,destructive);
     }
+    if (interrupted) flag_timeout;
   }
   else flag_algo;
 
@@ -32,6 +32,17 @@ extern "C" {
 
 ap_manager_t* opt_oct_manager_alloc(void);
 
+/* Component-packed storage: if flag is true, the octagons in decomposed
+     form returned by the manager only keep the half-matrices of their
+     independent components, instead of a full matrix over all the
+     variables. Their full matrix is materialised on a copy during each
+     operation, so that the arguments of the queries and of the
+     non-destructive operations are left unchanged, and for good when they
+     become dense. Octagons packed before the mode is turned off remain
+     valid arguments. */
+void opt_oct_set_packed(ap_manager_t* man, bool flag);
+bool opt_oct_get_packed(ap_manager_t* man);
+
 /* Enlarge each bound by epsilon times the maximum finite bound in 
      the octagon */
 
@@ -66,6 +77,24 @@ ap_abstract0_t*
 ap_abstract0_opt_oct_narrowing( ap_manager_t* man,
 			    ap_abstract0_t* a1,
 			    ap_abstract0_t* a2 );
+
+/* Meet with a pack of constraints, without going through ap_lincons0_t.
+     Exact (MPQ) packs are rounded outward to doubles. */
+ap_abstract0_t* 
+ap_abstract0_opt_oct_meet_linpack0(ap_manager_t* man,
+			       bool destructive,
+			       ap_abstract0_t* a,
+			       ap_linpack0_t* pack);
+
+/* Parallel assignment of the rows of a pack of expressions to the
+     dimensions tdim (of size pack->size), intersected with dest if not NULL */
+ap_abstract0_t* 
+ap_abstract0_opt_oct_assign_linpack0(ap_manager_t* man,
+				 bool destructive,
+				 ap_abstract0_t* a,
+				 ap_dim_t* tdim,
+				 ap_linpack0_t* pack,
+				 ap_abstract0_t* dest);
   
 #ifdef __cplusplus
  }
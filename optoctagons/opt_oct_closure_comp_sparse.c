@@ -516,7 +516,12 @@ double calculate_comp_sparsity(opt_oct_mat_t *oo, comp_list_t *cl, int dim){
 	return 1- ((double)(count/(double)size));
 }
 
-bool floyd_warshall_comp_dense(opt_oct_mat_t * oo, comp_list_t * cl, int dim){
+/******
+	Returns true if the Floyd-Warshall step was interrupted by the timeout
+	of the current call on man: the component is then copied back only
+	partially closed.
+*******/
+bool floyd_warshall_comp_dense(opt_oct_mat_t * oo, comp_list_t * cl, int dim, ap_manager_t* man){
 	unsigned short int comp_size = cl->size;
 	double *m = oo->mat;
 	int size = 2*comp_size*(comp_size+1);
@@ -547,9 +552,9 @@ bool floyd_warshall_comp_dense(opt_oct_mat_t * oo, comp_list_t * cl, int dim){
 		Apply Floyd-Warshall on temporary matrix.
 	*******/
 	#if defined(VECTOR)
-			floyd_warshall_dense(ot,temp1,temp2,comp_size, flag);
+			bool interrupted = floyd_warshall_dense(ot,temp1,temp2,comp_size, flag, man);
 	#else
-			floyd_warshall_dense_scalar(ot,temp1,temp2,comp_size, flag);
+			bool interrupted = floyd_warshall_dense_scalar(ot,temp1,temp2,comp_size, flag, man);
 	#endif
 	free(temp1);
 	free(temp2);
@@ -573,9 +578,10 @@ bool floyd_warshall_comp_dense(opt_oct_mat_t * oo, comp_list_t * cl, int dim){
 	free(ca);
 	free_array_comp_list(ot->acl);
 	opt_hmat_free(ot);
+	return interrupted;
 }
 
-bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2, unsigned short int *index1, unsigned short int *index2, int dim, bool is_int){
+bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2, unsigned short int *index1, unsigned short int *index2, int dim, bool is_int, ap_manager_t* man, bool* interrupted){
     double *m = oo->mat;
     array_comp_list_t *acl = oo->acl;
     int count = oo->nni;
@@ -586,8 +592,9 @@ bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2,
     }
     unsigned short int num_comp = acl->size;
     comp_list_t * cl = acl->head;
+    *interrupted = false;
     
-    for(int l = 0; l < num_comp; l++){
+    for(int l = 0; l < num_comp && !*interrupted; l++){
 	    /******
 			Calculate precise sparsity of each component set.
 			If it is less than threshold use dense Floyd Warshall,
@@ -595,7 +602,7 @@ bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2,
 	    *******/
 	    double sparsity = calculate_comp_sparsity(oo,cl,dim);
 	    if(sparsity < sparse_threshold){
-			floyd_warshall_comp_dense(oo,cl,dim);
+			*interrupted = floyd_warshall_comp_dense(oo,cl,dim,man);
 			cl = cl->next;
 			continue;
 	    }
@@ -606,6 +613,10 @@ bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2,
 			Floyd-Warshall step for each set independently
 	    ******/
 	    for(int k = 0; k < comp_size; k++){
+		if(man && ap_manager_timeout(man)){
+			*interrupted = true;
+			break;
+		}
 		//Compute index at start of iteration
 		unsigned short int k1 = ca[k];
 		//ck = ck->next;
@@ -947,6 +958,13 @@ bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2,
 	cl = cl->next;
     }
     oo->nni = count;
+    if(*interrupted || (man && ap_manager_timeout(man))){
+	/******
+		Stopped by the timeout: the matrix is sound, but not closed
+	*******/
+	*interrupted = true;
+	return 0;
+    }
     
     if(is_int){
 		if(strengthning_int_comp_sparse(oo,index1,temp1,n)){
@@ -959,5 +977,6 @@ bool strong_closure_comp_sparse(opt_oct_mat_t *oo, double *temp1, double *temp2,
 		}
     }
     //return strengthning_dense_scalar(m,temp1,n);
+    return 0;
 }
 
@@ -127,7 +127,12 @@ bool strengthning_dense(opt_oct_mat_t * oo, double *temp, int n){
 	return false;
 }
 
-bool floyd_warshall_dense(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int){
+/******
+	Returns true if the timeout of the current call on man (if not NULL)
+	stopped the iterations before their end: the matrix is then only
+	partially closed, but remains sound.
+*******/
+bool floyd_warshall_dense(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int, ap_manager_t* man){
     double *m = oo->mat;
     int size = 4 * dim * dim;
     int n = 2*dim; 
@@ -136,6 +141,9 @@ bool floyd_warshall_dense(opt_oct_mat_t *oo, double *temp1, double *temp2, int d
 		Floyd Warshall step
     *******/
     for(int k = 0; k < dim; k++){
+	if(man && ap_manager_timeout(man)){
+		return true;
+	}
 	//int pos1 = matpos2(2*k, (2*k)^1);
 	int ki = ((((2*k) + 1)*((2*k) + 1))/2);
 	int kki = (((((2*k)^1) + 1)*(((2*k)^1) + 1))/2);
@@ -372,12 +380,17 @@ bool floyd_warshall_dense(opt_oct_mat_t *oo, double *temp1, double *temp2, int d
 	}
 	
     }
+    return false;
 }
 
-bool strong_closure_dense(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int){
-    floyd_warshall_dense(oo,temp1,temp2,dim,is_int);
+bool strong_closure_dense(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int, ap_manager_t* man, bool* interrupted){
+    *interrupted = floyd_warshall_dense(oo,temp1,temp2,dim,is_int,man);
     int n = 2*dim;
     oo->nni = 2*dim*(dim+1);
+    if(*interrupted || (man && ap_manager_timeout(man))){
+	*interrupted = true;
+	return false;
+    }
     if(is_int){
 	return strengthning_int_dense(oo,temp1,n);
     }
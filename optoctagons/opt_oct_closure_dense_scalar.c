@@ -92,7 +92,12 @@ bool strengthning_dense_scalar(opt_oct_mat_t * oo, double *temp, int n){
 }
 
 
-bool floyd_warshall_dense_scalar(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int){
+/******
+	Returns true if the timeout of the current call on man (if not NULL)
+	stopped the iterations before their end: the matrix is then only
+	partially closed, but remains sound.
+*******/
+bool floyd_warshall_dense_scalar(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int, ap_manager_t* man){
     double *m = oo->mat;
     int size = 4 * dim * dim;
     int n = 2*dim; 
@@ -101,6 +106,9 @@ bool floyd_warshall_dense_scalar(opt_oct_mat_t *oo, double *temp1, double *temp2
 		Floyd Warshall step
     *******/
     for(int k = 0; k < dim; k++){
+	if(man && ap_manager_timeout(man)){
+		return true;
+	}
 	//int k2 = k==0 ? k + 1 : k;
 	//int pos1 = matpos2(2*k, (2*k)^1);
 	int pos1 = ((2*k)^1) + ((((2*k) + 1)*((2*k) + 1))/2);
@@ -250,12 +258,17 @@ bool floyd_warshall_dense_scalar(opt_oct_mat_t *oo, double *temp1, double *temp2
 	}
 	
     }
+    return false;
 }
 
-bool strong_closure_dense_scalar(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int){
-    floyd_warshall_dense_scalar(oo,temp1,temp2,dim,is_int);
+bool strong_closure_dense_scalar(opt_oct_mat_t *oo, double *temp1, double *temp2, int dim, bool is_int, ap_manager_t* man, bool* interrupted){
+    *interrupted = floyd_warshall_dense_scalar(oo,temp1,temp2,dim,is_int,man);
     int n = 2*dim;
     oo->nni = 2*dim*(dim+1);
+    if(*interrupted || (man && ap_manager_timeout(man))){
+	*interrupted = true;
+	return false;
+    }
     if(is_int){
 	return strengthning_int_dense_scalar(oo,temp1,n);
     }
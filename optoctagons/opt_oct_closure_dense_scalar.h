@@ -27,9 +27,9 @@ extern "C" {
 //void print_dense(double *m, int dim);
 
 //double strong_closure_calc_perf_dense(double cycles, int dim);
-bool strong_closure_dense_scalar(opt_oct_mat_t *m, double * temp1, double *temp2, int dim, bool is_int);
+bool strong_closure_dense_scalar(opt_oct_mat_t *m, double * temp1, double *temp2, int dim, bool is_int, ap_manager_t* man, bool* interrupted);
 bool strengthning_int_dense_scalar(opt_oct_mat_t * result, double *temp, int n);
-bool floyd_warshall_dense_scalar(opt_oct_mat_t *m, double * temp1, double *temp2, int dim, bool is_int);
+bool floyd_warshall_dense_scalar(opt_oct_mat_t *m, double * temp1, double *temp2, int dim, bool is_int, ap_manager_t* man);
 bool strengthning_dense_scalar(opt_oct_mat_t * result, double *temp, int n);
 
 
@@ -19,27 +19,27 @@
 #include "opt_oct_hmat.h"
 
 #if defined(TIMING)
-	double closure_time = 0;
-	double copy_time = 0;
-	double is_equal_time = 0;
-	double is_lequal_time = 0;
-	double permute_dimension_time = 0;
-	double top_time = 0;
-	double meet_time = 0;
-	double join_time = 0;
-	double add_dimension_time = 0;
-	double widening_time = 0;
-	double free_time = 0;
-	double forget_array_time = 0;
-	double meet_lincons_time = 0;
-	double oct_to_box_time = 0;
-	double alloc_time = 0;
-	double is_top_time = 0;
-	double expand_time = 0;
-	double fold_time = 0;
-	double sat_lincons_time = 0;
-	double assign_linexpr_time = 0;
-    double narrowing_time = 0;
+	__thread double closure_time = 0;
+	__thread double copy_time = 0;
+	__thread double is_equal_time = 0;
+	__thread double is_lequal_time = 0;
+	__thread double permute_dimension_time = 0;
+	__thread double top_time = 0;
+	__thread double meet_time = 0;
+	__thread double join_time = 0;
+	__thread double add_dimension_time = 0;
+	__thread double widening_time = 0;
+	__thread double free_time = 0;
+	__thread double forget_array_time = 0;
+	__thread double meet_lincons_time = 0;
+	__thread double oct_to_box_time = 0;
+	__thread double alloc_time = 0;
+	__thread double is_top_time = 0;
+	__thread double expand_time = 0;
+	__thread double fold_time = 0;
+	__thread double sat_lincons_time = 0;
+	__thread double assign_linexpr_time = 0;
+    __thread double narrowing_time = 0;
 #endif
 
 opt_oct_mat_t* opt_hmat_alloc(int size){
@@ -49,6 +49,7 @@ opt_oct_mat_t* opt_hmat_alloc(int size){
 	double *m = (double *)malloc(size*sizeof(double));
 	opt_oct_mat_t *oo= (opt_oct_mat_t *)malloc(sizeof(opt_oct_mat_t));
 	oo->mat = m;
+	oo->packed = NULL;
 	oo->nni = 0;
 	oo->acl = create_array_comp_list();
 	oo->is_dense = false;
@@ -64,6 +65,7 @@ void opt_hmat_free(opt_oct_mat_t *oo){
 		start_timing();
 	#endif
         free(oo->mat);
+	free(oo->packed);
 	if(!oo->is_dense){
 		free_array_comp_list(oo->acl);
 	}
@@ -143,6 +145,7 @@ opt_oct_mat_t * opt_hmat_alloc_top(int dim){
 	assert(m);
 	opt_oct_mat_t * oo = (opt_oct_mat_t *)malloc(sizeof(opt_oct_mat_t));
 	oo->mat = m;
+	oo->packed = NULL;
 	oo->nni = 2*dim;
 	oo->acl = create_array_comp_list();
 	oo->is_dense = false;
@@ -156,6 +159,76 @@ opt_oct_mat_t * opt_hmat_alloc_top(int dim){
 }
 
 
+/*******
+	Component-packed storage: the half-matrices of the components
+	of acl are stored one after the other in packed, in the order
+	of acl, and the full matrix mat is NULL
+*******/
+static size_t opt_hmat_packed_size(array_comp_list_t *acl){
+	size_t size = 0;
+	comp_list_t * cl = acl->head;
+	while(cl!=NULL){
+		size = size + opt_matsize(cl->size);
+		cl = cl->next;
+	}
+	return size;
+}
+
+void opt_hmat_pack(opt_oct_mat_t *oo, int dim){
+	if(!oo || !oo->mat || oo->is_dense){
+		return;
+	}
+	double *src = oo->mat;
+	size_t size = opt_hmat_packed_size(oo->acl);
+	double *dest = size ? (double *)malloc(size*sizeof(double)) : NULL;
+	double *p = dest;
+	comp_list_t * cl = oo->acl->head;
+	while(cl!=NULL){
+		unsigned short int comp_size = cl->size;
+		unsigned short int * ca = to_sorted_array(cl,dim);
+		for(int i = 0; i < 2*comp_size; i++){
+			int i1 = (i%2==0)? 2*ca[i/2] : 2*ca[i/2] + 1;
+			for(int j = 0; j <= (i|1); j++){
+				int j1 = (j%2==0)? 2*ca[j/2]: 2*ca[j/2]+1;
+				*p++ = src[j1 + (((i1 + 1)*(i1 + 1))/2)];
+			}
+		}
+		free(ca);
+		cl = cl->next;
+	}
+	free(oo->mat);
+	oo->mat = NULL;
+	oo->packed = dest;
+	/* only the entries of the components are kept */
+	oo->ti = false;
+}
+
+void opt_hmat_unpack(opt_oct_mat_t *oo, int dim){
+	if(!oo || oo->mat){
+		return;
+	}
+	double *dest = (double *)malloc(opt_matsize(dim)*sizeof(double));
+	assert(dest);
+	double *p = oo->packed;
+	comp_list_t * cl = oo->acl->head;
+	while(cl!=NULL){
+		unsigned short int comp_size = cl->size;
+		unsigned short int * ca = to_sorted_array(cl,dim);
+		for(int i = 0; i < 2*comp_size; i++){
+			int i1 = (i%2==0)? 2*ca[i/2] : 2*ca[i/2] + 1;
+			for(int j = 0; j <= (i|1); j++){
+				int j1 = (j%2==0)? 2*ca[j/2]: 2*ca[j/2]+1;
+				dest[j1 + (((i1 + 1)*(i1 + 1))/2)] = *p++;
+			}
+		}
+		free(ca);
+		cl = cl->next;
+	}
+	free(oo->packed);
+	oo->packed = NULL;
+	oo->mat = dest;
+}
+
 /*******
 	Copy octagons
 *******/
@@ -166,6 +239,45 @@ opt_oct_mat_t *opt_hmat_copy(opt_oct_mat_t * src_mat, int dim){
 	#if defined(TIMING)
 		start_timing();
 	#endif
+	if(!src_mat->mat){
+		/*****
+			Handle component-packed type, copy the packed
+			half-matrices as they are
+		******/
+		size_t psize = opt_hmat_packed_size(src_mat->acl);
+		opt_oct_mat_t * dst_mat = (opt_oct_mat_t *)malloc(sizeof(opt_oct_mat_t));
+		dst_mat->mat = NULL;
+		dst_mat->packed = NULL;
+		if(psize){
+			dst_mat->packed = (double *)malloc(psize*sizeof(double));
+			memcpy(dst_mat->packed,src_mat->packed,psize*sizeof(double));
+		}
+		dst_mat->nni = src_mat->nni;
+		dst_mat->is_dense = false;
+		dst_mat->is_top = src_mat->is_top;
+		dst_mat->ti = false;
+		/* copy_array_comp_list reverses the order of the components,
+		   which is also the order of the packed half-matrices */
+		dst_mat->acl = create_array_comp_list();
+		comp_list_t * cl = src_mat->acl->head;
+		comp_list_t * tail = NULL;
+		while(cl!=NULL){
+			comp_list_t * cd = copy_comp_list(cl);
+			if(tail){
+				tail->next = cd;
+			}
+			else{
+				dst_mat->acl->head = cd;
+			}
+			tail = cd;
+			dst_mat->acl->size++;
+			cl = cl->next;
+		}
+		#if defined(TIMING)
+			record_timing(copy_time);
+		#endif
+		return dst_mat;
+	}
 	double *src = src_mat->mat;
 	double *dest;
 	int n = 2*dim;
@@ -227,6 +339,7 @@ opt_oct_mat_t *opt_hmat_copy(opt_oct_mat_t * src_mat, int dim){
 	}	
 	
 	dst_mat->mat = dest;
+	dst_mat->packed = NULL;
 	dst_mat->nni = src_mat->nni;
   	dst_mat->is_dense = src_mat->is_dense;
 	dst_mat->is_top = src_mat->is_top;
@@ -284,6 +397,19 @@ double recalculate_sparsity(opt_oct_mat_t *oo, int dim){
 *****/
 
 bool opt_hmat_strong_closure(opt_oct_mat_t *oo, int dim){
+	return opt_hmat_strong_closure_timeout(oo,dim,NULL,NULL);
+}
+
+/*****
+	Same as opt_hmat_strong_closure, but stops between two iterations of
+	Floyd-Warshall, or before strengthening, once the deadline of the
+	current call on man (if not NULL) has passed. In that case,
+	*interrupted is set to true and oo is only partially closed: it is
+	still a sound (tightened) version of the original matrix, but not a
+	closed one.
+*****/
+
+bool opt_hmat_strong_closure_timeout(opt_oct_mat_t *oo, int dim, ap_manager_t* man, bool* interrupted){
 	#if defined(TIMING)
 		start_timing();
 	#endif
@@ -293,6 +419,7 @@ bool opt_hmat_strong_closure(opt_oct_mat_t *oo, int dim){
 	temp2 = (double *)malloc(2*dim*sizeof(double));
 	bool flag = is_int_flag ? true : false;
 	bool res;
+	bool stopped;
 	double size = 2*dim*(dim+1);
 	double sparsity = 1- ((double)(oo->nni/size));
         
@@ -311,7 +438,7 @@ bool opt_hmat_strong_closure(opt_oct_mat_t *oo, int dim){
 		
 		ind1 = (unsigned short int *)calloc(2*(2*dim + 1),sizeof(unsigned short int));
 		ind2 = (unsigned short int *)calloc(2*(2*dim + 1),sizeof(unsigned short int));
-		res = strong_closure_comp_sparse(oo,temp1,temp2,ind1,ind2,dim,flag);
+		res = strong_closure_comp_sparse(oo,temp1,temp2,ind1,ind2,dim,flag,man,&stopped);
 		free(ind1);
 		ind1 = NULL;
 		free(ind2);
@@ -337,7 +464,7 @@ bool opt_hmat_strong_closure(opt_oct_mat_t *oo, int dim){
 			}
 			ind1 = (unsigned short int *)calloc(2*(2*dim + 1),sizeof(unsigned short int));
 			ind2 = (unsigned short int *)calloc(2*(2*dim + 1),sizeof(unsigned short int));
-			res = strong_closure_comp_sparse(oo,temp1,temp2,ind1, ind2,dim, flag);
+			res = strong_closure_comp_sparse(oo,temp1,temp2,ind1, ind2,dim, flag,man,&stopped);
 			free(ind1);
 			ind1 = NULL;
 			free(ind2);
@@ -364,9 +491,9 @@ bool opt_hmat_strong_closure(opt_oct_mat_t *oo, int dim){
 			}
 			
 			#if defined(VECTOR)
-				res = strong_closure_dense(oo,temp1,temp2,dim, flag);
+				res = strong_closure_dense(oo,temp1,temp2,dim, flag,man,&stopped);
 			#else
-				res = strong_closure_dense_scalar(oo,temp1,temp2,dim, flag);
+				res = strong_closure_dense_scalar(oo,temp1,temp2,dim, flag,man,&stopped);
 			#endif
 		}
 	}
@@ -377,6 +504,9 @@ bool opt_hmat_strong_closure(opt_oct_mat_t *oo, int dim){
 	#if defined(TIMING)
 		record_timing(closure_time);
 	#endif
+	if(interrupted){
+		*interrupted = stopped;
+	}
 	return res;
 
 }
@@ -1931,6 +2061,35 @@ opt_uexpr opt_oct_uexpr_of_linexpr(opt_oct_internal_t* pr, double* dst,
   return u;
 }
 
+opt_uexpr opt_oct_uexpr_of_linpack0(opt_oct_internal_t* pr, double* dst,
+				    ap_linpack0_t* pack, size_t row, int intdim, int dim)
+{
+  /* the pack stores (inf,sup) pairs of doubles, we store (-inf,sup) */
+#define PACK_COEFF(kind,val,k,i)					\
+  dst[i] = -(val)[2*(k)];						\
+  dst[i+1] = (val)[2*(k)+1];						\
+  if ((val)[2*(k)] > (val)[2*(k)+1]) u.type = OPT_EMPTY;		\
+  if ((kind)!=AP_COEFF_SCALAR || !is_integer(dst[i])) u.is_int = 0;
+  opt_uexpr u = { OPT_ZERO, 0, 0, 0, 0, 1 };
+  size_t k;
+  int i;
+  assert(pack->discr==AP_SCALAR_DOUBLE);
+  PACK_COEFF(pack->cstkind[row],pack->cst.dbl,row,0);
+  for (i=0;i<dim;i++) {
+    dst[2*i+2] = 0;
+    dst[2*i+3] = 0;
+  }
+  for (k=pack->start[row];k<pack->start[row+1];k++) {
+    int d;
+    if(pack->dim[k]>=(ap_dim_t)dim)return u;
+    d = (int)pack->dim[k];
+    PACK_COEFF(pack->kind[k],pack->coeff.dbl,k,2*d+2);
+    CLASS_VAR(d);
+  }
+#undef PACK_COEFF
+  return u;
+}
+
 void opt_bounds_mul(double a_inf, double a_sup, double b_inf, double b_sup,double *tmpa, double *tmpb){
 	double tmp[8];
 	if((a_sup == 0) || (b_sup == 0)){
@@ -1983,9 +2142,10 @@ void opt_bounds_mul(double a_inf, double a_sup, double b_inf, double b_sup,doubl
 }
 
 
-bool opt_hmat_add_lincons(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim, int dim,
-		      ap_lincons0_array_t* ar, bool* exact,
-		      bool* respect_closure)
+/* Constraints are taken either from ar, or if ar==NULL, from pack */
+static bool opt_hmat_add_lincons_rows(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim, int dim,
+				      ap_lincons0_array_t* ar, ap_linpack0_t* pack,
+				      bool* exact, bool* respect_closure)
 {
   double *m = oo->mat;
   int i, j, k, ui, uj;
@@ -2031,8 +2191,9 @@ bool opt_hmat_add_lincons(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim,
   	#endif
   }
   
-  for (i=0;i<ar->size;i++) {
-   ap_constyp_t c = ar->p[i].constyp;
+  int nbcons = ar ? ar->size : pack->size;
+  for (i=0;i<nbcons;i++) {
+   ap_constyp_t c = ar ? ar->p[i].constyp : pack->constyp[i];
     opt_uexpr u;
 
     switch (c) {
@@ -2057,7 +2218,9 @@ bool opt_hmat_add_lincons(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim,
 
     /* now handle ==, >=, > */
     
-    u = opt_oct_uexpr_of_linexpr(pr,pr->tmp,ar->p[i].linexpr0,intdim,dim);
+    u = ar ?
+      opt_oct_uexpr_of_linexpr(pr,pr->tmp,ar->p[i].linexpr0,intdim,dim) :
+      opt_oct_uexpr_of_linpack0(pr,pr->tmp,pack,i,intdim,dim);
     
     /* transform e+[-a,b] > 0 into >= e+[-(a+1),b-1] >= 0 on integer constraints */
     if (u.is_int && c==AP_CONS_SUP) {
@@ -2796,6 +2959,20 @@ bool opt_hmat_add_lincons(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim,
   return false;
 }
 
+bool opt_hmat_add_lincons(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim, int dim,
+		      ap_lincons0_array_t* ar, bool* exact,
+		      bool* respect_closure)
+{
+  return opt_hmat_add_lincons_rows(pr,oo,intdim,dim,ar,NULL,exact,respect_closure);
+}
+
+bool opt_hmat_add_linpack0(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim, int dim,
+			   ap_linpack0_t* pack, bool* exact,
+			   bool* respect_closure)
+{
+  return opt_hmat_add_lincons_rows(pr,oo,intdim,dim,NULL,pack,exact,respect_closure);
+}
+
 
 /* ============================================================ */
 /* Assignement and Substitutions */
@@ -54,27 +54,30 @@ extern "C" {
   		CPUID();				\
   		cycles = (double)(COUNTER_DIFF(end, start));	\
   		counter += cycles	
-	extern double closure_time;
-	extern double copy_time;
-	extern double is_equal_time;
-	extern double is_lequal_time;
-	extern double permute_dimension_time;
-	extern double top_time;
-	extern double meet_time;
-	extern double join_time;
-	extern double add_dimension_time;
-	extern double widening_time;
-	extern double free_time;
-	extern double forget_array_time;
-	extern double meet_lincons_time;
-	extern double oct_to_box_time;
-	extern double alloc_time;
-	extern double is_top_time;
-	extern double expand_time;
-	extern double fold_time;
-	extern double sat_lincons_time;
-	extern double assign_linexpr_time;
-    extern double narrowing_time;
+	/* the counters are per thread, so that the clones of a manager (see
+	   ap_manager_clone_for_thread) can be used by several threads: a
+	   manager prints the ones of the thread which frees it */
+	extern __thread double closure_time;
+	extern __thread double copy_time;
+	extern __thread double is_equal_time;
+	extern __thread double is_lequal_time;
+	extern __thread double permute_dimension_time;
+	extern __thread double top_time;
+	extern __thread double meet_time;
+	extern __thread double join_time;
+	extern __thread double add_dimension_time;
+	extern __thread double widening_time;
+	extern __thread double free_time;
+	extern __thread double forget_array_time;
+	extern __thread double meet_lincons_time;
+	extern __thread double oct_to_box_time;
+	extern __thread double alloc_time;
+	extern __thread double is_top_time;
+	extern __thread double expand_time;
+	extern __thread double fold_time;
+	extern __thread double sat_lincons_time;
+	extern __thread double assign_linexpr_time;
+    extern __thread double narrowing_time;
 #endif
 
 #define min fmin
@@ -85,8 +88,11 @@ extern "C" {
 void opt_hmat_free(opt_oct_mat_t *m);
 opt_oct_mat_t * opt_hmat_alloc_top(int dim);
 opt_oct_mat_t *opt_hmat_copy(opt_oct_mat_t * src, int size);
+void opt_hmat_pack(opt_oct_mat_t *oo, int dim);
+void opt_hmat_unpack(opt_oct_mat_t *oo, int dim);
 void opt_hmat_set_array(double *dest, double *src, int size);
 bool opt_hmat_strong_closure(opt_oct_mat_t *m, int dim);
+bool opt_hmat_strong_closure_timeout(opt_oct_mat_t *m, int dim, ap_manager_t* man, bool* interrupted);
 bool is_top_half(opt_oct_mat_t *m, int dim);
 bool is_equal_half(opt_oct_mat_t *m1, opt_oct_mat_t *m2, int dim);
 bool is_lequal_half(opt_oct_mat_t *m1, opt_oct_mat_t *m2, int dim);
@@ -101,7 +107,9 @@ void widening_half(opt_oct_mat_t *oo, opt_oct_mat_t *oo1, opt_oct_mat_t *oo2, in
 void widening_thresholds_half(opt_oct_mat_t *oo, opt_oct_mat_t *oo1, opt_oct_mat_t *oo2, double *thresholds, int num_thresholds, int dim);
 void narrowing_half(opt_oct_mat_t *oo, opt_oct_mat_t *oo1, opt_oct_mat_t *oo2, int dim);
 opt_uexpr opt_oct_uexpr_of_linexpr(opt_oct_internal_t* pr, double* dst, ap_linexpr0_t* e, int intdim, int dim);
+opt_uexpr opt_oct_uexpr_of_linpack0(opt_oct_internal_t* pr, double* dst, ap_linpack0_t* pack, size_t row, int intdim, int dim);
 bool opt_hmat_add_lincons(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim, int dim, ap_lincons0_array_t* ar, bool* exact, bool* respect_closure);
+bool opt_hmat_add_linpack0(opt_oct_internal_t* pr, opt_oct_mat_t* oo, int intdim, int dim, ap_linpack0_t* pack, bool* exact, bool* respect_closure);
 void opt_oct_fprint(FILE* stream, ap_manager_t* man, opt_oct_t * a,char** name_of_dim);
 opt_oct_mat_t* opt_hmat_alloc(int size);
 void opt_hmat_assign(opt_oct_internal_t* pr, opt_uexpr u, opt_oct_mat_t* oo, size_t dim, size_t d, bool* respect_closure);
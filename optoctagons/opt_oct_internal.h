@@ -72,6 +72,12 @@ extern "C" {
 
 #define flag_conv flag_incomplete
 
+  /* closure interrupted by the timeout of the current call
+     (see opt_hmat_strong_closure_timeout) */
+#define flag_timeout							\
+  ap_manager_raise_exception(pr->man,AP_EXC_TIMEOUT,pr->funid,		\
+			     "closure interrupted by timeout")
+
 //#define INFINITY 1.0/0.0
 
 #include <stdio.h>
@@ -102,10 +108,15 @@ typedef struct opt_oct_internal_t{
 
   /* pointer to ap_manager*/
   ap_manager_t* man;
+
+  /* component-packed storage of decomposed results (see opt_oct_set_packed) */
+  bool packed;
 }opt_oct_internal_t;
 
 typedef struct opt_oct_mat_t{
 	double *mat;
+	/* half-matrices of the components of acl, when mat is NULL */
+	double *packed;
 	array_comp_list_t *acl;
 	int nni;
 	bool is_top;
@@ -375,6 +386,14 @@ opt_oct_t* opt_oct_closure(ap_manager_t *man, bool destructive, opt_oct_t *o);
 void opt_oct_internal_free(opt_oct_internal_t *pr);
 opt_oct_t* opt_oct_of_abstract0(ap_abstract0_t* a);
 ap_abstract0_t* abstract0_of_opt_oct(ap_manager_t* man, opt_oct_t* oct);
+void opt_oct_unpack(opt_oct_t* o);
+void opt_oct_pack(opt_oct_internal_t* pr, opt_oct_t* o);
+/* Argument o of an operation, in unpacked form: o itself if it is not
+   packed, or if it is consumed by the operation (destructive), in which
+   case it is unpacked in place; otherwise, an unpacked copy of o, which
+   opt_oct_release(pr,o,u) frees */
+opt_oct_t* opt_oct_unpacked(opt_oct_internal_t* pr, bool destructive, opt_oct_t* o);
+void opt_oct_release(opt_oct_internal_t* pr, opt_oct_t* o, opt_oct_t* u);
 void opt_oct_minimize(ap_manager_t* man, opt_oct_t* o);
 void opt_oct_canonicalize(ap_manager_t* man, opt_oct_t* o);
 int opt_oct_hash(ap_manager_t* man, opt_oct_t* o);
@@ -432,6 +451,8 @@ opt_oct_t* opt_oct_meet_lincons_array(ap_manager_t* man, bool destructive, opt_o
 opt_oct_t* opt_oct_meet_tcons_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_tcons0_array_t* array);
 opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, ap_linexpr0_t** texpr, size_t size, opt_oct_t* dest);
 opt_oct_t* opt_oct_assign_texpr_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, ap_texpr0_t** texpr, int size, opt_oct_t* dest);
+opt_oct_t* opt_oct_meet_linpack0(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_linpack0_t* pack);
+opt_oct_t* opt_oct_assign_linpack0(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, ap_linpack0_t* pack, opt_oct_t* dest);
 
 #ifdef __cplusplus
 }
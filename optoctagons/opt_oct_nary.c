@@ -291,9 +291,13 @@ ap_abstract0_opt_oct_widening_thresholds(ap_manager_t* man,
   if((man->library != a1->man->library) || (man->library != a2->man->library)){
 	     return abstract0_of_opt_oct(man,opt_oct_alloc_top(pr,o->dim,o->intdim));
   }
-  return 
-    abstract0_of_opt_oct(man,opt_oct_widening_thresholds
-		     (man,a1->value,a2->value,array,nb));
+  opt_oct_t* u1 = opt_oct_unpacked(pr,false,a1->value);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,a2->value);
+  opt_oct_t* r = opt_oct_widening_thresholds(man,u1,u2,array,nb);
+  opt_oct_release(pr,a1->value,u1);
+  opt_oct_release(pr,a2->value,u2);
+  opt_oct_pack(pr,r);
+  return abstract0_of_opt_oct(man,r);
 }
 
 
@@ -306,8 +310,13 @@ ap_abstract0_t* ap_abstract0_opt_oct_narrowing( ap_manager_t* man,
   if((man->library != a1->man->library) || (man->library != a2->man->library)){
 	     return abstract0_of_opt_oct(man,opt_oct_alloc_top(pr,o->dim,o->intdim));
   }
-  return abstract0_of_opt_oct(man,opt_oct_narrowing
-			  (man,a1->value,a2->value));
+  opt_oct_t* u1 = opt_oct_unpacked(pr,false,a1->value);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,a2->value);
+  opt_oct_t* r = opt_oct_narrowing(man,u1,u2);
+  opt_oct_release(pr,a1->value,u1);
+  opt_oct_release(pr,a2->value,u2);
+  opt_oct_pack(pr,r);
+  return abstract0_of_opt_oct(man,r);
 }
 
 
@@ -451,7 +460,11 @@ ap_abstract0_opt_oct_add_epsilon(ap_manager_t* man,
   if(man->library!=a1->man->library){
 	     return abstract0_of_opt_oct(man,opt_oct_alloc_top(pr,o->dim,o->intdim));
   }
-  return abstract0_of_opt_oct(man,opt_oct_add_epsilon(man,o,epsilon));
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  opt_oct_t* r = opt_oct_add_epsilon(man,u,epsilon);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return abstract0_of_opt_oct(man,r);
 }
 
 opt_oct_t* opt_oct_add_epsilon_bin(ap_manager_t* man, opt_oct_t* o1, opt_oct_t* o2, 
@@ -597,7 +610,13 @@ ap_abstract0_opt_oct_add_epsilon_bin(ap_manager_t* man,
   if((man->library!=a1->man->library) || (man->library!=a2->man->library)){
 	return abstract0_of_opt_oct(man,opt_oct_alloc_top(pr,a->dim,a->intdim));
   }
-  return abstract0_of_opt_oct(man,opt_oct_add_epsilon_bin(man,a1->value,a2->value,epsilon));
+  opt_oct_t* u1 = opt_oct_unpacked(pr,false,a1->value);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,a2->value);
+  opt_oct_t* r = opt_oct_add_epsilon_bin(man,u1,u2,epsilon);
+  opt_oct_release(pr,a1->value,u1);
+  opt_oct_release(pr,a2->value,u2);
+  opt_oct_pack(pr,r);
+  return abstract0_of_opt_oct(man,r);
 }
 
 
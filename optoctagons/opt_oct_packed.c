@@ -0,0 +1,469 @@
+/*
+	Copyright 2015 Software Reliability Lab, ETH Zurich
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/* ********************************************************************** */
+/* opt_oct_packed.c: component-packed storage of decomposed octagons */
+/* ********************************************************************** */
+
+/* In packed mode, the manager keeps the decomposed matrices of the octagons
+   it returns in component-packed form (see opt_hmat_pack), so that an
+   octagon over n variables split into small independent components uses
+   memory proportional to the sizes of its components instead of n^2.
+   Dense matrices are kept as they are.
+
+   Copy and free work directly on the packed form. The other operations
+   work on unpacked copies of their packed arguments, and pack their result.
+   The arguments are left unchanged, so that a packed octagon can be read
+   by several threads at once, except the ones consumed by a destructive
+   operation, which are unpacked in place, and the ones that the operation
+   updates in place (minimize, canonicalize, approximate). */
+
+#include "opt_oct_hmat.h"
+
+static bool opt_oct_is_packed(opt_oct_t* o)
+{
+  return (o->m && !o->m->mat) || (o->closed && !o->closed->mat);
+}
+
+void opt_oct_unpack(opt_oct_t* o)
+{
+  if (!o) return;
+  opt_hmat_unpack(o->m,o->dim);
+  opt_hmat_unpack(o->closed,o->dim);
+}
+
+void opt_oct_pack(opt_oct_internal_t* pr, opt_oct_t* o)
+{
+  if (!o || !pr->packed) return;
+  opt_hmat_pack(o->m,o->dim);
+  opt_hmat_pack(o->closed,o->dim);
+}
+
+opt_oct_t* opt_oct_unpacked(opt_oct_internal_t* pr, bool destructive, opt_oct_t* o)
+{
+  opt_oct_t* r;
+  if (!o || !opt_oct_is_packed(o)) return o;
+  if (destructive){
+    opt_oct_unpack(o);
+    return o;
+  }
+  r = opt_oct_copy_internal(pr,o);
+  opt_oct_unpack(r);
+  return r;
+}
+
+void opt_oct_release(opt_oct_internal_t* pr, opt_oct_t* o, opt_oct_t* u)
+{
+  if (u!=o) opt_oct_free_internal(pr,u);
+}
+
+/* ============================================================ */
+/* Wrappers */
+/* ============================================================ */
+
+/* Operations updating their argument in place */
+
+static void opt_oct_packed_minimize(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_unpack(o);
+  opt_oct_minimize(man,o);
+  opt_oct_pack(man->internal,o);
+}
+
+static void opt_oct_packed_canonicalize(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_unpack(o);
+  opt_oct_canonicalize(man,o);
+  opt_oct_pack(man->internal,o);
+}
+
+static void opt_oct_packed_approximate(ap_manager_t* man, opt_oct_t* o, int algorithm)
+{
+  opt_oct_unpack(o);
+  opt_oct_approximate(man,o,algorithm);
+  opt_oct_pack(man->internal,o);
+}
+
+/* Constructors */
+
+static opt_oct_t* opt_oct_packed_top(ap_manager_t* man, int intdim, int realdim)
+{
+  opt_oct_t* r = opt_oct_top(man,intdim,realdim);
+  opt_oct_pack(man->internal,r);
+  return r;
+}
+
+/* Queries */
+
+static int opt_oct_packed_hash(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  int res = opt_oct_hash(man,u);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static bool opt_oct_packed_is_bottom(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  bool res = opt_oct_is_bottom(man,u);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static bool opt_oct_packed_is_top(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  bool res = opt_oct_is_top(man,u);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static bool opt_oct_packed_is_leq(ap_manager_t* man, opt_oct_t* o1, opt_oct_t* o2)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u1 = opt_oct_unpacked(pr,false,o1);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,o2);
+  bool res = opt_oct_is_leq(man,u1,u2);
+  opt_oct_release(pr,o1,u1);
+  opt_oct_release(pr,o2,u2);
+  return res;
+}
+
+static bool opt_oct_packed_is_eq(ap_manager_t* man, opt_oct_t* o1, opt_oct_t* o2)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u1 = opt_oct_unpacked(pr,false,o1);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,o2);
+  bool res = opt_oct_is_eq(man,u1,u2);
+  opt_oct_release(pr,o1,u1);
+  opt_oct_release(pr,o2,u2);
+  return res;
+}
+
+static bool opt_oct_packed_is_dimension_unconstrained(ap_manager_t* man, opt_oct_t* o, ap_dim_t dim)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  bool res = opt_oct_is_dimension_unconstrained(man,u,dim);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static bool opt_oct_packed_sat_interval(ap_manager_t* man, opt_oct_t* o, ap_dim_t dim, ap_interval_t* i)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  bool res = opt_oct_sat_interval(man,u,dim,i);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static bool opt_oct_packed_sat_lincons(ap_manager_t* man, opt_oct_t* o, ap_lincons0_t* lincons)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  bool res = opt_oct_sat_lincons_timing(man,u,lincons);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static bool opt_oct_packed_sat_tcons(ap_manager_t* man, opt_oct_t* o, ap_tcons0_t* cons)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  bool res = opt_oct_sat_tcons(man,u,cons);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static ap_interval_t* opt_oct_packed_bound_dimension(ap_manager_t* man, opt_oct_t* o, ap_dim_t dim)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  ap_interval_t* res = opt_oct_bound_dimension(man,u,dim);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static ap_interval_t* opt_oct_packed_bound_texpr(ap_manager_t* man, opt_oct_t* o, ap_texpr0_t* expr)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  ap_interval_t* res = opt_oct_bound_texpr(man,u,expr);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static ap_interval_t** opt_oct_packed_to_box(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  ap_interval_t** res = opt_oct_to_box(man,u);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static ap_lincons0_array_t opt_oct_packed_to_lincons_array(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  ap_lincons0_array_t res = opt_oct_to_lincons_array(man,u);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+static ap_tcons0_array_t opt_oct_packed_to_tcons_array(ap_manager_t* man, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,false,o);
+  ap_tcons0_array_t res = opt_oct_to_tcons_array(man,u);
+  opt_oct_release(pr,o,u);
+  return res;
+}
+
+/* Operations returning an octagon */
+
+static opt_oct_t* opt_oct_packed_meet(ap_manager_t* man, bool destructive, opt_oct_t* o1, opt_oct_t* o2)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u1 = opt_oct_unpacked(pr,destructive,o1);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,o2);
+  opt_oct_t* r = opt_oct_meet(man,destructive,u1,u2);
+  opt_oct_release(pr,o1,u1);
+  opt_oct_release(pr,o2,u2);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_join(ap_manager_t* man, bool destructive, opt_oct_t* o1, opt_oct_t* o2)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u1 = opt_oct_unpacked(pr,destructive,o1);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,o2);
+  opt_oct_t* r = opt_oct_join(man,destructive,u1,u2);
+  opt_oct_release(pr,o1,u1);
+  opt_oct_release(pr,o2,u2);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_meetjoin_array(ap_manager_t* man, bool meet,
+						 opt_oct_t** tab, size_t size)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t** utab = (opt_oct_t**)malloc(size*sizeof(opt_oct_t*));
+  opt_oct_t* r;
+  size_t i;
+  for (i=0;i<size;i++) utab[i] = opt_oct_unpacked(pr,false,tab[i]);
+  r = meet ? opt_oct_meet_array(man,utab,size) : opt_oct_join_array(man,utab,size);
+  for (i=0;i<size;i++) opt_oct_release(pr,tab[i],utab[i]);
+  free(utab);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_meet_array(ap_manager_t* man, opt_oct_t** tab, size_t size)
+{
+  return opt_oct_packed_meetjoin_array(man,true,tab,size);
+}
+
+static opt_oct_t* opt_oct_packed_join_array(ap_manager_t* man, opt_oct_t** tab, size_t size)
+{
+  return opt_oct_packed_meetjoin_array(man,false,tab,size);
+}
+
+static opt_oct_t* opt_oct_packed_widening(ap_manager_t* man, opt_oct_t* o1, opt_oct_t* o2)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u1 = opt_oct_unpacked(pr,false,o1);
+  opt_oct_t* u2 = opt_oct_unpacked(pr,false,o2);
+  opt_oct_t* r = opt_oct_widening(man,u1,u2);
+  opt_oct_release(pr,o1,u1);
+  opt_oct_release(pr,o2,u2);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_meet_lincons_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_lincons0_array_t* array)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_meet_lincons_array(man,destructive,u,array);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_meet_tcons_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_tcons0_array_t* array)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_meet_tcons_array(man,destructive,u,array);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_assign_linexpr_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, ap_linexpr0_t** texpr, size_t size, opt_oct_t* dest)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* udest = opt_oct_unpacked(pr,false,dest);
+  opt_oct_t* r = opt_oct_assign_linexpr_array(man,destructive,u,tdim,texpr,size,udest);
+  opt_oct_release(pr,o,u);
+  opt_oct_release(pr,dest,udest);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_assign_texpr_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, ap_texpr0_t** texpr, int size, opt_oct_t* dest)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* udest = opt_oct_unpacked(pr,false,dest);
+  opt_oct_t* r = opt_oct_assign_texpr_array(man,destructive,u,tdim,texpr,size,udest);
+  opt_oct_release(pr,o,u);
+  opt_oct_release(pr,dest,udest);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_add_dimensions(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dimchange_t* dimchange, bool project)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_add_dimensions(man,destructive,u,dimchange,project);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_remove_dimensions(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dimchange_t* dimchange)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_remove_dimensions(man,destructive,u,dimchange);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_permute_dimensions(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dimperm_t* permutation)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_permute_dimensions(man,destructive,u,permutation);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_forget_array(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, int size, bool project)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_forget_array(man,destructive,u,tdim,size,project);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_expand(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t dim, size_t n)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_expand(man,destructive,u,dim,n);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_fold(ap_manager_t* man, bool destructive, opt_oct_t* o, ap_dim_t* tdim, size_t size)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_fold(man,destructive,u,tdim,size);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+static opt_oct_t* opt_oct_packed_closure(ap_manager_t* man, bool destructive, opt_oct_t* o)
+{
+  opt_oct_internal_t* pr = man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,o);
+  opt_oct_t* r = opt_oct_closure(man,destructive,u);
+  opt_oct_release(pr,o,u);
+  opt_oct_pack(pr,r);
+  return r;
+}
+
+/* ============================================================ */
+/* Mode */
+/* ============================================================ */
+
+void opt_oct_set_packed(ap_manager_t* man, bool flag)
+{
+  opt_oct_internal_t* pr = (opt_oct_internal_t*)man->internal;
+  pr->packed = flag;
+  if (!flag) return;
+  /* the wrappers stay installed when the mode is turned off, so that
+     the octagons packed so far remain valid arguments */
+  man->funptr[AP_FUNID_MINIMIZE] = &opt_oct_packed_minimize;
+  man->funptr[AP_FUNID_CANONICALIZE] = &opt_oct_packed_canonicalize;
+  man->funptr[AP_FUNID_HASH] = &opt_oct_packed_hash;
+  man->funptr[AP_FUNID_APPROXIMATE] = &opt_oct_packed_approximate;
+  man->funptr[AP_FUNID_TOP] = &opt_oct_packed_top;
+  man->funptr[AP_FUNID_IS_BOTTOM] = &opt_oct_packed_is_bottom;
+  man->funptr[AP_FUNID_IS_TOP] = &opt_oct_packed_is_top;
+  man->funptr[AP_FUNID_IS_LEQ] = &opt_oct_packed_is_leq;
+  man->funptr[AP_FUNID_IS_EQ] = &opt_oct_packed_is_eq;
+  man->funptr[AP_FUNID_IS_DIMENSION_UNCONSTRAINED] = &opt_oct_packed_is_dimension_unconstrained;
+  man->funptr[AP_FUNID_SAT_INTERVAL] = &opt_oct_packed_sat_interval;
+  man->funptr[AP_FUNID_SAT_LINCONS] = &opt_oct_packed_sat_lincons;
+  man->funptr[AP_FUNID_SAT_TCONS] = &opt_oct_packed_sat_tcons;
+  man->funptr[AP_FUNID_BOUND_DIMENSION] = &opt_oct_packed_bound_dimension;
+  man->funptr[AP_FUNID_BOUND_TEXPR] = &opt_oct_packed_bound_texpr;
+  man->funptr[AP_FUNID_TO_BOX] = &opt_oct_packed_to_box;
+  man->funptr[AP_FUNID_TO_LINCONS_ARRAY] = &opt_oct_packed_to_lincons_array;
+  man->funptr[AP_FUNID_TO_TCONS_ARRAY] = &opt_oct_packed_to_tcons_array;
+  man->funptr[AP_FUNID_MEET] = &opt_oct_packed_meet;
+  man->funptr[AP_FUNID_MEET_ARRAY] = &opt_oct_packed_meet_array;
+  man->funptr[AP_FUNID_MEET_LINCONS_ARRAY] = &opt_oct_packed_meet_lincons_array;
+  man->funptr[AP_FUNID_MEET_TCONS_ARRAY] = &opt_oct_packed_meet_tcons_array;
+  man->funptr[AP_FUNID_JOIN] = &opt_oct_packed_join;
+  man->funptr[AP_FUNID_JOIN_ARRAY] = &opt_oct_packed_join_array;
+  man->funptr[AP_FUNID_ASSIGN_LINEXPR_ARRAY] = &opt_oct_packed_assign_linexpr_array;
+  man->funptr[AP_FUNID_ASSIGN_TEXPR_ARRAY] = &opt_oct_packed_assign_texpr_array;
+  man->funptr[AP_FUNID_ADD_DIMENSIONS] = &opt_oct_packed_add_dimensions;
+  man->funptr[AP_FUNID_REMOVE_DIMENSIONS] = &opt_oct_packed_remove_dimensions;
+  man->funptr[AP_FUNID_PERMUTE_DIMENSIONS] = &opt_oct_packed_permute_dimensions;
+  man->funptr[AP_FUNID_FORGET_ARRAY] = &opt_oct_packed_forget_array;
+  man->funptr[AP_FUNID_EXPAND] = &opt_oct_packed_expand;
+  man->funptr[AP_FUNID_FOLD] = &opt_oct_packed_fold;
+  man->funptr[AP_FUNID_WIDENING] = &opt_oct_packed_widening;
+  man->funptr[AP_FUNID_CLOSURE] = &opt_oct_packed_closure;
+}
+
+bool opt_oct_get_packed(ap_manager_t* man)
+{
+  return ((opt_oct_internal_t*)man->internal)->packed;
+}
@@ -159,21 +159,29 @@ closure
 
 ****/
 void opt_oct_cache_closure(opt_oct_internal_t *pr, opt_oct_t *o){
+	bool interrupted;
 	if(o->closed || !o->m){
 		return;
 	}
 	
 	int size = 2*o->dim*(o->dim + 1);
 	o->closed = opt_hmat_copy(o->m,o->dim);
-	if(opt_hmat_strong_closure(o->closed,o->dim)){
+	if(opt_hmat_strong_closure_timeout(o->closed,o->dim,pr->man,&interrupted)){
 		opt_hmat_free(o->closed);
 		opt_hmat_free(o->m);
 		o->closed = NULL;
 		o->m = NULL;
 	}
+	else if(interrupted){
+		/* timeout: keep o->m alone, as if closure was disabled */
+		opt_hmat_free(o->closed);
+		o->closed = NULL;
+		flag_timeout;
+	}
 }
 
 void opt_oct_close(opt_oct_internal_t *pr, opt_oct_t *o){
+	bool interrupted;
 	if(!o->m){
 		return;
 	}
@@ -184,11 +192,17 @@ void opt_oct_close(opt_oct_internal_t *pr, opt_oct_t *o){
 	}
 	o->closed = o->m;
 	o->m = NULL;
-	if(opt_hmat_strong_closure(o->closed,o->dim)){
+	if(opt_hmat_strong_closure_timeout(o->closed,o->dim,pr->man,&interrupted)){
 		opt_hmat_free(o->closed);
 		o->closed = NULL;
 		return;
 	}
+	if(interrupted){
+		/* timeout: the partially closed matrix is still sound */
+		o->m = o->closed;
+		o->closed = NULL;
+		flag_timeout;
+	}
 }
 
 /*We throw an exception just like APRON */
@@ -256,6 +270,23 @@ void opt_oct_internal_free(opt_oct_internal_t *pr){
 	free(pr);
 }
 
+/* Fresh working space for a clone of an optoct manager */
+static void* opt_oct_internal_clone(void* internal, ap_manager_t* man)
+{
+  opt_oct_internal_t* pr = (opt_oct_internal_t*)internal;
+  opt_oct_internal_t* res = (opt_oct_internal_t*)malloc(sizeof(opt_oct_internal_t));
+  assert(res);
+  res->tmp_size = pr->tmp_size;
+  res->tmp = (double *)calloc(res->tmp_size,sizeof(double));
+  assert(res->tmp);
+  init_array(res->tmp,res->tmp_size);
+  res->tmp2 = calloc(res->tmp_size,sizeof(long));
+  assert(res->tmp2);
+  res->man = man;
+  res->packed = pr->packed;
+  return res;
+}
+
 /*****
 Print Timing Information
 
@@ -311,11 +342,13 @@ ap_manager_t* opt_oct_manager_alloc(void)
   init_array(pr->tmp,pr->tmp_size);
   pr->tmp2 = calloc(pr->tmp_size,sizeof(long));
   assert(pr->tmp2);
+  pr->packed = false;
   
   man = ap_manager_alloc("opt_oct","1.0 with double", pr,
 			 (void (*)(void*))opt_oct_internal_free);
 
   pr->man = man;
+  ap_manager_set_internal_clone(man, &opt_oct_internal_clone);
 
   man->funptr[AP_FUNID_COPY] = &opt_oct_copy;
   man->funptr[AP_FUNID_FREE] = &opt_oct_free;
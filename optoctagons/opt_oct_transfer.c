@@ -17,14 +17,19 @@
 
 #include "opt_oct_hmat.h"
 
-opt_oct_t* opt_oct_assign_linexpr(ap_manager_t* man,
-			  bool destructive, opt_oct_t* o,
-			  ap_dim_t d, ap_linexpr0_t* lexpr,
-			  opt_oct_t* dest)
+/* The expression is taken either from lexpr, or if lexpr==NULL, from the
+   given row of pack */
+static opt_oct_t* opt_oct_assign_row(ap_manager_t* man,
+				     bool destructive, opt_oct_t* o,
+				     ap_dim_t d, ap_linexpr0_t* lexpr,
+				     ap_linpack0_t* pack, size_t row,
+				     opt_oct_t* dest)
 {
   opt_oct_internal_t* pr =
     opt_oct_init_from_manager(man,AP_FUNID_ASSIGN_LINEXPR_ARRAY,2*(o->dim+1+5));
-  opt_uexpr u = opt_oct_uexpr_of_linexpr(pr,pr->tmp,lexpr,o->intdim,o->dim);
+  opt_uexpr u = lexpr ?
+    opt_oct_uexpr_of_linexpr(pr,pr->tmp,lexpr,o->intdim,o->dim) :
+    opt_oct_uexpr_of_linpack0(pr,pr->tmp,pack,row,o->intdim,o->dim);
   opt_oct_mat_t* src;
   bool respect_closure;
   if(d>=o->dim){
@@ -77,17 +82,28 @@ opt_oct_t* opt_oct_assign_linexpr(ap_manager_t* man,
   else return opt_oct_set_mat(pr,o,src,NULL,destructive);
 }
 
+opt_oct_t* opt_oct_assign_linexpr(ap_manager_t* man,
+			  bool destructive, opt_oct_t* o,
+			  ap_dim_t d, ap_linexpr0_t* lexpr,
+			  opt_oct_t* dest)
+{
+  return opt_oct_assign_row(man,destructive,o,d,lexpr,NULL,0,dest);
+}
 
 
-opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man,
-				bool destructive, opt_oct_t* o,
-				ap_dim_t* tdim,
-				ap_linexpr0_t** lexpr,
-				size_t size,
-				opt_oct_t* dest)
+/* The expressions are taken either from lexpr, or if lexpr==NULL, from
+   the rows of pack */
+static opt_oct_t* opt_oct_assign_rows(ap_manager_t* man,
+				      bool destructive, opt_oct_t* o,
+				      ap_dim_t* tdim,
+				      ap_linexpr0_t** lexpr,
+				      ap_linpack0_t* pack,
+				      size_t size,
+				      opt_oct_t* dest)
 {
   if (size==1)
-    return opt_oct_assign_linexpr(man,destructive,o,tdim[0],lexpr[0],dest);
+    return opt_oct_assign_row(man,destructive,o,tdim[0],
+			      lexpr ? lexpr[0] : NULL,pack,0,dest);
 
   opt_oct_internal_t* pr =
     opt_oct_init_from_manager(man,AP_FUNID_ASSIGN_LINEXPR_ARRAY,2*(o->dim+size+5));
@@ -97,6 +113,7 @@ opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man,
   ap_dim_t p = o->dim;
   int inexact = 0;
   bool respect_closure = false; /* TODO */
+  bool interrupted;
   int src_size = 2*(o->dim)*(o->dim+1);
   
   /* checks */
@@ -137,7 +154,9 @@ opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man,
   /* perform assignments */
   for (i=0;i<size;i++) {
 
-    opt_uexpr u = opt_oct_uexpr_of_linexpr(pr,pr->tmp,lexpr[i],o->intdim,o->dim);
+    opt_uexpr u = lexpr ?
+      opt_oct_uexpr_of_linexpr(pr,pr->tmp,lexpr[i],o->intdim,o->dim) :
+      opt_oct_uexpr_of_linpack0(pr,pr->tmp,pack,i,o->intdim,o->dim);
 
     if (u.type==OPT_EMPTY) {
       opt_hmat_free(dst);
@@ -154,11 +173,12 @@ opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man,
   #endif
   /* now close & remove temporary variables */
   if (pr->funopt->algorithm>=0) {
-    if (opt_hmat_strong_closure(dst,o->dim+size)) {
+    if (opt_hmat_strong_closure_timeout(dst,o->dim+size,pr->man,&interrupted)) {
       /* empty */
       opt_hmat_free(dst);
       return opt_oct_set_mat(pr,o,NULL,NULL,destructive);
     }
+    if (interrupted) flag_timeout;
   }
   else flag_algo;
   if (!destructive) src = opt_hmat_alloc(src_size);
@@ -186,9 +206,23 @@ opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man,
 }
 
 
-opt_oct_t* opt_oct_meet_lincons_array(ap_manager_t* man,
-			      bool destructive, opt_oct_t* o,
-			      ap_lincons0_array_t* array)
+opt_oct_t* opt_oct_assign_linexpr_array(ap_manager_t* man,
+				bool destructive, opt_oct_t* o,
+				ap_dim_t* tdim,
+				ap_linexpr0_t** lexpr,
+				size_t size,
+				opt_oct_t* dest)
+{
+  return opt_oct_assign_rows(man,destructive,o,tdim,lexpr,NULL,size,dest);
+}
+
+
+/* The constraints are taken either from array, or if array==NULL, from
+   pack */
+static opt_oct_t* opt_oct_meet_rows(ap_manager_t* man,
+				    bool destructive, opt_oct_t* o,
+				    ap_lincons0_array_t* array,
+				    ap_linpack0_t* pack)
 {
   opt_oct_internal_t* pr =
     opt_oct_init_from_manager(man,AP_FUNID_MEET_LINCONS_ARRAY,2*(o->dim+8));
@@ -209,7 +243,9 @@ opt_oct_t* opt_oct_meet_lincons_array(ap_manager_t* man,
     #if defined(TIMING)
   	start_timing();
     #endif
-    bool res = opt_hmat_add_lincons(pr,oo,o->intdim,o->dim,array,&exact,&respect_closure);
+    bool res = array ?
+      opt_hmat_add_lincons(pr,oo,o->intdim,o->dim,array,&exact,&respect_closure) :
+      opt_hmat_add_linpack0(pr,oo,o->intdim,o->dim,pack,&exact,&respect_closure);
     #if defined(TIMING)
 	record_timing(meet_lincons_time);
     #endif
@@ -231,6 +267,92 @@ opt_oct_t* opt_oct_meet_lincons_array(ap_manager_t* man,
   }
 }
 
+opt_oct_t* opt_oct_meet_lincons_array(ap_manager_t* man,
+			      bool destructive, opt_oct_t* o,
+			      ap_lincons0_array_t* array)
+{
+  return opt_oct_meet_rows(man,destructive,o,array,NULL);
+}
+
+
+/* ============================================================ */
+/* Packed expressions and constraints */
+/* ============================================================ */
+
+/* Matrices hold doubles: an exact pack is first repacked into doubles,
+   rounding its coefficients outward */
+static ap_linpack0_t* opt_oct_linpack0_double(ap_linpack0_t* pack)
+{
+  ap_lincons0_array_t array;
+  ap_linpack0_t* res;
+  if (pack->discr==AP_SCALAR_DOUBLE) return pack;
+  array = ap_lincons0_array_of_linpack0(pack);
+  res = ap_linpack0_of_lincons0_array(AP_SCALAR_DOUBLE,&array);
+  ap_lincons0_array_clear(&array);
+  return res;
+}
+
+opt_oct_t* opt_oct_meet_linpack0(ap_manager_t* man,
+				 bool destructive, opt_oct_t* o,
+				 ap_linpack0_t* pack)
+{
+  ap_linpack0_t* dpack = opt_oct_linpack0_double(pack);
+  opt_oct_t* r = opt_oct_meet_rows(man,destructive,o,NULL,dpack);
+  if (dpack!=pack) ap_linpack0_free(dpack);
+  return r;
+}
+
+opt_oct_t* opt_oct_assign_linpack0(ap_manager_t* man,
+				   bool destructive, opt_oct_t* o,
+				   ap_dim_t* tdim,
+				   ap_linpack0_t* pack,
+				   opt_oct_t* dest)
+{
+  ap_linpack0_t* dpack = opt_oct_linpack0_double(pack);
+  opt_oct_t* r = opt_oct_assign_rows(man,destructive,o,tdim,NULL,dpack,
+				     dpack->size,dest);
+  if (dpack!=pack) ap_linpack0_free(dpack);
+  return r;
+}
+
+ap_abstract0_t* ap_abstract0_opt_oct_meet_linpack0(ap_manager_t* man,
+						   bool destructive,
+						   ap_abstract0_t* a,
+						   ap_linpack0_t* pack)
+{
+  opt_oct_internal_t* pr = (opt_oct_internal_t*)man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,a->value);
+  opt_oct_t* r = opt_oct_meet_linpack0(man,destructive,u,pack);
+  opt_oct_release(pr,a->value,u);
+  opt_oct_pack(pr,r);
+  if (destructive) {
+    a->value = r;
+    return a;
+  }
+  return abstract0_of_opt_oct(man,r);
+}
+
+ap_abstract0_t* ap_abstract0_opt_oct_assign_linpack0(ap_manager_t* man,
+						     bool destructive,
+						     ap_abstract0_t* a,
+						     ap_dim_t* tdim,
+						     ap_linpack0_t* pack,
+						     ap_abstract0_t* dest)
+{
+  opt_oct_internal_t* pr = (opt_oct_internal_t*)man->internal;
+  opt_oct_t* u = opt_oct_unpacked(pr,destructive,a->value);
+  opt_oct_t* udest = dest ? opt_oct_unpacked(pr,false,dest->value) : NULL;
+  opt_oct_t* r = opt_oct_assign_linpack0(man,destructive,u,tdim,pack,udest);
+  opt_oct_release(pr,a->value,u);
+  if (dest) opt_oct_release(pr,dest->value,udest);
+  opt_oct_pack(pr,r);
+  if (destructive) {
+    a->value = r;
+    return a;
+  }
+  return abstract0_of_opt_oct(man,r);
+}
+
 
 opt_oct_t* opt_oct_meet_tcons_array(ap_manager_t* man,
 			    bool destructive, opt_oct_t* o,
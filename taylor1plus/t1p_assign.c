@@ -100,6 +100,7 @@ t1p_t* t1p_assign_texpr_array(ap_manager_t* man,
 	itv_set(res->box[tdim[i]],res->paf[tdim[i]]->itv);
 	res->paf[tdim[i]]->pby++;
     }
+    if (destructive) t1p_free(man, a);
     /* TODO: mettre top pour le moment */
     man->result.flag_best = tbool_top;
     man->result.flag_exact = tbool_top;
@@ -284,7 +284,6 @@ ap_interval_t* t1p_bound_dimension(ap_manager_t* man, t1p_t* a, ap_dim_t dim)
     //ap_interval_set_itv(pr->itv, ap_itv, tmp);
     ap_interval_set_itv(pr->itv, ap_itv, a->box[dim]);
     //itv_clear(tmp);
-    ap_interval_free(ap_itv);
     return ap_itv;
 }
 
@@ -22,149 +22,109 @@
 
 
 	/* pseudo-taken from http://kiwi.emse.fr/POLE/SDA/corr-iset.html */
-	/* we initialize p,q with the head of each list :
-	 * - if p and q are null pointers, we reach the halt condition;
-	 * - if one of p or q is a null pointer, we copy the non null list;
-	 * - else, p and q are non null pointers :
+	/* we initialize p,q with the first term of each array :
+	 * - if p and q are past the end, we reach the halt condition;
+	 * - if one of p or q is past the end, we copy the rest of the other array;
+	 * - else :
 	 *   - if nsym_index p = nsym_index q then 
 	 *    * add coeff, 
 	 *    * copy the index, 
-	 *    * increment p and q to p->next and q->next respectively.
+	 *    * increment p and q.
 	 *   - if nsym_index p < nsymindex q then
-	 *    * copy coeff and nsym_index of p,
-	 *    * increment p.
+	 *    * copy the run of terms of p whose index is less than nsym_index q,
+	 *    * move p past the run.
 	 *   - else :
-	 *    * copy coeff and nsym_index of q,
-	 *    * increment q.
+	 *    * copy the run of terms of q whose index is less than nsym_index p,
+	 *    * move q past the run.
+	 * The terms of q are negated if sub is true.
 	 */
+static void t1p_aff_merge(t1p_internal_t* pr, t1p_aff_t* res, t1p_aff_t* exprA, t1p_aff_t* exprB, bool sub)
+{
+    t1p_aaterm_t *p, *q, *ptr, *run;
+    t1p_aaterm_t *pend, *qend;
+    t1p_aff_reserve(pr, res, exprA->l + exprB->l);
+    p = exprA->q; pend = exprA->q + exprA->l;
+    q = exprB->q; qend = exprB->q + exprB->l;
+    ptr = res->q;
+    while (p < pend && q < qend) {
+	if (p->pnsym->index == q->pnsym->index) {
+	    if (!sub) t1p_coeff_add(ptr->coeff, p->coeff, q->coeff);
+	    else if (!itv_is_eq(p->coeff, q->coeff)) t1p_coeff_sub(ptr->coeff, p->coeff, q->coeff);
+	    else itv_set_int(ptr->coeff, 0);
+	    ptr->pnsym = p->pnsym;
+	    p++; q++; ptr++;
+	} else if (p->pnsym->index < q->pnsym->index) {
+	    for (run = p; run < pend && run->pnsym->index < q->pnsym->index; run++);
+	    t1p_aaterm_copy(ptr, p, (uint_t)(run - p));
+	    ptr += run - p;
+	    p = run;
+	} else {
+	    for (run = q; run < qend && run->pnsym->index < p->pnsym->index; run++);
+	    if (sub) t1p_aaterm_neg(ptr, q, (uint_t)(run - q));
+	    else t1p_aaterm_copy(ptr, q, (uint_t)(run - q));
+	    ptr += run - q;
+	    q = run;
+	}
+    }
+    t1p_aaterm_copy(ptr, p, (uint_t)(pend - p));
+    ptr += pend - p;
+    if (sub) t1p_aaterm_neg(ptr, q, (uint_t)(qend - q));
+    else t1p_aaterm_copy(ptr, q, (uint_t)(qend - q));
+    ptr += qend - q;
+    res->l = (uint_t)(ptr - res->q);
+}
+
+/* removes the terms of res with a zero coefficient, keeping the order of
+ * the others, and adds the concretization of the others to box */
+static void t1p_aff_keep_nonzero(t1p_internal_t* pr, t1p_aff_t* res, itv_t box, t1p_t* abs)
+{
+    itv_t tmp; itv_init(tmp);
+    uint_t i, k;
+    for (i=0, k=0; i<res->l; i++) {
+	if (!itv_is_zero(res->q[i].coeff)) {
+	    if (k != i) {
+		itv_swap(res->q[k].coeff, res->q[i].coeff);
+		res->q[k].pnsym = res->q[i].pnsym;
+	    }
+	    t1p_nsymcons_get_gamma(pr, tmp, res->q[k].pnsym->index, abs);
+	    itv_mul(pr->itv, tmp, tmp, res->q[k].coeff);
+	    itv_add(box, box, tmp);
+	    k++;
+	}
+    }
+    res->l = k;
+    itv_clear(tmp);
+}
+
 t1p_aff_t* t1p_aff_add(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff_t* exprB, t1p_t* abs)
 {
     itv_t box; itv_init(box);
-    itv_t tmp; itv_init(tmp);
     t1p_aff_t* res = t1p_aff_alloc_init(pr);
-    t1p_aaterm_t *p, *q, *ptr;
     itv_add(res->c, exprA->c, exprB->c);
     itv_set(box, res->c);
-    if (exprA->q || exprB->q) {
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exprA->q, q = exprB->q; p || q;) {
-	    if (p && q) {
-		if (p->pnsym->index == q->pnsym->index) {
-		    itv_add(ptr->coeff, p->coeff, q->coeff);
-		    ptr->pnsym = p->pnsym;
-		    p = p->n ;
-		    q = q->n ;
-		} else if (p->pnsym->index < q->pnsym->index) {
-		    itv_set(ptr->coeff, p->coeff);
-		    ptr->pnsym = p->pnsym;
-		    p = p->n ;
-		} else {
-		    itv_set(ptr->coeff, q->coeff);
-		    ptr->pnsym = q->pnsym;
-		    q = q->n ;
-		}
-	    } else if (p) {
-		itv_set(ptr->coeff, p->coeff);
-		ptr->pnsym = p->pnsym;
-		p = p->n ;
-	    } else {
-		itv_set(ptr->coeff, q->coeff);
-		ptr->pnsym = q->pnsym;
-		q = q->n ;
-	    }
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
-		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
-		res->l++;
-		t1p_nsymcons_get_gamma(pr, tmp, ptr->pnsym->index, abs);
-		itv_mul(pr->itv, tmp, tmp, ptr->coeff);
-		itv_add(box, box, tmp);
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		}
-	    }
-	}
+    if (exprA->l || exprB->l) {
+	t1p_aff_merge(pr, res, exprA, exprB, false);
+	t1p_aff_keep_nonzero(pr, res, box, abs);
     }
     itv_add(res->itv, exprA->itv, exprB->itv);
     itv_meet(pr->itv, res->itv, res->itv, box);
     itv_clear(box);
-    itv_clear(tmp);
     return res;
 }
 
 t1p_aff_t* t1p_aff_sub(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff_t* exprB, t1p_t* abs)
 {
     itv_t box; itv_init(box);
-    itv_t tmp; itv_init(tmp);
     t1p_aff_t* res = t1p_aff_alloc_init(pr);
-    t1p_aaterm_t *p, *q, *ptr;
     if (!itv_is_eq(exprA->c, exprB->c)) itv_sub(res->c, exprA->c, exprB->c);
     itv_set(box, res->c);
-    if (exprA->q || exprB->q) {
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exprA->q, q = exprB->q; p || q;) {
-	    if (p && q) {
-		if (p->pnsym->index == q->pnsym->index) {
-		    if (!itv_is_eq(p->coeff, q->coeff)) itv_sub(ptr->coeff, p->coeff, q->coeff);
-		    ptr->pnsym = p->pnsym;
-		    p = p->n ;
-		    q = q->n ;
-		} else if (p->pnsym->index < q->pnsym->index) {
-		    itv_set(ptr->coeff, p->coeff);
-		    ptr->pnsym = p->pnsym;
-		    p = p->n ;
-		} else {
-		    itv_neg(ptr->coeff, q->coeff);
-		    ptr->pnsym = q->pnsym;
-		    q = q->n ;
-		}
-	    } else if (p) {
-		itv_set(ptr->coeff, p->coeff);
-		ptr->pnsym = p->pnsym;
-		p = p->n ;
-	    } else {
-		itv_neg(ptr->coeff, q->coeff);
-		ptr->pnsym = q->pnsym;
-		q = q->n ;
-	    }
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
-		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
-		res->l++;
-		t1p_nsymcons_get_gamma(pr, tmp, ptr->pnsym->index, abs);
-		itv_mul(pr->itv, tmp, tmp, ptr->coeff);
-		itv_add(box, box, tmp);
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		    ptr->n = NULL;
-		}
-	    }
-	}
+    if (exprA->l || exprB->l) {
+	t1p_aff_merge(pr, res, exprA, exprB, true);
+	t1p_aff_keep_nonzero(pr, res, box, abs);
     }
     itv_sub(res->itv, exprA->itv, exprB->itv);
     itv_meet(pr->itv, res->itv, res->itv, box);
     itv_clear(box);
-    itv_clear(tmp);
     return res;
 }
 
@@ -182,23 +142,10 @@ t1p_aff_t* t1p_aff_mul_itv(t1p_internal_t* pr, t1p_aff_t* src, itv_t lambda)
 	q = NULL;
 	dst = t1p_aff_alloc_init(pr);
 	itv_mul(pr->itv, dst->c, lambda, src->c);
-	if (src->q) {
-	    dst->q = q = t1p_aaterm_alloc_init();
-	    for (p=src->q; p; p=p->n) {
-		/*if (p == src->lastu) {
-		    dst->lastu = q;
-		}*/
-		itv_mul(pr->itv, q->coeff, lambda, p->coeff);
-		q->pnsym = p->pnsym;
-		if (p->n) {
-		    /* continue */
-		    q->n = t1p_aaterm_alloc_init();
-		    q = q->n;
-		} else {
-		    /* the last iteration */
-		    dst->end = q; 
-		}
-	    }
+	t1p_aff_reserve(pr, dst, src->l);
+	for (p=src->q, q=dst->q; p<src->q+src->l; p++, q++) {
+	    itv_mul(pr->itv, q->coeff, lambda, p->coeff);
+	    q->pnsym = p->pnsym;
 	}
 	dst->l = src->l;
 	itv_mul(pr->itv, dst->itv, src->itv, lambda);
@@ -219,7 +166,7 @@ void t1p_aff_mul_itv_inplace(t1p_internal_t* pr, t1p_aff_t* exprA, itv_t lambda)
     } else {
 	t1p_aaterm_t *p;
 	itv_mul(pr->itv, exprA->c, exprA->c, lambda);
-	for (p=exprA->q; p; p=p->n) {
+	for (p=exprA->q; p<exprA->q+exprA->l; p++) {
 	    itv_mul(pr->itv, p->coeff, p->coeff, lambda);
 	}
 	itv_mul(pr->itv, exprA->itv, exprA->itv, lambda);
@@ -291,11 +238,12 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
     checked_malloc(nsym_shared_hash,int,2+pr->dim,abort(););
     ap_dim_t abs_dim = 0;
 
-    if (exprA->q || exprB->q) {
-	res->q = ptr = t1p_aaterm_alloc_init();
-	res->l++;
+    if (exprA->l || exprB->l) {
 	/* linear part */
-	for(p = exprA->q, q = exprB->q; p || q;) {
+	t1p_aff_reserve(pr, res, exprA->l + exprB->l);
+	for(p = t1p_aff_first(exprA), q = t1p_aff_first(exprB); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
+	    res->l++;
 	    dim += 1;	/* computes the number of different noise symbols */
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
@@ -317,8 +265,8 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
 			    itv_set(gammabis[p->pnsym->index], pr->muu);
 			}
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exprA, p);
+		    q = t1p_aff_next(exprB, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    itv_mul(pr->itv, ptr->coeff, p->coeff, mid2);
 		    ptr->pnsym = p->pnsym;
@@ -333,7 +281,7 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
 			    itv_set(gammabis[p->pnsym->index], pr->muu);
 			}
 		    }
-		    p = p->n ;
+		    p = t1p_aff_next(exprA, p);
 		} else {
 		    itv_mul(pr->itv, ptr->coeff, q->coeff, mid1);
 		    ptr->pnsym = q->pnsym;
@@ -348,7 +296,7 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
 			    itv_set(gammabis[q->pnsym->index], pr->muu);
 			}
 		    }
-		    q = q->n ;
+		    q = t1p_aff_next(exprB, q);
 		}
 	    } else if (p) {
 		itv_mul(pr->itv, ptr->coeff, p->coeff, exprB->c);
@@ -364,7 +312,7 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
 			itv_set(gammabis[p->pnsym->index], pr->muu);
 		    }
 		}
-		p = p->n ;
+		p = t1p_aff_next(exprA, p);
 	    } else {
 		itv_mul(pr->itv, ptr->coeff, q->coeff, exprA->c);
 		ptr->pnsym = q->pnsym;
@@ -379,17 +327,9 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
 			itv_set(gammabis[q->pnsym->index], pr->muu);
 		    }
 		}
-		q = q->n ;
-	    }
-	    /* we don't create a new aaterm if p and q are null */
-	    if (p||q) {
-		ptr->n = t1p_aaterm_alloc_init();
-		res->l++;
-		ptr=ptr->n;
+		q = t1p_aff_next(exprB, q);
 	    }
 	}
-	ptr->n = NULL;
-	res->end = ptr;
     }
     /* non linear part */
     /* Calling SDP solver (non guaranteed):
@@ -398,16 +338,16 @@ t1p_aff_t* t1p_aff_mul_constrained_backup(t1p_internal_t* pr, t1p_aff_t* exprA,
      * - objectif matrix (in primal form) is a 2 block matrix of dimension 2n. First block is deduced from the non linear (quadric) part of multiplication, we zero all values of the second block,
      * - objective vector (in dual form) is a one vector of dimension "n".
      */
-    if (exprA->q && exprB->q) {
+    if (exprA->l && exprB->l) {
 	ap_funopt_t option = ap_manager_get_funopt(pr->man, pr->funid);
 	cond_SDP = option.algorithm == INT_MAX ? true : false;
 	itv_t itv1; itv_init(itv1);
 	itv_t itv2; itv_init(itv2);
 	if (cond_SDP) { 
-	    call_sdp(pr->itv, itv1, exprA->q, exprB->q, dim, hash, true);
+	    call_sdp(pr->itv, itv1, exprA, exprB, dim, hash, true);
 	}
 	else 
-	    square_dep(pr, itv2, exprA->q, exprB->q, hash, dim, gammabis);
+	    square_dep(pr, itv2, exprA, exprB, hash, dim, gammabis);
 	if (exprA == exprB) {
 	    if (bound_sgn(itv1->inf) > 0) {bound_set_int(itv1->inf,0);}
 	    if (bound_sgn(itv2->inf) > 0) {bound_set_int(itv2->inf,0);}
@@ -484,11 +424,11 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
     checked_malloc(nsym_shared_hash,int,2+pr->dim,abort(););
     ap_dim_t abs_dim = 0;
 
-    if (exprA->q || exprB->q) {
-	ptr = t1p_aaterm_alloc_init();
-	//res->l++;
+    if (exprA->l || exprB->l) {
 	/* linear part */
-	for(p = exprA->q, q = exprB->q; p || q;) {
+	t1p_aff_reserve(pr, res, exprA->l + exprB->l);
+	for(p = t1p_aff_first(exprA), q = t1p_aff_first(exprB); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    dim += 1;	/* computes the number of different noise symbols */
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
@@ -511,8 +451,8 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
 			    itv_set(eps_itv,pr->muu);
 			}
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exprA, p);
+		    q = t1p_aff_next(exprB, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    itv_mul(pr->itv, ptr->coeff, p->coeff, mid2);
 		    ptr->pnsym = p->pnsym;
@@ -528,7 +468,7 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
 			    itv_set(eps_itv,pr->muu);
 			}
 		    }
-		    p = p->n ;
+		    p = t1p_aff_next(exprA, p);
 		} else {
 		    itv_mul(pr->itv, ptr->coeff, q->coeff, mid1);
 		    ptr->pnsym = q->pnsym;
@@ -544,7 +484,7 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
 			    itv_set(eps_itv,pr->muu);
 			}
 		    }
-		    q = q->n ;
+		    q = t1p_aff_next(exprB, q);
 		}
 	    } else if (p) {
 		itv_mul(pr->itv, ptr->coeff, p->coeff, mid2);
@@ -561,7 +501,7 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
 			itv_set(eps_itv,pr->muu);
 		    }
 		}
-		p = p->n ;
+		p = t1p_aff_next(exprA, p);
 	    } else {
 		itv_mul(pr->itv, ptr->coeff, q->coeff, mid1);
 		ptr->pnsym = q->pnsym;
@@ -577,29 +517,13 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
 			itv_set(eps_itv,pr->muu);
 		    }
 		}
-		q = q->n ;
+		q = t1p_aff_next(exprB, q);
 	    }
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
 		itv_mul(pr->itv, eps_itv, eps_itv, ptr->coeff);
 		itv_add(res->itv, res->itv, eps_itv);
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		    ptr->n = NULL;
-		}
 	    }
 	}
     }
@@ -610,16 +534,16 @@ t1p_aff_t* t1p_aff_mul_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff
      * - objectif matrix (in primal form) is a 2 block matrix of dimension 2n. First block is deduced from the non linear (quadric) part of multiplication, we zero all values of the second block,
      * - objective vector (in dual form) is a one vector of dimension "n".
      */
-    if (exprA->q && exprB->q) {
+    if (exprA->l && exprB->l) {
 	ap_funopt_t option = ap_manager_get_funopt(pr->man, pr->funid);
 	cond_SDP = option.algorithm == INT_MAX ? true : false;
 	itv_t itv1; itv_init(itv1);
 	itv_t itv2; itv_init(itv2);
 	if (cond_SDP) { 
-	    call_sdp(pr->itv, itv1, exprA->q, exprB->q, dim, hash, true);
+	    call_sdp(pr->itv, itv1, exprA, exprB, dim, hash, true);
 	}
 	else 
-	    square_dep(pr, itv2, exprA->q, exprB->q, hash, dim, gammabis);
+	    square_dep(pr, itv2, exprA, exprB, hash, dim, gammabis);
 	if (exprA == exprB) {
 	    if (bound_sgn(itv1->inf) > 0) {bound_set_int(itv1->inf,0);}
 	    if (bound_sgn(itv2->inf) > 0) {bound_set_int(itv2->inf,0);}
@@ -670,9 +594,10 @@ t1p_aff_t* t1p_aff_mul_non_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p
     t1p_aff_t* res = t1p_aff_alloc_init(pr);
     itv_mul(pr->itv, res->c, exprA->c, exprB->c);
     itv_set(res->itv, res->c);
-    if (exprA->q || exprB->q) {
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exprA->q, q = exprB->q; p || q;) {
+    if (exprA->l || exprB->l) {
+	t1p_aff_reserve(pr, res, exprA->l + exprB->l);
+	for(p = t1p_aff_first(exprA), q = t1p_aff_first(exprB); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    dim += 1;	/* compute the number of different noise symbols */
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
@@ -686,52 +611,36 @@ t1p_aff_t* t1p_aff_mul_non_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p
 		    SDP_dim++;
 		    nsym_shared_hash[p->pnsym->index] = SDP_dim;
 
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exprA, p);
+		    q = t1p_aff_next(exprB, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    itv_mul(pr->itv, ptr->coeff, p->coeff, exprB->c);
 		    ptr->pnsym = p->pnsym;
 		    hash[p->pnsym->index] = dim;
-		    p = p->n ;
+		    p = t1p_aff_next(exprA, p);
 		} else {
 		    itv_mul(pr->itv, ptr->coeff, q->coeff, exprA->c);
 		    ptr->pnsym = q->pnsym;
 		    hash[q->pnsym->index] = dim;
-		    q = q->n ;
+		    q = t1p_aff_next(exprB, q);
 		}
 	    } else if (p) {
 		itv_mul(pr->itv, ptr->coeff, p->coeff, exprB->c);
 		ptr->pnsym = p->pnsym;
 		hash[p->pnsym->index] = dim;
-		p = p->n ;
+		p = t1p_aff_next(exprA, p);
 	    } else {
 		itv_mul(pr->itv, ptr->coeff, q->coeff, exprA->c);
 		ptr->pnsym = q->pnsym;
 		hash[q->pnsym->index] = dim;
-		q = q->n ;
+		q = t1p_aff_next(exprB, q);
 	    }
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
 		t1p_nsymcons_get_gamma(pr, tmp, ptr->pnsym->index, env);
 		itv_mul(pr->itv, tmp, tmp, ptr->coeff);
 		itv_add(res->itv, res->itv, tmp);
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		    ptr->n = NULL;
-		}
 	    }
 	}
     }
@@ -742,23 +651,23 @@ t1p_aff_t* t1p_aff_mul_non_constrained(t1p_internal_t* pr, t1p_aff_t* exprA, t1p
      * - objectif matrix (in primal form) is a 2 block matrix of dimension 2n. First block is deduced from the non linear (quadric) part of multiplication, we zero all values of the second block,
      * - objective vector (in dual form) is a one vector of dimension "n".
      */
-    if (exprA->q && exprB->q) {
+    if (exprA->l && exprB->l) {
 	ap_funopt_t option = ap_manager_get_funopt(pr->man, pr->funid);
 	cond_SDP = option.algorithm == INT_MAX ? true : false;
 	itv_t itv1; itv_init(itv1);
 	itv_t itv2; itv_init(itv2);
 	if (cond_SDP) { 
-	    call_sdp(pr->itv, itv1, exprA->q, exprB->q, dim, hash, true);
+	    call_sdp(pr->itv, itv1, exprA, exprB, dim, hash, true);
 	    /* tentative de mise en place d'un solveur garantit, to be continued ... */
 	    //		    itv_t* array = itv_array_alloc(dim*(dim+1)/2);
-	    //		    buildIntervalUpperTriangle(pr, array, exprA->q, exprB->q, dim, hash);
+	    //		    buildIntervalUpperTriangle(pr, array, exprA, exprB, dim, hash);
 	    //		    double* phi = buildDoubleUpperTriangle(pr, array, dim);
 	    //		    call_sound_sdp(dim, phi);
 	    //		    free(phi);
 	    //		    itv_array_free(array,(dim*(dim+1)/2));
 	}
 	else 
-	    square_dep(pr, itv2, exprA->q, exprB->q, hash, dim, NULL);
+	    square_dep(pr, itv2, exprA, exprB, hash, dim, NULL);
 
 	if (exprA == exprB) {
 	    if (bound_sgn(itv1->inf) > 0) {bound_set_int(itv1->inf,0);}
@@ -810,7 +719,7 @@ t1p_aff_t* t1p_aff_div(t1p_internal_t* pr, t1p_aff_t* exprA, t1p_aff_t* exprB, t
 	itv_div(pr->itv, tmp, one, exprB->itv);
 	res = t1p_aff_mul_itv(pr, exprA, tmp);
     } else {
-	if (exprB->q == NULL) {
+	if (exprB->l == 0) {
 	    itv_div(pr->itv, tmp, one, exprB->c);
 	    res = t1p_aff_mul_itv(pr,exprA,tmp);
 	} else {
@@ -970,33 +879,18 @@ t1p_aff_t* t1p_aff_sqrt( t1p_internal_t* pr, t1p_aff_t* expr, t1p_t* env)
 t1p_aff_t* t1p_aff_neg(t1p_internal_t* pr, t1p_aff_t* b)
 {
     t1p_aff_t* res = t1p_aff_alloc_init(pr);
-    t1p_aaterm_t *p, *q;
     itv_neg(res->c, b->c);
+    t1p_aff_reserve(pr, res, b->l);
+    t1p_aaterm_neg(res->q, b->q, b->l);
     res->l = b->l;
-    if (b->q) {
-	res->q = t1p_aaterm_alloc_init();
-
-	for (p=b->q, q=res->q; p->n; p=p->n) {
-	    itv_neg(q->coeff, p->coeff);
-	    q->pnsym = p->pnsym;
-	    q->n = t1p_aaterm_alloc_init();
-	    q = q->n;
-	}
-	itv_neg(q->coeff, p->coeff);
-	q->pnsym = p->pnsym;
-	res->end = q;
-    }
     itv_neg(res->itv, b->itv);
     return res;
 }
 
 void t1p_aff_neg_inplace(t1p_internal_t* pr, t1p_aff_t* b)
 {
-    t1p_aaterm_t *p;
     itv_neg(b->c, b->c);
-    for (p=b->q; p->n; p=p->n) {
-	itv_neg(p->coeff, p->coeff);
-    }
+    t1p_aaterm_neg(b->q, b->q, b->l);
     itv_neg(b->itv, b->itv);
 }
 
@@ -1139,7 +1033,7 @@ t1p_aff_t* t1p_aff_eval_ap_texpr0(t1p_internal_t* pr, ap_texpr0_t* expr, t1p_t*
  * => non linear part \in (itv1 + itv2)
  * add_itv(itv1 + itv2)
 */
-void square_dep(t1p_internal_t* pr, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q, int* hash, unsigned int dim, itv_t* gamma)
+void square_dep(t1p_internal_t* pr, itv_t res, t1p_aff_t* exprA, t1p_aff_t* exprB, int* hash, unsigned int dim, itv_t* gamma)
 {
     t1p_aaterm_t* ptr_p; 
     t1p_aaterm_t* ptr_q;
@@ -1156,8 +1050,8 @@ void square_dep(t1p_internal_t* pr, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q,
 	itv_set_int2(zeroone,(long int)0,(long int)1);
 	itv_set_int2(moneone,(long int)(-1),(long int)1);
 	for (i=0; i<dim; i++) itv_matrix[i] = itv_array_alloc(dim);
-	for (ptr_p=p; ptr_p; ptr_p = ptr_p->n) {
-	    for (ptr_q=q; ptr_q; ptr_q = ptr_q->n) {
+	for (ptr_p=exprA->q; ptr_p<exprA->q+exprA->l; ptr_p++) {
+	    for (ptr_q=exprB->q; ptr_q<exprB->q+exprB->l; ptr_q++) {
 		itv_mul(pr->itv, tmp, ptr_p->coeff, ptr_q->coeff);
 		itv_set(itv_matrix[hash[ptr_p->pnsym->index]-1][hash[ptr_q->pnsym->index]-1], tmp);
 	    }
@@ -1194,8 +1088,8 @@ void square_dep(t1p_internal_t* pr, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q,
 	    itv_matrix[i] = itv_array_alloc(dim);
 	    itv_matrix2[i] = itv_array_alloc(i+1);
 	}
-	for (ptr_p=p; ptr_p; ptr_p = ptr_p->n) {
-	    for (ptr_q=q; ptr_q; ptr_q = ptr_q->n) {
+	for (ptr_p=exprA->q; ptr_p<exprA->q+exprA->l; ptr_p++) {
+	    for (ptr_q=exprB->q; ptr_q<exprB->q+exprB->l; ptr_q++) {
 		itv_mul(pr->itv, tmp, ptr_p->coeff, ptr_q->coeff);
 		itv_set(itv_matrix[hash[ptr_p->pnsym->index]-1][hash[ptr_q->pnsym->index]-1], tmp);
 		itv_mul(pr->itv, tmp, gamma[ptr_p->pnsym->index], gamma[ptr_q->pnsym->index]);
@@ -1234,7 +1128,7 @@ void square_dep(t1p_internal_t* pr, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q,
     itv_clear(tmp); itv_clear(tmp1); itv_clear(tmp2);
 }
 
-    void buildIntervalUpperTriangle(t1p_internal_t* pr, itv_t* array, t1p_aaterm_t* p, t1p_aaterm_t* q, size_t dim, int* hash) 
+    void buildIntervalUpperTriangle(t1p_internal_t* pr, itv_t* array, t1p_aff_t* exprA, t1p_aff_t* exprB, size_t dim, int* hash) 
 {
 }
 
@@ -1252,13 +1146,13 @@ double* buildDoubleUpperTriangle(t1p_internal_t* pr, itv_t* array, size_t dim) {
 }
 
 #ifndef _USE_SDP
-bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q, size_t dim, int* hash, bool square) 
+bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aff_t* exprA, t1p_aff_t* exprB, size_t dim, int* hash, bool square) 
 {
 	printf("SDP not supported, you have to enable it and rebuild the library\n");
 	abort();
 }
 #else
-bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q, size_t dim, int* hash, bool square)
+bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aff_t* exprA, t1p_aff_t* exprB, size_t dim, int* hash, bool square)
 {
     //	printf("Calling SDP %d\n",dim);
     t1p_aaterm_t* ptr_p; 
@@ -1354,8 +1248,8 @@ bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q,
     num_t eps; num_init(eps);
     bound_t err; bound_init(err);
     num_set_double(eps,(double)30*1.11022302462515654042e-16);
-    for (ptr_p=p; ptr_p; ptr_p = ptr_p->n) {
-	for (ptr_q=q; ptr_q; ptr_q = ptr_q->n) {
+    for (ptr_p=exprA->q; ptr_p<exprA->q+exprA->l; ptr_p++) {
+	for (ptr_q=exprB->q; ptr_q<exprB->q+exprB->l; ptr_q++) {
 	    /* TODO: We shall resolve an interval SDP problem and not reduce the interval to tmp->sup */
 	    itv_mul(itv, tmp, ptr_p->coeff, ptr_q->coeff);
 	    if (itv_is_point(itv, tmp)) double_set_num(&dbl, tmp->sup); 
@@ -55,9 +55,9 @@ t1p_aff_t* t1p_aff_sqrt(t1p_internal_t* pr, t1p_aff_t* a, t1p_t* env);
 t1p_aff_t* t1p_aff_mod(t1p_internal_t* pr, t1p_aff_t* a, t1p_aff_t* b);
 
 //void square_dep(itv_internal_t* itv, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q);
-void square_dep(t1p_internal_t* pr, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q, int* hash, unsigned int dim, itv_t* gamma);
-bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aaterm_t* p, t1p_aaterm_t* q, size_t dim, int* hash, bool square);
+void square_dep(t1p_internal_t* pr, itv_t res, t1p_aff_t* exprA, t1p_aff_t* exprB, int* hash, unsigned int dim, itv_t* gamma);
+bool call_sdp(itv_internal_t* itv, itv_t res, t1p_aff_t* exprA, t1p_aff_t* exprB, size_t dim, int* hash, bool square);
 
-void buildIntervalUpperTriangle(t1p_internal_t* pr, itv_t* array, t1p_aaterm_t* p, t1p_aaterm_t* q, size_t dim, int* hash);
+void buildIntervalUpperTriangle(t1p_internal_t* pr, itv_t* array, t1p_aff_t* exprA, t1p_aff_t* exprB, size_t dim, int* hash);
 double* buildDoubleUpperTriangle(t1p_internal_t* pr, itv_t* array, size_t dim);
 #endif
@@ -32,10 +32,12 @@ ap_manager_t* t1p_manager_alloc(void)
 	ap_manager_t* man;
 	void** funptr;
 
-	/*if (!ap_fpu_init()) {
+#if defined(NUM_NUMFLT)
+	/* floating-point coefficients are sound only with upward rounding */
+	if (!ap_fpu_init()) {
 		fprintf(stderr,"t1p_manager_alloc cannot change the FPU rounding mode\n");
-		return NULL;
-	}*/
+	}
+#endif
 	ap_manager_t* manNS = box_manager_alloc();
 	//ap_manager_t* manNS = oct_manager_alloc();
 	//ap_manager_t* manNS = pk_manager_alloc(true);
@@ -46,6 +48,9 @@ ap_manager_t* t1p_manager_alloc(void)
 			t1p, /* internal structure */
 			(void (*)(void*))t1p_internal_free /* free function for internal */
 			);
+	/* No internal_clone: the noise symbols of the values are allocated in
+	   the internal structure of the manager, which a clone could not share,
+	   so ap_manager_clone_for_thread returns NULL for Taylor1+ */
 
 	funptr = man->funptr;
 
@@ -137,6 +142,8 @@ ap_manager_t* t1p_manager_alloc(void)
 	   AP_FUNID_SIZE2
 	 */
 	man->option.abort_if_exception[AP_EXC_INVALID_ARGUMENT] = false;
+	man->option.abort_if_exception[AP_EXC_TIMEOUT] = false;
+	man->option.abort_if_exception[AP_EXC_OUT_OF_SPACE] = false;
 	return man;
 }
 
@@ -146,6 +153,57 @@ int ap_manager_t1p_get_nsym(ap_manager_t* man)
         return pr->dim;
 }
 
+/* Renumber the noise symbols referenced by the abstract values of tab
+   from 0 on, keeping their relative order, and free the other ones. */
+int ap_manager_t1p_compact_nsym(ap_manager_t* man, ap_abstract0_t** tab, size_t size)
+{
+	t1p_internal_t * pr = t1p_init_from_manager(man, AP_FUNID_UNKNOWN);
+	uint_t* newindex = (uint_t*)malloc((pr->dim+1)*sizeof(uint_t));
+	uint_t i, j, k, n;
+	size_t l;
+	t1p_aaterm_t* p;
+
+	/* mark used noise symbols */
+	for (i=0; i<pr->dim; i++) newindex[i] = 0;
+	for (l=0; l<size; l++) {
+	    t1p_t* a = (t1p_t*)tab[l]->value;
+	    for (i=0; i<a->dims; i++) {
+		for (p=a->paf[i]->q; p<a->paf[i]->q+a->paf[i]->l; p++) newindex[p->pnsym->index] = 1;
+	    }
+	    n = t1p_nsymcons_get_dimension(pr, a);
+	    for (i=0; i<n; i++) newindex[a->nsymcons[i]] = 1;
+	}
+	/* renumber them */
+	k = 0;
+	for (i=0; i<pr->dim; i++) {
+	    if (newindex[i]) {
+		newindex[i] = k;
+		pr->epsilon[k] = pr->epsilon[i];
+		pr->epsilon[k]->index = k;
+		k++;
+	    } else {
+		free(pr->epsilon[i]);
+		pr->epsilon[i] = NULL;
+		newindex[i] = pr->dim;
+	    }
+	}
+	for (i=k; i<pr->dim; i++) pr->epsilon[i] = NULL;
+	/* input noise symbols */
+	for (i=0, j=0; i<pr->epssize; i++) {
+	    if (newindex[pr->inputns[i]] < pr->dim) pr->inputns[j++] = newindex[pr->inputns[i]];
+	}
+	pr->epssize = j;
+	/* constrained noise symbols */
+	for (l=0; l<size; l++) {
+	    t1p_t* a = (t1p_t*)tab[l]->value;
+	    n = t1p_nsymcons_get_dimension(pr, a);
+	    for (i=0; i<n; i++) a->nsymcons[i] = newindex[a->nsymcons[i]];
+	}
+	pr->dim = k;
+	free(newindex);
+	return (int)k;
+}
+
 
 int get_clk_tck (void)
 {
@@ -976,7 +1034,7 @@ void optpr_solve(t1p_internal_t* pr, itv_t alpha0x, itv_t alpha0, itv_t midgx, i
     /* construction de la forme finale */
     t1p_aaterm_t *ptr = NULL;
     res = t1p_aff_alloc_init(pr);
-    res->q = ptr = t1p_aaterm_alloc_init();
+    t1p_aff_reserve(pr, res, opt->size);
     ap_interval_t* itv_dim = NULL;
     for (i=0;i<opt->size+1;i++) {
 	itv_dim = ap_abstract0_bound_dimension(pk, obj, (ap_dim_t)i);
@@ -984,16 +1042,12 @@ void optpr_solve(t1p_internal_t* pr, itv_t alpha0x, itv_t alpha0, itv_t midgx, i
 	itv_middev(pr->itv, tmp2,tmp3,tmp1);
 	if (i==0) itv_set(res->c,tmp2);
 	else {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    itv_set(ptr->coeff,tmp2);
 	    ptr->pnsym = opt->T[i-1].pnsym;
-	    res->end = ptr;
 	    res->l++;
-	    ptr->n = t1p_aaterm_alloc_init();
-	    ptr=ptr->n;
 	}
     }
-    t1p_aaterm_free(pr, ptr);
-    if (res->end) res->end->n = NULL;
 
     t1p_aff_nsym_create(pr, res, tauz, UN);
 
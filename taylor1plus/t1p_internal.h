@@ -20,6 +20,12 @@
 #include "t1p_itv_utils.h"
 #include "t1p_macro_def.h"
 
+/* SSE2 kernels on the coefficients of libt1pD */
+#if defined(NUM_DOUBLE) && defined(__SSE2__)
+#include <emmintrin.h>
+#define T1P_SIMD
+#endif
+
 #include "../newpolka/pk.h"
 #include "../box/box.h"
 #include "../octagons/oct.h"
@@ -51,7 +57,6 @@ typedef struct t1p_nsym_t {
 /*****************/
 /* Taylor1+ affine arithmetic term */
 typedef struct _t1p_aaterm_t {
-    struct _t1p_aaterm_t*	n;	/* next element */
     t1p_nsym_t*		pnsym;	/* index of the noise symbol */
     itv_t			coeff;	/* coeff, encoded as interval */
 } t1p_aaterm_t;
@@ -59,12 +64,15 @@ typedef struct _t1p_aaterm_t {
 /************************/
 /* Taylor1+ affine form */
 /************************/
+/* The terms of an affine form are stored in one array, sorted by
+   increasing index of noise symbol. The coefficients of the terms
+   q[l..size-1] are initialized too, so that they are reused when the form
+   grows. */
 struct _t1p_aff_t {
     itv_t		c;	/* center */
-    t1p_aaterm_t*	q;	/* first center term (epsilons) aaterm */
-    t1p_aaterm_t*	end;	/* quick jump to the last center term : to add a new term for instance */
-    t1p_aaterm_t*	lastu;	/* obsolete */
+    t1p_aaterm_t*	q;	/* center terms (epsilons) */
     uint_t		l;	/* number of noise symbols */
+    uint_t		size;	/* number of allocated terms */
     uint_t		pby;	/* # pointers to this affine form */
     itv_t		itv;	/* best known interval concretisation */
 };
@@ -151,6 +159,8 @@ typedef struct _t1p_internal_t {
     uint_t* inputns;
     uint_t epssize;
     uint_t it;	/* compteur d'iterations  la Kleene */
+    t1p_nsym_t**	pending;	/* if not NULL, noise symbols created but not yet numbered (see t1p_nsym_add) */
+    uint_t		npending;	/* size of pending */
 } t1p_internal_t;
 
 /***********/
@@ -201,13 +211,13 @@ inline static void t1p_nsym_fprint(FILE* stream, t1p_nsym_t *eps);
 /* Taylor1+ term */
 /*****************/
 //inline static t1p_nsym_t* t1p_nsym_init(t1p_internal_t* pr);
-static inline t1p_aaterm_t* t1p_aaterm_alloc_init(void);
-
-/* Free used memory of one linterm. */
-static inline void t1p_aaterm_free(t1p_internal_t* pr, t1p_aaterm_t* term);
+/* make room for n terms in expr */
+static inline void t1p_aff_reserve(t1p_internal_t* pr, t1p_aff_t* expr, uint_t n);
+/* memory allocation of the term following the terms of expr */
+static inline t1p_aaterm_t* t1p_aff_term_alloc_init(t1p_internal_t* pr, t1p_aff_t* expr);
 
-/* free memory used by a chained list starting from one element (for internal use) */
-static inline void t1p_aaterm_list_free(t1p_internal_t *pr, t1p_aaterm_t* head);
+/* free memory used by the terms of expr (for internal use) */
+static inline void t1p_aff_term_free(t1p_internal_t *pr, t1p_aff_t* expr);
 
 /* Pretty print aaterm */
 static inline void t1p_aaterm_fprint(t1p_internal_t *pr, FILE* stream, t1p_aaterm_t *ptr);
@@ -221,9 +231,8 @@ static t1p_aff_t* t1p_aff_alloc_init(t1p_internal_t *pr)
     t1p_aff_t* a = (t1p_aff_t*)malloc(sizeof(t1p_aff_t));
     itv_init(a->c);
     a->q = NULL;
-    a->end = NULL;
     a->l = 0;
-    a->lastu = NULL;
+    a->size = 0;
     a->pby = 0;
     itv_init(a->itv);
     return a;
@@ -247,7 +256,7 @@ static inline void t1p_aff_nsym_create(t1p_internal_t *pr, t1p_aff_t *expr, itv_
 static inline void t1p_aff_add_itv(t1p_internal_t* pr, t1p_aff_t *expr, itv_t itv, nsym_t type);
 /* change the coefficient of the aaterm (or add it if it was not there) */
 static inline void t1p_aff_build(t1p_internal_t *pr, t1p_aff_t* expr, itv_t coeff, uint_t index);
-static inline void t1p_aff_nsym_add(t1p_internal_t *pr, t1p_aff_t* expr, itv_t coeff, t1p_nsym_t* pnsym);
+static inline void t1p_aff_nsym_add(t1p_internal_t *pr, t1p_aff_t* expr, itv_ptr coeff, t1p_nsym_t* pnsym);
 
 /* returns a pointer to the coefficient of nymb [index]. Returns [NULL] if [index] is not present in [expr] */
 static inline itv_t* t1p_aff_get_coeff(t1p_internal_t *pr, t1p_aff_t* expr, uint_t index);
@@ -326,6 +335,9 @@ ap_manager_t* t1p_manager_alloc(void);
 /**************************************************************************************************/
 /* get the high index of noise symbols in use */
 int ap_manager_t1p_get_nsym(ap_manager_t* man);
+/* join (or widen) concurrently the affine forms of the variables tvar[0..size-1] of a1 and a2 into res;
+   exhausted is the flag of the join (see t1p_join_exhausted), NULL for the widening */
+void t1p_aff_join_concurrent(ap_manager_t* man, bool widening, t1p_t* a1, t1p_t* a2, t1p_t* res, size_t* tvar, size_t size, bool* exhausted);
 /* actually not used */
 void log_init(void* addr, uint_t length, int fd);
 void log_sync(void* addr, uint_t length, int fd);
@@ -436,33 +448,103 @@ inline static void t1p_nsym_sprint(char* string, t1p_nsym_t *eps)
     }
 }
 */
-/* memory allocation of affine form term: \alpha_i^x\epsilon_i */
-static inline t1p_aaterm_t* t1p_aaterm_alloc_init(void)
+/* Kernels on coefficients. With libt1pD on SSE2, an interval coefficient
+   is the pair of doubles [-inf,sup], which is added, subtracted or negated
+   by one instruction (the rounding mode is upward for both bounds). */
+static inline void t1p_coeff_add(itv_ptr a, itv_ptr b, itv_ptr c)
+{
+#if defined(T1P_SIMD)
+    _mm_storeu_pd(a->inf, _mm_add_pd(_mm_loadu_pd(b->inf), _mm_loadu_pd(c->inf)));
+#else
+    itv_add(a, b, c);
+#endif
+}
+static inline void t1p_coeff_sub(itv_ptr a, itv_ptr b, itv_ptr c)
+{
+#if defined(T1P_SIMD)
+    __m128d vc = _mm_loadu_pd(c->inf);
+    _mm_storeu_pd(a->inf, _mm_add_pd(_mm_loadu_pd(b->inf), _mm_shuffle_pd(vc, vc, 1)));
+#else
+    itv_sub(a, b, c);
+#endif
+}
+static inline void t1p_coeff_neg(itv_ptr a, itv_ptr b)
 {
-    t1p_aaterm_t* res = (t1p_aaterm_t*)malloc(sizeof(t1p_aaterm_t));
-    res->n = NULL;
+#if defined(T1P_SIMD)
+    __m128d vb = _mm_loadu_pd(b->inf);
+    _mm_storeu_pd(a->inf, _mm_shuffle_pd(vb, vb, 1));
+#else
+    itv_neg(a, b);
+#endif
+}
+/* dst[i] = src[i] for i < n, dst and src do not overlap */
+static inline void t1p_aaterm_copy(t1p_aaterm_t* dst, t1p_aaterm_t* src, uint_t n)
+{
+#if defined(NUM_NATIVE)
+    if (n) memcpy(dst, src, n*sizeof(t1p_aaterm_t));
+#else
+    uint_t i;
+    for (i=0; i<n; i++) {
+	dst[i].pnsym = src[i].pnsym;
+	itv_set(dst[i].coeff, src[i].coeff);
+    }
+#endif
+}
+/* dst[i] = -src[i] for i < n */
+static inline void t1p_aaterm_neg(t1p_aaterm_t* dst, t1p_aaterm_t* src, uint_t n)
+{
+    uint_t i;
+    for (i=0; i<n; i++) {
+	dst[i].pnsym = src[i].pnsym;
+	t1p_coeff_neg(dst[i].coeff, src[i].coeff);
+    }
+}
+/* make room for n terms in expr */
+static inline void t1p_aff_reserve(t1p_internal_t* pr, t1p_aff_t* expr, uint_t n)
+{
+    if (n > expr->size) {
+	uint_t i;
+	uint_t size = expr->size ? 2*expr->size : 4;
+	if (size < n) size = n;
+	expr->q = (t1p_aaterm_t*)realloc(expr->q, size*sizeof(t1p_aaterm_t));
+	for (i=expr->size; i<size; i++) {
+	    expr->q[i].pnsym = NULL;
+	    itv_init(expr->q[i].coeff);
+	}
+	expr->size = size;
+    }
+}
+/* the term following the l terms of expr, with a zero coefficient: it is
+   kept by incrementing expr->l. The pointers to the terms of expr are no
+   longer valid afterwards. */
+static inline t1p_aaterm_t* t1p_aff_term_alloc_init(t1p_internal_t* pr, t1p_aff_t* expr)
+{
+    t1p_aaterm_t* res;
+    t1p_aff_reserve(pr, expr, expr->l+1);
+    res = &expr->q[expr->l];
     res->pnsym = NULL;
-    itv_init(res->coeff);
+    itv_set_int(res->coeff,0);
     return res;
 }
-/* Free memory used by one aaterm */
-static inline void t1p_aaterm_free(t1p_internal_t* pr, t1p_aaterm_t* term)
+/* free the terms of expr */
+static inline void t1p_aff_term_free(t1p_internal_t* pr, t1p_aff_t* expr)
 {
-    arg_assert(term, abort(););
-    term->n = NULL;
-    term->pnsym = NULL;
-    itv_clear(term->coeff);
-    free(term);
+    uint_t i;
+    for (i=0; i<expr->size; i++) itv_clear(expr->q[i].coeff);
+    free(expr->q);
+    expr->q = NULL;
+    expr->l = 0;
+    expr->size = 0;
 }
-/* free memory used by a chained list starting from one term */
-static inline void t1p_aaterm_list_free(t1p_internal_t *pr, t1p_aaterm_t* head)
+/* first term of expr, NULL if expr has no term */
+static inline t1p_aaterm_t* t1p_aff_first(t1p_aff_t* expr)
 {
-    t1p_aaterm_t *p,*q;
-    p = q = NULL;
-    for (p = head; p; p = q) {
-	q = p->n;
-	t1p_aaterm_free(pr, p);
-    }
+    return expr->l ? expr->q : NULL;
+}
+/* term following p in expr, NULL if p is the last one */
+static inline t1p_aaterm_t* t1p_aff_next(t1p_aff_t* expr, t1p_aaterm_t* p)
+{
+    return p+1 < expr->q+expr->l ? p+1 : NULL;
 }
 /* Pretty print an aaterm */
 static inline void t1p_aaterm_fprint(t1p_internal_t *pr, FILE* stream, t1p_aaterm_t *ptr)
@@ -489,10 +571,7 @@ static inline t1p_aff_t * t1p_aff_bottom(t1p_internal_t* pr)
 static inline bool t1p_aff_is_zero(t1p_internal_t *pr, t1p_aff_t *a)
 {
     if (!itv_is_zero(a->c)) return false;
-    else if (a->q != NULL) return false;
-    else if (a->end != NULL) return false;
     else if (a->l != 0) return false;
-    //else if (a->lastu != NULL) return false;
     else if (!itv_is_zero(a->itv)) return false;
     else return true;
 }
@@ -511,11 +590,7 @@ static inline void t1p_aff_free(t1p_internal_t *pr, t1p_aff_t *a)
     } else {
 	a->pby = 0;
 	itv_clear(a->c);
-	if (a->q) t1p_aaterm_list_free(pr, a->q);
-	a->q = NULL;
-	a->end = NULL;
-	a->lastu = NULL;
-	a->l = (uint_t)0;
+	t1p_aff_term_free(pr, a);
 	itv_clear(a->itv);
 	free(a);
 	a = NULL;
@@ -534,9 +609,8 @@ static inline void t1p_aff_init(t1p_internal_t *pr, t1p_aff_t *a)
 {    
   itv_init(a->c);
   a->q = NULL;
-  a->end = NULL;
   a->l = 0;
-  a->lastu = NULL;
+  a->size = 0;
   a->pby = 0;
   itv_init(a->itv); 
 }
@@ -549,11 +623,7 @@ static inline void t1p_aff_clear(t1p_internal_t *pr, t1p_aff_t *a)
     } else {
 	a->pby = 0;
 	itv_init(a->c);
-	if (a->q) t1p_aaterm_list_free(pr, a->q);
-	a->q = NULL;
-	a->end = NULL;
-	a->lastu = NULL;
-	a->l = 0;
+	t1p_aff_term_free(pr, a);
 	itv_init(a->itv);
     }
 }
@@ -562,23 +632,9 @@ static inline void t1p_aff_clear(t1p_internal_t *pr, t1p_aff_t *a)
 static inline t1p_aff_t* t1p_aff_copy(t1p_internal_t *pr, t1p_aff_t *src)
 {
    t1p_aff_t* dst = t1p_aff_alloc_init(pr);
-   t1p_aaterm_t *p,*q;
    itv_set(dst->c, src->c);
-   if (src->q) {
-       dst->q = q = t1p_aaterm_alloc_init();
-       for (p=src->q; p; p=p->n) {
-           itv_set(q->coeff, p->coeff);
-           q->pnsym = p->pnsym;
-           if (p->n) {
-               /* continue */
-               q->n = t1p_aaterm_alloc_init();
-               q = q->n;
-           } else {
-               /* last iteration */
-               dst->end = q;
-           }
-       }
-   }
+   t1p_aff_reserve(pr, dst, src->l);
+   t1p_aaterm_copy(dst->q, src->q, src->l);
    dst->l = src->l;
    itv_set(dst->itv, src->itv);
    return dst;
@@ -589,18 +645,38 @@ static inline t1p_aff_t* t1p_aff_copy(t1p_internal_t *pr, t1p_aff_t *src)
  *  shall be different from all constrained nsym indices.
  *  Assume that a->nsymcons[0] <= nsymIndex <= a->nsymcons[size-1]
  */
-static inline t1p_nsym_t* t1p_nsym_add(t1p_internal_t *pr, nsym_t type)
+static inline void t1p_nsym_register(t1p_internal_t *pr, t1p_nsym_t* res)
     /* increment the global index of used noise symbols and add the noise symbol in pr->eps */
 {
     uint_t dim = pr->dim;
-    t1p_nsym_t* res;
+    nsym_t type = res->type;
     /* resize epsilon array */
     if ((dim+1) % 1024 == 0) pr->epsilon = (t1p_nsym_t**)realloc(pr->epsilon, (dim+1024)*sizeof(t1p_nsym_t*));
-    res = pr->epsilon[dim] = (t1p_nsym_t*)malloc(sizeof(t1p_nsym_t));
-    if (type == IN) {pr->inputns[pr->epssize] = dim; pr->epssize++;}
+    pr->epsilon[dim] = res;
+    if (type == IN) {
+	/* resize inputns array */
+	if ((pr->epssize+1) % 1024 == 0) pr->inputns = (uint_t*)realloc(pr->inputns, (pr->epssize+1024)*sizeof(uint_t));
+	pr->inputns[pr->epssize] = dim; pr->epssize++;
+    }
     res->index = dim;
-    res->type = type;
     pr->dim++;
+}
+static inline t1p_nsym_t* t1p_nsym_add(t1p_internal_t *pr, nsym_t type)
+    /* allocate a new noise symbol and register it, or, if pr->pending is
+       not NULL, put it in pr->pending with a temporary index greater than
+       the indices in use; it is registered later by the caller */
+{
+    t1p_nsym_t* res = (t1p_nsym_t*)malloc(sizeof(t1p_nsym_t));
+    res->type = type;
+    if (pr->pending) {
+	/* resize pending array */
+	if ((pr->npending+1) % 1024 == 0) pr->pending = (t1p_nsym_t**)realloc(pr->pending, (pr->npending+1024)*sizeof(t1p_nsym_t*));
+	res->index = pr->dim + pr->npending;
+	pr->pending[pr->npending] = res;
+	pr->npending++;
+    } else {
+	t1p_nsym_register(pr, res);
+    }
     return res;
 }
 
@@ -609,12 +685,9 @@ static inline void t1p_aff_nsym_create(t1p_internal_t *pr, t1p_aff_t *expr, itv_
 {
     itv_t zero; itv_init(zero);
     if (!itv_is_leq(coeff,zero)) {
-	t1p_aaterm_t* ptr = t1p_aaterm_alloc_init();
+	t1p_aaterm_t* ptr = t1p_aff_term_alloc_init(pr, expr);
 	itv_set(ptr->coeff, coeff);
 	ptr->pnsym = t1p_nsym_add(pr, type);
-	if (expr->end) expr->end->n = ptr;
-	else expr->q = ptr;
-	expr->end = ptr;
 	expr->l++;
     }
     itv_clear(zero);
@@ -623,83 +696,36 @@ static inline void t1p_aff_nsym_create(t1p_internal_t *pr, t1p_aff_t *expr, itv_
 /* add a new aaterm to the affine form with an already existing noise symbol (used to build by hand an affine form) */
 static inline void t1p_aff_build(t1p_internal_t *pr, t1p_aff_t* expr, itv_t coeff, uint_t index)
 {
-    nsym_t type;
-    t1p_aaterm_t* ptr = t1p_aaterm_alloc_init();
+    t1p_aaterm_t* ptr = t1p_aff_term_alloc_init(pr, expr);
     itv_set(ptr->coeff, coeff);
     ptr->pnsym = pr->epsilon[index];
-    if (expr->end) expr->end->n = ptr;
-    else expr->q = ptr;
-    expr->end = ptr;
-    /*
-    switch (ptr->pnsym->type) {
-	case IN:
-	    if (expr->end) expr->end->n = ptr;
-	    else expr->q = expr->end = ptr;
-	    ptr->n = expr->lastu;
-	    expr->end = ptr;
-	    break;
-	case UN:
-	    if (expr->lastu) expr->lastu->n = ptr;
-	    else if (expr->end) expr->end->n = ptr;
-	    else expr->q = expr->end = expr->end = ptr;
-	    ptr->n = NULL;
-	    expr->lastu = ptr;
-	    break;
-	default: fatal("Unknow noise symbol type, aborting.\n");
-    }
-    */
     expr->l++;
-    /*
-    t1p_aaterm_t* end;
-    if (expr->q) {
-	end = expr->end;
-	end->n = t1p_aaterm_alloc_init();
-	itv_set(end->n->coeff,coeff);
-	end->n->pnsym = pr->epsilon[index];
-	expr->end = end->n;
-    } else {
-	expr->q = t1p_aaterm_alloc_init();
-	itv_set(expr->q->coeff,coeff);
-	expr->q->pnsym = pr->epsilon[index];
-	expr->end = expr->q;
-    }
-    expr->l++;
-    */
 }
 
 
 /* returns a pointer to the coefficient of nymb [index]. Returns [NULL] if [index] is not present in [expr] */
 static inline itv_t* t1p_aff_get_coeff(t1p_internal_t *pr, t1p_aff_t* expr, uint_t index)
 {
-  t1p_aaterm_t* cell = expr->q;
-  itv_t* res=NULL;
-
-  while (cell != NULL)
+  /* binary search in the sorted terms */
+  uint_t lo = 0;
+  uint_t hi = expr->l;
+  while (lo < hi)
     {
-      if (cell->pnsym->index == index)
-	{
-	  res = &cell->coeff;
-	  cell=NULL; // stops the loop
-	}
-      else
-	{
-	  cell = cell->n;
-	}
+      uint_t mid = lo + (hi-lo)/2;
+      if (expr->q[mid].pnsym->index < index) lo = mid+1;
+      else hi = mid;
     }
-  return res;
+  if (lo < expr->l && expr->q[lo].pnsym->index == index) return &expr->q[lo].coeff;
+  else return NULL;
 }
 
 
-static inline void t1p_aff_nsym_add(t1p_internal_t *pr, t1p_aff_t* expr, itv_t coeff, t1p_nsym_t* pnsym)
+static inline void t1p_aff_nsym_add(t1p_internal_t *pr, t1p_aff_t* expr, itv_ptr coeff, t1p_nsym_t* pnsym)
 {
     if (!itv_is_zero(coeff)) {
-	nsym_t type;
-	t1p_aaterm_t* ptr = t1p_aaterm_alloc_init();
+	t1p_aaterm_t* ptr = t1p_aff_term_alloc_init(pr, expr);
 	itv_set(ptr->coeff, coeff);
 	ptr->pnsym = pnsym;
-	if (expr->end) expr->end->n = ptr;
-	else expr->q = ptr;
-	expr->end = ptr;
 	expr->l++;
     }
 }
@@ -721,16 +747,15 @@ static inline void t1p_aff_add_itv(t1p_internal_t* pr, t1p_aff_t *expr, itv_t it
 /* multiplication of an affine form by a scalar (= an interval) */
 static inline void t1p_aff_mul_scalar(t1p_internal_t* pr, t1p_aff_t *expr, itv_t lambda)
 {
+  uint_t i;
   /* multiplication of the center and of the best interval concretisation */
   itv_mul(pr->itv,expr->c,expr->c,lambda);
   itv_mul(pr->itv,expr->itv,expr->itv,lambda);
 
   /* "for" loop to do the same for each aaterm */
-  t1p_aaterm_t* current_aaterm = expr->q;
-  for(int i=0;i<(int)expr->l;i++)
+  for (i=0; i<expr->l; i++)
     {
-      itv_mul(pr->itv,current_aaterm->coeff,current_aaterm->coeff,lambda);
-      current_aaterm = current_aaterm->n;
+      itv_mul(pr->itv,expr->q[i].coeff,expr->q[i].coeff,lambda);
     }
 
 }
@@ -744,92 +769,47 @@ static inline void t1p_aff_add_aff(t1p_internal_t* pr, t1p_aff_t *a,  t1p_aff_t
   itv_add(a->itv,b->itv,c->itv);
 
   /* double loop to add terms respecting the order */
-  int i=0;
-  int j=0;
-  t1p_aaterm_t* term_b= b->q;
-  t1p_aaterm_t* term_c= c->q;
+  uint_t i=0;
+  uint_t j=0;
+  t1p_aaterm_t* term_b;
+  t1p_aaterm_t* term_c;
   itv_t temp;
-  /* printf("l1=%d\n",(int)b->l); */
-  /* printf("l2=%d\n",(int)c->l); */
+  itv_init(temp);
 
-  while (i<(int)b->l && j<(int)c->l)
+  t1p_aff_reserve(pr, a, a->l + b->l + c->l);
+  while (i<b->l && j<c->l)
     {
+      term_b = &b->q[i];
+      term_c = &c->q[j];
       if (term_b->pnsym->index == term_c->pnsym->index)
 	{
 	  /* the symbol is present in both terms */
-	  //printf("symbol %d present in both\n", (int)term_b->pnsym->index );
 	  /*compute the new coeff and add it to a */
-	  itv_init(temp);
-	  //printf("itv1:");
-	  //itv_fprint(stdout,term_b->coeff);
-	  //printf("\n");
-	  //printf("itv2:");
-	  //itv_fprint(stdout,term_c->coeff);
-	  //printf("\n");
-	  itv_add(temp,term_b->coeff,term_c->coeff);
-	  //printf("itv res:");
-	  //itv_fprint(stdout,temp);
-	  //printf("\n");
+	  t1p_coeff_add(temp,term_b->coeff,term_c->coeff);
 	  t1p_aff_nsym_add(pr,a,temp,term_b->pnsym);
-	  //t1p_aff_fprint(pr,stdout,a);
-	  //printf("\n");
-	  /* updates the terms and counters */
+	  /* updates the counters */
 	  i++;
 	  j++;
-	  term_b=term_b->n;
-	  term_c=term_c->n;
 	}
       else if (term_b->pnsym->index < term_c->pnsym->index)
 	{
 	  /* the symbol is present in b but not in c */
-	  //printf("symbol %d present in the first one\n", (int)term_b->pnsym->index);
-	  /*compute the new coeff and add it to a */
-	  itv_init(temp);
-	  itv_set(temp,term_b->coeff);
-	  t1p_aff_nsym_add(pr,a,temp,term_b->pnsym);
-	  //t1p_aff_fprint(pr,stdout,a);
-	  //printf("\n");
-	  /* updates the terms and counters */
+	  t1p_aff_nsym_add(pr,a,term_b->coeff,term_b->pnsym);
 	  i++;
-	  term_b=term_b->n;
 	}
       else
 	{
 	  /* the symbol is present in c but not in b */
-	  //printf("symbol %d present in the second one\n", (int)term_c->pnsym->index);
-	  /*compute the new coeff and add it to a */
-	  itv_init(temp);
+	  itv_set_int(temp,0);
 	  itv_join(temp,temp,term_c->coeff);
 	  t1p_aff_nsym_add(pr,a,temp,term_c->pnsym);
-	  //t1p_aff_fprint(pr,stdout,a);
-	  //printf("\n");	  
-	  /* updates the terms and counters */
 	  j++;
-	  term_c=term_c->n;
 	}
     }
   /* add the remaining symbols */
- while (i<(int)b->l)
-   {
-     //printf("symbol present in the first one\n");
-     t1p_aff_nsym_add(pr,a,term_b->coeff,term_b->pnsym);
-     //t1p_aff_fprint(pr,stdout,a);
-     //printf("\n");
-     /* updates the terms and counters */
-     i++;
-     term_b=term_b->n;
-   }
- while (j<(int)c->l)
-   {
-     //printf("symbol present in the second one\n");
-     t1p_aff_nsym_add(pr,a,term_c->coeff,term_c->pnsym);
-     /* updates the terms and counters */
-     //t1p_aff_fprint(pr,stdout,a);
-     //printf("\n");
-     j++;
-     term_c=term_c->n;
-   }
-
+  for (; i<b->l; i++) t1p_aff_nsym_add(pr,a,b->q[i].coeff,b->q[i].pnsym);
+  for (; j<c->l; j++) t1p_aff_nsym_add(pr,a,c->q[j].coeff,c->q[j].pnsym);
+  itv_clear(temp);
 }
 
 
@@ -841,14 +821,10 @@ static inline bool t1p_aff_is_eq(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_t *b)
     else if (a->l != b->l) return false;
     else if (!itv_is_eq(a->c, b->c)) return false;
     else {
-	t1p_aaterm_t *p, *q;
-	for (p=a->q, q=b->q; p && q;) {
-	    if (p->pnsym != q->pnsym) return false;
-	    else if (!itv_is_eq(p->coeff, q->coeff)) return false;
-	    else {
-		p = p->n;
-		q = q->n;
-	    }
+	uint_t i;
+	for (i=0; i<a->l; i++) {
+	    if (a->q[i].pnsym != b->q[i].pnsym) return false;
+	    else if (!itv_is_eq(a->q[i].coeff, b->q[i].coeff)) return false;
 	}
 	return true;
     }
@@ -862,14 +838,10 @@ static inline bool t1p_aff_is_perfectly_eq(t1p_internal_t* pr, t1p_aff_t *a, t1p
     else if (!itv_is_eq(a->c, b->c)) return false;
     else if (!itv_is_eq(a->itv, b->itv)) return false;
     else {
-	t1p_aaterm_t *p, *q;
-	for (p=a->q, q=b->q; p && q;) {
-	    if (p->pnsym != q->pnsym) return false;
-	    else if (!itv_is_eq(p->coeff, q->coeff)) return false;
-	    else {
-		p = p->n;
-		q = q->n;
-	    }
+	uint_t i;
+	for (i=0; i<a->l; i++) {
+	    if (a->q[i].pnsym != b->q[i].pnsym) return false;
+	    else if (!itv_is_eq(a->q[i].coeff, b->q[i].coeff)) return false;
 	}
 	return true;
     }
@@ -894,15 +866,11 @@ static inline bool t1p_aff_is_tild_eq(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
     else if (!itv_is_leq(a->c, tmp)) res = false;
     else if (!itv_is_leq(a->itv, tmp1)) res = false;
     else {
-	t1p_aaterm_t *p, *q;
-	for (p=a->q, q=b->q; p && q;) {
-	    itv_enlarge_bound(tmp, q->coeff, c);
-	    if (p->pnsym != q->pnsym) {res = false;break;}
-	    else if (!itv_is_leq(p->coeff, tmp)) {res = false;break;}
-	    else {
-		p = p->n;
-		q = q->n;
-	    }
+	uint_t i;
+	for (i=0; i<a->l; i++) {
+	    itv_enlarge_bound(tmp, b->q[i].coeff, c);
+	    if (a->q[i].pnsym != b->q[i].pnsym) {res = false;break;}
+	    else if (!itv_is_leq(a->q[i].coeff, tmp)) {res = false;break;}
 	}
 	res = true;
     }
@@ -936,9 +904,9 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
     uint_t i = 0;
 
     /* b = [] either cst or has infinite bounds */
-    if (!b->q) res = itv_is_leq(a->itv, b->c);
+    if (!b->l) res = itv_is_leq(a->itv, b->c);
     /* b is a form and a = [] ... [] should be a point otherwise the test returns false */
-    else if (!a->q)
+    else if (!a->l)
 	if (itv_is_point(pr->itv,a->c)) res = itv_is_leq(a->c, b->itv);
 	else res = false;
     else
@@ -955,14 +923,18 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 	itv_t betaB; itv_init(betaB);
 	itv_t tmp; itv_init(tmp);
 	t1p_aaterm_t *p, *q, *ptr;
+	t1p_aaterm_t term;
 	/* we do not compute here the difference (a->c - b->c)
 	   to mime exactly the operations of computing the join.
 	   This ensures a <= a U b and b <= a U b when using doubles (non deterministic).
 	 */
 	itv_set(c,a->c);
-	if (a->q || b->q) {
-	    ptr = t1p_aaterm_alloc_init();
-	    for(p = a->q, q = b->q; p || q;) {
+	if (a->l || b->l) {
+	    /* ptr is a scratch term */
+	    ptr = &term;
+	    ptr->pnsym = NULL;
+	    itv_init(ptr->coeff);
+	    for(p = t1p_aff_first(a), q = t1p_aff_first(b); p || q;) {
 		if (p && q) {
 		    if (p->pnsym->index == q->pnsym->index) {
 			if (!itv_is_eq(p->coeff, q->coeff)) {itv_sub(ptr->coeff, p->coeff, q->coeff);}
@@ -974,8 +946,8 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 			    itv_mul(pr->itv, ptr->coeff, tmp, q->coeff);
 			    itv_add(betaB, betaB, ptr->coeff);
 			}
-			p = p->n ;
-			q = q->n ;
+			p = t1p_aff_next(a, p);
+			q = t1p_aff_next(b, q);
 		    } else if (p->pnsym->index < q->pnsym->index) {
 			itv_set(ptr->coeff, p->coeff);
 			ptr->pnsym = p->pnsym;
@@ -984,7 +956,7 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 			    itv_mul(pr->itv, ptr->coeff, tmp, p->coeff);
 			    itv_add(betaA, betaA, ptr->coeff);
 			}
-			p = p->n ;
+			p = t1p_aff_next(a, p);
 		    } else {
 			itv_neg(ptr->coeff, q->coeff);
 			ptr->pnsym = q->pnsym;
@@ -993,7 +965,7 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 			    itv_mul(pr->itv, ptr->coeff, tmp, q->coeff);
 			    itv_add(betaB, betaB, ptr->coeff);
 			}
-			q = q->n ;
+			q = t1p_aff_next(b, q);
 		    }
 		} else if (p) {
 		    itv_set(ptr->coeff, p->coeff);
@@ -1003,7 +975,7 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 			itv_mul(pr->itv, ptr->coeff, tmp, p->coeff);
 			itv_add(betaA, betaA, ptr->coeff);
 		    }
-		    p = p->n ;
+		    p = t1p_aff_next(a, p);
 		} else {
 		    itv_neg(ptr->coeff, q->coeff);
 		    ptr->pnsym = q->pnsym;
@@ -1012,7 +984,7 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 			itv_mul(pr->itv, ptr->coeff, tmp, q->coeff);
 			itv_add(betaB, betaB, ptr->coeff);
 		    }
-		    q = q->n ;
+		    q = t1p_aff_next(b, q);
 		}
 		if (!itv_is_zero(ptr->coeff)) {
 		    if (ptr->pnsym->type == IN) {
@@ -1023,7 +995,7 @@ static inline bool t1p_aff_is_leq_constrained(t1p_internal_t* pr, t1p_aff_t *a,
 		    }
 		}
 	    }
-	    t1p_aaterm_free(pr, ptr);
+	    itv_clear(ptr->coeff);
 	}
 	itv_middev(pr->itv, c1, d1, betaA);
 	itv_middev(pr->itv, c2, d2, betaB);
@@ -1074,7 +1046,7 @@ static inline void t1p_aff_fprint(t1p_internal_t* pr, FILE* stream, t1p_aff_t *e
     if (itv_is_point(pr->itv,expr->c)) bound_fprint(stream,expr->c->sup);
     else itv_fprint(stream, expr->c);
     /* Print values */
-    for (p=expr->q; p; p=p->n) {
+    for (p=expr->q; p<expr->q+expr->l; p++) {
 	fprintf(stream," + ");
 	t1p_aaterm_fprint(pr, stream, p);
     }
@@ -1107,15 +1079,11 @@ static inline bool t1p_aff_reduce(t1p_internal_t* pr, t1p_aff_t *expr)
 	    itv_set(expr->c, mid);
 	    itv_add(sum, sum, dev);
 	}
-	for(p = expr->q; p; p=p->n) {
+	for (p=expr->q; p<expr->q+expr->l; p++) {
 	    if (itv_has_infty_bound(p->coeff)) {
 		if (itv_is_top(p->coeff)) {
 		    /* reduce to top */
-		    if (expr->q) t1p_aaterm_list_free(pr, expr->q);
-		    expr->q = NULL;
-		    expr->end = NULL;
-		    expr->lastu = NULL;
-		    expr->l = 0;
+		    t1p_aff_term_free(pr, expr);
 		    itv_set_top(expr->c);
 		    itv_set_top(expr->itv);
 		}
@@ -1151,7 +1119,7 @@ static inline bool t1p_aff_reduce(t1p_internal_t* pr, t1p_aff_t *expr)
 /* fetch the interval concretisation of constrained symbol from the abstract object, then compute gamma(expr) and store it in res */
 static inline void t1p_aff_boxize(t1p_internal_t* pr, itv_t res, t1p_aff_t *exp, t1p_t* a)
 {
-    if (exp->q == NULL) {
+    if (exp->l == 0) {
 	itv_set(res,exp->c);
 	return;
     } else {
@@ -1159,7 +1127,7 @@ static inline void t1p_aff_boxize(t1p_internal_t* pr, itv_t res, t1p_aff_t *exp,
 	itv_t tmp; itv_init(tmp);
 	t1p_aaterm_t *p;
 	itv_set(res,exp->c);
-	for (p=exp->q;p;p=p->n) {
+	for (p=exp->q; p<exp->q+exp->l; p++) {
 	    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 	    itv_mul(pr->itv,tmp,nsymItv1,p->coeff);
 	    itv_add(res,res,tmp);
@@ -1180,12 +1148,12 @@ static inline void t1p_aff_boxize(t1p_internal_t* pr, itv_t res, t1p_aff_t *exp,
 	t1p_aaterm_t* p;
 	itv_set(res,expr->c);
 	if (a->hypercube) {
-	    for (p=expr->q; p; p=p->n) {
+	    for (p=expr->q; p<expr->q+expr->l; p++) {
 		itv_mul(pr->itv, tmp, p->coeff, pr->muu);
 		itv_add(res, res, tmp);
 	    }
 	} else {
-	    for (p=expr->q; p; p=p->n) {
+	    for (p=expr->q; p<expr->q+expr->l; p++) {
 		if (t1p_nsymcons_get_dimpos(pr, &dim, p->pnsym->index, a)) {
 		    itv_set_ap_interval(pr->itv, eps_itv, a->gamma[dim]);
 		    itv_mul(pr->itv, tmp, p->coeff, eps_itv);
@@ -1212,7 +1180,7 @@ static inline void t1p_aff_bound(t1p_internal_t* pr, itv_t res, t1p_aff_t *expr,
 	t1p_aaterm_t* p;
 	itv_set(res,expr->c);
 	if (a->hypercube) {
-	    for (p=expr->q; p; p=p->n) {
+	    for (p=expr->q; p<expr->q+expr->l; p++) {
 		itv_mul(pr->itv, tmp, p->coeff, pr->muu);
 		itv_add(res, res, tmp);
 	    }
@@ -1223,7 +1191,7 @@ static inline void t1p_aff_bound(t1p_internal_t* pr, itv_t res, t1p_aff_t *expr,
 	    linexpr0->p.linterm = (ap_linterm_t*)malloc(expr->l*sizeof(ap_linterm_t));
 	    uint_t k = 0;
 	    ap_dim_t dim = 0;
-	    for (p=expr->q; p; p=p->n) {
+	    for (p=expr->q; p<expr->q+expr->l; p++) {
 		if (t1p_nsymcons_get_dimpos(pr, &dim, p->pnsym->index, a)) {
 		    ap_coeff_init(&linexpr0->p.linterm[k].coeff, AP_COEFF_INTERVAL);
 		    ap_coeff_set_itv(pr->itv, &linexpr0->p.linterm[k].coeff, p->coeff);
@@ -1305,62 +1273,38 @@ static inline t1p_aff_t * t1p_aff_join(t1p_internal_t* pr, t1p_aff_t *exp1, t1p_
     itv_init(mid); itv_init(dev);
     itv_t tmp, abscoeff, beta;
     itv_init(tmp); itv_init(abscoeff); itv_init(beta);
-    t1p_aaterm_t *lastu = NULL;
     t1p_aaterm_t *p, *q, *ptr;
 
     itv_t argminpq; itv_init(argminpq);
-    ptr = NULL;
-    if (exp1->q && exp2->q) {
-	for(p = exp1->q, q = exp2->q; p && q;) {
+    if (exp1->l && exp2->l) {
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p && q;) {
 	    if (p->pnsym->index == q->pnsym->index) {				/* coeff of the same noise symbol */
 		if (argmin(pr, argminpq, p->coeff, q->coeff)) {			/* true if the argmin is not zero */
-		    if (res->q == NULL) {
-			res->q = ptr = t1p_aaterm_alloc_init();			/* allocate the first element of res->q */
-			res->l++;
-		    }
-		    if (exp1->lastu && exp2->lastu) {				/* keep track of the perturbation noise symbol */
-			if (exp1->lastu == p && exp2->lastu == q) lastu = ptr;	/* only if exp1->lastu and exp2->lastu resist to argmin formula */
-		    }
+		    ptr = t1p_aff_term_alloc_init(pr, res);			/* allocate the next element of res->q */
 		    ptr->pnsym = p->pnsym;						/* set the index of the noise symbol */
 		    itv_set(ptr->coeff, argminpq);					/* set the coefficient as the argmin of the two other coefficients */
+		    res->l++;
 		}
-		p = p->n ;
-		q = q->n ;
+		p = t1p_aff_next(exp1, p);
+		q = t1p_aff_next(exp2, q);
 	    } else if (p->pnsym->index < q->pnsym->index) {
-		p = p->n ;
+		p = t1p_aff_next(exp1, p);
 	    } else {
-		q = q->n ;
+		q = t1p_aff_next(exp2, q);
 	    }
-	    if (p && q) {
-		if (p->pnsym->index == q->pnsym->index && res->q) {
-		    if (argmin(pr, argminpq, p->coeff, q->coeff)) {
-			ptr->n = t1p_aaterm_alloc_init();			/* allocate the next element of res->q */
-			res->l++;
-			ptr=ptr->n;
-		    }
-		}
-	    }
-	}
-	if (ptr) {
-	    ptr->n = NULL;
-	    res->end = ptr;
 	}
     }
 
-    if (lastu) {
-	itv_init(lastu->coeff);
-    }
     itv_join(res->itv, exp1->itv, exp2->itv);
     itv_middev(pr->itv, mid, dev, res->itv);
     itv_set(beta, dev);
     itv_set(res->c, mid);
-    for (q=res->q; q; q=q->n) {
+    for (q=res->q; q<res->q+res->l; q++) {
 	itv_abs(abscoeff, q->coeff);
 	itv_sub(beta, beta, abscoeff);
     }
     if (itv_is_pos(beta)) {
 	t1p_aff_nsym_create(pr, res, beta, UN);
-	res->lastu = res->end;
     } else {
 	fatal("Join without constrained, Perturbation coeff is not positive\n");
     }
@@ -1405,11 +1349,12 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
     ptr = NULL;
     int s = 0;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	t1p_aff_reserve(pr, res, exp1->l + exp2->l + 1);
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -1433,8 +1378,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
 			    itv_set(pmptr,p->coeff);
 			}
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -1446,7 +1391,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
 			itv_set_int(qmptr,0);
 		    }
 		    t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -1458,7 +1403,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
 			itv_set_int(pmptr,0);
 		    }
 		    t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -1471,7 +1416,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
 		    itv_set_int(qmptr,0);
 		}
 		t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -1483,7 +1428,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
 		    itv_set_int(pmptr,0);
 		}
 		t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    itv_mul(pr->itv, tmp1, nsymItv1, pmptr);
 	    itv_add(c1, c1, tmp1);
@@ -1491,24 +1436,9 @@ static inline t1p_aff_t * t1p_aff_join_constrained6(t1p_internal_t* pr, t1p_aff_
 	    itv_add(c2, c2, tmp2);
 	    itv_set_int(pmptr,0);
 	    itv_set_int(qmptr,0);
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		}
 	    }
 	}
 
@@ -1686,27 +1616,14 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 
     if (t1p_aff_is_leq_constrained(pr, exp1, exp2, a, b)) {
 	itv_set(res->c, exp2->c);
-	if (exp2->q) {
-	    res->q = q = t1p_aaterm_alloc_init();
-	    res->l++;
-	    for (p=exp2->q; p; p=p->n) {
-		if (p->pnsym->type == UN) {
-		    t1p_nsymcons_get_gamma(pr, tmp1, p->pnsym->index, b);
-		    itv_mul(pr->itv, tmp1, tmp1, p->coeff);
-		    itv_add(betaA, betaA, tmp1);
-		} else {
-		    itv_set(q->coeff, p->coeff);
-		    q->pnsym = p->pnsym;
-		    if (p->n && p->n->pnsym->type == IN) {
-			/* continue */
-			q->n = t1p_aaterm_alloc_init();
-			q = q->n;
-			res->l++;
-		    } else {
-			/* last iteration */
-			res->end = q;
-		    }
-		}
+	for (p=exp2->q; p<exp2->q+exp2->l; p++) {
+	    if (p->pnsym->type == UN) {
+		t1p_nsymcons_get_gamma(pr, tmp1, p->pnsym->index, b);
+		itv_mul(pr->itv, tmp1, tmp1, p->coeff);
+		itv_add(betaA, betaA, tmp1);
+	    } else {
+		/* keep the input noise symbols */
+		t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 	    }
 	}
 	itv_middev(pr->itv,mid,dev,betaA);
@@ -1714,27 +1631,14 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 	t1p_aff_nsym_create(pr, res, dev, UN);
     } else if (t1p_aff_is_leq_constrained(pr, exp2, exp1, b, a)) {
 	itv_set(res->c, exp1->c);
-	if (exp1->q) {
-	    res->q = q = t1p_aaterm_alloc_init();
-	    res->l++;
-	    for (p=exp1->q; p; p=p->n) {
-		if (p->pnsym->type == UN) {
-		    t1p_nsymcons_get_gamma(pr, tmp1, p->pnsym->index, a);
-		    itv_mul(pr->itv, tmp1, tmp1, p->coeff);
-		    itv_add(betaA, betaA, tmp1);
-		} else {
-		    itv_set(q->coeff, p->coeff);
-		    q->pnsym = p->pnsym;
-		    if (p->n && p->n->pnsym->type == IN) {
-			/* continue */
-			q->n = t1p_aaterm_alloc_init();
-			q = q->n;
-			res->l++;
-		    } else {
-			/* last iteration */
-			res->end = q;
-		    }
-		}
+	for (p=exp1->q; p<exp1->q+exp1->l; p++) {
+	    if (p->pnsym->type == UN) {
+		t1p_nsymcons_get_gamma(pr, tmp1, p->pnsym->index, a);
+		itv_mul(pr->itv, tmp1, tmp1, p->coeff);
+		itv_add(betaA, betaA, tmp1);
+	    } else {
+		/* keep the input noise symbols */
+		t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 	    }
 	}
 	itv_middev(pr->itv,mid,dev,betaA);
@@ -1747,9 +1651,9 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 	itv_middev_regular(pr->itv, midgx, dev, exp1->itv);
 	itv_middev_regular(pr->itv, midgy, dev, exp2->itv);
 
-	if (exp1->q || exp2->q) {
+	if (exp1->l || exp2->l) {
 	    optpr_init(pr);
-	    for(p = exp1->q, q = exp2->q; p || q;) {
+	    for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
 		if (p && q) {
 		    if (p->pnsym->index == q->pnsym->index) {
 			t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -1765,8 +1669,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 			    itv_set(alphaix, p->coeff);
 			    itv_set(alphaiy, q->coeff);
 			}
-			p = p->n ;
-			q = q->n ;
+			p = t1p_aff_next(exp1, p);
+			q = t1p_aff_next(exp2, q);
 		    } else if (p->pnsym->index < q->pnsym->index) {
 			t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 			t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -1779,7 +1683,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 			    itv_set(alphaix,p->coeff);
 			    itv_set_int(alphaiy,0);
 			}
-			p = p->n;
+			p = t1p_aff_next(exp1, p);
 		    } else {
 			t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 			t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -1792,7 +1696,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 			    itv_set_int(alphaix,0);
 			    itv_set(alphaiy,q->coeff);
 			}
-			q = q->n;
+			q = t1p_aff_next(exp2, q);
 		    }
 		} else if (p) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -1806,7 +1710,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 			itv_set(alphaix,p->coeff);
 			itv_set_int(alphaiy,0);
 		    }
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -1819,7 +1723,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained7(t1p_internal_t* pr, t1p_aff_
 			itv_set_int(alphaix,0);
 			itv_set(alphaiy,q->coeff);
 		    }
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 		if (pnsym) {
 		    if (itv_is_point(pr->itv, nsymItv1) && itv_is_point(pr->itv, nsymItv2)) {
@@ -1963,15 +1867,13 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
     itv_join(res->itv, exp1->itv, exp2->itv);
     uint_t i = 0;
 
-    t1p_aaterm_t *p, *q, *ptr;
-
-    ptr = NULL;
+    t1p_aaterm_t *p, *q;
 
     int s = 0;
 
     uint_t old = pr->dim;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
 	uint_t size = 0;
@@ -2026,7 +1928,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 	ap_interval_set_itv(pr->itv, tinterval[size], tmp);
 	size++;
 	bool ok = false;
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -2081,8 +1983,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 			    //	    fatal("Que faire dans ce cas ????\n");
 			}
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -2122,7 +2024,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 			    T[size].s = 0;
 			}
 		    }
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -2162,7 +2064,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 			    T[size].s = 0;
 			}
 		    }
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -2203,7 +2105,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 			T[size].s = 0;
 		    }
 		}
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -2243,7 +2145,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 			T[size].s = 0;
 		    }
 		}
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    if (ok) {
 		tinterval[size] = ap_interval_alloc();
@@ -2296,7 +2198,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 		/*
 		   itv_set(res->c, exp1->c);
 		   itv_set(res->itv, exp1->itv);
-		   for(p = exp1->q; p; p=p->n) {
+		   for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		   t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		   if (p->pnsym->type == UN) {
 		   res->end->pnsym = pr->mubGlobal.p[p->pnsym->index].x;
@@ -2306,10 +2208,11 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 	    } else if (s == 1) {
 		itv_set(res->c, exp2->c);
 		itv_set(res->itv, exp2->itv);
-		for(p = exp2->q; p; p=p->n) {
-		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
+		for (p=exp2->q; p<exp2->q+exp2->l; p++) {
 		    if (p->pnsym->type == UN) {
-			res->end->pnsym = pr->mubGlobal.p[p->pnsym->index].y;
+			t1p_aff_nsym_add(pr, res, p->coeff, pr->mubGlobal.p[p->pnsym->index].y);
+		    } else {
+			t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		    }
 		}
 
@@ -2319,7 +2222,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 		/*
 		   itv_set(res->c, exp1->c);
 		   itv_set(res->itv, exp1->itv);
-		   for(p = exp1->q; p; p=p->n) {
+		   for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		   t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		   if (p->pnsym->type == UN) {
 		   res->end->pnsym = pr->mubGlobal.p[p->pnsym->index].x;
@@ -2345,21 +2248,13 @@ static inline t1p_aff_t * t1p_aff_join_constrained8(t1p_internal_t* pr, t1p_aff_
 	    ap_abstract0_fprint(stdout, pk, obj1, NULL);
 	    printf("\n**********************************************\n");
 	    if (ap_abstract0_is_bottom(pk, obj1)) {
-		res->q = ptr = t1p_aaterm_alloc_init();
 		for (i=0;i<size;i++) {
 		    itv = ap_abstract0_bound_dimension(pk, obj, (ap_dim_t)i);
 		    itv_set_ap_interval(pr->itv, tmp, itv);
 		    //printf("x%d",i);itv_print(tmp1);printf("\n");
 		    itv_middev(pr->itv, mid, dev, tmp);
 		    if (i==0) itv_set(res->c, mid);
-		    else {
-			itv_set(ptr->coeff,mid);
-			ptr->pnsym = T[i].pnsym;
-			res->end = ptr;
-			res->l++;
-			ptr->n = t1p_aaterm_alloc_init();
-			ptr=ptr->n;
-		    }
+		    else t1p_aff_nsym_add(pr, res, mid, T[i].pnsym);
 		    if (itv_is_eq(mid,T[i].coeffx)) itv_set_int(T[i].coeffx,0);
 		    else {
 			itv_sub(T[i].coeffx,mid,T[i].coeffx);
@@ -2478,15 +2373,13 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
     itv_join(res->itv, exp1->itv, exp2->itv);
     uint_t i = 0;
 
-    t1p_aaterm_t *p, *q, *ptr;
-
-    ptr = NULL;
+    t1p_aaterm_t *p, *q;
 
     int s = 0;
 
     uint_t old = pr->dim;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
 	uint_t size = 0;
@@ -2532,7 +2425,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 	ap_interval_set_itv(pr->itv, tinterval[size], tmp);
 	size++;
 	bool ok = false;
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -2574,8 +2467,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 			    fatal("Que faire dans ce cas ????\n");
 			}
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -2604,7 +2497,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 			    fatal("Que faire dans ce cas ????\n");
 			}
 		    }
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -2633,7 +2526,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 			    fatal("Que faire dans ce cas ????\n");
 			}
 		    }
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -2663,7 +2556,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 			fatal("Que faire dans ce cas ????\n");
 		    }
 		}
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -2692,7 +2585,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 			fatal("Que faire dans ce cas ????\n");
 		    }
 		}
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    if (ok) {
 		tinterval[size] = ap_interval_alloc();
@@ -2742,7 +2635,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 		//res = exp1;
 		itv_set(res->c, exp1->c);
 		itv_set(res->itv, exp1->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    if (p->pnsym->type == IN) {
 			t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		    }
@@ -2756,7 +2649,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 		//res = exp2;
 		itv_set(res->c, exp2->c);
 		itv_set(res->itv, exp2->itv);
-		for(p = exp2->q; p; p=p->n) {
+		for (p=exp2->q; p<exp2->q+exp2->l; p++) {
 		    if (p->pnsym->type == IN) t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		    //if (p->pnsym->type == UN) {
 		    //	res->end->pnsym = pr->mubGlobal.p[p->pnsym->index].x;
@@ -2768,7 +2661,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 		//res = exp1;
 		itv_set(res->c, exp1->c);
 		itv_set(res->itv, exp1->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    if (p->pnsym->type == IN) t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		    //    if (p->pnsym->type == UN) {
 		    //	res->end->pnsym = pr->mubGlobal.p[p->pnsym->index].x;
@@ -2780,28 +2673,18 @@ static inline t1p_aff_t * t1p_aff_join_constrained8bis(t1p_internal_t* pr, t1p_a
 		fatal("sign pas connu \n");
 	    }
 	} else {
-	    res->q = ptr = t1p_aaterm_alloc_init();
 	    for (i=0;i<size;i++) {
 		itv = ap_abstract0_bound_dimension(pk, obj, (ap_dim_t)i);
 		itv_set_ap_interval(pr->itv, tmp1, itv);
 		//printf("x%d",i);itv_print(tmp1);printf("\n");
 		itv_middev(pr->itv, mid, dev, tmp1);
 		if (i==0) itv_set(res->c, mid);
-		else {
-		    itv_set(ptr->coeff,mid);
-		    ptr->pnsym = T[i].pnsym;
-		    res->end = ptr;
-		    res->l++;
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		}
+		else t1p_aff_nsym_add(pr, res, mid, T[i].pnsym);
 		if (itv_is_eq(mid,T[i].coeffx)) itv_set_int(T[i].coeffx,0);
 		else itv_sub(T[i].coeffx,mid,T[i].coeffx);
 		if (itv_is_eq(mid,T[i].coeffy)) itv_set_int(T[i].coeffy,0);
 		else itv_sub(T[i].coeffy,mid,T[i].coeffy);
 	    }
-	    t1p_aaterm_free(pr, ptr);
-	    if (res->end) res->end->n = NULL;
 	    itv_mul_2exp(T[0].coeffx, T[0].coeffx, -1);
 	    t1p_aff_nsym_add(pr, res, T[0].coeffx, pr->mubGlobal.cx);
 	    itv_mul_2exp(T[0].coeffy, T[0].coeffy, -1);
@@ -2881,11 +2764,12 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
     ptr = NULL;
     int s = 0;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	t1p_aff_reserve(pr, res, exp1->l + exp2->l + 1);
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -2908,8 +2792,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
 			itv_set(qmptr,q->coeff);
 			itv_set(pmptr,p->coeff);
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -2921,7 +2805,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
 		    itv_set_int(qmptr,0);
 
 		    t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -2933,7 +2817,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
 		    itv_set_int(pmptr,0);
 
 		    t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -2946,7 +2830,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
 		itv_set_int(qmptr,0);
 
 		t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -2958,7 +2842,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
 		itv_set_int(pmptr,0);
 
 		t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    itv_mul(pr->itv, tmp1, pmptr, nsymItv1);
 	    itv_add(c1, c1, tmp1);
@@ -2966,24 +2850,9 @@ static inline t1p_aff_t * t1p_aff_join_constrained6bis(t1p_internal_t* pr, t1p_a
 	    itv_add(c2, c2, tmp2);
 	    itv_set_int(pmptr,0);
 	    itv_set_int(qmptr,0);
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		}
 	    }
 	}
 
@@ -3112,9 +2981,10 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2(t1p_internal_t* pr, t1p_aff_t *exp
     ptr = NULL;
     int s = 0;
 
-    if (exp1->q || exp2->q) {
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exp1->q, q = exp2->q; p || q;) {
+    if (exp1->l || exp2->l) {
+	t1p_aff_reserve(pr, res, exp1->l + exp2->l + 1);
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3124,52 +2994,37 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2(t1p_internal_t* pr, t1p_aff_t *exp
 			itv_mul(pr->itv,tmp,ptr->coeff,pr->muu);
 			itv_add(d,d,tmp);
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
 
 		    t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
 
 		    t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
 
 		t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
 
 		t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		}
 	    }
 	}
 	itv_middev(pr->itv, res->c, dev, res->itv);
@@ -3229,13 +3084,11 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
     itv_join(res->itv, exp1->itv, exp2->itv);
     uint_t i = 0;
 
-    t1p_aaterm_t *p, *q, *ptr;
-
-    ptr = NULL;
+    t1p_aaterm_t *p, *q;
     int s = 0;
     uint_t old = pr->dim;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
 	uint_t size = 0;
@@ -3288,7 +3141,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 	itv_join(tmp, min, max);
 	ap_interval_set_itv(pr->itv, tinterval[size], tmp);
 	size++;
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3329,8 +3182,8 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 			T[size].s = 0;
 			//	    fatal("Que faire dans ce cas ????\n");
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -3359,7 +3212,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 			itv_set(max,tmp);
 			T[size].s = 0;
 		    }
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -3388,7 +3241,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 			itv_set(max,tmp);
 			T[size].s = 0;
 		    }
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3418,7 +3271,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 		    itv_set(max,tmp);
 		    T[size].s = 0;
 		}
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -3447,7 +3300,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 		    itv_set(max,tmp);
 		    T[size].s = 0;
 		}
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    tinterval[size] = ap_interval_alloc();
 	    itv_join(tmp, min, max);
@@ -3478,7 +3331,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 		//res = exp1;
 		itv_set(res->c, exp1->c);
 		itv_set(res->itv, exp1->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		}
 	    } else if (s == 1) {
@@ -3486,7 +3339,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 		//res = exp2;
 		itv_set(res->c, exp2->c);
 		itv_set(res->itv, exp2->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		}
 	    } else if (s == -1) {
@@ -3494,7 +3347,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 		//res = exp1;
 		itv_set(res->c, exp1->c);
 		itv_set(res->itv, exp1->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		}
 	    } else {
@@ -3517,7 +3370,6 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 	    printf("\n**********************************************\n");
 	    if (ap_abstract0_is_bottom(pk, obj1)) {
 		/* mean value solution */
-		res->q = ptr = t1p_aaterm_alloc_init();
 		for (i=0;i<size;i++) {
 		    if (!itv_is_eq(T[i].coeffx,T[i].coeffy)) {
 			itv_sub(tmp,T[i].coeffx,T[i].coeffy);
@@ -3529,14 +3381,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2bis(t1p_internal_t* pr, t1p_aff_t *
 		    //printf("x%d",i);itv_print(tmp1);printf("\n");
 		    itv_middev(pr->itv, mid, dev, tmp);
 		    if (i==0) itv_set(res->c, mid);
-		    else {
-			itv_set(ptr->coeff,mid);
-			ptr->pnsym = T[i].pnsym;
-			res->end = ptr;
-			res->l++;
-			ptr->n = t1p_aaterm_alloc_init();
-			ptr=ptr->n;
-		    }
+		    else t1p_aff_nsym_add(pr, res, mid, T[i].pnsym);
 		    /*
 		       if (itv_is_eq(mid,T[i].coeffx)) itv_set_int(T[i].coeffx,0);
 		       else {
@@ -3643,11 +3488,12 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2ter(t1p_internal_t* pr, t1p_aff_t *
     ptr = NULL;
     int size = 0;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	t1p_aff_reserve(pr, res, exp1->l + exp2->l + 1);
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3670,8 +3516,8 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2ter(t1p_internal_t* pr, t1p_aff_t *
 			}
 			size++;
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -3688,7 +3534,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2ter(t1p_internal_t* pr, t1p_aff_t *
 		    }
 
 		    t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -3705,7 +3551,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2ter(t1p_internal_t* pr, t1p_aff_t *
 		    }
 
 		    t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3723,7 +3569,7 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2ter(t1p_internal_t* pr, t1p_aff_t *
 		}
 
 		t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -3740,26 +3586,11 @@ static inline t1p_aff_t * t1p_aff_join_arXiv2ter(t1p_internal_t* pr, t1p_aff_t *
 		}
 
 		t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		}
 	    }
 	}
 
@@ -3839,7 +3670,7 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 
     uint_t old = pr->dim;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
 	uint_t size = 0;
@@ -3854,7 +3685,7 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 	itv_set(T[size].coeffy,exp2->c);
 	size++;
 	bool ok = false;
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3878,8 +3709,8 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 			itv_set(T[size].coeffx,p->coeff);
 			itv_set(T[size].coeffy,q->coeff);
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -3898,7 +3729,7 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 			itv_init(T[size].coeffx);
 			itv_set(T[size].coeffx,p->coeff);
 		    }
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -3916,7 +3747,7 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 			itv_init(T[size].coeffy);
 			itv_set(T[size].coeffy,q->coeff);
 		    }
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -3935,7 +3766,7 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 		    itv_init(T[size].coeffx);
 		    itv_set(T[size].coeffx,p->coeff);
 		}
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -3955,7 +3786,7 @@ static inline t1p_aff_t * t1p_aff_join_bub(t1p_internal_t* pr, t1p_aff_t *exp1,
 		    itv_init(T[size].coeffy);
 		    itv_set(T[size].coeffy,q->coeff);
 		}
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    if (ok) {
 		size++;
@@ -4072,7 +3903,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
     int s = 0;
     uint_t old = pr->dim;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
 	uint_t size = 0;
@@ -4127,7 +3958,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 	ap_interval_set_itv(pr->itv, tinterval[size], tmp);
 	size++;
 	bool ok = false;
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -4178,8 +4009,8 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 			    //	    fatal("Que faire dans ce cas ????\n");
 			}
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -4218,7 +4049,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 			    T[size].s = 0;
 			}
 		    }
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -4259,7 +4090,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 			    T[size].s = 0;
 			}
 		    }
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -4301,7 +4132,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 			T[size].s = 0;
 		    }
 		}
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -4342,7 +4173,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 			T[size].s = 0;
 		    }
 		}
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    if (ok) {
 		tinterval[size] = ap_interval_alloc();
@@ -4376,7 +4207,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 		//res = exp1;
 		itv_set(res->c, exp1->c);
 		itv_set(res->itv, exp1->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		}
 	    } else if (s == 1) {
@@ -4384,7 +4215,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 		//res = exp2;
 		itv_set(res->c, exp2->c);
 		itv_set(res->itv, exp2->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		}
 	    } else if (s == -1) {
@@ -4392,7 +4223,7 @@ static inline t1p_aff_t * t1p_aff_join_bub_argmin(t1p_internal_t* pr, t1p_aff_t
 		//res = exp1;
 		itv_set(res->c, exp1->c);
 		itv_set(res->itv, exp1->itv);
-		for(p = exp1->q; p; p=p->n) {
+		for (p=exp1->q; p<exp1->q+exp1->l; p++) {
 		    t1p_aff_nsym_add(pr, res, p->coeff, p->pnsym);
 		}
 	    } else {
@@ -4515,7 +4346,6 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
     itv_init(itv); itv_init(itv1); itv_init(itv2);
     itv_t tmp, abscoeff, beta;
     itv_init(tmp); itv_init(abscoeff); itv_init(beta);
-    t1p_aaterm_t *lastu = NULL;
     t1p_aaterm_t *p, *q, *ptr;
 
     //t1p_aff_boxize(pr, itv1, exp1, a);			/* gamma(exp1) */
@@ -4545,14 +4375,13 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 	itv_set(beta, dev);
 	itv_set(res->c, mid);
 	t1p_aff_nsym_create(pr, res, beta, UN);
-	res->lastu = res->end;
 	return res;
     } else {
 	/* exp1 and exp2 are in generic position and mid(exp1) \leq mid(exp2) */
 	itv_t argminpq; itv_init(argminpq);
 	ptr = NULL;
 
-	if (exp1->q && exp2->q) {
+	if (exp1->l && exp2->l) {
 	    itv_t nsym_gammaa, nsym_gammab, nsym_gamma_res;
 	    itv_init(nsym_gammaa); itv_init(nsym_gammab); itv_init(nsym_gamma_res);
 	    itv_t suma, sumb; itv_init(suma); itv_init(sumb);
@@ -4576,7 +4405,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 	    itv_set(sumb, tmp);
 	    ap_linexpr0_set_cst(b_linexpr0, coeff);
 	    ap_dim_t dim_nsym_a, dim_nsym_b, dim_nsym_res;
-	    for(p = exp1->q, q = exp2->q; p && q;) {
+	    for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p && q;) {
 		if (p->pnsym->index == q->pnsym->index) {				/* coeff of the same noise symbol */
 		    t1p_nsymcons_get_gamma(pr, nsym_gammaa, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsym_gammab, p->pnsym->index, b);
@@ -4593,17 +4422,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 			    if (itv_is_neg(tmpa) && itv_is_pos(tmpb)) {
 				/* \alpha_i^c <> 0 */
 				if (argmin(pr, argminpq, p->coeff, q->coeff) != 0) {
-				    if (res->q == NULL) {
-					res->q = ptr = t1p_aaterm_alloc_init();			/* allocate the first element of res->q */
-					res->l++;
-				    } else {
-					ptr->n = t1p_aaterm_alloc_init();
-					res->l++;
-					ptr = ptr->n;
-				    }
-				    if (exp1->lastu && exp2->lastu) {				/* keep track of the perturbation noise symbol */
-					if (exp1->lastu == p && exp2->lastu == q) lastu = ptr;	/* only if exp1->lastu and exp2->lastu resist to argmin formula */
-				    }
+				    ptr = t1p_aff_term_alloc_init(pr, res);			/* allocate the next element of res->q */
+				    res->l++;
 				    ptr->pnsym = p->pnsym;						/* set the index of the noise symbol */
 				    itv_set(ptr->coeff, argminpq);					/* set the coefficient as the argmin of the two other coefficients */
 				    itv_set(hypercube[-1 + res->l],argminpq);
@@ -4630,17 +4450,8 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 			    if (itv_is_pos(tmpa) && itv_is_neg(tmpb)) {
 				/* \alpha_i^c <> 0 */
 				if (argmin(pr, argminpq, p->coeff, q->coeff) != 0) {
-				    if (res->q == NULL) {
-					res->q = ptr = t1p_aaterm_alloc_init();			/* allocate the first element of res->q */
-					res->l++;
-				    } else {
-					ptr->n = t1p_aaterm_alloc_init();
-					res->l++;
-					ptr = ptr->n;
-				    }
-				    if (exp1->lastu && exp2->lastu) {				/* keep track of the perturbation noise symbol */
-					if (exp1->lastu == p && exp2->lastu == q) lastu = ptr;	/* only if exp1->lastu and exp2->lastu resist to argmin formula */
-				    }
+				    ptr = t1p_aff_term_alloc_init(pr, res);			/* allocate the next element of res->q */
+				    res->l++;
 				    ptr->pnsym = p->pnsym;					/* set the index of the noise symbol */
 				    itv_set(ptr->coeff, argminpq);				/* set the coefficient as the argmin of the two other coefficients */
 				    itv_set(hypercube[-1 + res->l], argminpq);
@@ -4668,37 +4479,26 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 		    } else {
 			t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		    p = p->n ;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		    q = q->n ;
+		    q = t1p_aff_next(exp2, q);
 		}
 		/*
 		   if (p && q) {
 		   if (p->pnsym->index == q->pnsym->index && res->q) {
 		   if (argmin(pr, argminpq, p->coeff, q->coeff)) {
-		   ptr->n = t1p_aaterm_alloc_init();			//allocate the next element of res->q
+		   ptr->n = t1p_aaterm_alloc_init(pr);			//allocate the next element of res->q
 		   res->l++;
 		   ptr=ptr->n;
 		   }
 		   }
 		   }*/
 	    }
-	    if (ptr) {
-		ptr->n = NULL;
-		res->end = ptr;
-	    }
-	    /* Delete the join symbol if exists.
-	     * This is done simply by setting the coeff to zero, hence this will not appear while computing the norm.
-	     * TODO: what if the perturbation coeff isupports constraints ?
-	     */
-	    if (lastu) {
-		itv_init(lastu->coeff);
-	    }
 	    ap_lincons0_array_t hyperplane = ap_lincons0_array_make(1);
 	    //itv_fprint(stdout,suma); printf("\n");
 	    //itv_fprint(stdout,sumb); printf("\n");
@@ -4730,7 +4530,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 		    ap_abstract0_t* abs1 = ap_abstract0_meet_lincons_array(pr->box, false, abs, &hyperplane);
 		    ap_interval_t** tinterval2 = ap_abstract0_to_box(pr->box, abs1);
 		    k = 0;
-		    for (p=res->q; p; p=p->n) {
+		    for (p=res->q; p<res->q+res->l; p++) {
 			itv_set_ap_interval(pr->itv, tmp, tinterval2[k]);
 			itv_middev(pr->itv, midi, devi, tmp);
 			itv_set(p->coeff, midi);
@@ -4759,7 +4559,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 		    ap_abstract0_t* abs1 = ap_abstract0_meet_lincons_array(pr->box, false, abs, &hyperplane);
 		    ap_interval_t** tinterval2 = ap_abstract0_to_box(pr->box, abs1);
 		    k = 0;
-		    for (p=res->q; p; p=p->n) {
+		    for (p=res->q; p<res->q+res->l; p++) {
 			itv_set_ap_interval(pr->itv, tmp, tinterval2[k]);
 			itv_middev(pr->itv, midi, devi, tmp);
 			itv_set(p->coeff, midi);
@@ -4779,7 +4579,6 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 		    itv_set(beta, dev);
 		    itv_set(res->c, mid);
 		    t1p_aff_nsym_create(pr, res, beta, UN);
-		    res->lastu = res->end;
 		    return res;
 		}
 	    }
@@ -4787,7 +4586,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 	    itv_set(beta, dev);
 	    itv_set(res->c, mid);
 	    //if (gamma_ab == NULL) {		/* use the hypercube [-1,1]^dim */
-	    //	for (q=res->q; q; q=q->n) {
+	    //	for (q=res->q; q<res->q+res->l; q++) {
 	    //	    itv_abs(abscoeff, q->coeff);
 	    //	    itv_sub(beta, beta, abscoeff);
 	    //	}
@@ -4795,7 +4594,7 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 	    itv_t midi, devi;
 	    itv_init(midi);
 	    itv_init(devi);
-	    for (q=res->q; q; q=q->n) {
+	    for (q=res->q; q<res->q+res->l; q++) {
 		t1p_nsymcons_get_gamma(pr, nsym_gammaa, q->pnsym->index, ab);
 		itv_middev(pr->itv, midi, devi, nsym_gamma_res);    /* supposes that gamma has the newest interval concretisations */
 		itv_mul(pr->itv, tmp, midi, q->coeff);		/* alpha_i mid(epsilon_i) */
@@ -4810,7 +4609,6 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 	    if (itv_is_pos(beta)) {
 		if (!(itv_is_zero(beta))) {
 		    t1p_aff_nsym_create(pr, res, beta, UN);
-		    res->lastu = res->end;
 		}
 	    } else {
 		fatal("ae, ae, ae, le beta est ngatif !\n");
@@ -4823,7 +4621,6 @@ static inline t1p_aff_t * t1p_aff_join_constrained1(t1p_internal_t* pr, t1p_aff_
 	    itv_set(beta, dev);
 	    itv_set(res->c, mid);
 	    t1p_aff_nsym_create(pr, res, beta, UN);
-	    res->lastu = res->end;
 	    return res;
 	}
     }
@@ -4849,7 +4646,7 @@ static inline void t1p_aff_cons_eq_lambda(t1p_internal_t* pr, itv_t* res, t1p_af
     itv_init(dim_itv);
     ap_dim_t dim;
     /* parcourir la contrainte */
-    for (p=cons->q, q=x->q; p || q;) {
+    for (p=t1p_aff_first(cons), q=t1p_aff_first(x); p || q;) {
 	if (p && q) {
 	    if (p->pnsym->index == q->pnsym->index) {
 		/* ajouter -q->coeff/p->coeff avec l'indice d'epsilon */
@@ -4880,8 +4677,8 @@ static inline void t1p_aff_cons_eq_lambda(t1p_internal_t* pr, itv_t* res, t1p_af
 		    }
 		    i++;
 		}
-		p = p->n ;
-		q = q->n ;
+		p = t1p_aff_next(cons, p);
+		q = t1p_aff_next(x, q);
 	    } else if (p->pnsym->index < q->pnsym->index) {
 		/* ajouter 0 dans les valeurs  trier avec l'indice d'epsilon */
 		array[i] = (obj*)calloc(1,sizeof(obj));
@@ -4903,9 +4700,9 @@ static inline void t1p_aff_cons_eq_lambda(t1p_internal_t* pr, itv_t* res, t1p_af
 		}
 		itv_set_int(array[i]->itv,0);
 		i++;
-		p = p->n ;
+		p = t1p_aff_next(cons, p);
 	    } else {
-		q = q->n ;
+		q = t1p_aff_next(x, q);
 	    }
 	} else if (p) {
 	    /* ajouter 0 dans les valeurs  trier avec l'indice d'epsilon */
@@ -4928,7 +4725,7 @@ static inline void t1p_aff_cons_eq_lambda(t1p_internal_t* pr, itv_t* res, t1p_af
 	    }
 	    itv_set_int(array[i]->itv,0);
 	    i++;
-	    p = p->n ;
+	    p = t1p_aff_next(cons, p);
 	} else {
 	    /* ces termes n'intervienderont pas dans la minimisation de la concretisation */
 	    /* on peut arreter la boucle ici */
@@ -5020,11 +4817,12 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
     itv_join(res->itv, exp1->itv, exp2->itv);
     ptr = NULL;
 
-    if (exp1->q || exp2->q) {
+    if (exp1->l || exp2->l) {
 	itv_set(c1, exp1->c);
 	itv_set(c2, exp2->c);
-	ptr = t1p_aaterm_alloc_init();
-	for(p = exp1->q, q = exp2->q; p || q;) {
+	t1p_aff_reserve(pr, res, exp1->l + exp2->l + 1);
+	for(p = t1p_aff_first(exp1), q = t1p_aff_first(exp2); p || q;) {
+	    ptr = t1p_aff_term_alloc_init(pr, res);
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -5040,8 +4838,8 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
 			itv_sub(pmptr, p->coeff, ptr->coeff);
 			itv_sub(qmptr, q->coeff, ptr->coeff);
 		    }
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(exp1, p);
+		    q = t1p_aff_next(exp2, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, p->pnsym->index, b);
@@ -5053,7 +4851,7 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
 			itv_set_int(qmptr,0);
 		    }
 		    t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		    p = p->n;
+		    p = t1p_aff_next(exp1, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		    t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -5065,7 +4863,7 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
 			itv_set_int(pmptr,0);
 		    }
 		    t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		    q = q->n;
+		    q = t1p_aff_next(exp2, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, a);
@@ -5078,7 +4876,7 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
 		    itv_set_int(qmptr,0);
 		}
 		t1p_delete_constrained_nsym(pr, p->pnsym->index, ab);
-		p = p->n;
+		p = t1p_aff_next(exp1, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, a);
 		t1p_nsymcons_get_gamma(pr, nsymItv2, q->pnsym->index, b);
@@ -5090,7 +4888,7 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
 		    itv_set_int(pmptr,0);
 		}
 		t1p_delete_constrained_nsym(pr, q->pnsym->index, ab);
-		q = q->n;
+		q = t1p_aff_next(exp2, q);
 	    }
 	    itv_mul(pr->itv, tmp1, pmptr, nsymItv1);
 	    itv_add(c1, c1, tmp1);
@@ -5098,24 +4896,9 @@ static inline t1p_aff_t* t1p_aff_widening_constrained6(t1p_internal_t* pr, t1p_a
 	    itv_add(c2, c2, tmp2);
 	    itv_set_int(pmptr,0);
 	    itv_set_int(qmptr,0);
-	    if (itv_is_zero(ptr->coeff)) {
-		if (!(p||q)) {
-		    /* the last iteration */
-		    t1p_aaterm_free(pr, ptr);
-		    if (res->end) res->end->n = NULL;
-		}
-	    } else {
+	    if (!itv_is_zero(ptr->coeff)) {
 		/* keep this term */
-		if (!res->q) res->q = ptr;
-		res->end = ptr;
 		res->l++;
-		if (p||q) {
-		    /* continuing */
-		    ptr->n = t1p_aaterm_alloc_init();
-		    ptr=ptr->n;
-		} else {
-		    /* the last iteration */
-		}
 	    }
 	}
 
@@ -5228,7 +5011,7 @@ static inline bool t1p_aff_is_top(t1p_internal_t* pr, t1p_aff_t *a)
     if (a == pr->top) return true;
     else if (!itv_is_top(a->c)) return false;
     else if (!itv_is_top(a->itv)) return false;
-    else if (a->q != NULL) return false;
+    else if (a->l != 0) return false;
     else return true;
 }
 static inline bool t1p_aff_is_bottom(t1p_internal_t* pr, t1p_aff_t *a)
@@ -5236,7 +5019,7 @@ static inline bool t1p_aff_is_bottom(t1p_internal_t* pr, t1p_aff_t *a)
     if (a == pr->bot) return true;
     else if (!itv_is_bottom(pr->itv, a->c)) return false;
     else if (!itv_is_bottom(pr->itv, a->itv)) return false;
-    else if (a->q != NULL) return false;
+    else if (a->l != 0) return false;
     else return true;
 }
 
@@ -5253,6 +5036,8 @@ static inline t1p_internal_t* t1p_internal_alloc(ap_manager_t* manNS)
     CALL();
     t1p_internal_t* pr = (t1p_internal_t*)malloc(sizeof(t1p_internal_t));
     pr->itv = itv_internal_alloc();
+    pr->pending = NULL;
+    pr->npending = 0;
     pr->dim = 0;
     pr->funid = AP_FUNID_UNKNOWN;
     pr->man = NULL;
@@ -5505,7 +5290,7 @@ static inline ap_linexpr0_t* t1p_ap_linexpr0_set_aff(t1p_internal_t* pr, t1p_aff
     linexpr0->size = aff->l;
     uint_t k = 0;
     ap_dim_t dim = 0;
-    for (p=aff->q; p; p=p->n) {
+    for (p=aff->q; p<aff->q+aff->l; p++) {
 	ap_coeff_init(&linexpr0->p.linterm[k].coeff, AP_COEFF_INTERVAL);
 	ap_coeff_set_itv(pr->itv, &linexpr0->p.linterm[k].coeff, p->coeff);
 	/* update a->abs with new constrained noise symbols */
@@ -5561,22 +5346,20 @@ static inline void t1p_update_nsymcons_gamma(t1p_internal_t* pr, t1p_t* a)
 
 static inline void t1p_aff_canonical(t1p_internal_t* pr, t1p_aff_t* aff)
 {
-    if (aff->q) {
+    if (aff->l) {
 	bool ok;
 	do {
 	    ok = true;
 	    t1p_aaterm_t *p,*q;
 	    t1p_nsym_t* tmp;
-	    for (p=aff->q; p; p=p->n) {
-		q = p->n;
-		if (q) {
-		    if (p->pnsym->index > q->pnsym->index) {
-			itv_swap(p->coeff, q->coeff);
-			tmp = p->pnsym;
-			p->pnsym = q->pnsym;
-			q->pnsym = tmp;
-			ok = false;
-		    }
+	    for (p=aff->q; p+1<aff->q+aff->l; p++) {
+		q = p+1;
+		if (p->pnsym->index > q->pnsym->index) {
+		    itv_swap(p->coeff, q->coeff);
+		    tmp = p->pnsym;
+		    p->pnsym = q->pnsym;
+		    q->pnsym = tmp;
+		    ok = false;
 		}
 	    }
 	} while (!ok);
@@ -5596,8 +5379,8 @@ static inline double t1p_aff_distance(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
     t1p_aaterm_t *p, *q;
     p = q = NULL;
     itv_square(pr->itv,d,d);
-    if (a->q || b->q) {
-	for(p = a->q, q = b->q; p || q;) {
+    if (a->l || b->l) {
+	for(p = t1p_aff_first(a), q = t1p_aff_first(b); p || q;) {
 	    if (p && q) {
 		if (p->pnsym->index == q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, obj);
@@ -5609,8 +5392,8 @@ static inline double t1p_aff_distance(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
 		    itv_mul(pr->itv,tmp,tmp,dev);
 		    itv_square(pr->itv,tmp,tmp);
 		    itv_add(d,d,tmp);
-		    p = p->n ;
-		    q = q->n ;
+		    p = t1p_aff_next(a, p);
+		    q = t1p_aff_next(b, q);
 		} else if (p->pnsym->index < q->pnsym->index) {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, obj);
 		    itv_middev(pr->itv, mid, dev, nsymItv1);
@@ -5619,7 +5402,7 @@ static inline double t1p_aff_distance(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
 		    itv_mul(pr->itv,dev,p->coeff,dev);
 		    itv_square(pr->itv,tmp,dev);
 		    itv_add(d,d,tmp);
-		    p = p->n ;
+		    p = t1p_aff_next(a, p);
 		} else {
 		    t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, obj);
 		    itv_middev(pr->itv, mid, dev, nsymItv1);
@@ -5629,7 +5412,7 @@ static inline double t1p_aff_distance(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
 		    itv_mul(pr->itv,dev,tmp,dev);
 		    itv_square(pr->itv,tmp,dev);
 		    itv_add(d,d,tmp);
-		    q = q->n ;
+		    q = t1p_aff_next(b, q);
 		}
 	    } else if (p) {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, p->pnsym->index, obj);
@@ -5639,7 +5422,7 @@ static inline double t1p_aff_distance(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
 		itv_mul(pr->itv,dev,p->coeff,dev);
 		itv_square(pr->itv,tmp,dev);
 		itv_add(d,d,tmp);
-		p = p->n ;
+		p = t1p_aff_next(a, p);
 	    } else {
 		t1p_nsymcons_get_gamma(pr, nsymItv1, q->pnsym->index, obj);
 		itv_middev(pr->itv, mid, dev, nsymItv1);
@@ -5649,7 +5432,7 @@ static inline double t1p_aff_distance(t1p_internal_t* pr, t1p_aff_t *a, t1p_aff_
 		itv_mul(pr->itv,dev,tmp,dev);
 		itv_square(pr->itv,tmp,dev);
 		itv_add(d,d,tmp);
-		q = q->n ;
+		q = t1p_aff_next(b, q);
 	    }
 	}
     }
@@ -13,33 +13,33 @@
 #include "itv.h"
 
 /* TODO: To be add to itv lib (?) */
-static inline bool itv_has_infty_bound(itv_t itv);
-static inline bool itv_has_finite_bound(itv_t itv);
-static inline bool itv_cmp(itv_t a, itv_t b);
-static inline int itv_sign(itv_internal_t *itv, itv_t a, itv_t b);
+static inline bool itv_has_infty_bound(itv_ptr itv);
+static inline bool itv_has_finite_bound(itv_ptr itv);
+static inline bool itv_cmp(itv_ptr a, itv_ptr b);
+static inline int itv_sign(itv_internal_t *itv, itv_ptr a, itv_ptr b);
 
 /* mid = RND_NEAREST((sup(a) + inf(a))/2). dev = max(sup(a)-mid, mid-inf(a)) */
-static inline void itv_middev(itv_internal_t *itv, itv_t mid, itv_t dev, itv_t a);
-static inline void itv_middev_regular(itv_internal_t *itv, itv_t mid, itv_t dev, itv_t a);
+static inline void itv_middev(itv_internal_t *itv, itv_ptr mid, itv_ptr dev, itv_ptr a);
+static inline void itv_middev_regular(itv_internal_t *itv, itv_ptr mid, itv_ptr dev, itv_ptr a);
 
-static inline bool itv_has_infty_bound(itv_t itv)
+static inline bool itv_has_infty_bound(itv_ptr itv)
 {
         return (bound_infty(itv->sup) || bound_infty(itv->inf)) ;
 }
 
-static inline bool itv_has_finite_bound(itv_t itv)
+static inline bool itv_has_finite_bound(itv_ptr itv)
 {
         return !(bound_infty(itv->sup) || bound_infty(itv->inf)) ;
 }
 
 /* be aware: itv->inf is encoded with minus sign */
-static inline bool itv_has_not_zero(itv_t itv)
+static inline bool itv_has_not_zero(itv_ptr itv)
 {
 	return ((bound_sgn(bound_numref(itv->inf))==-1) || (bound_sgn(bound_numref(itv->sup))==-1));
 }
 
 /* if a is bottom or has one infity bound, mid and dev are set to top. */
-static inline void itv_middev(itv_internal_t *itv, itv_t mid, itv_t dev, itv_t a)
+static inline void itv_middev(itv_internal_t *itv, itv_ptr mid, itv_ptr dev, itv_ptr a)
 /* L'intervalle [mid-dev,mid+dev] colle plus  l'intervalle d'origine [x,y] si mid est calcule en arrondissant au plus pres.
  * En effet, [mid-dev,mid+dev] est decalle de la distance qui separe le vrai milieu de celui arrondi, l'arrondi au plus pres minimise cette distance.
  */
@@ -96,7 +96,7 @@ static inline void itv_middev(itv_internal_t *itv, itv_t mid, itv_t dev, itv_t a
 }
 
 /* return true if for all x in a, for all y in b: x <= y */
-static inline bool itv_cmp(itv_t a, itv_t b){
+static inline bool itv_cmp(itv_ptr a, itv_ptr b){
     bool res = false;
     bound_t tmp; bound_init(tmp);
     bound_neg(tmp,b->inf);
@@ -104,7 +104,7 @@ static inline bool itv_cmp(itv_t a, itv_t b){
     bound_clear(tmp);
     return res;
 }
-static inline bool itv_is_generic(itv_t a, itv_t b) 
+static inline bool itv_is_generic(itv_ptr a, itv_ptr b) 
 {
     if (itv_is_leq(a,b) || itv_is_leq(a,b)) {
 	if ((bound_cmp(a->inf, b->inf) == 0) || (bound_cmp(a->sup, b->sup) == 0)) return true; else return false;
@@ -112,7 +112,7 @@ static inline bool itv_is_generic(itv_t a, itv_t b)
 }
 
 /* sign of a-b : 0 means a == b; 1 means a < b; -1 means a > b; 2 means undef sign */
-static inline int itv_sign(itv_internal_t *itv, itv_t a, itv_t b)
+static inline int itv_sign(itv_internal_t *itv, itv_ptr a, itv_ptr b)
 {
     int res = 0;
     itv_t meet; itv_init(meet);
@@ -130,14 +130,14 @@ static inline int itv_sign(itv_internal_t *itv, itv_t a, itv_t b)
     return res;
 }
 
-static inline void itv_square(itv_internal_t *itv, itv_t res, itv_t a)
+static inline void itv_square(itv_internal_t *itv, itv_ptr res, itv_ptr a)
 {
     itv_mul(itv,res,a,a);
     if (bound_cmp_int(res->inf,0) >= 0) {bound_set_int(res->inf,0);}
 }
 
 /* mid contient a coup sur le mid reel, pareil pour dev, utilise surtout quand on a besoin de ses valeurs reelles */
-static inline void itv_middev_regular(itv_internal_t *itv, itv_t mid, itv_t dev, itv_t a)
+static inline void itv_middev_regular(itv_internal_t *itv, itv_ptr mid, itv_ptr dev, itv_ptr a)
 {
     itv_t minf, sup;
     itv_init(minf);
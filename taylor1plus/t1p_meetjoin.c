@@ -6,6 +6,8 @@
 
 
 #include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include "num.h"
 #include "itv.h"
@@ -132,7 +134,7 @@ t1p_t* t1p_meet(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 	for (i=0; i<intdim+realdim; i++) {
 	    /* update res->box */
 	    itv_meet(pr->itv, res->box[i], a1->box[i], a2->box[i]);
-	    if ((a1->paf[i]->q == NULL) && (a2->paf[i]->q == NULL)) {
+	    if ((a1->paf[i]->l == 0) && (a2->paf[i]->l == 0)) {
 		itv_meet(pr->itv, tmp, a1->paf[i]->c, a2->paf[i]->c);
 		if (itv_is_bottom(pr->itv, tmp)) {
 		    t1p_free(man, res);
@@ -154,9 +156,11 @@ t1p_t* t1p_meet(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 		res->paf[i] = t1p_aff_alloc_init(pr);
 		itv_set(res->paf[i]->c, res->box[i]);
 	    } else {
+#ifdef _T1P_DEBUG
 		fprintf(stdout, "destructive ? %d\n",destructive);
 		t1p_fprint(stdout, man, a1, 0x0);
 		t1p_fprint(stdout, man, a2, 0x0);
+#endif
 		//not_implemented();
 		/* return a top instead */
 		res->paf[i] = pr->top;
@@ -269,7 +273,7 @@ static inline bool t1p_eval_lincons_array(t1p_internal_t* pr, size_t* hash, t1p_
 		eps_linexpr0->size = sum->l;
 		size_t k = 0;
 		ap_dim_t dim = 0;
-		for (p=sum->q; p; p=p->n) {
+		for (p=sum->q; p<sum->q+sum->l; p++) {
 		    ap_coeff_init(&eps_linexpr0->p.linterm[k].coeff, AP_COEFF_INTERVAL);
 		    ap_coeff_set_itv(pr->itv, &eps_linexpr0->p.linterm[k].coeff, p->coeff);
 		    t1p_insert_constrained_nsym(pr, &dim, p->pnsym->index, a);
@@ -365,7 +369,7 @@ t1p_t* t1p_meet_tcons_array(ap_manager_t* man, bool destructive, t1p_t* a, ap_tc
 		    if (itv_is_bottom(pr->itv, res->box[i])) {
 			is_bottom = true;
 			break;
-		    } else if (res->paf[i]->q == NULL) {
+		    } else if (res->paf[i]->l == 0) {
 			t1p_aff_check_free(pr, res->paf[i]);
 			res->paf[i] = t1p_aff_alloc_init(pr);
 
@@ -404,7 +408,7 @@ t1p_t* t1p_meet_tcons_array(ap_manager_t* man, bool destructive, t1p_t* a, ap_tc
 	for (i=0; i<array->size; i++) {
 	    texpr0 = array->p[i].texpr0;
 	    aff[i] = t1p_aff_eval_ap_texpr0(pr, texpr0, a);
-	    if (aff[i]->q == NULL) {
+	    if (aff[i]->l == 0) {
 		/* only the centers are involved in this constraint, already treated while updating res->box */
 	    } else {
 		/* infer constraints on noise symbols */
@@ -433,7 +437,7 @@ t1p_t* t1p_meet_tcons_array(ap_manager_t* man, bool destructive, t1p_t* a, ap_tc
 		t1p_aff_t* tmp, *tmp1;
 		size_t j = 0;
 		for (j=0; j<res->dims; j++) {
-		    if (res->paf[j]->q) {
+		    if (res->paf[j]->l) {
 			t1p_aff_cons_eq_lambda(pr, &dummy, res->paf[j], aff[i], res);
 			tmp = t1p_aff_mul_itv(pr, aff[i], dummy);
 			itv_set(res->paf[j]->itv, res->box[j]);
@@ -480,12 +484,214 @@ t1p_t* t1p_meet_tcons_array(ap_manager_t* man, bool destructive, t1p_t* a, ap_tc
 /************************************************/
 /* 2.Join					*/
 /************************************************/
+/* Once the timeout of the join is over, or the number of noise symbols
+   exceeds its max_object_size, the remaining variables are joined on their
+   concretisation only (the exception is raised once) */
+static bool t1p_join_exhausted(t1p_internal_t* pr, ap_manager_t* man, bool* exhausted)
+{
+    size_t max_object_size = man->option.funopt[AP_FUNID_JOIN].max_object_size;
+    if (*exhausted) return true;
+    if (ap_manager_timeout(man)) {
+	ap_manager_raise_exception(man, AP_EXC_TIMEOUT, AP_FUNID_JOIN, "join interrupted by timeout");
+	*exhausted = true;
+    } else if (max_object_size && pr->dim > max_object_size) {
+	ap_manager_raise_exception(man, AP_EXC_OUT_OF_SPACE, AP_FUNID_JOIN, "too many noise symbols");
+	*exhausted = true;
+    }
+    return *exhausted;
+}
+
+/* Concurrent join of affine forms, used by t1p_join and t1p_widening when
+   the algorithm option of the function is greater than 1.
+
+   The variables are split among at most algorithm workers (bounded by the
+   number of processors), each one with a private copy of the internal
+   structure: its own working space and clone of the manager of noise
+   symbols. The noise symbols created by a worker are kept in
+   its pending array, and registered afterwards in the order of the
+   variables, so that the result is the same as the one of the sequential
+   join. The join checks whether it is exhausted (see t1p_join_exhausted)
+   at the same points as the sequential one, while it registers the noise
+   symbols: the forms of the variables found exhausted are replaced by their
+   concretisation, and their new noise symbols are dropped. The workers
+   stop at the deadline of the join, checked on their own copy of the timer
+   of the manager. As the join of two forms updates their itv field, the
+   variables whose forms are shared with another variable are all joined by
+   the first worker. */
+typedef struct t1p_join_worker_t {
+    t1p_internal_t pr;		/* private copy of the internal structure */
+    bool widening;
+    ap_timer_t timer;		/* deadline of the join, none for the widening */
+    t1p_t *a1, *a2, *res;
+    size_t* tvar;		/* variables joined by the worker */
+    size_t size;
+    uint_t* first;		/* for each variable, its first and last+1 */
+    uint_t* last;		/* noise symbols in pr.pending */
+} t1p_join_worker_t;
+
+typedef struct t1p_join_form_t {
+    t1p_aff_t* aff;
+    size_t var;
+} t1p_join_form_t;
+
+static int t1p_join_form_cmp(const void* a, const void* b)
+{
+    const t1p_join_form_t* fa = (const t1p_join_form_t*)a;
+    const t1p_join_form_t* fb = (const t1p_join_form_t*)b;
+    uintptr_t pa = (uintptr_t)fa->aff;
+    uintptr_t pb = (uintptr_t)fb->aff;
+    return pa < pb ? -1 : (pa > pb ? 1 : (fa->var > fb->var) - (fa->var < fb->var));
+}
+
+static void* t1p_join_worker(void* arg)
+{
+    t1p_join_worker_t* w = (t1p_join_worker_t*)arg;
+    t1p_internal_t* pr = &w->pr;
+    size_t k, i;
+    for (k=0; k<w->size; k++) {
+	i = w->tvar[k];
+	w->first[i] = pr->npending;
+	if (w->timer.deadline != 0.0 && ap_timer_check(&w->timer)) {
+	    /* joined on its concretisation by t1p_aff_join_concurrent */
+	    w->res->paf[i] = NULL;
+	    w->last[i] = pr->npending;
+	    continue;
+	}
+	itv_set(w->a1->paf[i]->itv, w->a1->box[i]);
+	itv_set(w->a2->paf[i]->itv, w->a2->box[i]);
+	if (w->widening) w->res->paf[i] = t1p_aff_widening_constrained6(pr, w->a1->paf[i], w->a2->paf[i], w->a1, w->a2, w->res);
+	else w->res->paf[i] = t1p_aff_join_constrained6(pr, w->a1->paf[i], w->a2->paf[i], w->a1, w->a2, w->res);
+	w->last[i] = pr->npending;
+    }
+    return NULL;
+}
+
+void t1p_aff_join_concurrent(ap_manager_t* man, bool widening, t1p_t* a1, t1p_t* a2, t1p_t* res, size_t* tvar, size_t size, bool* exhausted)
+{
+    t1p_internal_t* pr = (t1p_internal_t*)man->internal;
+    long nbprocs = sysconf(_SC_NPROCESSORS_ONLN);
+    int algorithm = man->option.funopt[widening ? AP_FUNID_WIDENING : AP_FUNID_JOIN].algorithm;
+    size_t nbworkers = algorithm > 1 ? (size_t)algorithm : 1;
+    size_t i, j, k, n, nshared;
+    uint_t l;
+    t1p_join_worker_t* worker;
+    pthread_t* thread;
+    bool* started;
+    t1p_join_form_t* form;
+    bool* shared;
+    size_t* order;
+    size_t* owner;
+    uint_t* first;
+    uint_t* last;
+
+    if (nbprocs > 0 && nbworkers > (size_t)nbprocs) nbworkers = (size_t)nbprocs;
+    if (nbworkers > size) nbworkers = size;
+    if (nbworkers < 1) nbworkers = 1;
+
+    /* variables whose forms are shared with another variable */
+    shared = (bool*)calloc(a1->dims, sizeof(bool));
+    form = (t1p_join_form_t*)malloc(2*size*sizeof(t1p_join_form_t));
+    for (k=0; k<size; k++) {
+	form[2*k].aff = a1->paf[tvar[k]]; form[2*k].var = tvar[k];
+	form[2*k+1].aff = a2->paf[tvar[k]]; form[2*k+1].var = tvar[k];
+    }
+    qsort(form, 2*size, sizeof(t1p_join_form_t), t1p_join_form_cmp);
+    for (k=0; k<2*size; k=j) {
+	for (j=k+1; j<2*size && form[j].aff == form[k].aff; j++);
+	if (form[j-1].var != form[k].var) {
+	    for (n=k; n<j; n++) shared[form[n].var] = true;
+	}
+    }
+    free(form);
+    /* order: shared variables first, then the other ones */
+    order = (size_t*)malloc(size*sizeof(size_t));
+    nshared = 0;
+    for (k=0; k<size; k++) if (shared[tvar[k]]) order[nshared++] = tvar[k];
+    for (k=0, n=nshared; k<size; k++) if (!shared[tvar[k]]) order[n++] = tvar[k];
+
+    /* workers */
+    worker = (t1p_join_worker_t*)malloc(nbworkers*sizeof(t1p_join_worker_t));
+    thread = (pthread_t*)malloc(nbworkers*sizeof(pthread_t));
+    started = (bool*)calloc(nbworkers, sizeof(bool));
+    owner = (size_t*)malloc(a1->dims*sizeof(size_t));
+    first = (uint_t*)malloc(a1->dims*sizeof(uint_t));
+    last = (uint_t*)malloc(a1->dims*sizeof(uint_t));
+    for (k=0; k<nbworkers; k++) {
+	ap_manager_t* manNS = k==0 ? pr->manNS : ap_manager_clone_for_thread(pr->manNS);
+	if (manNS == NULL) {
+	    nbworkers = k;
+	    break;
+	}
+	worker[k].pr = *pr;
+	worker[k].pr.itv = itv_internal_alloc();
+	worker[k].pr.manNS = manNS;
+	worker[k].pr.pending = (t1p_nsym_t**)malloc(1024*sizeof(t1p_nsym_t*));
+	worker[k].pr.npending = 0;
+	worker[k].widening = widening;
+	worker[k].timer = man->timer;
+	if (exhausted == NULL) worker[k].timer.deadline = 0.0;
+	worker[k].a1 = a1;
+	worker[k].a2 = a2;
+	worker[k].res = res;
+	worker[k].first = first;
+	worker[k].last = last;
+    }
+    /* split the non shared variables */
+    n = 0;
+    for (k=0; k<nbworkers; k++) {
+	size_t end = nshared + (size-nshared)*(k+1)/nbworkers;
+	worker[k].tvar = order + n;
+	worker[k].size = end - n;
+	for (j=n; j<end; j++) owner[order[j]] = k;
+	n = end;
+    }
+    for (k=1; k<nbworkers; k++) {
+	started[k] = pthread_create(&thread[k], NULL, &t1p_join_worker, &worker[k]) == 0;
+    }
+    t1p_join_worker(&worker[0]);
+    for (k=1; k<nbworkers; k++) {
+	if (started[k]) pthread_join(thread[k], NULL);
+	else t1p_join_worker(&worker[k]);
+    }
+
+    /* register the new noise symbols in the order of the variables */
+    for (k=0; k<size; k++) {
+	i = tvar[k];
+	if (exhausted && (t1p_join_exhausted(pr, man, exhausted) || res->paf[i] == NULL)) {
+	    if (res->paf[i]) {
+		t1p_aff_free(pr, res->paf[i]);
+		for (l=first[i]; l<last[i]; l++) free(worker[owner[i]].pr.pending[l]);
+	    }
+	    res->paf[i] = t1p_aff_alloc_init(pr);
+	    itv_set(res->paf[i]->c, res->box[i]);
+	} else {
+	    for (l=first[i]; l<last[i]; l++) t1p_nsym_register(pr, worker[owner[i]].pr.pending[l]);
+	}
+	res->paf[i]->pby++;
+    }
+    for (k=0; k<nbworkers; k++) {
+	t1p_internal_t* wpr = &worker[k].pr;
+	itv_internal_free(wpr->itv);
+	if (k>0) ap_manager_free(wpr->manNS);
+	free(wpr->pending);
+    }
+    free(worker);
+    free(thread);
+    free(started);
+    free(shared);
+    free(order);
+    free(owner);
+    free(first);
+    free(last);
+}
+
 /* local join */
 t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
     /* TODO destructive not used  */
 {
     CALL();
     size_t i = 0;
+    bool exhausted = false;
     t1p_internal_t* pr = (t1p_internal_t*)t1p_init_from_manager(man, AP_FUNID_JOIN);
     arg_assert(a1->dims==a2->dims && a1->intdim==a2->intdim,abort(););
 #ifdef _T1P_DEBUG
@@ -528,6 +734,9 @@ t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 	for (i=0; i<(intdim+realdim); i++) itv_join(res->box[i], a1->box[i], a2->box[i]);
 
 	if (a1->hypercube && a2->hypercube) {
+	    bool concurrent = man->option.funopt[AP_FUNID_JOIN].algorithm > 1;
+	    size_t* tvar = concurrent ? (size_t*)malloc((intdim+realdim)*sizeof(size_t)) : NULL;
+	    size_t size = 0;
 	    for (i=0; i<(intdim+realdim); i++) {
 		//printf("%d: ",i);
 		if (t1p_aff_is_bottom(pr, a1->paf[i])) res->paf[i] = a2->paf[i];
@@ -548,7 +757,7 @@ t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 		    itv_set(res->paf[i]->c, a2->paf[i]->c);
 		    itv_set(res->paf[i]->itv, a2->paf[i]->itv);
 		    t1p_aaterm_t* p = NULL;
-		    for(p = a2->paf[i]->q; p; p=p->n) {
+		    for (p=a2->paf[i]->q; p<a2->paf[i]->q+a2->paf[i]->l; p++) {
 			t1p_aff_nsym_add(pr, res->paf[i], p->coeff, p->pnsym);
 			if (p->pnsym->type == UN) {
 			    res->paf[i]->end->pnsym = pr->mubGlobal.p[p->pnsym->index].y;
@@ -556,12 +765,17 @@ t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 		    }
 		    *
 		} */ else {
-		    if (itv_has_infty_bound(a1->box[i]) || itv_has_infty_bound(a2->box[i])) {
+		    if ((!concurrent && t1p_join_exhausted(pr, man, &exhausted)) || itv_has_infty_bound(a1->box[i]) || itv_has_infty_bound(a2->box[i])) {
 			/* Do nothing, the join of concretisations is already done and stored in res->box */
 			res->paf[i] = t1p_aff_alloc_init(pr);
 			itv_set(res->paf[i]->c, res->box[i]);
 		    } else {
 			/* join two affine form expressions */
+			if (concurrent) {
+			    /* done by t1p_aff_join_concurrent */
+			    tvar[size++] = i;
+			    continue;
+			}
 			itv_set(a1->paf[i]->itv, a1->box[i]);
 			itv_set(a2->paf[i]->itv, a2->box[i]);
 			res->paf[i] = t1p_aff_join_constrained6(pr, a1->paf[i], a2->paf[i], a1, a2, res);
@@ -570,6 +784,8 @@ t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 		//printf("%d",i);itv_print(a1->box[i]); printf("\t");itv_print(a2->box[i]);printf("\n");
 		res->paf[i]->pby++;
 	    }
+	    if (size) t1p_aff_join_concurrent(man, false, a1, a2, res, tvar, size, &exhausted);
+	    free(tvar);
 
 	} else {
 	    size_t k = 0;
@@ -636,7 +852,7 @@ t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 		else if (t1p_aff_is_top(pr, a1->paf[i]) || t1p_aff_is_top(pr, a2->paf[i])) res->paf[i] = pr->top;
 		else if (t1p_aff_is_eq(pr, a1->paf[i], a2->paf[i])) res->paf[i] = a1->paf[i];
 		else {
-		    if (itv_has_infty_bound(a1->box[i]) || itv_has_infty_bound(a2->box[i])) {
+		    if (t1p_join_exhausted(pr, man, &exhausted) || itv_has_infty_bound(a1->box[i]) || itv_has_infty_bound(a2->box[i])) {
 			/* Do nothing, the join of concretisations is already done and stored in res->box */
 			res->paf[i] = t1p_aff_alloc_init(pr);
 			itv_set(res->paf[i]->c, res->box[i]);
@@ -662,6 +878,7 @@ t1p_t* t1p_join(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
     }
     man->result.flag_best = tbool_true;
     man->result.flag_exact = tbool_true;
+    if (exhausted) man->result.flag_best = man->result.flag_exact = false;
 
 
 #ifdef _T1P_DEBUG
@@ -771,7 +988,7 @@ t1p_t* t1p_join_faux(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 		    itv_set(res->paf[i]->c, a2->paf[i]->c);
 		    itv_set(res->paf[i]->itv, a2->paf[i]->itv);
 		    t1p_aaterm_t* p = NULL;
-		    for(p = a2->paf[i]->q; p; p=p->n) {
+		    for (p=a2->paf[i]->q; p<a2->paf[i]->q+a2->paf[i]->l; p++) {
 			t1p_aff_nsym_add(pr, res->paf[i], p->coeff, p->pnsym);
 			if (p->pnsym->type == UN) {
 			    res->paf[i]->end->pnsym = pr->mubGlobal.p[p->pnsym->index].y;
@@ -806,7 +1023,7 @@ t1p_t* t1p_join_faux(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 	    if (!res->g[0]) res->g[0] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 	    itv_init(res->g[0][i]);
 	    itv_set(res->g[0][i],res->paf[i]->c);
-	    for(p=res->paf[i]->q;p;p=p->n) {
+	    for (p=res->paf[i]->q; p<res->paf[i]->q+res->paf[i]->l; p++) {
 		if (!res->g[1+p->pnsym->index]) res->g[1+p->pnsym->index] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 		itv_init(res->g[1+p->pnsym->index][i]);
 		itv_set(res->g[1+p->pnsym->index][i],p->coeff);
@@ -818,11 +1035,9 @@ t1p_t* t1p_join_faux(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2)
 	for (i=1+pr->epssize;i<1+(-1+pr->dim);i++) {
 	    for (j=i+1;j<1+pr->dim;j++) {
 		if (res->g[i] && res->g[j]) {
-		    if (res->g[j][0] && res->g[i][0]) itv_div(pr->itv,tmp,res->g[j][0],res->g[i][0]);
-		    else break;
+		    itv_div(pr->itv,tmp,res->g[j][0],res->g[i][0]);
 		    for (k=1;k<intdim+realdim;) {
-			if (res->g[j][k] && res->g[i][k]) itv_div(pr->itv,tmp1,res->g[j][k],res->g[i][k]);
-			else break;
+			itv_div(pr->itv,tmp1,res->g[j][k],res->g[i][k]);
 			if (itv_is_eq(tmp,tmp1)) k++;
 			else break;
 		    }
@@ -1233,7 +1448,7 @@ t1p_t* t1p_join_global(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2
 	    if (!a1->g[0]) a1->g[0] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 	    itv_init(a1->g[0][i]);
 	    itv_set(a1->g[0][i],a1->paf[i]->c);
-	    for(p=a1->paf[i]->q;p;p=p->n) {
+	    for (p=a1->paf[i]->q; p<a1->paf[i]->q+a1->paf[i]->l; p++) {
 		if (!a1->g[p->pnsym->index]) a1->g[p->pnsym->index] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 		itv_init(a1->g[p->pnsym->index][i]);
 		itv_set(a1->g[p->pnsym->index][i],p->coeff);
@@ -1242,7 +1457,7 @@ t1p_t* t1p_join_global(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2
 	    if (!a2->g[0]) a2->g[0] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 	    itv_init(a2->g[0][i]);
 	    itv_set(a2->g[0][i],a2->paf[i]->c);
-	    for(p=a2->paf[i]->q;p;p=p->n) {
+	    for (p=a2->paf[i]->q; p<a2->paf[i]->q+a2->paf[i]->l; p++) {
 		if (!a2->g[p->pnsym->index]) a2->g[p->pnsym->index] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 		itv_init(a2->g[p->pnsym->index][i]);
 		itv_set(a2->g[p->pnsym->index][i],p->coeff);
@@ -1319,7 +1534,7 @@ t1p_t* t1p_join_global(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2
 	    if (!res->g[0]) res->g[0] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 	    itv_init(res->g[0][i]);
 	    itv_set(res->g[0][i],res->paf[i]->c);
-	    for(p=res->paf[i]->q;p;p=p->n) {
+	    for (p=res->paf[i]->q; p<res->paf[i]->q+res->paf[i]->l; p++) {
 		if (!res->g[1+p->pnsym->index]) res->g[1+p->pnsym->index] = (itv_t*)calloc(intdim+realdim,sizeof(itv_t));
 		itv_init(res->g[1+p->pnsym->index][i]);
 		itv_set(res->g[1+p->pnsym->index][i],p->coeff);
@@ -1331,11 +1546,9 @@ t1p_t* t1p_join_global(ap_manager_t* man, bool destructive, t1p_t* a1, t1p_t* a2
 	for (i=1+pr->epssize;i<1+(-1+pr->dim);i++) {
 	    for (j=i+1;j<1+pr->dim;j++) {
 		if (res->g[i] && res->g[j]) {
-		    if (res->g[j][0] && res->g[i][0]) itv_div(pr->itv,tmp,res->g[j][0],res->g[i][0]);
-		    else break;
+		    itv_div(pr->itv,tmp,res->g[j][0],res->g[i][0]);
 		    for (k=1;k<intdim+realdim;) {
-			if (res->g[j][k] && res->g[i][k]) itv_div(pr->itv,tmp1,res->g[j][k],res->g[i][k]);
-			else break;
+			itv_div(pr->itv,tmp1,res->g[j][k],res->g[i][k]);
 			if (itv_is_eq(tmp,tmp1)) k++;
 			else break;
 		    }
@@ -96,6 +96,9 @@ t1p_t* t1p_widening(ap_manager_t* man, t1p_t* a1, t1p_t* a2)
 	itv_t tmp; itv_init(tmp);
 	res = t1p_alloc(man, intdim, realdim);
 	/* update res->box */
+	bool concurrent = man->option.funopt[AP_FUNID_WIDENING].algorithm > 1;
+	size_t* tvar = concurrent ? (size_t*)malloc((intdim+realdim)*sizeof(size_t)) : NULL;
+	size_t size = 0;
 	for (i=0; i<(intdim+realdim); i++) itv_widening(res->box[i], a1->box[i], a2->box[i]);
 	for (i=0; i<(intdim+realdim); i++) {
 	    if (t1p_aff_is_bottom(pr, a1->paf[i])) res->paf[i] = a2->paf[i];
@@ -109,6 +112,11 @@ t1p_t* t1p_widening(ap_manager_t* man, t1p_t* a1, t1p_t* a2)
 		    itv_set(res->paf[i]->c, res->box[i]);
 		} else {
 		    /* join two affine form expressions */
+		    if (concurrent) {
+			/* done by t1p_aff_join_concurrent */
+			tvar[size++] = i;
+			continue;
+		    }
 		    itv_set(a1->paf[i]->itv, a1->box[i]);
 		    itv_set(a2->paf[i]->itv, a2->box[i]);
 		    res->paf[i] = t1p_aff_widening_constrained6(pr, a1->paf[i], a2->paf[i], a1, a2, res);
@@ -116,6 +124,8 @@ t1p_t* t1p_widening(ap_manager_t* man, t1p_t* a1, t1p_t* a2)
 	    }
 	    res->paf[i]->pby++;
 	}
+	if (size) t1p_aff_join_concurrent(man, true, a1, a2, res, tvar, size, NULL);
+	free(tvar);
 	man->result.flag_best = tbool_true;
 	man->result.flag_exact = tbool_top;
 	itv_clear(tmp);
@@ -15,6 +15,11 @@
 /*******************/
 
 int ap_manager_t1p_get_nsym(ap_manager_t* man);
+/* Free the noise symbols which are not referenced by the abstract values of
+   tab, and renumber the other ones, keeping their order. tab should contain
+   all the abstract values still in use, as the other ones become invalid.
+   Return the new number of noise symbols. */
+int ap_manager_t1p_compact_nsym(ap_manager_t* man, ap_abstract0_t** tab, size_t size);
  
 void ap_abstract1_aff_build(ap_manager_t* man, ap_abstract1_t * abstract, ap_var_t var, unsigned int index, ap_interval_t *itv, bool isunion);
 void ap_abstract1_ns_meet_lincons_array(ap_manager_t* man, ap_abstract1_t* abstract1, ap_lincons0_array_t* lincons);
@@ -0,0 +1,348 @@
+/*
+ * arena.c
+ *
+ * Checks the arenas of ../apron/ap_arena.h: alignment, marks, reuse of the
+ * blocks and objects larger than a block; the transient objects of an
+ * arena, read and modified by the usual functions, against the same
+ * objects allocated with malloc; and ap_intlinearize_tcons0_array_arena
+ * (see ../apron/ap_linearize.h) against ap_intlinearize_tcons0_array with
+ * double scalars, as well as the meet of octagons with tree constraints,
+ * which linearizes them in an arena.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "ap_global0.h"
+
+#include "oct.h"
+
+#define DIM 4
+
+static int nerrors = 0;
+
+static void check(bool ok, const char* what)
+{
+  if (!ok){
+    fprintf(stderr,"%s: failed\n",what);
+    nerrors++;
+  }
+}
+
+static bool aligned(void* p)
+{
+  return ((uintptr_t)p & (AP_ARENA_ALIGN-1))==0;
+}
+
+/* ====================================================================== */
+/* Memory management */
+/* ====================================================================== */
+
+static void test_memory(void)
+{
+  int nerrors0 = nerrors;
+  ap_arena_t arena;
+  ap_arena_t* parena;
+  ap_arena_mark_t mark0,mark;
+  char* p[40];
+  char* q;
+  size_t i,size;
+  bool ok;
+
+  ap_arena_init(&arena,256);
+  check(ap_arena_size(&arena)==0,"memory: empty arena");
+  mark0 = ap_arena_mark(&arena);
+
+  /* objects of 1 to 40 bytes, on several blocks, aligned and disjoint */
+  for (i=0; i<40; i++){
+    p[i] = ap_arena_malloc(&arena,i+1);
+    memset(p[i],(int)i,i+1);
+  }
+  ok = true;
+  for (i=0; i<40; i++){
+    size_t j;
+    ok = ok && aligned(p[i]);
+    for (j=0; j<=i; j++) ok = ok && p[i][j]==(char)i;
+  }
+  check(ok,"memory: aligned and disjoint objects");
+  check(ap_arena_size(&arena)>256,"memory: several blocks");
+
+  /* released objects are allocated again at the same addresses, without
+     new blocks */
+  mark = ap_arena_mark(&arena);
+  q = ap_arena_malloc(&arena,100);
+  ap_arena_malloc(&arena,200);
+  ap_arena_release(&arena,mark);
+  check(ap_arena_malloc(&arena,100)==q,"memory: release to a mark");
+  size = ap_arena_size(&arena);
+  ap_arena_release(&arena,mark0);
+  ok = true;
+  for (i=0; i<40; i++) ok = ok && ap_arena_malloc(&arena,i+1)==p[i];
+  check(ok,"memory: release to the mark of the empty arena");
+  ap_arena_reset(&arena);
+  check(ap_arena_malloc(&arena,1)==p[0],"memory: reset");
+  check(ap_arena_size(&arena)==size,"memory: blocks reused");
+
+  /* an object larger than a block gets its own block, which is kept */
+  q = ap_arena_malloc(&arena,1000);
+  memset(q,1,1000);
+  check(aligned(q) && ap_arena_size(&arena)==size+1000,
+	"memory: large object");
+  ap_arena_reset(&arena);
+  ap_arena_malloc(&arena,1);
+  check(ap_arena_malloc(&arena,1000)==q && ap_arena_size(&arena)==size+1000,
+	"memory: large block reused");
+  ap_arena_clear(&arena);
+  check(ap_arena_size(&arena)==0,"memory: clear");
+
+  parena = ap_arena_alloc(0);
+  check(parena->blocksize==4096,"memory: default block size");
+  q = ap_arena_malloc(parena,4096);
+  check(aligned(q) && ap_arena_size(parena)==4096,"memory: exact fit");
+  ap_arena_free(parena);
+  if (nerrors==nerrors0) printf("memory: ok\n");
+}
+
+/* ====================================================================== */
+/* Transient objects */
+/* ====================================================================== */
+
+/* 2.x0 - x1 + [1,3].x3 + 0.5 >= 0 in a dense expression of the arena, and
+   x2 + x3 - 10 >= 0 in a sparse one, against the same constraints built
+   with malloc */
+static void test_objects(void)
+{
+  int nerrors0 = nerrors;
+  ap_arena_t arena;
+  ap_manager_t* man = oct_manager_alloc();
+  ap_lincons0_array_t array,heap;
+  ap_linexpr0_t* e;
+  ap_abstract0_t* top;
+  ap_abstract0_t* a1;
+  ap_abstract0_t* a2;
+  ap_interval_t** tinterval;
+  ap_coeff_t coeff;
+  size_t i;
+  bool ok;
+
+  ap_arena_init(&arena,0);
+
+  /* scalars, intervals and coefficients are doubles equal to 0 */
+  ok = true;
+  tinterval = ap_arena_interval_array_alloc(&arena,DIM);
+  for (i=0; i<DIM; i++){
+    ok = ok && tinterval[i]->inf->discr==AP_SCALAR_DOUBLE &&
+      tinterval[i]->sup->discr==AP_SCALAR_DOUBLE &&
+      ap_scalar_sgn(tinterval[i]->inf)==0 && ap_scalar_sgn(tinterval[i]->sup)==0;
+    ap_interval_set_double(tinterval[i],-(double)i,(double)i);
+  }
+  ok = ok && ap_scalar_equal_int(ap_arena_scalar_alloc_set_double(&arena,2.0),2);
+  ap_arena_coeff_init(&arena,&coeff,AP_COEFF_SCALAR);
+  ok = ok && coeff.discr==AP_COEFF_SCALAR && ap_coeff_zero(&coeff);
+  ap_arena_coeff_reinit(&arena,&coeff,AP_COEFF_INTERVAL);
+  ok = ok && coeff.discr==AP_COEFF_INTERVAL && ap_coeff_zero(&coeff);
+  check(ok,"objects: scalars, intervals and coefficients");
+
+  array = ap_arena_lincons0_array_make(&arena,2);
+  e = ap_arena_linexpr0_alloc(&arena,AP_LINEXPR_DENSE,DIM);
+  ap_coeff_set_scalar_double(&e->p.coeff[0],2.0);
+  ap_coeff_set_scalar_double(&e->p.coeff[1],-1.0);
+  ap_arena_coeff_reinit(&arena,&e->p.coeff[3],AP_COEFF_INTERVAL);
+  ap_coeff_set_interval_double(&e->p.coeff[3],1.0,3.0);
+  ap_coeff_set_scalar_double(&e->cst,0.5);
+  array.p[0].linexpr0 = e;
+  array.p[0].constyp = AP_CONS_SUPEQ;
+  e = ap_arena_linexpr0_alloc(&arena,AP_LINEXPR_SPARSE,2);
+  e->p.linterm[0].dim = 2;
+  ap_coeff_set_scalar_double(&e->p.linterm[0].coeff,1.0);
+  e->p.linterm[1].dim = 3;
+  ap_coeff_set_scalar_double(&e->p.linterm[1].coeff,1.0);
+  ap_coeff_set_scalar_double(&e->cst,-10.0);
+  array.p[1].linexpr0 = e;
+  array.p[1].constyp = AP_CONS_SUPEQ;
+
+  heap = ap_lincons0_array_make(2);
+  e = ap_linexpr0_alloc(AP_LINEXPR_DENSE,DIM);
+  ap_linexpr0_set_list(e,
+		       AP_COEFF_S_DOUBLE,2.0,(ap_dim_t)0,
+		       AP_COEFF_S_DOUBLE,-1.0,(ap_dim_t)1,
+		       AP_COEFF_I_DOUBLE,1.0,3.0,(ap_dim_t)3,
+		       AP_CST_S_DOUBLE,0.5,AP_END);
+  heap.p[0] = ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+  e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_list(e,
+		       AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)2,
+		       AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)3,
+		       AP_CST_S_DOUBLE,-10.0,AP_END);
+  heap.p[1] = ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+
+  ok = true;
+  for (i=0; i<2; i++){
+    ok = ok && ap_linexpr0_equal(array.p[i].linexpr0,heap.p[i].linexpr0);
+  }
+  check(ok,"objects: linear expressions");
+
+  /* the domain reads the constraints of the arena as the other ones */
+  top = ap_abstract0_of_box(man,0,DIM,tinterval);
+  a1 = ap_abstract0_meet_lincons_array(man,false,top,&array);
+  a2 = ap_abstract0_meet_lincons_array(man,false,top,&heap);
+  check(ap_abstract0_is_eq(man,a1,a2) && !ap_abstract0_is_eq(man,a1,top),
+	"objects: meet with constraints");
+  ap_abstract0_free(man,a1);
+  ap_abstract0_free(man,a2);
+  ap_abstract0_free(man,top);
+  ap_lincons0_array_clear(&heap);
+  ap_arena_clear(&arena);
+  ap_manager_free(man);
+  if (nerrors==nerrors0) printf("objects: ok\n");
+}
+
+/* ====================================================================== */
+/* Linearization */
+/* ====================================================================== */
+
+static ap_texpr0_t* dim(ap_dim_t d)
+{
+  return ap_texpr0_dim(d);
+}
+static ap_texpr0_t* binop(ap_texpr_op_t op, ap_texpr0_t* a, ap_texpr0_t* b)
+{
+  return ap_texpr0_binop(op,a,b,AP_RTYPE_REAL,AP_RDIR_NEAREST);
+}
+
+/* Tree constraints with products, divisions, square roots, intervals and
+   float roundings; the last one x3 <= k bounds a dimension, so that the
+   boxization refines it */
+static ap_tcons0_array_t tcons_array(int k)
+{
+  ap_tcons0_array_t array = ap_tcons0_array_make(5);
+
+  array.p[0] = ap_tcons0_make(AP_CONS_SUPEQ,
+    binop(AP_TEXPR_SUB,
+	  binop(AP_TEXPR_MUL,dim(0),dim(1)),
+	  binop(AP_TEXPR_ADD,dim(2),ap_texpr0_cst_interval_double(-1.0,2.5))),
+    NULL);
+  array.p[1] = ap_tcons0_make(AP_CONS_SUPEQ,
+    binop(AP_TEXPR_SUB,
+	  ap_texpr0_cst_scalar_int(20+k),
+	  binop(AP_TEXPR_DIV,
+		binop(AP_TEXPR_ADD,dim(0),dim(3)),
+		ap_texpr0_cst_scalar_int(3))),
+    NULL);
+  array.p[2] = ap_tcons0_make(AP_CONS_SUPEQ,
+    binop(AP_TEXPR_SUB,
+	  ap_texpr0_unop(AP_TEXPR_SQRT,
+			 binop(AP_TEXPR_ADD,dim(1),ap_texpr0_cst_scalar_int(10)),
+			 AP_RTYPE_REAL,AP_RDIR_UP),
+	  dim(2)),
+    NULL);
+  array.p[3] = ap_tcons0_make(AP_CONS_EQ,
+    ap_texpr0_binop(AP_TEXPR_SUB,
+		    binop(AP_TEXPR_MUL,ap_texpr0_cst_scalar_double(0.1),dim(3)),
+		    dim(0),
+		    AP_RTYPE_SINGLE,AP_RDIR_RND),
+    NULL);
+  array.p[4] = ap_tcons0_make(AP_CONS_SUPEQ,
+    binop(AP_TEXPR_SUB,ap_texpr0_cst_scalar_int(k),dim(3)),
+    NULL);
+  return array;
+}
+
+static bool lincons0_equal(ap_lincons0_t* c1, ap_lincons0_t* c2)
+{
+  return
+    c1->constyp==c2->constyp &&
+    ap_linexpr0_equal(c1->linexpr0,c2->linexpr0) &&
+    (c1->scalar==NULL ? c2->scalar==NULL :
+     c2->scalar!=NULL && ap_scalar_equal(c1->scalar,c2->scalar));
+}
+
+/* With the three types of linearization, and with or without boxization,
+   on values where the tree constraints are satisfiable or not, the
+   constraints linearized in an arena are equal to the ones linearized
+   with malloc; the arena is reset between the linearizations, and needs
+   no new block the second time */
+static void test_linearize(void)
+{
+  static const ap_linexpr_type_t types[] = {
+    AP_LINEXPR_INTLINEAR, AP_LINEXPR_QUASILINEAR, AP_LINEXPR_LINEAR
+  };
+  int nerrors0 = nerrors;
+  ap_manager_t* man = oct_manager_alloc();
+  ap_arena_t arena;
+  ap_interval_t** tinterval = ap_interval_array_alloc(DIM);
+  ap_abstract0_t* a;
+  ap_abstract0_t* m1;
+  ap_abstract0_t* m2;
+  ap_tcons0_array_t tarray;
+  ap_lincons0_array_t array1,array2;
+  bool exact1,exact2,boxize,ok,okmeet;
+  size_t i,t,size,nbcons;
+  int k,pass;
+
+  ap_arena_init(&arena,512);
+  for (i=0; i<DIM; i++) ap_interval_set_int(tinterval[i],-(int)i-5,2*(int)i+7);
+  a = ap_abstract0_of_box(man,0,DIM,tinterval);
+  ok = okmeet = true;
+  size = 0;
+  nbcons = 0;
+  for (pass=0; pass<2; pass++){
+    if (pass==1) size = ap_arena_size(&arena);
+    for (k=-12; k<=12; k+=4){
+      tarray = tcons_array(k);
+      for (t=0; t<3; t++){
+	for (boxize=false; ; boxize=true){
+	  ap_arena_reset(&arena);
+	  array1 = ap_intlinearize_tcons0_array(man,a,&tarray,&exact1,
+						AP_SCALAR_DOUBLE,types[t],true,
+						boxize,2,false);
+	  array2 = ap_intlinearize_tcons0_array_arena(man,a,&tarray,&exact2,
+						      &arena,types[t],true,
+						      boxize,2,false);
+	  ok = ok && exact1==exact2 && array1.size==array2.size;
+	  for (i=0; ok && i<array1.size; i++){
+	    ok = lincons0_equal(&array1.p[i],&array2.p[i]);
+	  }
+	  nbcons += array1.size;
+	  ap_lincons0_array_clear(&array1);
+	  if (boxize) break;
+	}
+      }
+      /* oct_meet_tcons_array linearizes in an arena */
+      m1 = ap_abstract0_meet_tcons_array(man,false,a,&tarray);
+      array1 = ap_intlinearize_tcons0_array(man,a,&tarray,NULL,
+					    AP_SCALAR_DOUBLE,
+					    AP_LINEXPR_INTLINEAR,true,true,2,false);
+      m2 = ap_abstract0_meet_lincons_array(man,false,a,&array1);
+      okmeet = okmeet && ap_abstract0_is_eq(man,m1,m2);
+      ap_abstract0_free(man,m1);
+      ap_abstract0_free(man,m2);
+      ap_lincons0_array_clear(&array1);
+      ap_tcons0_array_clear(&tarray);
+    }
+  }
+  check(ok,"linearize: arena and malloc");
+  check(okmeet,"linearize: meet with tree constraints");
+  check(ap_arena_size(&arena)==size,"linearize: blocks reused");
+  ap_arena_clear(&arena);
+  ap_abstract0_free(man,a);
+  ap_interval_array_free(tinterval,DIM);
+  ap_manager_free(man);
+  if (nerrors==nerrors0)
+    printf("linearize: %lu constraints, ok\n",(unsigned long)nbcons);
+}
+
+int main(void)
+{
+  test_memory();
+  test_objects();
+  test_linearize();
+  return nerrors ? 1 : 0;
+}
@@ -0,0 +1,178 @@
+/*
+ * clone.c
+ *
+ * Checks ap_manager_clone_for_thread (see ../apron/ap_manager.h) on box,
+ * oct, optoct and polka: several threads, each one with its own clone,
+ * compute on values created by the original manager, and their results,
+ * freed by the original manager, are equal to the ones computed
+ * sequentially. Taylor1+ does not support cloning.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "ap_global0.h"
+
+#include "box.h"
+#include "oct.h"
+#include "opt_oct.h"
+#include "pk.h"
+#include "t1p.h"
+
+#define NBTHREADS 4
+#define DIM 4
+
+static int nerrors = 0;
+
+/* x(i+1)-x(i)-k >= 0 and x(i) in [-k-10,k+10], with double coefficients,
+   the only ones optoct accepts */
+static ap_abstract0_t* chain(ap_manager_t* man, int k)
+{
+  ap_lincons0_array_t array = ap_lincons0_array_make(3*DIM-1);
+  ap_abstract0_t* res;
+  ap_linexpr0_t* expr;
+  size_t i;
+
+  for (i=0; i<DIM; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_list(expr,AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)i,
+			 AP_CST_S_DOUBLE,(double)(k+10),AP_END);
+    array.p[2*i] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_list(expr,AP_COEFF_S_DOUBLE,-1.0,(ap_dim_t)i,
+			 AP_CST_S_DOUBLE,(double)(k+10),AP_END);
+    array.p[2*i+1] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  }
+  for (i=0; i<DIM-1; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+    ap_linexpr0_set_list(expr,
+			 AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)(i+1),
+			 AP_COEFF_S_DOUBLE,-1.0,(ap_dim_t)i,
+			 AP_CST_S_DOUBLE,(double)-k,AP_END);
+    array.p[2*DIM+i] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  }
+  res = ap_abstract0_of_lincons_array(man,0,DIM,&array);
+  ap_lincons0_array_clear(&array);
+  return res;
+}
+
+/* join(a,b), then x0 := x1+x2+1, then meet with b */
+static ap_abstract0_t* compute(ap_manager_t* man,
+			       ap_abstract0_t* a, ap_abstract0_t* b)
+{
+  ap_linexpr0_t* expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_abstract0_t* res;
+
+  ap_linexpr0_set_list(expr,
+		       AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)1,
+		       AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)2,
+		       AP_CST_S_DOUBLE,1.0,AP_END);
+  res = ap_abstract0_join(man,false,a,b);
+  res = ap_abstract0_assign_linexpr(man,true,res,0,expr,NULL);
+  res = ap_abstract0_meet(man,true,res,b);
+  ap_linexpr0_free(expr);
+  return res;
+}
+
+typedef struct task_t {
+  ap_manager_t* man;  /* clone, used by this thread only */
+  ap_abstract0_t* a;  /* copies of the values of the original manager */
+  ap_abstract0_t* b;
+  ap_abstract0_t* res[2];
+} task_t;
+
+static void* run(void* arg)
+{
+  task_t* task = (task_t*)arg;
+  size_t i;
+  for (i=0; i<2; i++){
+    task->res[i] = compute(task->man,task->a,task->b);
+  }
+  return NULL;
+}
+
+static void test(ap_manager_t* man)
+{
+  const char* library = man->library;
+  ap_abstract0_t* a = chain(man,1);
+  ap_abstract0_t* b = chain(man,2);
+  ap_abstract0_t* res = compute(man,a,b);
+  pthread_t threads[NBTHREADS];
+  task_t tasks[NBTHREADS];
+  size_t t,i;
+  bool ok = true;
+
+  /* oct, optoct and polka close or minimize their arguments on demand: each
+     thread works on its own copies */
+  for (t=0; t<NBTHREADS; t++){
+    tasks[t].man = ap_manager_clone_for_thread(man);
+    if (tasks[t].man==NULL){
+      fprintf(stderr,"%s: clone_for_thread failed\n",library);
+      exit(1);
+    }
+    tasks[t].a = ap_abstract0_copy(man,a);
+    tasks[t].b = ap_abstract0_copy(man,b);
+  }
+  for (t=0; t<NBTHREADS; t++){
+    pthread_create(&threads[t],NULL,&run,&tasks[t]);
+  }
+  for (t=0; t<NBTHREADS; t++){
+    pthread_join(threads[t],NULL);
+  }
+  /* the values computed by the clones are read and freed by man */
+  for (t=0; t<NBTHREADS; t++){
+    for (i=0; i<2; i++){
+      ok = ok && ap_abstract0_is_eq(man,tasks[t].res[i],res);
+      ap_abstract0_free(man,tasks[t].res[i]);
+    }
+    ap_abstract0_free(man,tasks[t].a);
+    ap_abstract0_free(man,tasks[t].b);
+    ap_manager_free(tasks[t].man);
+  }
+  if (!ok){
+    fprintf(stderr,"%s: the clones and the manager give different results\n",
+	    library);
+    nerrors++;
+  }
+  else {
+    printf("%s: ok\n",library);
+  }
+  ap_abstract0_free(man,res);
+  ap_abstract0_free(man,a);
+  ap_abstract0_free(man,b);
+}
+
+int main(void)
+{
+  ap_manager_t* man;
+
+  man = box_manager_alloc();
+  test(man);
+  ap_manager_free(man);
+  man = oct_manager_alloc();
+  test(man);
+  ap_manager_free(man);
+  man = opt_oct_manager_alloc();
+  test(man);
+  ap_manager_free(man);
+  man = pk_manager_alloc(false);
+  test(man);
+  ap_manager_free(man);
+
+  man = t1p_manager_alloc();
+  if (ap_manager_clone_for_thread(man)!=NULL){
+    fprintf(stderr,"Taylor1+: clone_for_thread should fail\n");
+    nerrors++;
+  }
+  else {
+    printf("%s: no clone, ok\n",man->library);
+  }
+  ap_manager_free(man);
+  return nerrors ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * disjunction.c
+ *
+ * Checks that the disjunctive domain (see ../apron/ap_disjunction.h) on oct
+ * and polka gives the same results with and without workers, when join,
+ * join_array and meet exceed the bound on the number of disjuncts and the
+ * inclusion tests between disjuncts are run in several threads.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_global0.h"
+#include "ap_disjunction.h"
+
+#include "oct.h"
+#include "pk.h"
+
+#define NBWORKERS 3
+#define MAXSIZE 3
+
+static int nerrors = 0;
+
+/* [x0inf,x0sup]x[x1inf,x1sup] */
+static ap_abstract0_t* box2(ap_manager_t* man,
+			    int x0inf, int x0sup, int x1inf, int x1sup)
+{
+  ap_interval_t** tinterval = ap_interval_array_alloc(2);
+  ap_abstract0_t* res;
+  ap_interval_set_int(tinterval[0],x0inf,x0sup);
+  ap_interval_set_int(tinterval[1],x1inf,x1sup);
+  res = ap_abstract0_of_box(man,0,2,tinterval);
+  ap_interval_array_free(tinterval,2);
+  return res;
+}
+
+/* Disjunction of the size boxes [x0inf[i],x0inf[i]+w]x[x1inf[i],x1inf[i]+h] */
+static ap_abstract0_t* boxes(ap_manager_t* dman,
+			     int* x0inf, int* x1inf, size_t size, int w, int h)
+{
+  ap_abstract0_t* res = box2(dman,x0inf[0],x0inf[0]+w,x1inf[0],x1inf[0]+h);
+  size_t i;
+  for (i=1; i<size; i++){
+    ap_abstract0_t* b = box2(dman,x0inf[i],x0inf[i]+w,x1inf[i],x1inf[i]+h);
+    ap_abstract0_t* r = ap_abstract0_join(dman,false,res,b);
+    ap_abstract0_free(dman,res);
+    ap_abstract0_free(dman,b);
+    res = r;
+  }
+  return res;
+}
+
+/* Checks that the disjuncts of a1 and a2 are equal, in the same order */
+static void check_equal(const char* test, const char* library,
+			ap_manager_t* man, ap_manager_t* dman,
+			ap_abstract0_t* a1, ap_abstract0_t* a2)
+{
+  void (*absfree)(ap_manager_t*,...) = man->funptr[AP_FUNID_FREE];
+  size_t size1,size2,i;
+  void** p1 = ap_disjunction_decompose(dman,false,a1->value,&size1);
+  void** p2 = ap_disjunction_decompose(dman,false,a2->value,&size2);
+  bool res = size1==size2 && size1<=MAXSIZE;
+
+  for (i=0; i<size1 && i<size2; i++){
+    ap_abstract0_t b1,b2;
+    b1.value = p1[i]; b1.man = man;
+    b2.value = p2[i]; b2.man = man;
+    res = res && ap_abstract0_is_eq(man,&b1,&b2);
+  }
+  for (i=0; i<size1; i++) absfree(man,p1[i]);
+  for (i=0; i<size2; i++) absfree(man,p2[i]);
+  free(p1);
+  free(p2);
+  if (!res){
+    fprintf(stderr,"%s: %s: sequential and parallel results differ\n",
+	    library,test);
+    nerrors++;
+  }
+}
+
+/* Computes op on the arguments with dman, first sequentially and then with
+   the workers, and compares the results */
+#define COMPARE(test,op)					\
+  ap_disjunction_set_workers(dman,NULL,0);			\
+  rs = op;							\
+  ap_disjunction_set_workers(dman,workers,NBWORKERS);		\
+  rp = op;							\
+  check_equal(test,library,man,dman,rs,rp);			\
+  ap_abstract0_free(dman,rs);					\
+  ap_abstract0_free(dman,rp);
+
+/* Sets the algorithm of funid to -1, so that is_bottom and is_top do not
+   compute the closure of octagons and the generators of polyhedra: the
+   disjuncts reach the inclusion tests in their lazy form */
+static void set_lazy(ap_manager_t* man, ap_funid_t funid)
+{
+  ap_funopt_t funopt = ap_manager_get_funopt(man,funid);
+  funopt.algorithm = -1;
+  ap_manager_set_funopt(man,funid,&funopt);
+}
+
+static void test(ap_manager_t* man, ap_manager_t** workers)
+{
+  const char* library = man->library;
+  ap_manager_t* dman = ap_disjunction_manager_alloc(man,NULL);
+  /* a: 4 squares, the last one included in the first one; b: 4 overlapping
+     rectangles, the third one included in the second one; c: 3 squares */
+  int ax0[] = {0,4,8,1}, ax1[] = {0,4,8,1};
+  int bx0[] = {1,2,3,6}, bx1[] = {-1,1,2,0};
+  int cx0[] = {0,3,6}, cx1[] = {6,3,0};
+  ap_abstract0_t *a,*b,*c,*rs,*rp;
+  ap_abstract0_t* tab[3];
+
+  set_lazy(man,AP_FUNID_IS_BOTTOM);
+  set_lazy(man,AP_FUNID_IS_TOP);
+  a = boxes(dman,ax0,ax1,4,2,2);
+  b = boxes(dman,bx0,bx1,4,4,4);
+  c = boxes(dman,cx0,cx1,3,1,1);
+  tab[0] = a; tab[1] = b; tab[2] = c;
+  ap_disjunction_set_maxsize(dman,MAXSIZE);
+
+  COMPARE("join",ap_abstract0_join(dman,false,a,b));
+  COMPARE("join_array",ap_abstract0_join_array(dman,tab,3));
+  COMPARE("meet",ap_abstract0_meet(dman,false,a,b));
+
+  ap_abstract0_free(dman,a);
+  ap_abstract0_free(dman,b);
+  ap_abstract0_free(dman,c);
+  ap_manager_free(dman);
+  printf("%s: done\n",library);
+}
+
+int main(void)
+{
+  ap_manager_t* man;
+  ap_manager_t* workers[NBWORKERS];
+  size_t i;
+
+  man = oct_manager_alloc();
+  for (i=0; i<NBWORKERS; i++) workers[i] = oct_manager_alloc();
+  test(man,workers);
+  for (i=0; i<NBWORKERS; i++) ap_manager_free(workers[i]);
+  ap_manager_free(man);
+
+  man = pk_manager_alloc(false);
+  for (i=0; i<NBWORKERS; i++) workers[i] = pk_manager_alloc(false);
+  test(man,workers);
+  for (i=0; i<NBWORKERS; i++) ap_manager_free(workers[i]);
+  ap_manager_free(man);
+  return nerrors ? 1 : 0;
+}
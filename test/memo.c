@@ -0,0 +1,182 @@
+/*
+ * memo.c
+ *
+ * Checks the memo manager (see ../apron/ap_memo.h) on box and polka: cache
+ * hits, LRU eviction, sharing of equal results, widenings left out of the
+ * cache, and freeing of values referenced by the cache.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_global0.h"
+#include "ap_memo.h"
+
+#include "box.h"
+#include "pk.h"
+
+static int nerrors = 0;
+
+#define CHECK(test,cond)						\
+  if (!(cond)){								\
+    fprintf(stderr,"%s: %s: %s failed\n",library,test,#cond);		\
+    nerrors++;								\
+  }
+
+/* [x0inf,x0sup]x[x1inf,x1sup] */
+static ap_abstract0_t* box2(ap_manager_t* man,
+			    int x0inf, int x0sup, int x1inf, int x1sup)
+{
+  ap_interval_t** tinterval = ap_interval_array_alloc(2);
+  ap_abstract0_t* res;
+  ap_interval_set_int(tinterval[0],x0inf,x0sup);
+  ap_interval_set_int(tinterval[1],x1inf,x1sup);
+  res = ap_abstract0_of_box(man,0,2,tinterval);
+  ap_interval_array_free(tinterval,2);
+  return res;
+}
+
+/* Value of the memo domain wrapped by a */
+static ap_memo_t* memo(ap_abstract0_t* a)
+{
+  return (ap_memo_t*)a->value;
+}
+
+/* Checks that a (memo) is equal to b (underlying) */
+static bool same(ap_manager_t* mman, ap_manager_t* man,
+		 ap_abstract0_t* a, ap_abstract0_t* b)
+{
+  ap_abstract0_t c;
+  c.value = ap_memo_decompose(mman,false,memo(a));
+  c.man = man;
+  bool res = ap_abstract0_is_eq(man,&c,b);
+  {
+    void (*absfree)(ap_manager_t*,...) = man->funptr[AP_FUNID_FREE];
+    absfree(man,c.value);
+  }
+  return res;
+}
+
+static void test(ap_manager_t* man)
+{
+  const char* library = man->library;
+  ap_manager_t* mman = ap_memo_manager_alloc(man);
+  ap_abstract0_t *a,*b,*c,*d,*j1,*j2,*j3,*m,*w1,*w2,*ua,*ub,*uj,*uw;
+  ap_memo_stat_t stat,stat2;
+
+  a = box2(mman,0,1,0,1);
+  b = box2(mman,2,3,-1,0);
+  c = box2(mman,0,1,0,1);
+  d = box2(mman,5,6,5,6);
+  ua = box2(man,0,1,0,1);
+  ub = box2(man,2,3,-1,0);
+  uj = ap_abstract0_join(man,false,ua,ub);
+  uw = ap_abstract0_widening(man,ua,uj);
+
+  /* cache hits, join being commutative */
+  j1 = ap_abstract0_join(mman,false,a,b);
+  stat = ap_memo_get_stat(mman);
+  j2 = ap_abstract0_join(mman,false,b,a);
+  stat2 = ap_memo_get_stat(mman);
+  CHECK("hit",stat2.hits==stat.hits+1);
+  CHECK("hit",memo(j1)==memo(j2));
+  CHECK("hit",same(mman,man,j1,uj) && same(mman,man,j2,uj));
+
+  /* a and c are equal: they get the same identifier, and the result of
+     join(a,c), equal to a, is shared with a */
+  j3 = ap_abstract0_join(mman,false,a,c);
+  stat = ap_memo_get_stat(mman);
+  CHECK("sharing",memo(a)->id!=0 && memo(a)->id==memo(c)->id);
+  CHECK("sharing",memo(j3)==memo(a));
+  CHECK("sharing",stat.shared>=1);
+  CHECK("sharing",ap_abstract0_is_leq(mman,c,a));
+  ap_abstract0_free(mman,j3);
+
+  /* the widening is neither cached nor shared */
+  stat = ap_memo_get_stat(mman);
+  w1 = ap_abstract0_widening(mman,a,j1);
+  w2 = ap_abstract0_widening(mman,a,j1);
+  stat2 = ap_memo_get_stat(mman);
+  CHECK("widening",stat2.hits==stat.hits && stat2.misses==stat.misses);
+  CHECK("widening",stat2.entries==stat.entries);
+  CHECK("widening",memo(w1)!=memo(w2) && memo(w1)->id==0);
+  CHECK("widening",same(mman,man,w1,uw) && same(mman,man,w2,uw));
+  ap_abstract0_free(mman,w1);
+  ap_abstract0_free(mman,w2);
+
+  /* the cached result survives the free of the values returned to the
+     user, and is returned again */
+  ap_abstract0_free(mman,j1);
+  ap_abstract0_free(mman,j2);
+  j1 = ap_abstract0_join(mman,false,a,b);
+  stat2 = ap_memo_get_stat(mman);
+  CHECK("free",stat2.hits==stat.hits+1);
+  CHECK("free",same(mman,man,j1,uj));
+
+  /* LRU eviction, with at most 2 entries: join(a,b) is the oldest one after
+     meet(a,d) and join(c,d) */
+  ap_memo_set_bounds(mman,2,0);
+  ap_abstract0_free(mman,j1);
+  j1 = ap_abstract0_join(mman,false,a,b);
+  m = ap_abstract0_meet(mman,false,a,d);
+  j2 = ap_abstract0_join(mman,false,c,d);
+  stat = ap_memo_get_stat(mman);
+  CHECK("lru",stat.entries==2 && stat.evictions>=1);
+  ap_abstract0_free(mman,j2);
+  j2 = ap_abstract0_join(mman,false,d,c);
+  stat2 = ap_memo_get_stat(mman);
+  CHECK("lru",stat2.hits==stat.hits+1);
+  ap_abstract0_free(mman,j1);
+  j1 = ap_abstract0_join(mman,false,a,b);
+  stat = ap_memo_get_stat(mman);
+  CHECK("lru",stat.misses==stat2.misses+1);
+  CHECK("lru",same(mman,man,j1,uj));
+  CHECK("lru",ap_abstract0_is_bottom(mman,m));
+
+  /* a destructive operation on a shared value copies it */
+  j3 = ap_abstract0_copy(mman,a);
+  j3 = ap_abstract0_join(mman,true,j3,d);
+  CHECK("destructive",same(mman,man,a,ua));
+
+  /* freeing the values before emptying the cache, and the cache before the
+     manager */
+  ap_abstract0_free(mman,j3);
+  ap_abstract0_free(mman,m);
+  ap_abstract0_free(mman,j1);
+  ap_abstract0_free(mman,j2);
+  ap_abstract0_free(mman,a);
+  ap_abstract0_free(mman,b);
+  ap_abstract0_free(mman,c);
+  ap_memo_clear(mman);
+  stat = ap_memo_get_stat(mman);
+  CHECK("clear",stat.entries==0 && stat.size==0);
+  CHECK("clear",stat.values==1);
+  ap_abstract0_free(mman,d);
+  stat = ap_memo_get_stat(mman);
+  CHECK("clear",stat.values==0);
+
+  ap_abstract0_free(man,ua);
+  ap_abstract0_free(man,ub);
+  ap_abstract0_free(man,uj);
+  ap_abstract0_free(man,uw);
+  ap_manager_free(mman);
+  printf("%s: done\n",library);
+}
+
+int main(void)
+{
+  ap_manager_t* man;
+
+  man = box_manager_alloc();
+  test(man);
+  ap_manager_free(man);
+  man = pk_manager_alloc(false);
+  test(man);
+  ap_manager_free(man);
+  return nerrors ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+(** Test the bigarray conversions of Abstract0, Box and Oct against
+    Abstract0.to_box and Abstract0.to_lincons_array, with the libraries boxD
+    and octD *)
+
+open Format;;
+open Apron;;
+
+let nbfail = ref 0;;
+let check name b =
+  if not b then begin
+    incr nbfail;
+    printf "FAILED: %s@." name
+  end
+;;
+
+let equal_float x s = Scalar.equal (Scalar.of_float x) s;;
+
+(* -x0-x1+4>=0, x2-1=0, x0-0.5>0 *)
+let typ = [| Lincons0.SUPEQ; Lincons0.EQ; Lincons0.SUP |];;
+let coeffs = [|
+  [| -1.0; -1.0; 0.0; 4.0 |];
+  [| 0.0; 0.0; 1.0; -1.0 |];
+  [| 1.0; 0.0; 0.0; -0.5 |];
+|];;
+(* x0-5>=0, empty with the box below *)
+let typ_bot = [| Lincons0.SUPEQ |];;
+let coeffs_bot = [| [| 1.0; 0.0; 0.0; -5.0 |] |];;
+
+let matrix_of_array coeffs =
+  Bigarray.Array2.of_array Bigarray.float64 Bigarray.c_layout coeffs
+;;
+let lincons_array_of_array typ coeffs =
+  Array.mapi
+    (begin fun i row ->
+      let n = Array.length row - 1 in
+      let expr =
+	Linexpr0.of_array (Some n)
+	  (Array.init n (fun j -> (Coeff.s_of_float row.(j), j)))
+	  (Some (Coeff.s_of_float row.(n)))
+      in
+      Lincons0.make expr typ.(i)
+    end)
+    coeffs
+;;
+
+(* to_box_bigarray against to_box *)
+let check_box man name abs =
+  let box = Abstract0.to_box man abs in
+  let ba = Abstract0.to_box_bigarray man abs in
+  check (name^": to_box_bigarray dimensions")
+    (Bigarray.Array2.dim1 ba = Array.length box && Bigarray.Array2.dim2 ba = 2);
+  Array.iteri
+    (begin fun k itv ->
+      check (name^": to_box_bigarray inf") (equal_float ba.{k,0} itv.Interval.inf);
+      check (name^": to_box_bigarray sup") (equal_float ba.{k,1} itv.Interval.sup);
+    end)
+    box;
+  if Abstract0.is_bottom man abs then
+    check (name^": to_box_bigarray of bottom")
+      (Array.length box = 0 || ba.{0,0} > ba.{0,1})
+;;
+
+(* meet_lincons_bigarray(_with) against meet_lincons_array *)
+let check_meet man name abs typ coeffs =
+  let mat = matrix_of_array coeffs in
+  let res = Abstract0.meet_lincons_bigarray man abs typ mat in
+  let res2 = Abstract0.meet_lincons_array man abs (lincons_array_of_array typ coeffs) in
+  check (name^": meet_lincons_bigarray") (Abstract0.is_eq man res res2);
+  check (name^": to_lincons_array")
+    (Array.length (Abstract0.to_lincons_array man res) =
+      Array.length (Abstract0.to_lincons_array man res2));
+  let res3 = Abstract0.copy man abs in
+  Abstract0.meet_lincons_bigarray_with man res3 typ mat;
+  check (name^": meet_lincons_bigarray_with") (Abstract0.is_eq man res3 res2);
+  check_box man name res;
+  res
+;;
+
+let make man =
+  Abstract0.of_box man 1 2 [|
+    Interval.of_float (-1.5) 2.0;
+    Interval.of_scalar (Scalar.of_float 3.0) (Scalar.of_infty 1);
+    Interval.top;
+  |]
+;;
+
+let test_box () =
+  let man = Box.manager_alloc () in
+  let check_view name abs =
+    let box = Abstract0.to_box man abs in
+    match Box.to_bigarray man abs with
+    | None -> check (name^": Box.to_bigarray of bottom") (Abstract0.is_bottom man abs)
+    | Some ba ->
+	Array.iteri
+	  (begin fun k itv ->
+	    check (name^": Box.to_bigarray inf") (equal_float (-. ba.{k,0}) itv.Interval.inf);
+	    check (name^": Box.to_bigarray sup") (equal_float ba.{k,1} itv.Interval.sup);
+	  end)
+	  box
+  in
+  let abs = make man in
+  check_box man "box" abs;
+  check_view "box" abs;
+  let res = check_meet man "box" abs typ coeffs in
+  check_view "box meet" res;
+  let bot = check_meet man "box bottom" abs typ_bot coeffs_bot in
+  check "box bottom: is_bottom" (Abstract0.is_bottom man bot);
+  check "box bottom: Box.to_bigarray" (Box.to_bigarray man bot = None);
+  let bot = Abstract0.bottom man 1 2 in
+  check_box man "box bottom" bot;
+  check "box bottom: Box.to_bigarray" (Box.to_bigarray man bot = None)
+;;
+
+let test_oct () =
+  let man = Oct.manager_alloc () in
+  let check_view name abs =
+    let box = Abstract0.to_box man abs in
+    match Oct.to_bigarray man abs with
+    | None -> check (name^": Oct.to_bigarray of bottom") (Abstract0.is_bottom man abs)
+    | Some ba ->
+	let n = Array.length box in
+	check (name^": Oct.to_bigarray dimension")
+	  (Bigarray.Array1.dim ba = 2*n*(n+1));
+	let elt i j = ba.{j+(i+1)*(i+1)/2} in
+	Array.iteri
+	  (begin fun k itv ->
+	    check (name^": Oct.to_bigarray inf")
+	      (equal_float (-. (elt (2*k) (2*k+1)) /. 2.0) itv.Interval.inf);
+	    check (name^": Oct.to_bigarray sup")
+	      (equal_float ((elt (2*k+1) (2*k)) /. 2.0) itv.Interval.sup);
+	  end)
+	  box
+  in
+  let abs = make man in
+  check_box man "oct" abs;
+  check_view "oct" abs;
+  let res = check_meet man "oct" abs typ coeffs in
+  check_view "oct meet" res;
+  let bot = check_meet man "oct bottom" abs typ_bot coeffs_bot in
+  check "oct bottom: is_bottom" (Abstract0.is_bottom man bot);
+  check "oct bottom: Oct.to_bigarray" (Oct.to_bigarray man bot = None)
+;;
+
+let _ =
+  test_box ();
+  test_oct ();
+  Gc.full_major ();
+  if !nbfail = 0 then printf "mlbigarray: OK@."
+  else begin
+    printf "mlbigarray: %d failures@." !nbfail;
+    exit 1
+  end
+;;
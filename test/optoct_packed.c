@@ -0,0 +1,316 @@
+/*
+ * optoct_packed.c
+ *
+ * Checks the component-packed storage of optoctagons (see
+ * ../optoctagons/opt_oct.h): the operations of a packed manager give the
+ * same results as the ones of an unpacked manager on the same octagons, and
+ * the queries and non-destructive operations leave their packed arguments
+ * unchanged.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ap_global0.h"
+
+#include "opt_oct.h"
+#include "opt_oct_internal.h"
+
+#define DIM 24
+#define GROUP 3
+
+static int nerrors = 0;
+
+#define CHECK(test,cond)						\
+  if (!(cond)){								\
+    fprintf(stderr,"%s: %s failed\n",test,#cond);			\
+    nerrors++;								\
+  }
+
+/* x(i)-x(j)+cst >= 0 (x(i)+cst >= 0 if j<0), with double coefficients, the
+   only ones optoctagons accept */
+static ap_lincons0_t cons(int i, int j, double cst)
+{
+  ap_linexpr0_t* e = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,j<0 ? 1 : 2);
+  if (j<0)
+    ap_linexpr0_set_list(e,AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)i,
+			 AP_CST_S_DOUBLE,cst,AP_END);
+  else
+    ap_linexpr0_set_list(e,AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)i,
+			 AP_COEFF_S_DOUBLE,-1.0,(ap_dim_t)j,
+			 AP_CST_S_DOUBLE,cst,AP_END);
+  return ap_lincons0_make(AP_CONS_SUPEQ,e,NULL);
+}
+
+/* Random constraints linking the variables of the groups of GROUP
+   consecutive variables starting at a multiple of step */
+static ap_lincons0_array_t random_cons(int step)
+{
+  ap_lincons0_array_t array = ap_lincons0_array_make(2*DIM);
+  size_t k;
+  for (k=0; k<array.size; k++){
+    int g = (rand()%(DIM/step))*step;
+    int i = g + rand()%GROUP;
+    int j = g + rand()%GROUP;
+    array.p[k] = cons(i, i==j ? -1 : j, (double)(rand()%11));
+  }
+  return array;
+}
+
+/* Octagons built from the same constraints by the two managers */
+static void random_oct(ap_manager_t* mu, ap_manager_t* mp, int step,
+		       ap_abstract0_t** au, ap_abstract0_t** ap)
+{
+  ap_lincons0_array_t array = random_cons(step);
+  *au = ap_abstract0_meet_lincons_array(mu,true,ap_abstract0_top(mu,0,DIM),&array);
+  *ap = ap_abstract0_meet_lincons_array(mp,true,ap_abstract0_top(mp,0,DIM),&array);
+  ap_lincons0_array_clear(&array);
+}
+
+static bool is_packed(ap_abstract0_t* a)
+{
+  opt_oct_t* o = opt_oct_of_abstract0(a);
+  return (o->m && !o->m->mat) || (o->closed && !o->closed->mat);
+}
+
+/* State of a matrix of a packed octagon */
+typedef struct snapshot_mat_t {
+  opt_oct_mat_t* oo;
+  double* mat;
+  double* packed;
+  double* content;
+  size_t size;
+} snapshot_mat_t;
+
+/* State of the matrices of a packed octagon */
+typedef struct snapshot_t {
+  snapshot_mat_t m;
+  snapshot_mat_t closed;
+} snapshot_t;
+
+static size_t packed_size(opt_oct_mat_t* oo)
+{
+  size_t size = 0;
+  comp_list_t* cl;
+  for (cl=oo->acl->head; cl!=NULL; cl=cl->next)
+    size += opt_matsize(cl->size);
+  return size;
+}
+
+static void snapshot_mat(snapshot_mat_t* s, opt_oct_mat_t* oo)
+{
+  s->oo = oo;
+  s->mat = oo ? oo->mat : NULL;
+  s->packed = oo ? oo->packed : NULL;
+  s->size = oo && !oo->mat ? packed_size(oo) : 0;
+  s->content = malloc((s->size+1)*sizeof(double));
+  if (s->size) memcpy(s->content,s->packed,s->size*sizeof(double));
+}
+
+static bool unchanged_mat(snapshot_mat_t* s, opt_oct_mat_t* oo)
+{
+  bool res =
+    oo==s->oo &&
+    (!oo || (oo->mat==s->mat && oo->packed==s->packed &&
+	     (s->size==0 ||
+	      memcmp(oo->packed,s->content,s->size*sizeof(double))==0)));
+  free(s->content);
+  return res;
+}
+
+static void snapshot(snapshot_t* s, ap_abstract0_t* a)
+{
+  opt_oct_t* o = opt_oct_of_abstract0(a);
+  snapshot_mat(&s->m,o->m);
+  snapshot_mat(&s->closed,o->closed);
+}
+
+static bool unchanged(snapshot_t* s, ap_abstract0_t* a)
+{
+  opt_oct_t* o = opt_oct_of_abstract0(a);
+  bool res = unchanged_mat(&s->m,o->m);
+  return unchanged_mat(&s->closed,o->closed) && res;
+}
+
+/* Checks that ru (computed by mu) and rp (computed by mp) are equal */
+static void check_eq(const char* test, ap_manager_t* mu, ap_manager_t* mp,
+		     ap_abstract0_t* ru, ap_abstract0_t* rp)
+{
+  ap_interval_t** bu = ap_abstract0_to_box(mu,ru);
+  ap_interval_t** bp = ap_abstract0_to_box(mp,rp);
+  bool res = ap_abstract0_is_eq(mp,ru,rp);
+  size_t i;
+  for (i=0; i<DIM; i++) res = res && ap_interval_equal(bu[i],bp[i]);
+  ap_interval_array_free(bu,DIM);
+  ap_interval_array_free(bp,DIM);
+  CHECK(test,res);
+}
+
+static void test(ap_manager_t* mu, ap_manager_t* mp)
+{
+  ap_abstract0_t *au[3],*ap[3],*ru,*rp;
+  ap_lincons0_array_t array;
+  ap_linexpr0_t* expr;
+  ap_dim_t tdim[2] = {1,4};
+  ap_dimchange_t* dimchange;
+  ap_interval_t* itv;
+  snapshot_t s0,s1;
+  size_t k;
+
+  /* groups of 3 variables in the first two octagons, and of 6 in the last
+     one */
+  random_oct(mu,mp,GROUP,&au[0],&ap[0]);
+  random_oct(mu,mp,GROUP,&au[1],&ap[1]);
+  random_oct(mu,mp,2*GROUP,&au[2],&ap[2]);
+  for (k=0; k<3; k++){
+    CHECK("packed",ap_abstract0_is_bottom(mp,ap[k]) || is_packed(ap[k]));
+    CHECK("packed",!is_packed(au[k]));
+  }
+
+  /* queries */
+  snapshot(&s0,ap[0]);
+  snapshot(&s1,ap[1]);
+  CHECK("is_bottom",ap_abstract0_is_bottom(mu,au[0])==ap_abstract0_is_bottom(mp,ap[0]));
+  CHECK("is_top",ap_abstract0_is_top(mu,au[0])==ap_abstract0_is_top(mp,ap[0]));
+  CHECK("is_leq",ap_abstract0_is_leq(mu,au[0],au[1])==ap_abstract0_is_leq(mp,ap[0],ap[1]));
+  CHECK("is_eq",ap_abstract0_is_eq(mu,au[0],au[1])==ap_abstract0_is_eq(mp,ap[0],ap[1]));
+  CHECK("is_dimension_unconstrained",
+	ap_abstract0_is_dimension_unconstrained(mu,au[0],DIM-1)==
+	ap_abstract0_is_dimension_unconstrained(mp,ap[0],DIM-1));
+  itv = ap_interval_alloc();
+  ap_interval_set_double(itv,0.0,5.0);
+  CHECK("sat_interval",ap_abstract0_sat_interval(mu,au[0],2,itv)==
+	ap_abstract0_sat_interval(mp,ap[0],2,itv));
+  ap_interval_free(itv);
+  {
+    ap_lincons0_t c = cons(0,1,3);
+    CHECK("sat_lincons",ap_abstract0_sat_lincons(mu,au[0],&c)==
+	  ap_abstract0_sat_lincons(mp,ap[0],&c));
+    ap_lincons0_clear(&c);
+  }
+  {
+    ap_interval_t* iu = ap_abstract0_bound_dimension(mu,au[0],1);
+    ap_interval_t* ip = ap_abstract0_bound_dimension(mp,ap[0],1);
+    CHECK("bound_dimension",ap_interval_equal(iu,ip));
+    ap_interval_free(iu);
+    ap_interval_free(ip);
+  }
+  {
+    ap_lincons0_array_t cu = ap_abstract0_to_lincons_array(mu,au[0]);
+    ap_lincons0_array_t cp = ap_abstract0_to_lincons_array(mp,ap[0]);
+    /* the constraints are read from equal matrices in the same order */
+    bool res = cu.size==cp.size;
+    for (k=0; res && k<cu.size; k++)
+      res = cu.p[k].constyp==cp.p[k].constyp &&
+	ap_linexpr0_compare(cu.p[k].linexpr0,cp.p[k].linexpr0)==0;
+    CHECK("to_lincons_array",res);
+    ap_lincons0_array_clear(&cu);
+    ap_lincons0_array_clear(&cp);
+  }
+  CHECK("hash",ap_abstract0_hash(mu,au[0])==ap_abstract0_hash(mp,ap[0]));
+  CHECK("queries",unchanged(&s0,ap[0]));
+  CHECK("queries",unchanged(&s1,ap[1]));
+
+  /* non-destructive operations */
+  snapshot(&s0,ap[0]);
+  snapshot(&s1,ap[1]);
+
+  ru = ap_abstract0_meet(mu,false,au[0],au[1]);
+  rp = ap_abstract0_meet(mp,false,ap[0],ap[1]);
+  check_eq("meet",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  ru = ap_abstract0_join(mu,false,au[0],au[1]);
+  rp = ap_abstract0_join(mp,false,ap[0],ap[1]);
+  check_eq("join",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  ru = ap_abstract0_join_array(mu,au,3);
+  rp = ap_abstract0_join_array(mp,ap,3);
+  check_eq("join_array",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  ru = ap_abstract0_meet_array(mu,au,3);
+  rp = ap_abstract0_meet_array(mp,ap,3);
+  check_eq("meet_array",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  ru = ap_abstract0_widening(mu,au[0],au[1]);
+  rp = ap_abstract0_widening(mp,ap[0],ap[1]);
+  check_eq("widening",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  array = ap_lincons0_array_make(1);
+  array.p[0] = cons(2,3,-1);
+  ru = ap_abstract0_meet_lincons_array(mu,false,au[0],&array);
+  rp = ap_abstract0_meet_lincons_array(mp,false,ap[0],&array);
+  check_eq("meet_lincons_array",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+  ap_lincons0_array_clear(&array);
+
+  expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+  ap_linexpr0_set_list(expr,AP_COEFF_S_DOUBLE,1.0,(ap_dim_t)7,AP_CST_S_DOUBLE,2.0,AP_END);
+  ru = ap_abstract0_assign_linexpr(mu,false,au[0],1,expr,NULL);
+  rp = ap_abstract0_assign_linexpr(mp,false,ap[0],1,expr,NULL);
+  check_eq("assign_linexpr",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+  ap_linexpr0_free(expr);
+
+  ru = ap_abstract0_forget_array(mu,false,au[0],tdim,2,false);
+  rp = ap_abstract0_forget_array(mp,false,ap[0],tdim,2,false);
+  check_eq("forget_array",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  ru = ap_abstract0_closure(mu,false,au[0]);
+  rp = ap_abstract0_closure(mp,false,ap[0]);
+  check_eq("closure",mu,mp,ru,rp);
+  ap_abstract0_free(mu,ru); ap_abstract0_free(mp,rp);
+
+  dimchange = ap_dimchange_alloc(0,1);
+  dimchange->dim[0] = 5;
+  ru = ap_abstract0_remove_dimensions(mu,false,au[0],dimchange);
+  rp = ap_abstract0_remove_dimensions(mp,false,ap[0],dimchange);
+  {
+    ap_abstract0_t* eu = ap_abstract0_add_dimensions(mu,true,ru,dimchange,false);
+    ap_abstract0_t* ep = ap_abstract0_add_dimensions(mp,true,rp,dimchange,false);
+    check_eq("remove/add_dimensions",mu,mp,eu,ep);
+    ap_abstract0_free(mu,eu); ap_abstract0_free(mp,ep);
+  }
+  ap_dimchange_free(dimchange);
+
+  CHECK("operations",unchanged(&s0,ap[0]));
+  CHECK("operations",unchanged(&s1,ap[1]));
+
+  /* destructive operation */
+  ru = ap_abstract0_meet(mu,true,au[0],au[1]);
+  rp = ap_abstract0_meet(mp,true,ap[0],ap[1]);
+  check_eq("destructive meet",mu,mp,ru,rp);
+  CHECK("destructive meet",ap_abstract0_is_bottom(mp,rp) || is_packed(rp));
+  au[0] = ru; ap[0] = rp;
+
+  for (k=0; k<3; k++){
+    ap_abstract0_free(mu,au[k]);
+    ap_abstract0_free(mp,ap[k]);
+  }
+}
+
+int main(void)
+{
+  ap_manager_t* mu = opt_oct_manager_alloc();
+  ap_manager_t* mp = opt_oct_manager_alloc();
+  int n;
+
+  opt_oct_set_packed(mp,true);
+  srand(41);
+  for (n=0; n<50; n++) test(mu,mp);
+  printf("optoct packed: %d errors\n",nerrors);
+  ap_manager_free(mu);
+  ap_manager_free(mp);
+  return nerrors ? 1 : 0;
+}
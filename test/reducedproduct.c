@@ -0,0 +1,266 @@
+/*
+ * reducedproduct.c
+ *
+ * Checks the parallel option of the reduced product (see
+ * ../apron/ap_reducedproduct.h) on the product of box and polka: the same
+ * operations, on a product with the option set and on one without it,
+ * each one with its own component managers, give the same components and
+ * the same tests, including when a meet gives bottom. The option is refused
+ * when the components share their manager. The test reads the components
+ * of the products.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_global0.h"
+#include "ap_reducedproduct.h"
+
+#include "box.h"
+#include "pk.h"
+
+#define DIM 4
+#define NBRUNS 4
+
+static int nerrors = 0;
+
+/* Meets the box with the bounds of the polyhedron, and the polyhedron with
+   the constraints of the box */
+static void reduce(ap_manager_t* manager, ap_reducedproduct_t* a)
+{
+  ap_reducedproduct_internal_t* intern =
+    (ap_reducedproduct_internal_t*)manager->internal;
+  ap_manager_t* manbox = intern->tmanagers[0];
+  ap_manager_t* manpoly = intern->tmanagers[1];
+  box_t* box = (box_t*)a->p[0];
+  pk_t* poly = (pk_t*)a->p[1];
+  ap_dimension_t dimension = pk_dimension(manpoly,poly);
+  ap_interval_t** tinterval;
+  ap_lincons0_array_t array;
+  box_t* box2;
+
+  if (!box_is_bottom(manbox,box) && !pk_is_bottom(manpoly,poly)){
+    tinterval = pk_to_box(manpoly,poly);
+    box2 = box_of_box(manbox,dimension.intdim,dimension.realdim,tinterval);
+    box = box_meet(manbox,true,box,box2);
+    box_free(manbox,box2);
+    ap_interval_array_free(tinterval,dimension.intdim+dimension.realdim);
+    array = box_to_lincons_array(manbox,box);
+    poly = pk_meet_lincons_array(manpoly,true,poly,&array);
+    ap_lincons0_array_clear(&array);
+  }
+  if (box_is_bottom(manbox,box) || pk_is_bottom(manpoly,poly)){
+    box_free(manbox,box);
+    pk_free(manpoly,poly);
+    box = box_bottom(manbox,dimension.intdim,dimension.realdim);
+    poly = pk_bottom(manpoly,dimension.intdim,dimension.realdim);
+  }
+  a->p[0] = box;
+  a->p[1] = poly;
+  a->reduced = true;
+}
+
+static ap_manager_t* product_alloc(bool parallel)
+{
+  ap_manager_t* tab[2];
+  ap_manager_t* man;
+
+  tab[0] = box_manager_alloc();
+  tab[1] = pk_manager_alloc(false);
+  man = ap_reducedproduct_manager_alloc("box x polka",tab,2,&reduce,NULL);
+  ap_manager_free(tab[0]);
+  ap_manager_free(tab[1]);
+  if (ap_reducedproduct_set_parallel(man,parallel)!=parallel){
+    fprintf(stderr,"set_parallel(%d) failed\n",(int)parallel);
+    exit(1);
+  }
+  return man;
+}
+
+/* x(i+1)-x(i) >= k and x(i) in [-10-k,10+k] */
+static ap_abstract0_t* chain(ap_manager_t* man, int k)
+{
+  ap_lincons0_array_t array = ap_lincons0_array_make(3*DIM-1);
+  ap_abstract0_t* res;
+  ap_linexpr0_t* expr;
+  size_t i;
+
+  for (i=0; i<DIM; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_list(expr,AP_COEFF_S_INT,1,(ap_dim_t)i,
+			 AP_CST_S_INT,10+k,AP_END);
+    array.p[2*i] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+    ap_linexpr0_set_list(expr,AP_COEFF_S_INT,-1,(ap_dim_t)i,
+			 AP_CST_S_INT,10+k,AP_END);
+    array.p[2*i+1] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  }
+  for (i=0; i<DIM-1; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+    ap_linexpr0_set_list(expr,
+			 AP_COEFF_S_INT,1,(ap_dim_t)(i+1),
+			 AP_COEFF_S_INT,-1,(ap_dim_t)i,
+			 AP_CST_S_INT,-k,AP_END);
+    array.p[2*DIM+i] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  }
+  res = ap_abstract0_of_lincons_array(man,0,DIM,&array);
+  ap_lincons0_array_clear(&array);
+  return res;
+}
+
+/* c.x(d) >= cst, with a singleton interval coefficient, which the product
+   reduces before the components read it */
+static ap_lincons0_array_t bound(ap_dim_t d, int c, int cst)
+{
+  ap_lincons0_array_t array = ap_lincons0_array_make(1);
+  ap_linexpr0_t* expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+  ap_linexpr0_set_list(expr,AP_COEFF_I_INT,c,c,d,AP_CST_S_INT,-cst,AP_END);
+  array.p[0] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  return array;
+}
+
+#define NBVALUES 10
+#define NBTESTS 4
+
+typedef struct result_t {
+  ap_manager_t* man;
+  ap_abstract0_t* value[NBVALUES];
+  bool test[NBTESTS];
+} result_t;
+
+/* Meets, joins, assignments, substitutions, widening and tests, on values
+   of which some are bottom */
+static void run(result_t* r, bool parallel)
+{
+  ap_manager_t* man = r->man = product_alloc(parallel);
+  ap_abstract0_t** v = r->value;
+  ap_abstract0_t* tab[3];
+  ap_lincons0_array_t array;
+  ap_linexpr0_t* expr[2];
+  ap_dim_t tdim[2] = { 0, 2 };
+
+  v[0] = chain(man,1);
+  v[1] = chain(man,3);
+  v[2] = ap_abstract0_join(man,false,v[0],v[1]);
+  v[3] = ap_abstract0_meet(man,false,v[0],v[2]);
+
+  /* x0 := x1+2x3-1, x2 := -x0+[0,1], simultaneously */
+  expr[0] = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+  ap_linexpr0_set_list(expr[0],
+		       AP_COEFF_S_INT,1,(ap_dim_t)1,
+		       AP_COEFF_S_INT,2,(ap_dim_t)3,
+		       AP_CST_S_INT,-1,AP_END);
+  expr[1] = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,1);
+  ap_linexpr0_set_list(expr[1],
+		       AP_COEFF_I_INT,-1,-1,(ap_dim_t)0,
+		       AP_CST_I_INT,0,1,AP_END);
+  v[4] = ap_abstract0_assign_linexpr_array(man,false,v[2],tdim,expr,2,NULL);
+  v[5] = ap_abstract0_substitute_linexpr_array(man,false,v[2],tdim,expr,2,
+					       v[1]);
+  ap_linexpr0_free(expr[0]);
+  ap_linexpr0_free(expr[1]);
+
+  /* 3.x3 >= 3, then x3 <= -40, which is bottom */
+  array = bound(3,3,3);
+  v[6] = ap_abstract0_meet_lincons_array(man,false,v[4],&array);
+  ap_lincons0_array_clear(&array);
+  array = bound(3,-1,40);
+  v[7] = ap_abstract0_meet_lincons_array(man,false,v[6],&array);
+  r->test[0] = ap_abstract0_sat_lincons(man,v[6],&array.p[0]);
+  ap_lincons0_array_clear(&array);
+
+  v[8] = ap_abstract0_widening(man,v[0],v[2]);
+  tab[0] = v[0]; tab[1] = v[5]; tab[2] = v[7];
+  v[9] = ap_abstract0_join_array(man,tab,3);
+  tab[2] = v[4];
+  tab[0] = ap_abstract0_meet_array(man,tab,3);
+  r->test[1] = ap_abstract0_is_bottom(man,tab[0]);
+  ap_abstract0_free(man,tab[0]);
+
+  r->test[2] = ap_abstract0_is_leq(man,v[0],v[8]);
+  r->test[3] = ap_abstract0_is_eq(man,v[3],v[0]);
+}
+
+static void clear(result_t* r)
+{
+  size_t i;
+  for (i=0; i<NBVALUES; i++) ap_abstract0_free(r->man,r->value[i]);
+  ap_manager_free(r->man);
+}
+
+/* The components of the values, compared with the component managers of
+   r->man, and the tests */
+static bool is_eq(result_t* r, result_t* s)
+{
+  ap_reducedproduct_internal_t* intern =
+    (ap_reducedproduct_internal_t*)r->man->internal;
+  ap_manager_t* manbox = intern->tmanagers[0];
+  ap_manager_t* manpoly = intern->tmanagers[1];
+  ap_reducedproduct_t* x;
+  ap_reducedproduct_t* y;
+  size_t i;
+
+  for (i=0; i<NBVALUES; i++){
+    x = (ap_reducedproduct_t*)r->value[i]->value;
+    y = (ap_reducedproduct_t*)s->value[i]->value;
+    if (!box_is_eq(manbox,x->p[0],y->p[0]) ||
+	!pk_is_eq(manpoly,x->p[1],y->p[1]))
+      return false;
+  }
+  for (i=0; i<NBTESTS; i++){
+    if (r->test[i]!=s->test[i]) return false;
+  }
+  return true;
+}
+
+/* The option is refused when a manager is used for two components */
+static void test_shared(void)
+{
+  ap_manager_t* tab[2];
+  ap_manager_t* man;
+
+  tab[0] = tab[1] = pk_manager_alloc(false);
+  man = ap_reducedproduct_manager_alloc("polka x polka",tab,2,NULL,NULL);
+  ap_manager_free(tab[0]);
+  if (ap_reducedproduct_set_parallel(man,true)){
+    fprintf(stderr,"polka x polka: set_parallel should fail\n");
+    nerrors++;
+  }
+  else {
+    printf("polka x polka: no parallel option, ok\n");
+  }
+  ap_manager_free(man);
+}
+
+int main(void)
+{
+  result_t seq, par;
+  size_t k;
+  bool ok = true;
+
+  run(&seq,false);
+  if (!ap_abstract0_is_bottom(seq.man,seq.value[7])){
+    fprintf(stderr,"box x polka: the meet should be bottom\n");
+    nerrors++;
+  }
+  for (k=0; k<NBRUNS; k++){
+    run(&par,true);
+    ok = ok && is_eq(&seq,&par);
+    clear(&par);
+  }
+  if (!ok){
+    fprintf(stderr,"box x polka: the parallel and the sequential results differ\n");
+    nerrors++;
+  }
+  else {
+    printf("box x polka: ok\n");
+  }
+  clear(&seq);
+  test_shared();
+  return nerrors ? 1 : 0;
+}
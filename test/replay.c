@@ -0,0 +1,81 @@
+/*
+ * replay.c
+ *
+ * Replay of a trace recorded with ap_trace_start on a given domain, and
+ * printing of the time spent in each function.
+ *
+ * Usage: replay [-d] <box|oct|optoct|polka|polka_strict|pkeq|t1p> trace
+ *   -d: convert the scalars of the trace to double
+ *       (implied for optoct, which only accepts them)
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "ap_global0.h"
+
+#include "box.h"
+#include "oct.h"
+#include "opt_oct.h"
+#include "pk.h"
+#include "pkeq.h"
+#include "t1p.h"
+
+static ap_manager_t* manager_of_name(const char* name)
+{
+  if (!strcmp(name,"box")) return box_manager_alloc();
+  if (!strcmp(name,"oct")) return oct_manager_alloc();
+  if (!strcmp(name,"optoct")) return opt_oct_manager_alloc();
+  if (!strcmp(name,"polka")) return pk_manager_alloc(false);
+  if (!strcmp(name,"polka_strict")) return pk_manager_alloc(true);
+  if (!strcmp(name,"pkeq")) return pkeq_manager_alloc();
+  if (!strcmp(name,"t1p")) return t1p_manager_alloc();
+  return NULL;
+}
+
+int main(int argc, char** argv)
+{
+  ap_manager_t* man;
+  ap_trace_stat_t stat;
+  bool scalar_double = false;
+  bool ok;
+  FILE* stream;
+  int i = 1;
+
+  if (argc>1 && !strcmp(argv[1],"-d")){
+    scalar_double = true;
+    i++;
+  }
+  if (argc!=i+2){
+    fprintf(stderr,"usage: %s [-d] <box|oct|optoct|polka|polka_strict|pkeq|t1p> trace\n",argv[0]);
+    return 2;
+  }
+  man = manager_of_name(argv[i]);
+  if (man==NULL){
+    fprintf(stderr,"%s: unknown domain %s\n",argv[0],argv[i]);
+    return 2;
+  }
+  if (!strcmp(argv[i],"optoct")) scalar_double = true;
+  stream = fopen(argv[i+1],"rb");
+  if (stream==NULL){
+    perror(argv[i+1]);
+    ap_manager_free(man);
+    return 2;
+  }
+  memset(&stat,0,sizeof(stat));
+  ok = ap_trace_replay(man,stream,scalar_double,&stat);
+  fclose(stream);
+  printf("function,count,time,exceptions\n");
+  ap_trace_stat_fprint(stdout,&stat);
+  ap_manager_free(man);
+  if (!ok){
+    fprintf(stderr,"%s: malformed trace %s\n",argv[0],argv[i+1]);
+    return 1;
+  }
+  return 0;
+}
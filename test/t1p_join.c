@@ -0,0 +1,163 @@
+/*
+ * t1p_join.c
+ *
+ * Checks the concurrent join and widening of Taylor1+ (algorithm option
+ * greater than 1, see ../taylor1plus/t1p_meetjoin.c) against the sequential
+ * ones: on the same values, built by fresh managers, the affine forms of
+ * the results, the indices of their noise symbols and the number of noise
+ * symbols of the managers are the same, at each run, including when the
+ * join runs out of noise symbols (max_object_size). The test reads the
+ * internal representation.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_global0.h"
+
+#include "t1p.h"
+#include "t1p_internal.h"
+
+#define DIM 12
+#define NBRUNS 8
+
+static int nerrors = 0;
+
+/* x(i) in [i-k,i+k+2], then x(i) := x(i+1)+2.x(i+3)-k, and a product
+   x(i) := x(i)*x(i+5) every 4 dimensions, which creates noise symbols;
+   build(man,1) is included in build(man,3), so that the widening of
+   build(man,3) by build(man,1) keeps finite bounds */
+static ap_abstract0_t* build(ap_manager_t* man, int k)
+{
+  ap_interval_t** box = ap_interval_array_alloc(DIM);
+  ap_abstract0_t* res;
+  ap_linexpr0_t* expr;
+  ap_texpr0_t* texpr;
+  size_t i;
+
+  for (i=0; i<DIM; i++){
+    ap_interval_set_int(box[i],(int)i-k,(int)i+k+2);
+  }
+  res = ap_abstract0_of_box(man,0,DIM,box);
+  ap_interval_array_free(box,DIM);
+  for (i=0; i<DIM; i++){
+    expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+    ap_linexpr0_set_list(expr,
+			 AP_COEFF_S_INT,1,(ap_dim_t)((i+1)%DIM),
+			 AP_COEFF_S_INT,2,(ap_dim_t)((i+3)%DIM),
+			 AP_CST_S_INT,-k,AP_END);
+    res = ap_abstract0_assign_linexpr(man,true,res,(ap_dim_t)i,expr,NULL);
+    ap_linexpr0_free(expr);
+  }
+  for (i=0; i<DIM; i+=4){
+    texpr = ap_texpr0_binop(AP_TEXPR_MUL,
+			    ap_texpr0_dim((ap_dim_t)i),
+			    ap_texpr0_dim((ap_dim_t)((i+5)%DIM)),
+			    AP_RTYPE_REAL,AP_RDIR_NEAREST);
+    res = ap_abstract0_assign_texpr(man,true,res,(ap_dim_t)i,texpr,NULL);
+    ap_texpr0_free(texpr);
+  }
+  return res;
+}
+
+typedef struct result_t {
+  ap_manager_t* man;
+  ap_abstract0_t* a1;
+  ap_abstract0_t* a2;
+  ap_abstract0_t* res;
+  int nsym;  /* number of noise symbols before the join */
+  ap_exc_t exn;
+} result_t;
+
+/* funid(a1,a2) with a fresh manager and the given algorithm; if extra is
+   not 0, the join is given at most extra noise symbols more than the
+   ones of its arguments */
+static void run(result_t* r, ap_funid_t funid, int algorithm, size_t extra)
+{
+  ap_funopt_t funopt;
+
+  r->man = t1p_manager_alloc();
+  ap_manager_set_abort_if_exception(r->man,AP_EXC_OUT_OF_SPACE,false);
+  r->a1 = build(r->man,3);
+  r->a2 = build(r->man,1);
+  funopt = ap_manager_get_funopt(r->man,funid);
+  funopt.algorithm = algorithm;
+  r->nsym = ap_manager_t1p_get_nsym(r->man);
+  funopt.max_object_size = extra ? (size_t)r->nsym+extra : 0;
+  ap_manager_set_funopt(r->man,funid,&funopt);
+  r->res = funid==AP_FUNID_JOIN ?
+    ap_abstract0_join(r->man,false,r->a1,r->a2) :
+    ap_abstract0_widening(r->man,r->a1,r->a2);
+  r->exn = r->man->result.exn;
+}
+
+static void clear(result_t* r)
+{
+  ap_abstract0_free(r->man,r->res);
+  ap_abstract0_free(r->man,r->a1);
+  ap_abstract0_free(r->man,r->a2);
+  ap_manager_free(r->man);
+}
+
+static bool aff_is_eq(t1p_aff_t* x, t1p_aff_t* y)
+{
+  uint_t j;
+  if (!itv_is_eq(x->c,y->c) || x->l!=y->l) return false;
+  for (j=0; j<x->l; j++){
+    if (x->q[j].pnsym->index!=y->q[j].pnsym->index ||
+	!itv_is_eq(x->q[j].coeff,y->q[j].coeff)) return false;
+  }
+  return true;
+}
+
+static bool is_eq(result_t* r, result_t* s)
+{
+  t1p_t* x = (t1p_t*)r->res->value;
+  t1p_t* y = (t1p_t*)s->res->value;
+  size_t i;
+  if (ap_manager_t1p_get_nsym(r->man)!=ap_manager_t1p_get_nsym(s->man) ||
+      r->exn!=s->exn) return false;
+  for (i=0; i<DIM; i++){
+    if (!itv_is_eq(x->box[i],y->box[i]) || !aff_is_eq(x->paf[i],y->paf[i]))
+      return false;
+  }
+  return true;
+}
+
+static void test(ap_funid_t funid, size_t extra)
+{
+  const char* name = funid==AP_FUNID_JOIN ? "join" : "widening";
+  result_t seq, con;
+  size_t k;
+  bool ok = true;
+
+  run(&seq,funid,0,extra);
+  for (k=0; k<NBRUNS; k++){
+    run(&con,funid,4,extra);
+    ok = ok && is_eq(&seq,&con);
+    clear(&con);
+  }
+  if (!ok){
+    fprintf(stderr,"%s (max %zu more noise symbols): the concurrent and the sequential results differ\n",
+	    name,extra);
+    nerrors++;
+  }
+  else {
+    printf("%s (max %zu more noise symbols): %d new noise symbols, ok\n",
+	   name,extra,ap_manager_t1p_get_nsym(seq.man)-seq.nsym);
+  }
+  clear(&seq);
+}
+
+int main(void)
+{
+  test(AP_FUNID_JOIN,0);
+  test(AP_FUNID_JOIN,3);
+  test(AP_FUNID_WIDENING,0);
+  return nerrors ? 1 : 0;
+}
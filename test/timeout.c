@@ -0,0 +1,197 @@
+/*
+ * timeout.c
+ *
+ * Checks that the timeout of ap_funopt_t interrupts the expensive
+ * algorithms of box, oct and polka: the call raises AP_EXC_TIMEOUT, resets
+ * flag_best, and the deadline of the outermost call is kept by the
+ * ap_abstract0_* calls made by the libraries themselves.
+ *
+ */
+
+/* This file is part of the APRON Library, released under LGPL license
+
+   Please read the COPYING file packaged in the distribution.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ap_global0.h"
+
+#include "box.h"
+#include "oct.h"
+#include "pk.h"
+
+static int nerrors = 0;
+
+static void set_timeout(ap_manager_t* man, ap_funid_t funid, size_t timeout)
+{
+  ap_funopt_t funopt = ap_manager_get_funopt(man,funid);
+  funopt.timeout = timeout;
+  ap_manager_set_funopt(man,funid,&funopt);
+}
+
+/* Forgets the exceptions of the previous calls on man */
+static void clear_exceptions(ap_manager_t* man)
+{
+  ap_manager_clear_exclog(man);
+  man->result.exn = AP_EXC_NONE;
+}
+
+/* Sets the algorithm of funid to -1, which disables the closure of oct and
+   the conversion of polka in is_bottom: the expensive work of meet_tcons is
+   then done in the nested to_box */
+static void set_lazy_is_bottom(ap_manager_t* man)
+{
+  ap_funopt_t funopt = ap_manager_get_funopt(man,AP_FUNID_IS_BOTTOM);
+  funopt.algorithm = -1;
+  ap_manager_set_funopt(man,AP_FUNID_IS_BOTTOM,&funopt);
+}
+
+/* Checks that the last call on man ended by a timeout */
+static void check_timeout(ap_manager_t* man, const char* test)
+{
+  ap_exc_t exn = man->result.exn;
+  if (exn!=AP_EXC_TIMEOUT || ap_manager_get_flag_best(man)){
+    fprintf(stderr,"%s: exception %s, flag_best %d\n",
+	    test,ap_name_of_exception[exn],ap_manager_get_flag_best(man));
+    nerrors++;
+  }
+  else {
+    printf("%s: ok\n",test);
+  }
+}
+
+/* [-1,1]^n */
+static ap_abstract0_t* hypercube(ap_manager_t* man, size_t n)
+{
+  ap_interval_t** tinterval = ap_interval_array_alloc(n);
+  ap_abstract0_t* res;
+  size_t i;
+  for (i=0;i<n;i++) ap_interval_set_int(tinterval[i],-1,1);
+  res = ap_abstract0_of_box(man,0,n,tinterval);
+  ap_interval_array_free(tinterval,n);
+  return res;
+}
+
+/* x0*x1 <= 0, which the generic meet_tcons linearizes on the bounding box
+   computed by a nested ap_abstract0_to_box */
+static ap_tcons0_array_t product_tcons(void)
+{
+  ap_tcons0_array_t array = ap_tcons0_array_make(1);
+  ap_texpr0_t* expr =
+    ap_texpr0_unop(AP_TEXPR_NEG,
+		   ap_texpr0_binop(AP_TEXPR_MUL,
+				   ap_texpr0_dim(0),ap_texpr0_dim(1),
+				   AP_RTYPE_REAL,AP_RDIR_RND),
+		   AP_RTYPE_REAL,AP_RDIR_RND);
+  array.p[0] = ap_tcons0_make(AP_CONS_SUPEQ,expr,NULL);
+  return array;
+}
+
+/* x(i+1)-x(i)-1 >= 0 for i<n-1, listed backwards so that each propagation
+   pass only refines one more variable */
+static ap_lincons0_array_t chain_lincons(size_t n)
+{
+  ap_lincons0_array_t array = ap_lincons0_array_make(n-1);
+  size_t i;
+  for (i=0;i<n-1;i++){
+    ap_linexpr0_t* expr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE,2);
+    ap_linexpr0_set_list(expr,
+			 AP_COEFF_S_INT,1,(ap_dim_t)(i+1),
+			 AP_COEFF_S_INT,-1,(ap_dim_t)i,
+			 AP_CST_S_INT,-1,
+			 AP_END);
+    array.p[n-2-i] = ap_lincons0_make(AP_CONS_SUPEQ,expr,NULL);
+  }
+  return array;
+}
+
+/* Chernikova conversion, reached through the to_box of the linearization */
+static void test_pk(void)
+{
+  ap_manager_t* man = pk_manager_alloc(false);
+  ap_abstract0_t* a = hypercube(man,16);
+  ap_tcons0_array_t array = product_tcons();
+  ap_abstract0_t* res;
+
+  set_lazy_is_bottom(man);
+  set_timeout(man,AP_FUNID_MEET_TCONS_ARRAY,1);
+  clear_exceptions(man);
+  res = ap_abstract0_meet_tcons_array(man,false,a,&array);
+  check_timeout(man,"polka meet_tcons_array");
+  ap_abstract0_free(man,res);
+  ap_tcons0_array_clear(&array);
+  ap_abstract0_free(man,a);
+  ap_manager_free(man);
+}
+
+/* Closure, directly and through the to_box of the linearization */
+static void test_oct(void)
+{
+  ap_manager_t* man = oct_manager_alloc();
+  size_t n = 200;
+  ap_lincons0_array_t chain = chain_lincons(n);
+  ap_tcons0_array_t array = product_tcons();
+  ap_funopt_t funopt;
+  ap_abstract0_t *a, *res;
+
+  /* keep the chain unclosed */
+  funopt = ap_manager_get_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY);
+  funopt.algorithm = -1;
+  ap_manager_set_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY,&funopt);
+  a = ap_abstract0_top(man,0,n);
+  a = ap_abstract0_meet_lincons_array(man,true,a,&chain);
+
+  set_timeout(man,AP_FUNID_IS_BOTTOM,1);
+  clear_exceptions(man);
+  ap_abstract0_is_bottom(man,a);
+  check_timeout(man,"oct is_bottom");
+
+  set_lazy_is_bottom(man);
+  set_timeout(man,AP_FUNID_MEET_TCONS_ARRAY,1);
+  clear_exceptions(man);
+  res = ap_abstract0_meet_tcons_array(man,false,a,&array);
+  check_timeout(man,"oct meet_tcons_array");
+  ap_abstract0_free(man,res);
+
+  ap_tcons0_array_clear(&array);
+  ap_lincons0_array_clear(&chain);
+  ap_abstract0_free(man,a);
+  ap_manager_free(man);
+}
+
+/* Propagation passes */
+static void test_box(void)
+{
+  ap_manager_t* man = box_manager_alloc();
+  size_t n = 4000;
+  ap_lincons0_array_t chain = chain_lincons(n);
+  ap_funopt_t funopt;
+  ap_interval_t** tinterval = ap_interval_array_alloc(n);
+  ap_abstract0_t *a, *res;
+  size_t i;
+
+  for (i=0;i<n;i++) ap_interval_set_int(tinterval[i],0,(long)n);
+  a = ap_abstract0_of_box(man,0,n,tinterval);
+  funopt = ap_manager_get_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY);
+  funopt.algorithm = (int)n;
+  funopt.timeout = 1;
+  ap_manager_set_funopt(man,AP_FUNID_MEET_LINCONS_ARRAY,&funopt);
+  clear_exceptions(man);
+  res = ap_abstract0_meet_lincons_array(man,false,a,&chain);
+  check_timeout(man,"box meet_lincons_array");
+
+  ap_abstract0_free(man,res);
+  ap_interval_array_free(tinterval,n);
+  ap_lincons0_array_clear(&chain);
+  ap_abstract0_free(man,a);
+  ap_manager_free(man);
+}
+
+int main(void)
+{
+  test_pk();
+  test_oct();
+  test_box();
+  return nerrors ? 1 : 0;
+}